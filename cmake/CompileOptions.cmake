@@ -61,6 +61,7 @@ endfunction()
 macro(get_list_of_supported_optimizations PLATFORMS_LIST)
     list(APPEND PLATFORMS_LIST "")
     list(APPEND PLATFORMS_LIST "px")
+    list(APPEND PLATFORMS_LIST "avx2")
     list(APPEND PLATFORMS_LIST "avx512")
 endmacro(get_list_of_supported_optimizations)
 
@@ -70,15 +71,21 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
     list(APPEND PACK_POSTFIX_LIST "")
     list(APPEND PACK_INDEX_POSTFIX_LIST "")
     list(APPEND SCAN_POSTFIX_LIST "")
+    list(APPEND SCAN_NU1U_POSTFIX_LIST "")
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "")
     list(APPEND DEFAULT_BIT_WIDTH_LIST "")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "")
+    list(APPEND SCAN_64U_POSTFIX_LIST "")
 
     #create list of functions that use only 8u 16u 32u postfixes
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "unpack_prle")
+    list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "prle_run_length")
+    list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "prle_find_equal_octet")
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "extract")
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "extract_i")
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "select")
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "select_i")
+    list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "select_bit_mask")
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "expand")
 
     #create default bit width list
@@ -86,6 +93,12 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
     list(APPEND DEFAULT_BIT_WIDTH_LIST "16u")
     list(APPEND DEFAULT_BIT_WIDTH_LIST "32u")
 
+    #create list of functions that also have 64u postfix
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "extract_i")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "select")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "select_bit_mask")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "expand")
+
     #create scan kernel postfixes
     list(APPEND SCAN_COMPARATOR_LIST "")
 
@@ -104,16 +117,29 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         list(APPEND SCAN_POSTFIX_LIST "_${SCAN_COMPARATOR}_32u8u")
     endforeach()
 
+    # create fused scan kernel postfixes, packed n-bit input and nominal bit vector output
+    foreach(SCAN_COMPARATOR IN LISTS SCAN_COMPARATOR_LIST)
+        list(APPEND SCAN_NU1U_POSTFIX_LIST "_${SCAN_COMPARATOR}_nu1u")
+    endforeach()
+
+    # create 64-bit scan kernel postfixes, unpacked qword input and 64-bit parameters
+    foreach(SCAN_COMPARATOR IN LISTS SCAN_COMPARATOR_LIST)
+        list(APPEND SCAN_64U_POSTFIX_LIST "_${SCAN_COMPARATOR}_64u8u")
+    endforeach()
+
     # create unpack kernel postfixes
-    foreach(input_width RANGE 1 32 1)
+    foreach(input_width RANGE 1 64 1)
         if(input_width LESS 8 OR input_width EQUAL 8)
             list(APPEND UNPACK_POSTFIX_LIST "_${input_width}u8u")
 
         elseif(input_width LESS 16 OR input_width EQUAL 16)
             list(APPEND UNPACK_POSTFIX_LIST "_${input_width}u16u")
 
-        else()
+        elseif(input_width LESS 32 OR input_width EQUAL 32)
             list(APPEND UNPACK_POSTFIX_LIST "_${input_width}u32u")
+
+        else()
+            list(APPEND UNPACK_POSTFIX_LIST "_${input_width}u64u")
         endif()
     endforeach()
 
@@ -134,6 +160,10 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
     list(APPEND PACK_POSTFIX_LIST "_8u32u")
     list(APPEND PACK_POSTFIX_LIST "_16u32u")
 
+    foreach(output_width RANGE 33 64 1)
+        list(APPEND PACK_POSTFIX_LIST "_64u${output_width}u")
+    endforeach()
+
     # create pack index kernel postfixes
     list(APPEND PACK_INDEX_POSTFIX_LIST "_nu")
     list(APPEND PACK_INDEX_POSTFIX_LIST "_8u")
@@ -253,6 +283,52 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}scan_i.cpp "}\n")
 
+        #
+        # Write fused scan table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}scan_nu1u.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_nu1u.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_nu1u.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_nu1u.cpp "scan_nu1u_table_t ${PLATFORM_PREFIX}scan_nu1u_table = {\n")
+
+        #get last element of the list
+        set(LAST_ELEMENT "")
+        list(GET SCAN_NU1U_POSTFIX_LIST -1 LAST_ELEMENT)
+
+        foreach(SCAN_POSTFIX IN LISTS SCAN_NU1U_POSTFIX_LIST)
+
+            if(SCAN_POSTFIX STREQUAL LAST_ELEMENT)
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_nu1u.cpp "\t${PLATFORM_PREFIX}qplc_scan${SCAN_POSTFIX}};\n")
+            else()
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_nu1u.cpp "\t${PLATFORM_PREFIX}qplc_scan${SCAN_POSTFIX},\n")
+            endif()
+        endforeach()
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_nu1u.cpp "}\n")
+
+        #
+        # Write 64-bit scan table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "scan_64u_i_table_t ${PLATFORM_PREFIX}scan_64u_i_table = {\n")
+
+        #get last element of the list
+        set(LAST_ELEMENT "")
+        list(GET SCAN_64U_POSTFIX_LIST -1 LAST_ELEMENT)
+
+        foreach(SCAN_POSTFIX IN LISTS SCAN_64U_POSTFIX_LIST)
+
+            if(SCAN_POSTFIX STREQUAL LAST_ELEMENT)
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "\t${PLATFORM_PREFIX}qplc_scan${SCAN_POSTFIX}_i};\n")
+            else()
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "\t${PLATFORM_PREFIX}qplc_scan${SCAN_POSTFIX}_i,\n")
+            endif()
+        endforeach()
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "}\n")
+
         #
         # Write pack_index table
         #
@@ -280,11 +356,19 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
             file(APPEND ${directory}/${PLATFORM_PREFIX}${DEAULT_BIT_WIDTH_FUNCTION}.cpp "namespace qpl::core_sw::dispatcher\n{\n")
             file(APPEND ${directory}/${PLATFORM_PREFIX}${DEAULT_BIT_WIDTH_FUNCTION}.cpp "${DEAULT_BIT_WIDTH_FUNCTION}_table_t ${PLATFORM_PREFIX}${DEAULT_BIT_WIDTH_FUNCTION}_table = {\n")
 
+            set(FUNCTION_BIT_WIDTH_LIST ${DEFAULT_BIT_WIDTH_LIST})
+
+            list(FIND WIDE_BIT_WIDTH_FUNCTIONS_LIST ${DEAULT_BIT_WIDTH_FUNCTION} WIDE_FUNCTION_INDEX)
+
+            if(NOT WIDE_FUNCTION_INDEX EQUAL -1)
+                list(APPEND FUNCTION_BIT_WIDTH_LIST "64u")
+            endif()
+
             #get last element of the list
             set(LAST_ELEMENT "")
-            list(GET DEFAULT_BIT_WIDTH_LIST -1 LAST_ELEMENT)
+            list(GET FUNCTION_BIT_WIDTH_LIST -1 LAST_ELEMENT)
 
-            foreach(BIT_WIDTH IN LISTS DEFAULT_BIT_WIDTH_LIST)
+            foreach(BIT_WIDTH IN LISTS FUNCTION_BIT_WIDTH_LIST)
 
                 set(FUNCTION_NAME "")
                 get_function_name_with_default_bit_width(${DEAULT_BIT_WIDTH_FUNCTION} ${BIT_WIDTH} FUNCTION_NAME)
@@ -314,6 +398,18 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "}\n")
 
+        #
+        # Write 64-bit aggregates table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}aggregates_64u.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates_64u.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates_64u.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates_64u.cpp "aggregates_64u_table_t ${PLATFORM_PREFIX}aggregates_64u_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates_64u.cpp "\t${PLATFORM_PREFIX}qplc_aggregates_64u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates_64u.cpp "}\n")
+
         #
         # Write mem_copy functions table
         #
@@ -364,6 +460,22 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "}\n")
 
+        #
+        # Write crc64 context function tables
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "crc64_init_context_table_t ${PLATFORM_PREFIX}crc64_init_context_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "\t${PLATFORM_PREFIX}qplc_crc64_init_context};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "crc64_with_context_table_t ${PLATFORM_PREFIX}crc64_with_context_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "\t${PLATFORM_PREFIX}qplc_crc64_with_context};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64_context.cpp "}\n")
+
         #
         # Write xor_checksum function table
         #
@@ -380,6 +492,7 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         # Write deflate functions table
         #
         file(WRITE ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_slow_icf.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_optimal_icf.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_hash_table.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_histogram.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
@@ -388,7 +501,8 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}slow_deflate_icf_body),\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_histogram_reset),\n")
-        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_hash_table_reset)};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_hash_table_reset),\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}optimal_deflate_icf_body)};\n")
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "}\n")
 
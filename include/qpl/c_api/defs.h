@@ -154,6 +154,21 @@ extern "C" {
  */
 #define QPL_FLAG_CANNED_MODE 0x00400000u
 
+/**
+ * Software Path only: process a single job (@ref QPL_FLAG_FIRST | @ref QPL_FLAG_LAST) with several threads,
+ * the flag is ignored for the jobs and the modes the parallel processing doesn't support.
+ * The threads are taken from a pool kept by the library, if no thread can be started the job is processed
+ * by the calling thread.
+ * Decompression: the gzip members with the BGZF BSIZE subfield are decompressed in parallel
+ */
+#define QPL_FLAG_PARALLEL 0x00800000u
+
+/**
+ * Software Path only: extract, select and expand write the output elements in the Parquet RLE/bit-packed hybrid
+ * format, repeated values are written as runs (see @ref qpl_job.out_rle_threshold)
+ */
+#define QPL_FLAG_OUT_PARQUET_RLE 0x01000000u
+
 /* CRC64 flags */
 /**
  * The data should be viewed as Big-Endian
@@ -177,7 +192,8 @@ extern "C" {
 
 /* Data Integrity & Aggregates flags */
 /**
- * Filtering only: don't calculate CRC and XOR checksums
+ * Filtering: don't calculate CRC and XOR checksums.
+ * Decompression on the software path: don't calculate XOR checksum, CRC is still calculated
  */
 #define QPL_FLAG_OMIT_CHECKSUMS 0x00100000u
 
@@ -188,6 +204,41 @@ extern "C" {
 
 /** @} */
 
+/**
+ * @addtogroup QPL_OP_CLASSES
+ * @brief Use these values to specify the @ref qpl_operation classes a job is sized and initialized for,
+ *        see @ref qpl_get_job_size_ex and @ref qpl_init_job_ex.
+ * @{
+ *
+ */
+
+/**
+ * @ref qpl_op_compress
+ */
+#define QPL_OP_CLASS_COMPRESS 0x0001u
+
+/**
+ * @ref qpl_op_decompress
+ */
+#define QPL_OP_CLASS_DECOMPRESS 0x0002u
+
+/**
+ * Filter operations: scans, @ref qpl_op_extract, @ref qpl_op_select and @ref qpl_op_expand
+ */
+#define QPL_OP_CLASS_ANALYTICS 0x0004u
+
+/**
+ * @ref qpl_op_crc64
+ */
+#define QPL_OP_CLASS_CRC64 0x0008u
+
+/**
+ * All operations, the layout used by @ref qpl_get_job_size and @ref qpl_init_job
+ */
+#define QPL_OP_CLASS_ALL (QPL_OP_CLASS_COMPRESS | QPL_OP_CLASS_DECOMPRESS | QPL_OP_CLASS_ANALYTICS | QPL_OP_CLASS_CRC64)
+
+/** @} */
+
 /**
  * @enum qpl_path_t
  * @brief Enum of the executing paths
@@ -341,17 +392,21 @@ typedef enum {
 
 /**
  * @brief Enumerates different compressions levels
+ *
+ * @note Levels above @ref qpl_default_level are supported on the Software Path only.
+ *       Every next level trades compression speed for compression ratio. The levels from 3 to 9 search
+ *       for matches beyond 4 kb (up to 32 kb) if fixed or dynamic blocks are built without a dictionary.
  */
 typedef enum {
     qpl_level_1 = 1,                 /**< The fastest compression with low compression ratio*/
-    qpl_level_2 = 2,                 /**< Not supported */
+    qpl_level_2 = 2,                 /**< Fast compression, short hash chains with greedy match search */
     qpl_level_3 = 3,                 /**< Medium compression speed, medium compression ratio*/
-    qpl_level_4 = 4,                 /**< Not supported */
-    qpl_level_5 = 5,                 /**< Not supported */
-    qpl_level_6 = 6,                 /**< Not supported */
-    qpl_level_7 = 7,                 /**< Not supported */
-    qpl_level_8 = 8,                 /**< Not supported */
-    qpl_level_9 = 9,                 /**< Not supported */
+    qpl_level_4 = 4,                 /**< Medium compression speed, lazy match search in the 16 kb window */
+    qpl_level_5 = 5,                 /**< Lazy match search in the 32 kb window */
+    qpl_level_6 = 6,                 /**< Balanced compression speed and ratio */
+    qpl_level_7 = 7,                 /**< Slow compression, longer hash chains */
+    qpl_level_8 = 8,                 /**< Slow compression, high compression ratio */
+    qpl_level_9 = 9,                 /**< The slowest compression, optimal parsing of dynamic blocks */
     qpl_default_level = qpl_level_1, /**< Default compression level defined by the highest compression level supported by Accelerator */
     qpl_high_level = qpl_level_3     /**< The level with highest compression level from supported by Intel QPL */
 } qpl_compression_levels;
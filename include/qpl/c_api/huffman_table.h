@@ -189,7 +189,8 @@ qpl_status qpl_huffman_table_get_type(const qpl_huffman_table_t table,
 
 /**
  * @brief API to get size of the table to be serialized.
- * @note Serialization is only supported for serialization_raw format.
+ * @note Serialization is supported for Deflate tables only. The serialization_compact format stores
+ *       the Deflate header only, the tables are rebuilt from it during deserialization.
  *
  * @param[in]  table    @ref qpl_huffman_table_t object to serialize
  * @param[in]  options  @ref serialization_options_t
@@ -203,7 +204,8 @@ qpl_status qpl_huffman_table_get_serialized_size(const qpl_huffman_table_t table
 
 /**
  * @brief Serializes qpl_huffman_table_t object.
- * @note Serialization is only supported for serialization_raw format.
+ * @note Serialization is supported for Deflate tables only. The serialization_compact format stores
+ *       the Deflate header only, the tables are rebuilt from it during deserialization.
  *
  * @param[in] table @ref qpl_huffman_table_t object to serialize
  * @param[out] dump_buffer_ptr serialized object buffer
@@ -115,6 +115,43 @@ QPL_API(qpl_status, qpl_find_mini_block_index, (qpl_index_table * table_ptr,
                                                 uint32_t mini_block_number,
                                                 uint32_t * block_index_ptr))
 
+/**
+ * @brief Decompresses all mini-blocks of an indexed deflate stream in parallel
+ *
+ * @details Every mini-block is decompressed by its own job into the offset `mini_block_number * mini_block_size`
+ *          of the destination, the jobs are spread over the available cores. The deflate block headers are parsed
+ *          once per block by every thread. The CRC of every mini-block is checked against the index table.
+ *
+ * @note For the stream compressed as a single block, mini_blocks_per_block of the table is the number of mini-blocks
+ *
+ * @param qpl_path          Execution path of the jobs
+ * @param source_ptr        Compressed stream, the bit offsets of the index table are counted from its beginning
+ * @param source_size       Size of the compressed stream
+ * @param table_ptr         Index table of the stream
+ * @param mini_block_size   Mini-block size used to compress the stream
+ * @param destination_ptr   Output for the decompressed data
+ * @param destination_size  Size of the output
+ * @param output_size_ptr   Is set to the number of decompressed bytes
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_SIZE_ERR;
+ *     - @ref QPL_STS_DST_IS_SHORT_ERR;
+ *     - @ref QPL_STS_NO_MEM_ERR;
+ *     - @ref QPL_STS_INDEX_CRC_MISMATCH_ERR;
+ *     - error status of the first failed mini-block decompression.
+ */
+QPL_API(qpl_status, qpl_decompress_indexed, (qpl_path_t qpl_path,
+                                             uint8_t * source_ptr,
+                                             uint32_t source_size,
+                                             qpl_index_table * table_ptr,
+                                             qpl_mini_block_size mini_block_size,
+                                             uint8_t * destination_ptr,
+                                             uint32_t destination_size,
+                                             uint32_t * output_size_ptr))
+
 /** @} */
 
 #ifdef __cplusplus
@@ -37,6 +37,7 @@ struct qpl_aux_data {
     uint8_t    *middle_layer_buffer_ptr; /**< Internal middle-level layer buffer */
     uint8_t    *hw_state_ptr;            /**< Hardware path execution context */
     qpl_path_t path;                     /**< @ref qpl_path_t marker */
+    uint32_t   op_mask;                  /**< @ref QPL_OP_CLASSES the job is initialized for */
 };
 
 typedef struct qpl_aux_data qpl_data; /**< Hidden internal state structure */
@@ -84,7 +85,7 @@ typedef struct {
     // Filter Function Fields
     uint8_t    *next_src2_ptr;        /**< Pointer to source-2 data. Updated value is returned */
     uint32_t   available_src2;        /**< Number of valid bytes of source-2 data */
-    uint32_t   src1_bit_width;        /**< Source-1 bit width for Analytics. Valid values are 1-32 */
+    uint32_t   src1_bit_width;        /**< Source-1 bit width for Analytics. Valid values are 1-32 (1-64 for @ref qpl_path_software) */
     uint32_t   src2_bit_width;        /**< Source-2 bit width for Analytics. Valid values are 1-32 */
     uint32_t   num_input_elements;    /**< Number of input elements for Analytics */
 
@@ -129,6 +130,29 @@ typedef struct {
 
     // storage for auxiliary data
     qpl_data data_ptr;    /**< Internal memory buffers & structures for all Intel QPL operations */
+
+    // New fields are added to the end of the structure, so the offsets of the fields above stay unchanged
+
+    /**
+     * Low parameter for operations extract or scan with @ref qpl_job.src1_bit_width greater than 32
+     */
+    uint64_t param_low_64;
+
+    /**
+     * High parameter for operations extract or scan with @ref qpl_job.src1_bit_width greater than 32
+     */
+    uint64_t param_high_64;
+
+    // Filter Aggregate Values for src1_bit_width greater than 32
+    uint64_t min_value_64;             /**< Output aggregate value - min value of the extracted elements */
+    uint64_t max_value_64;             /**< Output aggregate value - max value of the extracted elements */
+    uint64_t sum_value_64;             /**< Output aggregate value - sum of all values, modulo 2^64 */
+
+    /**
+     * Minimal number of repeated elements written as a single run with @ref QPL_FLAG_OUT_PARQUET_RLE,
+     * shorter sequences are bit-packed. Valid values are 0 (default, 8 elements) and 8 or greater
+     */
+    uint32_t out_rle_threshold;
 } qpl_job;
 
 /** @} */
@@ -177,6 +201,45 @@ QPL_API(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t * job_size_
  */
 QPL_API(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Calculates the amount of memory, in bytes, required for the qpl_job structure that runs
+ *        only the operations of the specified classes.
+ *
+ * @param[in]   qpl_path      type of implementation path to use - @ref qpl_path_auto,
+ *                            @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]   op_mask       combination of @ref QPL_OP_CLASSES values
+ * @param[out]  job_size_ptr  a pointer to uint32_t, where the qpl_job size (in bytes) is stored
+ *
+ * @note Internal buffers of the operation classes that are not in op_mask are not allocated,
+ *       so the job can be significantly smaller than the one sized with @ref qpl_get_job_size
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_OPERATION_ERR if op_mask is empty or contains unknown classes;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_get_job_size_ex, (qpl_path_t qpl_path, uint32_t op_mask, uint32_t * job_size_ptr))
+
+/**
+ * @brief Initializes the qpl_job structure for the operations of the specified classes.
+ *
+ * @param[in]      qpl_path     type of implementation path to use - @ref qpl_path_auto,
+ *                              @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]      op_mask      combination of @ref QPL_OP_CLASSES values, must match the one used
+ *                              in @ref qpl_get_job_size_ex
+ * @param[in,out]  qpl_job_ptr  a pointer to the @ref qpl_job structure
+ *
+ * @note The job returns @ref QPL_STS_BAD_JOB_STRUCT_ERR on submission of an operation that is not in op_mask
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_OPERATION_ERR if op_mask is empty or contains unknown classes;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_init_job_ex, (qpl_path_t qpl_path, uint32_t op_mask, qpl_job * qpl_job_ptr))
+
 /**
  * @brief Parses the qpl_job structure and forms the corresponding processing functions pipeline.
  *
@@ -217,6 +280,41 @@ QPL_API(qpl_status, qpl_wait_job, (qpl_job * qpl_job_ptr))
  */
 QPL_API(qpl_status, qpl_check_job, (qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Submits a batch of independent @ref qpl_job objects and reports the submission status of every job.
+ *
+ * @param[in,out]  job_ptrs     Array of pointers to the initialized @ref qpl_job structures
+ * @param[in]      jobs_count   Number of jobs in the batch
+ * @param[out]     status_ptr   Array of jobs_count statuses, status i is the result of job i submission
+ *
+ * @note Jobs that are executed on the software path are completed within this call. Jobs that are sent to
+ *       the accelerator are completed with @ref qpl_wait_batch, which must get the same status array.
+ *
+ * @return
+ *     - @ref QPL_STS_OK if all jobs are submitted;
+ *     - @ref QPL_STS_NULL_PTR_ERR if job_ptrs or status_ptr is NULL;
+ *     - Status of the first job in the batch that failed otherwise.
+ */
+QPL_API(qpl_status, qpl_submit_batch, (qpl_job **job_ptrs, uint32_t jobs_count, qpl_status *status_ptr))
+
+/**
+ * @brief Waits for the end of processing of all jobs submitted with @ref qpl_submit_batch.
+ *        Completions of all jobs in the batch are polled in a single loop.
+ *
+ * @param[in,out]  job_ptrs     Array of pointers to the @ref qpl_job structures passed to @ref qpl_submit_batch
+ * @param[in]      jobs_count   Number of jobs in the batch
+ * @param[in,out]  status_ptr   Array of jobs_count statuses filled by @ref qpl_submit_batch,
+ *                              status i is replaced with the result of job i processing
+ *
+ * @note Jobs with failed submission are not waited for, and their statuses are kept
+ *
+ * @return
+ *     - @ref QPL_STS_OK if all jobs are completed successfully;
+ *     - @ref QPL_STS_NULL_PTR_ERR if job_ptrs or status_ptr is NULL;
+ *     - Status of the first job in the batch that failed otherwise.
+ */
+QPL_API(qpl_status, qpl_wait_batch, (qpl_job **job_ptrs, uint32_t jobs_count, qpl_status *status_ptr))
+
 /**
  * @brief Completes @ref qpl_job lifecycle: disconnects from the internal library context, frees internal resources.
  *
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_JOB_POOL_API_H_
+#define QPL_JOB_POOL_API_H_
+
+#include "qpl/c_api/status.h"
+#include "qpl/c_api/defs.h"
+#include "qpl/c_api/job.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup JOB_POOL_API Job Pool API
+ * @ingroup JOB_API
+ * @{
+ */
+
+/**
+ * @typedef qpl_job_pool_t
+ * @brief Opaque pointer to a pool of initialized @ref qpl_job structures.
+ */
+typedef struct qpl_job_pool *qpl_job_pool_t;
+
+/**
+ * @brief Allocates a pool of capacity jobs on the specified NUMA node and initializes every job for the path.
+ *
+ * @param[in]   qpl_path   type of implementation path to use - @ref qpl_path_auto,
+ *                         @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]   capacity   number of jobs in the pool
+ * @param[in]   numa_node  NUMA node the pool memory is placed on, -1 for the node of the calling thread
+ * @param[out]  pool_ptr   output parameter for the created pool
+ *
+ * @note The NUMA node is also stored into @ref qpl_job.numa_id of every job, so the hardware path
+ *       submits the jobs to the accelerators of the same node
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_SIZE_ERR if capacity is 0;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_OBJECT_ALLOCATION_ERR;
+ *     - Status of @ref qpl_init_job otherwise.
+ */
+QPL_API(qpl_status, qpl_job_pool_create, (qpl_path_t qpl_path,
+                                          uint32_t capacity,
+                                          int32_t numa_node,
+                                          qpl_job_pool_t *pool_ptr))
+
+/**
+ * @brief Takes a free job from the pool, the function is lock-free and can be called from several threads.
+ *
+ * @param[in]   pool     @ref qpl_job_pool_t object
+ * @param[out]  job_ptr  output parameter for the acquired job
+ *
+ * @note All public fields of the acquired job are zero, except @ref qpl_job.numa_id
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_JOB_POOL_IS_EMPTY_ERR if all jobs of the pool are acquired;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_job_pool_acquire, (qpl_job_pool_t pool, qpl_job **job_ptr))
+
+/**
+ * @brief Returns a completed job to the pool, the function is lock-free and can be called from several threads.
+ *
+ * @param[in]   pool     @ref qpl_job_pool_t object
+ * @param[in]   job_ptr  job previously acquired from the same pool
+ *
+ * @note Only the public fields of the job are reset, the internal states are reinitialized by the next job
+ *       that has @ref QPL_FLAG_FIRST set
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if the job does not belong to the pool;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_job_pool_release, (qpl_job_pool_t pool, qpl_job *job_ptr))
+
+/**
+ * @brief Finalizes all jobs of the pool and frees the pool memory.
+ *
+ * @param[in]  pool  @ref qpl_job_pool_t object, all jobs must be released
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_job_pool_destroy, (qpl_job_pool_t pool))
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //QPL_JOB_POOL_API_H_
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_PARQUET_RLE_H_
+#define QPL_PARQUET_RLE_H_
+
+#include "stdint.h"
+#include "qpl/c_api/status.h"
+#include "qpl/c_api/defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup PARQUET_RLE_API Parquet RLE Pack API
+ * @ingroup JOB_API
+ * @{
+ */
+
+/**
+ * @brief Encodes a little-endian packed array to the Parquet RLE/bit-packed hybrid format
+ *
+ * The output starts with the bit width byte followed by the runs, the same layout the
+ * @ref qpl_p_parquet_rle parser reads. Sequences of at least run_threshold equal elements are written
+ * as repeated runs, the other elements are bit-packed by groups of 8, the last group is padded with zeros.
+ * Extract, select and expand write the same format with @ref QPL_FLAG_OUT_PARQUET_RLE.
+ *
+ * @param[in]   source_ptr         Pointer to the little-endian packed array
+ * @param[in]   source_size        Size of the source buffer in bytes
+ * @param[in]   source_bit_width   Bit width of the elements, 1..32
+ * @param[in]   num_elements       Number of elements to encode
+ * @param[in]   run_threshold      Minimal length of a repeated run, 0 (8 elements) or 8 and greater
+ * @param[out]  destination_ptr    Pointer to the output buffer
+ * @param[in]   destination_size   Size of the output buffer in bytes
+ * @param[out]  total_out_ptr      Number of bytes written to the output buffer
+ *
+ * @note The operation is executed on the software path only
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_SIZE_ERR if there are no elements;
+ *     - @ref QPL_STS_BIT_WIDTH_ERR;
+ *     - @ref QPL_STS_SRC_IS_SHORT_ERR if the source is shorter than num_elements;
+ *     - @ref QPL_STS_DST_IS_SHORT_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if run_threshold is 1..7.
+ */
+QPL_API(qpl_status, qpl_pack_parquet_rle, (const uint8_t *source_ptr,
+                                           uint32_t source_size,
+                                           uint32_t source_bit_width,
+                                           uint32_t num_elements,
+                                           uint32_t run_threshold,
+                                           uint8_t *destination_ptr,
+                                           uint32_t destination_size,
+                                           uint32_t *total_out_ptr))
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //QPL_PARQUET_RLE_H_
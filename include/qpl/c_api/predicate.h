@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_PREDICATE_H_
+#define QPL_PREDICATE_H_
+
+#include "stdint.h"
+#include "qpl/c_api/status.h"
+#include "qpl/c_api/defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup PREDICATE_API Multi-Predicate Scan API
+ * @ingroup JOB_API
+ * @{
+ */
+
+#define QPL_PREDICATE_MAX_INSTRUCTIONS 32u /**< Maximal number of instructions in a predicate program */
+#define QPL_PREDICATE_MAX_DEPTH        8u  /**< Maximal number of bit vectors on the evaluation stack */
+
+/**
+ * @brief Instructions of the predicate program, the program is evaluated as a postfix expression
+ */
+typedef enum {
+    qpl_predicate_scan = 0, /**< Scans a column with a comparator and pushes the resulting bit vector */
+    qpl_predicate_and  = 1, /**< Pops two bit vectors and pushes their conjunction */
+    qpl_predicate_or   = 2, /**< Pops two bit vectors and pushes their disjunction */
+    qpl_predicate_not  = 3  /**< Inverts the bit vector on the top of the stack */
+} qpl_predicate_opcode;
+
+/**
+ * @struct qpl_predicate_instruction
+ * @brief Single instruction of the predicate program
+ *
+ * @note The comparator, column_index and parameters are used by the @ref qpl_predicate_scan instructions only
+ */
+typedef struct {
+    qpl_predicate_opcode opcode;       /**< Instruction kind */
+    qpl_operation        comparator;   /**< One of the scan operations from @ref qpl_op_scan_eq to @ref qpl_op_scan_not_range */
+    uint32_t             column_index; /**< Index of the scanned column */
+    uint32_t             param_low;    /**< Low parameter of the scan, same as @ref qpl_job.param_low */
+    uint32_t             param_high;   /**< High parameter of the scan, same as @ref qpl_job.param_high */
+} qpl_predicate_instruction;
+
+/**
+ * @struct qpl_predicate_column
+ * @brief Column the predicate is evaluated against, all columns hold the same number of elements
+ */
+typedef struct {
+    const uint8_t *data_ptr;  /**< Little-endian packed array of elements */
+    uint32_t      size;       /**< Size of the column in bytes */
+    uint32_t      bit_width;  /**< Bit width of the elements, 1..32 */
+} qpl_predicate_column;
+
+/**
+ * @struct qpl_predicate_result
+ * @brief Size of the output bit vector and its aggregates, same as the ones reported by the scan operations
+ */
+typedef struct {
+    uint32_t total_out;             /**< Number of bytes written to the destination */
+    uint32_t first_index_min_value; /**< Index of the first set bit, UINT32_MAX if there are no set bits */
+    uint32_t last_index_max_value;  /**< Index of the last set bit */
+    uint32_t sum_value;             /**< Number of set bits */
+} qpl_predicate_result;
+
+/**
+ * @brief Evaluates a predicate over several columns and writes a single nominal bit vector
+ *
+ * The columns are processed by blocks of elements, every column is read once, and the intermediate bit vectors
+ * are combined in a small stack that stays in the cache, so an expression like `a BETWEEN x AND y AND b = z OR c < w`
+ * is evaluated in a single pass instead of several scans and bit vector merges.
+ *
+ * The program `scan(a, range, x, y), scan(b, eq, z), and, scan(c, lt, w), or` is an example of such expression.
+ *
+ * @param[in]   columns_ptr       Pointer to the array of columns
+ * @param[in]   columns_count     Number of columns
+ * @param[in]   program_ptr       Pointer to the array of instructions
+ * @param[in]   program_length    Number of instructions, up to @ref QPL_PREDICATE_MAX_INSTRUCTIONS
+ * @param[in]   num_elements      Number of elements in every column
+ * @param[out]  destination_ptr   Pointer to the output bit vector, one bit per element, little-endian bit order
+ * @param[in]   destination_size  Size of the output buffer in bytes
+ * @param[out]  result_ptr        Pointer to @ref qpl_predicate_result
+ *
+ * @note The operation is executed on the software path only
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_SIZE_ERR if there are no elements or columns;
+ *     - @ref QPL_STS_BIT_WIDTH_ERR;
+ *     - @ref QPL_STS_SRC_IS_SHORT_ERR if a column is shorter than num_elements;
+ *     - @ref QPL_STS_DST_IS_SHORT_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR if the program is malformed or uses more than @ref QPL_PREDICATE_MAX_DEPTH
+ *       bit vectors at a time.
+ */
+QPL_API(qpl_status, qpl_scan_predicate, (const qpl_predicate_column *columns_ptr,
+                                         uint32_t columns_count,
+                                         const qpl_predicate_instruction *program_ptr,
+                                         uint32_t program_length,
+                                         uint32_t num_elements,
+                                         uint8_t *destination_ptr,
+                                         uint32_t destination_size,
+                                         qpl_predicate_result *result_ptr))
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //QPL_PREDICATE_H_
@@ -48,6 +48,19 @@ typedef struct {
     uint32_t reserved_distances[2u];                           /**< Reserved distance tokens */
 } qpl_histogram;
 
+/**
+ * @struct qpl_statistics_options
+ * @brief Structure that sets up the parallel and sampled gathering of deflate statistics
+ *
+ * @note The source is split into chunks of @ref QPL_STATISTICS_CHUNK_SIZE bytes, matches don't cross the chunk boundaries.
+ */
+typedef struct {
+    uint32_t threads_count;  /**< Number of threads gathering statistics, 0 means the number of hardware threads */
+    uint32_t sample_percent; /**< Percent of the chunks (1-100) that are evenly picked from the source and histogrammed */
+} qpl_statistics_options;
+
+#define QPL_STATISTICS_CHUNK_SIZE          (64u * 1024u) /**< Size of the source chunk histogrammed by one thread at a time */
+
 /** @} */
 
 /**
@@ -72,6 +85,29 @@ QPL_API(qpl_status, qpl_gather_deflate_statistics, (uint8_t * source_ptr,
                                                     const qpl_compression_levels level,
                                                     const qpl_path_t path))
 
+/**
+ * @brief Gathers deflate statistics over several threads and (optionally) a part of the source only
+ *
+ * The chunks of the source are histogrammed by the threads independently, and the partial histograms are merged
+ * into the histogram_ptr one. Sampled statistics hold the counts of the histogrammed chunks only, that is enough
+ * to build a Huffman table, as only the relative frequencies of the symbols matter.
+ *
+ * @param[in]   source_ptr     Pointer to source vector that should be processed
+ * @param[in]   source_length  Source vector length
+ * @param[out]  histogram_ptr  Pointer to histogram to be updated
+ * @param[in]   level          Level of compression algorithm
+ * @param[in]   path           Execution path
+ * @param[in]   options_ptr    Pointer to @ref qpl_statistics_options
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_gather_deflate_statistics_ext, (uint8_t * source_ptr,
+                                                        const uint32_t source_length,
+                                                        qpl_histogram *histogram_ptr,
+                                                        const qpl_compression_levels level,
+                                                        const qpl_path_t path,
+                                                        const qpl_statistics_options *options_ptr))
+
 /** @} */
 
 #ifdef __cplusplus
@@ -77,6 +77,7 @@ typedef enum {
     QPL_STS_QUEUES_ARE_BUSY_ERR     = QPL_PROCESSING_ERROR(5u), /**< Descriptor can't be submitted into filled work queue */
     QPL_STS_LIBRARY_INTERNAL_ERR    = QPL_PROCESSING_ERROR(6u), /**< Unexpected internal error condition */
     QPL_STS_JOB_NOT_SUBMITTED       = QPL_PROCESSING_ERROR(7u), /**< The job being checked/waited has not been submitted */
+    QPL_STS_JOB_POOL_IS_EMPTY_ERR   = QPL_PROCESSING_ERROR(8u), /**< All jobs of the job pool are acquired */
 
 /* ====== Operations Statuses ====== */
 /* --- Incorrect Parameter Value --- */
@@ -130,6 +131,7 @@ typedef enum {
     QPL_STS_ARCHIVE_HEADER_ERR        = QPL_SERVICE_LOGIC_ERROR(4u), /**< Invalid GZIP/Zlib header */
     QPL_STS_ARCHIVE_UNSUP_METHOD_ERR  = QPL_SERVICE_LOGIC_ERROR(5u), /**< Gzip/Zlib header specifies unsupported compress method */
     QPL_STS_OBJECT_ALLOCATION_ERR     = QPL_SERVICE_LOGIC_ERROR(6u), /**< Not able to allocate Huffman table object */
+    QPL_STS_INDEX_CRC_MISMATCH_ERR    = QPL_SERVICE_LOGIC_ERROR(7u), /**< CRC of a decompressed mini-block doesn't match the index table */
 
 /* --- Corresponds to the error codes in Completion Record from Intel® In-Memory Analytics Accelerator --- */
     QPL_STS_BIG_HEADER_ERR                  = QPL_OPERATION_ERROR(1u),  /**< Reached the end of the input stream before decoding header and header is too big to fit in input buffer */
@@ -22,6 +22,9 @@
 #include "c_api/version.h"
 #include "c_api/defs.h"
 #include "c_api/job.h"
+#include "c_api/job_pool.h"
+#include "c_api/predicate.h"
+#include "c_api/parquet_rle.h"
 #include "c_api/index_table.h"
 
 #endif /* //QPL_H__ */
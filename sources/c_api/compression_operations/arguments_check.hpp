@@ -85,11 +85,11 @@ auto inline bad_arguments_check(const qpl_job *const job_ptr) -> uint32_t {
 
 template <>
 inline auto validate_mode<qpl_operation::qpl_op_compress>(const qpl_job * const qpl_job_ptr) noexcept {
-    if (qpl_job_ptr->level != qpl_high_level && qpl_job_ptr->level != qpl_default_level) {
+    if (qpl_job_ptr->level < qpl_level_1 || qpl_job_ptr->level > qpl_level_9) {
         return ml::status_list::not_supported_level_err;
     }
 
-    if (qpl_job_ptr->level == qpl_high_level &&
+    if (qpl_job_ptr->level != qpl_default_level &&
         (job::get_execution_path(qpl_job_ptr) == ml::execution_path_t::hardware)) {
         return ml::status_list::not_supported_level_err;
     }
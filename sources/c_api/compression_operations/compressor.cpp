@@ -13,6 +13,7 @@
 #include "common/linear_allocator.hpp"
 
 #include "compression/deflate/deflate.hpp"
+#include "compression/deflate/parallel_deflate.hpp"
 #include "compression/deflate/streams/deflate_state_builder.hpp"
 
 #include "compression/huffman_only/huffman_only.hpp"
@@ -122,6 +123,38 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
         }
 
     } else { // Deflate Mode
+        if constexpr (qpl::ml::execution_path_t::software == path) {
+            if (job::is_parallel_compression(job_ptr) && job_ptr->available_in > parallel_deflate_chunk_size) {
+                const auto is_dynamic_mode = static_cast<bool>(job_ptr->flags & QPL_FLAG_DYNAMIC_HUFFMAN);
+                qpl_compression_huffman_table *table_ptr = nullptr;
+
+                if (!is_dynamic_mode && job_ptr->huffman_table) {
+                    OWN_QPL_CHECK_STATUS(check_huffman_table_is_correct<compression_algorithm_e::deflate>(job_ptr->huffman_table))
+                    auto table_impl = use_as_huffman_table<compression_algorithm_e::deflate>(job_ptr->huffman_table);
+
+                    table_ptr = reinterpret_cast<qpl_compression_huffman_table*>(table_impl->compression_huffman_table<path>());
+                }
+
+                const auto mode   = is_dynamic_mode ? dynamic_mode : (table_ptr ? static_mode : fixed_mode);
+                const auto header = (job_ptr->flags & QPL_FLAG_GZIP_MODE) ? gzip_header_t :
+                                    (job_ptr->flags & QPL_FLAG_ZLIB_MODE) ? zlib_header_t : no_header_t;
+
+                result = parallel_deflate(job_ptr->next_in_ptr,
+                                          job_ptr->available_in,
+                                          job_ptr->next_out_ptr,
+                                          job_ptr->available_out,
+                                          static_cast<compression_level_t>(job_ptr->level),
+                                          mode,
+                                          table_ptr,
+                                          header,
+                                          !(job_ptr->flags & QPL_FLAG_OMIT_VERIFY));
+
+                job::update(job_ptr, result);
+
+                return result.status_code_;
+            }
+        }
+
         auto builder = (job_ptr->flags & QPL_FLAG_FIRST) ?
                        deflate_state_builder<path>::create(allocator) :
                        deflate_state_builder<path>::restore(allocator);
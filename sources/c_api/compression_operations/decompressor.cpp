@@ -19,6 +19,7 @@
 // ML
 #include "common/defs.hpp"
 #include "compression/huffman_table/inflate_huffman_table.hpp"
+#include "compression/inflate/gzip_members.hpp"
 #include "compression/inflate/inflate.hpp"
 #include "compression/inflate/inflate_state.hpp"
 #include "compression/huffman_only/huffman_only.hpp"
@@ -92,16 +93,21 @@ uint32_t perform_decompress(qpl_job *const job_ptr) noexcept {
 
         set_representation_flags(d_table_ptr, decompression_table);
 
+        // Decoding tables are built once per Huffman table and are shared by all the jobs that use it
+        if constexpr (path == qpl::ml::execution_path_t::software) {
+            decompression_table.set_huffman_only_decoding_tables(table_impl->get_huffman_only_decoding_tables());
+        }
+
         huffman_only_decompression_state<path> state(allocator);
 
         auto endianness = (job_ptr->flags & QPL_FLAG_HUFFMAN_BE) ? big_endian : little_endian;
 
         if constexpr (path == qpl::ml::execution_path_t::software) {
             // available_in and ignore_end_bits were set based on BE16 format, update them for normal format:
-            // if ignore_end_bits is greater than 8, in the last 16-bit word, only the first byte
+            // if ignore_end_bits is 8 or greater, in the last 16-bit word, only the first byte
             // is (partially) written and the second byte is empty. Therefore, subtract available_in by 1 and
             // ignore_end_bits by 8.
-            if (endianness == big_endian && job_ptr->ignore_end_bits > 8) {
+            if (endianness == big_endian && job_ptr->ignore_end_bits >= 8) {
                 job_ptr->available_in -= 1;
                 job_ptr->ignore_end_bits -= 8;
             }
@@ -121,6 +127,30 @@ uint32_t perform_decompress(qpl_job *const job_ptr) noexcept {
         }
         result = decompress_huffman_only<path>(state, decompression_table);
     } else {
+        if constexpr (qpl::ml::execution_path_t::software == path) {
+            if (job::is_parallel_decompression(job_ptr)) {
+                gzip_decorator::gzip_header header{};
+
+                // Only BGZF members are located without decompression, other streams are processed by one thread
+                if (job_ptr->available_in >= OWN_GZIP_HEADER_LENGTH &&
+                    status_list::ok == gzip_decorator::read_header(job_ptr->next_in_ptr, job_ptr->available_in, header) &&
+                    header.block_size > 0u) {
+                    result = inflate_gzip_members(job_ptr->next_in_ptr,
+                                                  job_ptr->available_in,
+                                                  job_ptr->next_out_ptr,
+                                                  job_ptr->available_out,
+                                                  !(job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS),
+                                                  true);
+
+                    if (result.status_code_ == status_list::ok) {
+                        job::update(job_ptr, result);
+                    }
+
+                    return result.status_code_;
+                }
+            }
+        }
+
         // Prepare decompression state
         auto state = (job_ptr->flags & QPL_FLAG_FIRST) ?
                      qpl::ml::compression::inflate_state<path>::template create<true>(allocator) :
@@ -145,6 +175,12 @@ uint32_t perform_decompress(qpl_job *const job_ptr) noexcept {
 
         if constexpr (qpl::ml::execution_path_t::hardware == path) {
             state.aecs_format_version(qpl::ml::util::get_device_aecs_format());
+        } else {
+            // XOR checksum of the whole output is accumulated job by job along with the CRC
+            if (!(job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS)) {
+                state.xor_checksum((job_ptr->flags & QPL_FLAG_FIRST) ? 0u : job_ptr->xor_checksum,
+                                   job_ptr->total_out);
+            }
         }
 
         if (job::is_dictionary(job_ptr)) {
@@ -19,7 +19,7 @@ QPL_FUN(qpl_status, qpl_gather_deflate_statistics, (uint8_t * source_ptr,
 
     OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, histogram_ptr));
 
-    if (level != qpl_high_level && level != qpl_default_level) {
+    if (level < qpl_level_1 || level > qpl_level_9) {
         return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
     }
 
@@ -48,4 +48,52 @@ QPL_FUN(qpl_status, qpl_gather_deflate_statistics, (uint8_t * source_ptr,
     }
 }
 
+QPL_FUN(qpl_status, qpl_gather_deflate_statistics_ext, (uint8_t * source_ptr,
+        const uint32_t               source_length,
+        qpl_histogram                *histogram_ptr,
+        const qpl_compression_levels level,
+        const qpl_path_t             path,
+        const qpl_statistics_options *options_ptr)) {
+    using namespace qpl::ml;
+
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, histogram_ptr, options_ptr));
+
+    if (level < qpl_level_1 || level > qpl_level_9) {
+        return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
+    }
+
+    if (0u == options_ptr->sample_percent || 100u < options_ptr->sample_percent) {
+        return QPL_STS_INVALID_PARAM_ERR;
+    }
+
+    qpl_ml_status status = status_list::ok;
+
+    const uint8_t *const begin = source_ptr;
+    const uint8_t *const end = source_ptr + source_length;
+
+    switch (path) {
+        case qpl_path_auto:
+            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+
+        case qpl_path_hardware:
+            status = compression::update_histogram_parallel<execution_path_t::hardware>(begin,
+                                                                                        end,
+                                                                                        *histogram_ptr,
+                                                                                        level,
+                                                                                        options_ptr->threads_count,
+                                                                                        options_ptr->sample_percent);
+            return static_cast<qpl_status>(status);
+        case qpl_path_software:
+            status = compression::update_histogram_parallel<execution_path_t::software>(begin,
+                                                                                        end,
+                                                                                        *histogram_ptr,
+                                                                                        level,
+                                                                                        options_ptr->threads_count,
+                                                                                        options_ptr->sample_percent);
+            return static_cast<qpl_status>(status);
+        default:
+            return QPL_STS_PATH_ERR;
+    }
+}
+
 }
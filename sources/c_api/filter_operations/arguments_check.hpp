@@ -80,8 +80,14 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
         source_bit_width = static_cast<uint32_t>(job_ptr->next_in_ptr[0]);
     }
 
+    // Elements wider than 32 bits are supported by the software path only (qpl_path_auto routes them there)
+    // and never come from the Parquet RLE format
+    const uint32_t max_bit_width = (qpl_path_hardware != job_ptr->data_ptr.path && qpl_p_parquet_rle != job_ptr->parser)
+                                   ? limits::max_sw_bit_width
+                                   : limits::max_bit_width;
+
     if (false == source_bit_width_is_unknown &&
-        (source_bit_width < 1u || source_bit_width > 32u)) {
+        (source_bit_width < limits::min_bit_width || source_bit_width > max_bit_width)) {
         return QPL_STS_BIT_WIDTH_ERR;
     }
 
@@ -99,6 +105,8 @@ static inline qpl_status check_bad_arguments(const qpl_job *const job_ptr) {
     QPL_BADARG_RET((1u != job_ptr->src2_bit_width), QPL_STS_BIT_WIDTH_ERR)
 
     QPL_BADARG_RET(job_ptr->initial_output_index, QPL_STS_INVALID_PARAM_ERR);
+    QPL_BADARG_RET((job_ptr->src1_bit_width > limits::max_bit_width && qpl_ow_nom != job_ptr->out_bit_width),
+                   QPL_STS_OUT_FORMAT_ERR)
 
     if (job_ptr->parser != qpl_p_parquet_rle && !(job_ptr->flags & QPL_FLAG_DECOMPRESS_ENABLE)) {
         uint64_t expected_source_byte_length = util::bit_to_byte((uint64_t)job_ptr->num_input_elements * (uint64_t)job_ptr->src1_bit_width);
@@ -132,6 +140,8 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
     QPL_BADARG_RET((1u != job_ptr->src2_bit_width), QPL_STS_BIT_WIDTH_ERR);
 
     QPL_BADARG_RET(job_ptr->initial_output_index, QPL_STS_INVALID_PARAM_ERR);
+    QPL_BADARG_RET((job_ptr->src1_bit_width > limits::max_bit_width && qpl_ow_nom != job_ptr->out_bit_width),
+                   QPL_STS_OUT_FORMAT_ERR);
 
     // num_input_elements reflect elements in source-2 for expand operation
     uint32_t expected_mask_byte_length = util::bit_to_byte(job_ptr->num_input_elements);
@@ -143,6 +153,10 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 
 namespace extract {
 static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
+    // Elements wider than 32 bits are written as is
+    QPL_BADARG_RET((job_ptr->src1_bit_width > limits::max_bit_width && qpl_ow_nom != job_ptr->out_bit_width),
+                   QPL_STS_OUT_FORMAT_ERR);
+
     if ((qpl_p_parquet_rle != job_ptr->parser) &&
         !(QPL_FLAG_DECOMPRESS_ENABLE & job_ptr->flags)) {
         uint64_t input_bits = (uint64_t)job_ptr->num_input_elements * (uint64_t)job_ptr->src1_bit_width;
@@ -169,6 +183,29 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 }
 }
 
+namespace parquet_rle_output {
+static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
+    if (!(QPL_FLAG_OUT_PARQUET_RLE & job_ptr->flags)) {
+        return QPL_STS_OK;
+    }
+
+    // Runs and bit-packed groups keep the source bit width in little-endian order
+    if (qpl_ow_nom != job_ptr->out_bit_width || (QPL_FLAG_OUT_BE & job_ptr->flags)) {
+        return QPL_STS_OUT_FORMAT_ERR;
+    }
+
+    if (qpl_p_parquet_rle != job_ptr->parser && job_ptr->src1_bit_width > limits::max_bit_width) {
+        return QPL_STS_BIT_WIDTH_ERR;
+    }
+
+    if (0u != job_ptr->out_rle_threshold && job_ptr->out_rle_threshold < limits::min_prle_run) {
+        return QPL_STS_INVALID_PARAM_ERR;
+    }
+
+    return QPL_STS_OK;
+}
+}
+
 namespace scanning {
 static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
     if (qpl_ow_nom == job_ptr->out_bit_width) {
@@ -218,6 +255,7 @@ inline auto validate_operation<qpl_op_extract>(const qpl_job *const job_ptr) noe
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_extract>(job_ptr));
     OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr))
     OWN_QPL_CHECK_STATUS(details::extract::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::parquet_rle_output::check_bad_arguments(job_ptr));
 
     return QPL_STS_OK;
 }
@@ -227,6 +265,7 @@ inline auto validate_operation<qpl_op_select>(const qpl_job *const job_ptr) noex
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_select>(job_ptr));
     OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr));
     OWN_QPL_CHECK_STATUS(details::select::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::parquet_rle_output::check_bad_arguments(job_ptr));
 
     return QPL_STS_OK;
 }
@@ -236,6 +275,7 @@ inline auto validate_operation<qpl_op_expand>(const qpl_job *const job_ptr) noex
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_expand>(job_ptr));
     OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr));
     OWN_QPL_CHECK_STATUS(details::expand::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::parquet_rle_output::check_bad_arguments(job_ptr));
 
     return QPL_STS_OK;
 }
@@ -285,6 +325,9 @@ static inline auto update_job(qpl_job *job_ptr, const analytic_operation_result_
     job_ptr->first_index_min_value = operation_result.aggregates_.min_value_;
     job_ptr->last_index_max_value  = operation_result.aggregates_.max_value_;
     job_ptr->sum_value             = operation_result.aggregates_.sum_;
+    job_ptr->min_value_64          = operation_result.aggregates_.wide_min_value_;
+    job_ptr->max_value_64          = operation_result.aggregates_.wide_max_value_;
+    job_ptr->sum_value_64          = operation_result.aggregates_.wide_sum_;
     job_ptr->last_bit_offset       = operation_result.last_bit_offset_;
     job_ptr->xor_checksum          = operation_result.checksums_.xor_;
     job_ptr->crc                   = operation_result.checksums_.crc32_;
@@ -28,8 +28,9 @@ uint32_t perform_expand(qpl_job *job_ptr,
     const auto out_bit_width_format = static_cast<analytics::output_bit_width_format_t>(job_ptr->out_bit_width);
     const auto mask_stream_format   = job_ptr->flags & QPL_FLAG_SRC2_BE ? stream_format_t::be_format
                                                                         : stream_format_t::le_format;
-    const auto output_stream_format = (job_ptr->flags & QPL_FLAG_OUT_BE) ? stream_format_t::be_format
-                                                                         : stream_format_t::le_format;
+    const auto output_stream_format = (job_ptr->flags & QPL_FLAG_OUT_PARQUET_RLE) ? stream_format_t::prle_format
+                                      : (job_ptr->flags & QPL_FLAG_OUT_BE) ? stream_format_t::be_format
+                                                                           : stream_format_t::le_format;
     const auto crc_type             = job_ptr->flags & QPL_FLAG_CRC32C ? analytics::input_stream_t::crc_t::iscsi
                                                                        : analytics::input_stream_t::crc_t::gzip;
 
@@ -119,9 +120,10 @@ uint32_t perform_expand(qpl_job *job_ptr,
                     .bit_format(out_bit_width_format, input_stream.bit_width())
                     .nominal(input_stream.bit_width() == bit_bits_size)
                     .initial_output_index(job_ptr->initial_output_index)
+                    .run_threshold(job_ptr->out_rle_threshold)
                     .build<execution_path_t::auto_detect>();
 
-            auto bad_arg_status = validate_input_stream(input_stream);
+            auto bad_arg_status = validate_input_stream(input_stream, limits::min_bit_width, limits::max_sw_bit_width);
 
             if (bad_arg_status != status_list::ok) {
                 return bad_arg_status;
@@ -165,9 +167,10 @@ uint32_t perform_expand(qpl_job *job_ptr,
                     .bit_format(out_bit_width_format, input_stream.bit_width())
                     .nominal(input_stream.bit_width() == bit_bits_size)
                     .initial_output_index(job_ptr->initial_output_index)
+                    .run_threshold(job_ptr->out_rle_threshold)
                     .build<execution_path_t::software>();
 
-            auto bad_arg_status = validate_input_stream(input_stream);
+            auto bad_arg_status = validate_input_stream(input_stream, limits::min_bit_width, limits::max_sw_bit_width);
 
             if (bad_arg_status != status_list::ok) {
                 return bad_arg_status;
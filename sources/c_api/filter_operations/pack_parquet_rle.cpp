@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#include "qpl/c_api/parquet_rle.h"
+#include "own_defs.h"
+#include "analytics/prle_encoder.hpp"
+#include "util/checkers.hpp"
+#include "util/util.hpp"
+
+extern "C" {
+
+QPL_FUN(qpl_status, qpl_pack_parquet_rle, (const uint8_t *source_ptr,
+        uint32_t source_size,
+        uint32_t source_bit_width,
+        uint32_t num_elements,
+        uint32_t run_threshold,
+        uint8_t  *destination_ptr,
+        uint32_t destination_size,
+        uint32_t *total_out_ptr)) {
+    using namespace qpl::ml;
+
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, destination_ptr, total_out_ptr));
+
+    if (0u == num_elements) {
+        return QPL_STS_SIZE_ERR;
+    }
+
+    if (source_bit_width < limits::min_bit_width || source_bit_width > limits::max_bit_width) {
+        return QPL_STS_BIT_WIDTH_ERR;
+    }
+
+    if (0u != run_threshold && run_threshold < limits::min_prle_run) {
+        return QPL_STS_INVALID_PARAM_ERR;
+    }
+
+    if (util::bit_to_byte(static_cast<uint64_t>(num_elements) * source_bit_width) > source_size) {
+        return QPL_STS_SRC_IS_SHORT_ERR;
+    }
+
+    *total_out_ptr = 0u;
+
+    return static_cast<qpl_status>(analytics::pack_parquet_rle(source_ptr,
+                                                               source_bit_width,
+                                                               num_elements,
+                                                               run_threshold,
+                                                               destination_ptr,
+                                                               destination_size,
+                                                               *total_out_ptr));
+}
+
+}
@@ -185,7 +185,7 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     .initial_output_index(job_ptr->initial_output_index)
                     .build<execution_path_t::auto_detect>();
 
-            auto bad_arg_status = validate_input_stream(input_stream);
+            auto bad_arg_status = validate_input_stream(input_stream, limits::min_bit_width, limits::max_sw_bit_width);
 
             if (bad_arg_status != status_list::ok) {
                 return bad_arg_status;
@@ -193,13 +193,18 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
 
             limited_buffer_t temporary_buffer(buffer_ptr, buffer_ptr + buffer_size, input_stream.bit_width());
 
+            const uint64_t param_low  = (job_ptr->src1_bit_width > limits::max_bit_width) ? job_ptr->param_low_64
+                                                                                          : job_ptr->param_low;
+            const uint64_t param_high = (job_ptr->src1_bit_width > limits::max_bit_width) ? job_ptr->param_high_64
+                                                                                          : job_ptr->param_high;
+
             switch (job_ptr->op) {
                 case qpl_op_scan_eq: {
                     scan_result = analytics::call_scan<analytics::comparator_t::equals,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
@@ -207,8 +212,8 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     scan_result = analytics::call_scan<analytics::comparator_t::not_equals,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
@@ -216,8 +221,8 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     scan_result = analytics::call_scan<analytics::comparator_t::less_than,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
@@ -225,8 +230,8 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     scan_result = analytics::call_scan<analytics::comparator_t::less_equals,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
@@ -234,8 +239,8 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     scan_result = analytics::call_scan<analytics::comparator_t::greater_than,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
@@ -243,8 +248,8 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     scan_result = analytics::call_scan<analytics::comparator_t::greater_equals,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
@@ -252,8 +257,8 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     scan_result = analytics::call_scan<analytics::comparator_t::out_of_range,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
@@ -261,8 +266,8 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                     scan_result = analytics::call_scan<analytics::comparator_t::in_range,
                             execution_path_t::software>(input_stream,
                                                         output_stream,
-                                                        job_ptr->param_low,
-                                                        job_ptr->param_high,
+                                                        param_low,
+                                                        param_high,
                                                         temporary_buffer);
                     break;
                 }
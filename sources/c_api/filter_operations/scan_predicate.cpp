@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#include <array>
+
+#include "qpl/c_api/predicate.h"
+#include "own_defs.h"
+#include "analytics/scan_predicate.hpp"
+#include "util/checkers.hpp"
+
+extern "C" {
+
+QPL_FUN(qpl_status, qpl_scan_predicate, (const qpl_predicate_column *columns_ptr,
+        uint32_t                        columns_count,
+        const qpl_predicate_instruction *program_ptr,
+        uint32_t                        program_length,
+        uint32_t                        num_elements,
+        uint8_t                         *destination_ptr,
+        uint32_t                        destination_size,
+        qpl_predicate_result            *result_ptr)) {
+    using namespace qpl::ml;
+
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(columns_ptr, program_ptr, destination_ptr, result_ptr));
+
+    if (0u == columns_count) {
+        return QPL_STS_SIZE_ERR;
+    }
+
+    if (0u == program_length || program_length > QPL_PREDICATE_MAX_INSTRUCTIONS) {
+        return QPL_STS_INVALID_PARAM_ERR;
+    }
+
+    // Every scan instruction gets its own copy of the column, so only the referenced columns are checked
+    std::array<analytics::predicate_column_t, QPL_PREDICATE_MAX_INSTRUCTIONS>      columns{};
+    std::array<analytics::predicate_instruction_t, QPL_PREDICATE_MAX_INSTRUCTIONS> program{};
+    uint32_t scans_count = 0u;
+
+    for (uint32_t idx = 0u; idx < program_length; idx++) {
+        const auto &instruction = program_ptr[idx];
+
+        program[idx].opcode     = static_cast<analytics::predicate_opcode_t>(instruction.opcode);
+        program[idx].comparator = analytics::equals;
+
+        if (qpl_predicate_scan == instruction.opcode) {
+            if (instruction.column_index >= columns_count
+                || instruction.comparator < qpl_op_scan_eq || instruction.comparator > qpl_op_scan_not_range) {
+                return QPL_STS_INVALID_PARAM_ERR;
+            }
+
+            const auto &column = columns_ptr[instruction.column_index];
+
+            columns[scans_count] = {column.data_ptr, column.size, column.bit_width};
+
+            program[idx].comparator   = static_cast<analytics::comparator_t>(instruction.comparator - qpl_op_scan_eq);
+            program[idx].column_index = scans_count++;
+            program[idx].param_low    = instruction.param_low;
+            program[idx].param_high   = instruction.param_high;
+        }
+    }
+
+    OWN_QPL_CHECK_STATUS(analytics::validate_predicate(columns.data(),
+                                                       scans_count,
+                                                       program.data(),
+                                                       program_length,
+                                                       num_elements));
+
+    if (destination_size < util::bit_to_byte(num_elements)) {
+        return QPL_STS_DST_IS_SHORT_ERR;
+    }
+
+    aggregates_t aggregates{};
+
+    result_ptr->total_out = analytics::scan_predicate(columns.data(),
+                                                      program.data(),
+                                                      program_length,
+                                                      num_elements,
+                                                      destination_ptr,
+                                                      aggregates);
+
+    result_ptr->first_index_min_value = aggregates.min_value_;
+    result_ptr->last_index_max_value  = aggregates.max_value_;
+    result_ptr->sum_value             = aggregates.sum_;
+
+    return QPL_STS_OK;
+}
+
+}
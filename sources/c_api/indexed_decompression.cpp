@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+
+#include "qpl/qpl.h"
+
+// Middle layer headers
+#include "util/thread_pool.hpp"
+
+// Legacy
+#include "own_defs.h"
+
+namespace {
+
+/**
+ * Number of neighbouring mini-blocks decompressed by one thread at a time, the block header is parsed once for them
+ */
+constexpr uint32_t own_mini_blocks_per_task = 16u;
+
+constexpr uint32_t own_no_block = UINT32_MAX;
+
+struct own_indexed_decompression_context {
+    uint8_t               *source_ptr;
+    uint32_t              source_size;
+    qpl_index_table       *table_ptr;
+    uint32_t              mini_block_size;
+    uint8_t               *destination_ptr;
+    uint32_t              destination_size;
+    std::atomic<uint32_t> next_mini_block;
+    std::atomic<uint32_t> output_size;
+    std::atomic<int32_t>  status;
+};
+
+/**
+ * @brief Sets the job input to the bits between two neighbouring indices
+ */
+auto own_set_index_range(qpl_job *job_ptr,
+                         const own_indexed_decompression_context &context,
+                         uint32_t index) noexcept -> qpl_status {
+    const uint32_t start_bit = context.table_ptr->indices_ptr[index].bit_offset;
+    const uint32_t last_bit  = context.table_ptr->indices_ptr[index + 1u].bit_offset;
+
+    if (start_bit > last_bit || (last_bit + 7u) / 8u > context.source_size) {
+        return QPL_STS_SIZE_ERR;
+    }
+
+    uint8_t  *source_ptr       = context.source_ptr;
+    uint32_t ignore_start_bits = 0u;
+    uint32_t ignore_end_bits   = 0u;
+    uint32_t compressed_size   = 0u;
+
+    auto status = qpl_set_mini_block_location(start_bit,
+                                              last_bit,
+                                              &source_ptr,
+                                              &ignore_start_bits,
+                                              &ignore_end_bits,
+                                              &compressed_size);
+
+    job_ptr->next_in_ptr       = source_ptr;
+    job_ptr->available_in      = compressed_size;
+    job_ptr->ignore_start_bits = static_cast<uint8_t>(ignore_start_bits);
+    job_ptr->ignore_end_bits   = static_cast<uint8_t>(ignore_end_bits);
+
+    return status;
+}
+
+auto own_decompress_mini_block(qpl_job *job_ptr,
+                               own_indexed_decompression_context &context,
+                               uint32_t mini_block_number,
+                               uint32_t &parsed_block) noexcept -> qpl_status {
+    const uint32_t block_number   = mini_block_number / context.table_ptr->mini_blocks_per_block;
+    const uint32_t output_offset  = mini_block_number * context.mini_block_size;
+    uint8_t *const output_ptr     = context.destination_ptr + output_offset;
+    const uint32_t available_out  = std::min(context.mini_block_size, context.destination_size - output_offset);
+    const bool     is_last        = mini_block_number + 1u == context.table_ptr->mini_block_count;
+
+    qpl_status status = QPL_STS_OK;
+
+    // The header of the block is kept by the job till the next block is met
+    if (block_number != parsed_block) {
+        uint32_t header_index = 0u;
+
+        status = qpl_find_header_block_index(context.table_ptr, mini_block_number, &header_index);
+
+        if (QPL_STS_OK == status) {
+            status = own_set_index_range(job_ptr, context, header_index);
+        }
+
+        if (QPL_STS_OK != status) {
+            return status;
+        }
+
+        // FIRST | RND_ACCESS reads the block header only
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_RND_ACCESS;
+        job_ptr->next_out_ptr  = output_ptr;
+        job_ptr->available_out = available_out;
+
+        status = qpl_execute_job(job_ptr);
+
+        if (QPL_STS_OK != status) {
+            return status;
+        }
+
+        parsed_block = block_number;
+    }
+
+    uint32_t mini_block_index = 0u;
+
+    status = qpl_find_mini_block_index(context.table_ptr, mini_block_number, &mini_block_index);
+
+    if (QPL_STS_OK == status) {
+        status = own_set_index_range(job_ptr, context, mini_block_index);
+    }
+
+    if (QPL_STS_OK != status) {
+        return status;
+    }
+
+    job_ptr->flags         = QPL_FLAG_RND_ACCESS;
+    job_ptr->crc           = context.table_ptr->indices_ptr[mini_block_index].crc;
+    job_ptr->next_out_ptr  = output_ptr;
+    job_ptr->available_out = available_out;
+
+    status = qpl_execute_job(job_ptr);
+
+    if (QPL_STS_OK != status) {
+        return status;
+    }
+
+    if (job_ptr->crc != context.table_ptr->indices_ptr[mini_block_index + 1u].crc) {
+        return QPL_STS_INDEX_CRC_MISMATCH_ERR;
+    }
+
+    // total_out is accumulated by all jobs of the block, so the output is counted by the pointer
+    const auto output_size = static_cast<uint32_t>(job_ptr->next_out_ptr - output_ptr);
+
+    // Only the last mini-block can be shorter, otherwise the output offsets of the next ones are wrong
+    if (!is_last && context.mini_block_size != output_size) {
+        return QPL_STS_INDEX_GENERATION_ERR;
+    }
+
+    context.output_size.fetch_add(output_size, std::memory_order_relaxed);
+
+    return QPL_STS_OK;
+}
+
+void own_decompress_mini_blocks(qpl_job *job_ptr, own_indexed_decompression_context &context) noexcept {
+    const uint32_t mini_block_count = context.table_ptr->mini_block_count;
+
+    uint32_t parsed_block = own_no_block;
+
+    while (QPL_STS_OK == context.status.load(std::memory_order_relaxed)) {
+        const uint32_t first_mini_block = context.next_mini_block.fetch_add(own_mini_blocks_per_task,
+                                                                            std::memory_order_relaxed);
+
+        if (first_mini_block >= mini_block_count) {
+            break;
+        }
+
+        const uint32_t last_mini_block = std::min(first_mini_block + own_mini_blocks_per_task, mini_block_count);
+
+        for (uint32_t i = first_mini_block; i < last_mini_block; i++) {
+            auto status = own_decompress_mini_block(job_ptr, context, i, parsed_block);
+
+            if (QPL_STS_OK != status) {
+                int32_t expected = QPL_STS_OK;
+
+                // The first error is reported
+                context.status.compare_exchange_strong(expected, static_cast<int32_t>(status));
+
+                return;
+            }
+        }
+    }
+}
+
+}
+
+extern "C" {
+
+QPL_FUN(qpl_status, qpl_decompress_indexed, (qpl_path_t qpl_path,
+                                             uint8_t *source_ptr,
+                                             uint32_t source_size,
+                                             qpl_index_table *table_ptr,
+                                             qpl_mini_block_size mini_block_size,
+                                             uint8_t *destination_ptr,
+                                             uint32_t destination_size,
+                                             uint32_t *output_size_ptr)) {
+    QPL_BADARG_RET(qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BAD_PTR2_RET(source_ptr, destination_ptr);
+    QPL_BAD_PTR2_RET(table_ptr, output_size_ptr);
+    QPL_BAD_PTR_RET(table_ptr->indices_ptr);
+    QPL_BADARG_RET(qpl_mblk_size_none == mini_block_size || qpl_mblk_size_32k < mini_block_size, QPL_STS_SIZE_ERR);
+    QPL_BADARG_RET(0u == table_ptr->mini_block_count || 0u == table_ptr->mini_blocks_per_block, QPL_STS_SIZE_ERR);
+
+    *output_size_ptr = 0u;
+
+    const uint32_t mini_block_bytes  = 256u << mini_block_size;
+    const uint64_t last_block_offset = static_cast<uint64_t>(table_ptr->mini_block_count - 1u) * mini_block_bytes;
+
+    if (last_block_offset >= destination_size) {
+        return QPL_STS_DST_IS_SHORT_ERR;
+    }
+
+    uint32_t job_size = 0u;
+    auto     status   = qpl_get_job_size(qpl_path, &job_size);
+
+    if (QPL_STS_OK != status) {
+        return status;
+    }
+
+    const uint32_t tasks_count   = (table_ptr->mini_block_count + own_mini_blocks_per_task - 1u) / own_mini_blocks_per_task;
+    const uint32_t threads_count = std::min(std::max(1u, std::thread::hardware_concurrency()), tasks_count);
+
+    // Every thread keeps its own job, so the parsed block header survives between its mini-blocks
+    const uint32_t job_stride = QPL_ALIGNED_SIZE(job_size, QPL_DEFAULT_ALIGNMENT);
+
+    std::unique_ptr<uint8_t[]> jobs_buffer(new (std::nothrow) uint8_t[static_cast<size_t>(job_stride) * threads_count]);
+
+    if (!jobs_buffer) {
+        return QPL_STS_NO_MEM_ERR;
+    }
+
+    auto *const jobs_ptr = jobs_buffer.get();
+
+    auto get_job = [jobs_ptr, job_stride](uint32_t index) {
+        return reinterpret_cast<qpl_job *>(jobs_ptr + static_cast<size_t>(job_stride) * index);
+    };
+
+    for (uint32_t i = 0u; i < threads_count; i++) {
+        status = qpl_init_job(qpl_path, get_job(i));
+
+        if (QPL_STS_OK != status) {
+            for (uint32_t j = 0u; j < i; j++) {
+                qpl_fini_job(get_job(j));
+            }
+
+            return status;
+        }
+    }
+
+    own_indexed_decompression_context context;
+
+    context.source_ptr       = source_ptr;
+    context.source_size      = source_size;
+    context.table_ptr        = table_ptr;
+    context.mini_block_size  = mini_block_bytes;
+    context.destination_ptr  = destination_ptr;
+    context.destination_size = destination_size;
+    context.next_mini_block.store(0u);
+    context.output_size.store(0u);
+    context.status.store(QPL_STS_OK);
+
+    // The calling thread takes the mini-blocks too, so they are decompressed even if no worker is started
+    auto task = [&](uint32_t task_index) noexcept {
+        own_decompress_mini_blocks(get_job(task_index), context);
+    };
+
+    qpl::ml::util::thread_pool::get_instance().run(threads_count, task);
+
+    for (uint32_t i = 0u; i < threads_count; i++) {
+        qpl_fini_job(get_job(i));
+    }
+
+    status = static_cast<qpl_status>(context.status.load());
+
+    if (QPL_STS_OK == status) {
+        *output_size_ptr = context.output_size.load();
+    }
+
+    return status;
+}
+
+}
@@ -57,7 +57,7 @@ static inline bool is_dictionary(const qpl_job *const job_ptr) noexcept {
 }
 
 static inline bool is_high_level_compression(const qpl_job *const job_ptr) noexcept{
-    return (qpl_op_compress == job_ptr->op) && (qpl_high_level == job_ptr->level);
+    return (qpl_op_compress == job_ptr->op) && (qpl_default_level != job_ptr->level);
 }
 
 static inline bool is_canned_mode_compression(const qpl_job *const job_ptr) noexcept {
@@ -98,6 +98,28 @@ static inline bool is_compression(const qpl_job *const job_ptr) noexcept {
     return job_ptr->op == qpl_op_compress;
 }
 
+static inline bool is_parallel_compression(const qpl_job *const job_ptr) noexcept {
+    const uint32_t unsupported_flags = QPL_FLAG_CANNED_MODE | QPL_FLAG_GEN_LITERALS;
+
+    return is_compression(job_ptr) &&
+           (QPL_FLAG_PARALLEL & job_ptr->flags) &&
+           !(unsupported_flags & job_ptr->flags) &&
+           is_single_job(job_ptr) &&
+           !is_indexing_enabled(job_ptr) &&
+           !is_dictionary(job_ptr);
+}
+
+static inline bool is_parallel_decompression(const qpl_job *const job_ptr) noexcept {
+    const uint32_t unsupported_flags = QPL_FLAG_NO_HDRS | QPL_FLAG_RND_ACCESS | QPL_FLAG_CANNED_MODE;
+
+    return is_decompression(job_ptr) &&
+           (QPL_FLAG_PARALLEL & job_ptr->flags) &&
+           (QPL_FLAG_GZIP_MODE & job_ptr->flags) &&
+           !(unsupported_flags & job_ptr->flags) &&
+           is_single_job(job_ptr) &&
+           !is_dictionary(job_ptr);
+}
+
 static inline bool is_extract(const qpl_job *const job_ptr) noexcept {
     return qpl_op_extract == job_ptr->op;
 }
@@ -118,6 +140,37 @@ static inline bool is_zlib_flag_set(const qpl_job *const job_ptr) noexcept {
     return QPL_FLAG_ZLIB_MODE & job_ptr->flags;
 }
 
+static inline auto get_operation_class(const qpl_job *const job_ptr) noexcept -> uint32_t {
+    switch (job_ptr->op) {
+        case qpl_op_compress: {
+            return QPL_OP_CLASS_COMPRESS;
+        }
+        case qpl_op_decompress: {
+            return QPL_OP_CLASS_DECOMPRESS;
+        }
+        case qpl_op_crc64: {
+            return QPL_OP_CLASS_CRC64;
+        }
+        default: {
+            return QPL_OP_CLASS_ANALYTICS;
+        }
+    }
+}
+
+static inline bool is_operation_class_initialized(const qpl_job *const job_ptr) noexcept {
+    return job_ptr->data_ptr.op_mask & get_operation_class(job_ptr);
+}
+
+static inline bool is_wide_analytics(const qpl_job *const job_ptr) noexcept {
+    return (QPL_OP_CLASS_ANALYTICS == get_operation_class(job_ptr))
+           && (job_ptr->src1_bit_width > ml::limits::max_bit_width);
+}
+
+static inline bool is_parquet_rle_output(const qpl_job *const job_ptr) noexcept {
+    return (QPL_OP_CLASS_ANALYTICS == get_operation_class(job_ptr))
+           && (QPL_FLAG_OUT_PARQUET_RLE & job_ptr->flags);
+}
+
 static inline bool is_verification_supported(const qpl_job *const qpl_job_ptr) noexcept {
     bool stream_should_be_verified = false;
 
@@ -133,7 +186,9 @@ static inline bool is_verification_supported(const qpl_job *const qpl_job_ptr) n
 static inline bool hardware_supported(const qpl_job *const qpl_ptr) {
     return ((qpl_path_hardware == qpl_ptr->data_ptr.path || qpl_path_auto == qpl_ptr->data_ptr.path)
             && !is_high_level_compression(qpl_ptr)
-            && !is_zlib_flag_set(qpl_ptr));
+            && !is_zlib_flag_set(qpl_ptr)
+            && !is_wide_analytics(qpl_ptr)
+            && !is_parquet_rle_output(qpl_ptr));
 }
 
 // ------ JOB SETTERS ------ //
@@ -37,20 +37,29 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
     QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.analytics_state_ptr);
     QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.hw_state_ptr);
     QPL_BAD_OP_RET(qpl_job_ptr->op);
+    OWN_RETURN_ERROR(!job::is_operation_class_initialized(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
 
     uint32_t status = QPL_STS_OK;
 
     qpl_path_t path = qpl_job_ptr->data_ptr.path;
 
+    // Set if the auto path job falls back to the software path, qpl_wait_job reports its status then
+    qpl_hw_state *fallback_state_ptr = nullptr;
+
     if (qpl_path_hardware == path) {
-        if ((qpl_op_compress == qpl_job_ptr->op) && (qpl_high_level == qpl_job_ptr->level)) {
+        if ((qpl_op_compress == qpl_job_ptr->op) && (qpl_default_level != qpl_job_ptr->level)) {
             return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
         }
-        if (QPL_FLAG_ZLIB_MODE & qpl_job_ptr->flags) {
+        if ((QPL_FLAG_ZLIB_MODE & qpl_job_ptr->flags) || job::is_parquet_rle_output(qpl_job_ptr)) {
             return QPL_STS_NOT_SUPPORTED_MODE_ERR;
         }
     }
 
+    // Elements wider than 32 bits and the PRLE output are processed on the software path only
+    if (qpl_path_auto == path && (job::is_wide_analytics(qpl_job_ptr) || job::is_parquet_rle_output(qpl_job_ptr))) {
+        qpl_job_ptr->data_ptr.path = qpl_path_software;
+    }
+
     if (qpl_path_hardware == qpl_job_ptr->data_ptr.path || qpl_path_auto == qpl_job_ptr->data_ptr.path) {
         auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
 
@@ -66,11 +75,11 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
         }
 #endif
 
+        state_ptr->job_is_done_in_software = false;
+
         status = hw_submit_job(qpl_job_ptr);
 
-        if (status == QPL_STS_OK) {
-            state_ptr->job_is_submitted = true;
-        }
+        state_ptr->job_is_submitted = (status == QPL_STS_OK);
 
 #if defined(KEEP_DESCRIPTOR_ENABLED)
         if (status == QPL_STS_QUEUES_ARE_BUSY_ERR && qpl_path_hardware == qpl_job_ptr->data_ptr.path) {
@@ -81,6 +90,7 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
         // Call SW-path fallback in case if HW limits are exceeded
         if (status != QPL_STS_OK && qpl_job_ptr->data_ptr.path == qpl_path_auto) {
             qpl_job_ptr->data_ptr.path = qpl_path_software;
+            fallback_state_ptr         = state_ptr;
         } else {
             return static_cast<qpl_status>(status);
         }
@@ -95,7 +105,9 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
         case qpl_op_decompress: {
             status = perform_decompress<qpl::ml::execution_path_t::software>(qpl_job_ptr);
 
-            if (qpl_job_ptr->flags & QPL_FLAG_LAST && QPL_STS_OK == status) {
+            // Inflate accumulates the XOR checksum during decompression, Huffman only streams are checked here
+            if ((qpl_job_ptr->flags & QPL_FLAG_LAST) && (qpl_job_ptr->flags & QPL_FLAG_NO_HDRS)
+                && !(qpl_job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS) && QPL_STS_OK == status) {
                 auto *const data_begin_ptr = qpl_job_ptr->next_out_ptr - qpl_job_ptr->total_out;
                 auto *const data_end_ptr = qpl_job_ptr->next_out_ptr;
 
@@ -128,7 +140,8 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
             if (qpl_job_ptr->param_low > qpl_job_ptr->param_high) {
                 qpl_job_ptr->first_index_min_value = 0u;
 
-                return QPL_STS_OK;
+                status = QPL_STS_OK;
+                break;
             }
 
             status = perform_extract(qpl_job_ptr,
@@ -163,6 +176,11 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
 
     qpl_job_ptr->data_ptr.path = path;
 
+    if (fallback_state_ptr) {
+        fallback_state_ptr->job_is_done_in_software = true;
+        fallback_state_ptr->software_status         = status;
+    }
+
     return static_cast<qpl_status>(status);
 }
 
@@ -191,10 +209,77 @@ QPL_FUN("C" qpl_status, qpl_wait_job, (qpl_job *qpl_job_ptr)) {
     return static_cast<qpl_status>(status);
 }
 
+QPL_FUN("C" qpl_status, qpl_submit_batch, (qpl_job **job_ptrs, uint32_t jobs_count, qpl_status *status_ptr)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(job_ptrs);
+    QPL_BAD_PTR_RET(status_ptr);
+
+    qpl_status batch_status = QPL_STS_OK;
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        qpl_job *job_ptr = job_ptrs[i];
+
+        if (job_ptr && job_ptr->data_ptr.hw_state_ptr && job::hardware_supported(job_ptr)) {
+            // Only jobs that reach the accelerator in this batch are polled by qpl_wait_batch
+            reinterpret_cast<qpl_hw_state *>(job::get_state(job_ptr))->job_is_submitted = false;
+        }
+
+        do {
+            status_ptr[i] = qpl_submit_job(job_ptr);
+        } while (QPL_STS_QUEUES_ARE_BUSY_ERR == status_ptr[i]);
+
+        if (QPL_STS_OK == batch_status) {
+            batch_status = status_ptr[i];
+        }
+    }
+
+    return batch_status;
+}
+
+QPL_FUN("C" qpl_status, qpl_wait_batch, (qpl_job **job_ptrs, uint32_t jobs_count, qpl_status *status_ptr)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(job_ptrs);
+    QPL_BAD_PTR_RET(status_ptr);
+
+    uint32_t jobs_in_flight = 0u;
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        if (QPL_STS_OK == status_ptr[i] && job::hardware_supported(job_ptrs[i]) &&
+            reinterpret_cast<qpl_hw_state *>(job::get_state(job_ptrs[i]))->job_is_submitted) {
+            status_ptr[i] = QPL_STS_BEING_PROCESSED;
+            jobs_in_flight++;
+        }
+    }
+
+    // Jobs are reaped in any order, so a slow job does not delay the check of the other ones
+    while (0u != jobs_in_flight) {
+        for (uint32_t i = 0u; i < jobs_count; i++) {
+            if (QPL_STS_BEING_PROCESSED == status_ptr[i]) {
+                status_ptr[i] = hw_check_job(job_ptrs[i]);
+
+                if (QPL_STS_BEING_PROCESSED != status_ptr[i]) {
+                    jobs_in_flight--;
+                }
+            }
+        }
+    }
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        if (QPL_STS_OK != status_ptr[i]) {
+            return status_ptr[i];
+        }
+    }
+
+    return QPL_STS_OK;
+}
+
 QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
     using namespace qpl;
 
     QPL_BAD_PTR_RET(qpl_job_ptr);
+    OWN_RETURN_ERROR(!job::is_operation_class_initialized(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
 
     if (job::hardware_supported(qpl_job_ptr)) {
         auto *const analytics_state_ptr = reinterpret_cast<own_analytics_state_t *>(qpl_job_ptr->data_ptr.analytics_state_ptr);
@@ -240,12 +325,12 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
             return static_cast<qpl_status>(perform_compression<ml::execution_path_t::hardware>(qpl_job_ptr));
         }
 
+        auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
+        state_ptr->job_is_done_in_software = false;
+
         qpl_status status = hw_submit_job(qpl_job_ptr);
 
-        if (status == QPL_STS_OK) {
-            auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
-            state_ptr->job_is_submitted = true;
-        }
+        state_ptr->job_is_submitted = (status == QPL_STS_OK);
 
         return (QPL_STS_OK == status) ? qpl_wait_job(qpl_job_ptr) : status;
     }
@@ -32,34 +32,76 @@
 #include "compression/huffman_only/huffman_only_decompression_state.hpp"
 #include "compression/verification/verification_state.hpp"
 
+/**
+ * @brief Returns size of the middle-layer states required by the operation classes for the given path
+ */
+template <qpl::ml::execution_path_t path>
+static inline uint32_t own_get_middle_layer_states_size(uint32_t op_mask) {
+    using namespace qpl;
+
+    uint32_t size = 0u;
+
+    if (op_mask & QPL_OP_CLASS_COMPRESS) {
+        // Verification of compressed data requires decompression states as well
+        uint32_t deflate_size      = 0;
+        uint32_t huffman_only_size = 0;
+
+        deflate_size += ml::compression::deflate_state<path>::get_buffer_size();
+        deflate_size += ml::compression::verify_state<path>::get_buffer_size();
+        deflate_size += ml::compression::inflate_state<path>::get_buffer_size();
+
+        huffman_only_size += ml::compression::huffman_only_state<path>::get_buffer_size();
+        huffman_only_size += ml::compression::huffman_only_decompression_state<path>::get_buffer_size();
+
+        size = std::max(size, std::max(deflate_size, huffman_only_size));
+    }
+
+    if (op_mask & QPL_OP_CLASS_DECOMPRESS) {
+        size = std::max(size, std::max(ml::compression::inflate_state<path>::get_buffer_size(),
+                                       ml::compression::huffman_only_decompression_state<path>::get_buffer_size()));
+    }
+
+    // Software analytics decompresses compressed input with the inflate state
+    if ((op_mask & QPL_OP_CLASS_ANALYTICS) && ml::execution_path_t::software == path) {
+        size = std::max(size, ml::compression::inflate_state<path>::get_buffer_size());
+    }
+
+    return size;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-QPL_INLINE uint32_t own_get_job_size_compress  (qpl_path_t qpl_path);
-QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t qpl_path);
-QPL_INLINE uint32_t own_get_job_size_analytics (qpl_path_t qpl_path);
-uint32_t            own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path);
+QPL_INLINE uint32_t own_get_job_size_compress  (qpl_path_t qpl_path, uint32_t op_mask);
+QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t qpl_path, uint32_t op_mask);
+QPL_INLINE uint32_t own_get_job_size_analytics (qpl_path_t qpl_path, uint32_t op_mask);
+uint32_t            own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path, uint32_t op_mask);
 
 QPL_INLINE void own_init_compress  (qpl_job *qpl_job_ptr);
 QPL_INLINE void own_init_decompress(qpl_job *qpl_job_ptr);
 QPL_INLINE void own_init_analytics (qpl_job *qpl_job_ptr);
 
 QPL_FUN(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t *job_size_ptr)) {
+    return qpl_get_job_size_ex(qpl_path, QPL_OP_CLASS_ALL, job_size_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_get_job_size_ex, (qpl_path_t qpl_path, uint32_t op_mask, uint32_t *job_size_ptr)) {
     using namespace qpl;
 
     QPL_BAD_PTR_RET(job_size_ptr);
     QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BADARG_RET (0u == op_mask || (op_mask & ~QPL_OP_CLASS_ALL), QPL_STS_OPERATION_ERR);
 
     // qpl_job_ptr can have any alignment,
     // therefore need to add additional bytes to be able to align pointers
     *job_size_ptr  = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT) + QPL_DEFAULT_ALIGNMENT;
 
     // add storage required for internal stuctures
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
 
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
         *job_size_ptr += QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
@@ -69,17 +111,22 @@ QPL_FUN(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t *job_size_p
 }
 
 QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
+    return qpl_init_job_ex(qpl_path, QPL_OP_CLASS_ALL, qpl_job_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_init_job_ex, (qpl_path_t qpl_path, uint32_t op_mask, qpl_job *qpl_job_ptr)) {
     using namespace qpl;
 
     QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
     QPL_BAD_PTR_RET(qpl_job_ptr);
+    QPL_BADARG_RET (0u == op_mask || (op_mask & ~QPL_OP_CLASS_ALL), QPL_STS_OPERATION_ERR);
 
     uint32_t       status                   = QPL_STS_OK;
     const uint32_t job_size                 = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t comp_size                = QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t decomp_size              = QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t analytics_size           = QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t middle_layer_buffer_size = QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t comp_size                = QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t decomp_size              = QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t analytics_size           = QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t middle_layer_buffer_size = QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path, op_mask), QPL_DEFAULT_ALIGNMENT);
 
     core_sw::util::set_zeros((uint8_t *) qpl_job_ptr, job_size);
 
@@ -92,6 +139,7 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
     qpl_job_ptr->data_ptr.middle_layer_buffer_ptr = qpl_job_ptr->data_ptr.analytics_state_ptr + analytics_size;
     qpl_job_ptr->data_ptr.hw_state_ptr            = qpl_job_ptr->data_ptr.middle_layer_buffer_ptr + middle_layer_buffer_size;
     qpl_job_ptr->data_ptr.path                    = qpl_path;
+    qpl_job_ptr->data_ptr.op_mask                 = op_mask;
 
 #ifdef __linux__
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
@@ -125,9 +173,17 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
 
     // initialize internal structures
     // note: ml is just a raw buffer, so no need
-    own_init_compress(qpl_job_ptr);
-    own_init_decompress(qpl_job_ptr);
-    own_init_analytics(qpl_job_ptr);
+    if (op_mask & QPL_OP_CLASS_COMPRESS) {
+        own_init_compress(qpl_job_ptr);
+    }
+
+    if (op_mask & QPL_OP_CLASS_DECOMPRESS) {
+        own_init_decompress(qpl_job_ptr);
+    }
+
+    if (op_mask & QPL_OP_CLASS_ANALYTICS) {
+        own_init_analytics(qpl_job_ptr);
+    }
 
     return static_cast<qpl_status>(status);
 }
@@ -148,7 +204,8 @@ QPL_FUN(qpl_status, qpl_fini_job, (qpl_job *qpl_job_ptr)) {
  *
  * @note Currently not in use
  */
-QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path),
+                                                uint32_t UNREFERENCED_PARAMETER(op_mask)) {
     return 0;
 }
 
@@ -157,7 +214,11 @@ QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t UNREFERENCED_PARAMETE
  *
  * @note Currently only stores middle_layer_compression_style
  */
-QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path), uint32_t op_mask) {
+    if (!(op_mask & QPL_OP_CLASS_COMPRESS)) {
+        return 0u;
+    }
+
     return QPL_ALIGNED_SIZE(sizeof(own_compression_state_t), QPL_DEFAULT_ALIGNMENT);
 }
 
@@ -166,9 +227,13 @@ QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t UNREFERENCED_PARAMETER(
  *
  * @note Holds allocations required for performin various analytics operations.
  */
-QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER(qpl_path), uint32_t op_mask) {
     uint32_t size = 0u;
 
+    if (!(op_mask & QPL_OP_CLASS_ANALYTICS)) {
+        return size;
+    }
+
     size += QPL_ALIGNED_SIZE(sizeof(own_analytics_state_t), QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_INFLATE_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_UNPACK_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
@@ -184,41 +249,21 @@ QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER
  * @note The purpose of middle_layer_buffer is to hold all the states that are constructed in middle-layer,
  * e.g., deflate_state stores internal structures needed for deflate compression,
  * inflate_state store internal structures needed for decompression with defaltes, etc.
- * Job structure currently is supposed to be used for either deflate or huffman only mode,
- * and not both at the same time, so it is not necessary to allocate memory required for both states,
- * hence the std::max usage below.
+ * Job structure currently is supposed to be used for one operation at a time, e.g. either deflate or
+ * huffman only mode, and not both at the same time, so it is not necessary to allocate memory required
+ * for all states, hence the std::max usage. Only the states of the operation classes from op_mask are counted.
  */
-uint32_t own_get_job_size_middle_layer_buffer(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+uint32_t own_get_job_size_middle_layer_buffer(qpl_path_t UNREFERENCED_PARAMETER(qpl_path), uint32_t op_mask) {
     using namespace qpl;
 
     uint32_t size = 0u;
 
     if (qpl_path_software == qpl_path || qpl_path_auto == qpl_path) {
-        uint32_t deflate_size      = 0;
-        uint32_t huffman_only_size = 0;
-
-        deflate_size += ml::compression::deflate_state<ml::execution_path_t::software>::get_buffer_size();
-        deflate_size += ml::compression::verify_state<ml::execution_path_t::software>::get_buffer_size();
-        deflate_size += ml::compression::inflate_state<ml::execution_path_t::software>::get_buffer_size();
-
-        huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::software>::get_buffer_size();
-        huffman_only_size += ml::compression::huffman_only_decompression_state<ml::execution_path_t::software>::get_buffer_size();
-
-        size += std::max(deflate_size, huffman_only_size);
+        size += own_get_middle_layer_states_size<ml::execution_path_t::software>(op_mask);
     }
 
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
-        uint32_t deflate_size      = 0;
-        uint32_t huffman_only_size = 0;
-
-        deflate_size += ml::compression::deflate_state<ml::execution_path_t::hardware>::get_buffer_size();
-        deflate_size += ml::compression::verify_state<ml::execution_path_t::hardware>::get_buffer_size();
-        deflate_size += ml::compression::inflate_state<ml::execution_path_t::hardware>::get_buffer_size();
-
-        huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::hardware>::get_buffer_size();
-        huffman_only_size += ml::compression::huffman_only_decompression_state<ml::execution_path_t::hardware>::get_buffer_size();
-
-        size += std::max(deflate_size, huffman_only_size);
+        size += own_get_middle_layer_states_size<ml::execution_path_t::hardware>(op_mask);
     }
 
     return size;
@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#endif
+
+#include "qpl/qpl.h"
+#include "simple_memory_ops.hpp"
+#include "dispatcher/numa.hpp"
+
+// Legacy
+#include "own_defs.h"
+
+/**
+ * @brief Pool header, placed at the beginning of the pool memory and followed by the free list and the jobs
+ *
+ * @details Free jobs form a lock-free stack. The head stores the index of the top job in the low 32 bits
+ *          and a modification counter in the high 32 bits, so a job that is released and acquired again
+ *          between the load and the compare-exchange of another thread does not corrupt the stack.
+ */
+struct qpl_job_pool {
+    std::atomic<uint64_t> head;                /**< Modification counter and index of the top free job */
+    std::atomic<uint32_t> *next_ptr;           /**< Index of the next free job for every job of the pool */
+    uint8_t               *jobs_ptr;           /**< First job of the pool */
+    size_t                allocated_size;      /**< Size of the pool memory */
+    uint32_t              job_stride;          /**< Distance between two neighbouring jobs */
+    uint32_t              capacity;            /**< Number of jobs in the pool */
+    int32_t               numa_node;           /**< NUMA node of the pool memory, -1 if unknown */
+};
+
+namespace {
+
+constexpr uint32_t own_job_pool_empty_index = UINT32_MAX;
+constexpr uint32_t own_job_pool_max_nodes   = 1024u;
+
+inline auto own_job_pool_pack_head(uint64_t old_head, uint32_t index) noexcept -> uint64_t {
+    return (((old_head >> 32u) + 1u) << 32u) | index;
+}
+
+/**
+ * @brief Allocates zeroed memory that is placed on numa_node when the pages are touched for the first time
+ *
+ * @note The placement is a preference, the memory is still allocated if the node has no free pages
+ */
+auto own_job_pool_allocate(size_t size, int32_t numa_node) noexcept -> void * {
+#if defined(__linux__)
+    void *memory_ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == memory_ptr) {
+        return nullptr;
+    }
+
+    if (numa_node >= 0 && static_cast<uint32_t>(numa_node) < own_job_pool_max_nodes) {
+        constexpr int      mpol_preferred = 1;
+        constexpr uint32_t mask_bits      = 8u * sizeof(unsigned long);
+        unsigned long      node_mask[own_job_pool_max_nodes / mask_bits] = {};
+
+        node_mask[numa_node / mask_bits] = 1ul << (numa_node % mask_bits);
+
+        // Kernels without NUMA support fail the call, the memory is placed by the default policy then
+        syscall(SYS_mbind, memory_ptr, size, mpol_preferred, node_mask, own_job_pool_max_nodes + 1u, 0u);
+    }
+
+    return memory_ptr;
+#else
+    void *memory_ptr = std::calloc(1u, size);
+
+    return memory_ptr;
+#endif
+}
+
+void own_job_pool_free(void *memory_ptr, size_t size) noexcept {
+#if defined(__linux__)
+    munmap(memory_ptr, size);
+#else
+    (void) size;
+    std::free(memory_ptr);
+#endif
+}
+
+}
+
+extern "C" {
+
+QPL_FUN(qpl_status, qpl_job_pool_create, (qpl_path_t qpl_path,
+                                          uint32_t capacity,
+                                          int32_t numa_node,
+                                          qpl_job_pool_t *pool_ptr)) {
+    using namespace qpl;
+
+    QPL_BADARG_RET(qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BAD_PTR_RET(pool_ptr);
+    QPL_BADARG_RET(0u == capacity || own_job_pool_empty_index == capacity, QPL_STS_SIZE_ERR);
+
+    *pool_ptr = nullptr;
+
+    uint32_t job_size = 0u;
+    auto     status   = qpl_get_job_size(qpl_path, &job_size);
+
+    if (QPL_STS_OK != status) {
+        return status;
+    }
+
+    if (numa_node < 0) {
+        numa_node = ml::util::get_numa_id();
+    }
+
+    // Every job gets its own cache lines, qpl_init_job aligns the internal buffers by itself
+    const uint32_t job_stride  = QPL_ALIGNED_SIZE(job_size, QPL_DEFAULT_ALIGNMENT);
+    const size_t   header_size = QPL_ALIGNED_SIZE(sizeof(qpl_job_pool), QPL_DEFAULT_ALIGNMENT);
+    const size_t   list_size   = QPL_ALIGNED_SIZE(sizeof(std::atomic<uint32_t>) * capacity, QPL_DEFAULT_ALIGNMENT);
+    const size_t   total_size  = header_size + list_size + static_cast<size_t>(job_stride) * capacity;
+
+    auto *memory_ptr = static_cast<uint8_t *>(own_job_pool_allocate(total_size, numa_node));
+
+    if (!memory_ptr) {
+        return QPL_STS_OBJECT_ALLOCATION_ERR;
+    }
+
+    auto *pool = new (memory_ptr) qpl_job_pool();
+
+    pool->next_ptr       = reinterpret_cast<std::atomic<uint32_t> *>(memory_ptr + header_size);
+    pool->jobs_ptr       = memory_ptr + header_size + list_size;
+    pool->allocated_size = total_size;
+    pool->job_stride     = job_stride;
+    pool->capacity       = capacity;
+    pool->numa_node      = numa_node;
+
+    for (uint32_t i = 0u; i < capacity; i++) {
+        auto *job_ptr = reinterpret_cast<qpl_job *>(pool->jobs_ptr + static_cast<size_t>(job_stride) * i);
+
+        status = qpl_init_job(qpl_path, job_ptr);
+
+        if (QPL_STS_OK != status) {
+            for (uint32_t j = 0u; j < i; j++) {
+                qpl_fini_job(reinterpret_cast<qpl_job *>(pool->jobs_ptr + static_cast<size_t>(job_stride) * j));
+            }
+
+            own_job_pool_free(memory_ptr, total_size);
+
+            return status;
+        }
+
+        job_ptr->numa_id = numa_node;
+
+        new (&pool->next_ptr[i]) std::atomic<uint32_t>(i + 1u < capacity ? i + 1u : own_job_pool_empty_index);
+    }
+
+    pool->head.store(0u, std::memory_order_release);
+
+    *pool_ptr = pool;
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN(qpl_status, qpl_job_pool_acquire, (qpl_job_pool_t pool, qpl_job **job_ptr)) {
+    QPL_BAD_PTR_RET(pool);
+    QPL_BAD_PTR_RET(job_ptr);
+
+    uint64_t head = pool->head.load(std::memory_order_acquire);
+    uint32_t index;
+
+    do {
+        index = static_cast<uint32_t>(head);
+
+        if (own_job_pool_empty_index == index) {
+            *job_ptr = nullptr;
+
+            return QPL_STS_JOB_POOL_IS_EMPTY_ERR;
+        }
+    } while (!pool->head.compare_exchange_weak(head,
+                                               own_job_pool_pack_head(head, pool->next_ptr[index].load(std::memory_order_relaxed)),
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire));
+
+    *job_ptr = reinterpret_cast<qpl_job *>(pool->jobs_ptr + static_cast<size_t>(pool->job_stride) * index);
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN(qpl_status, qpl_job_pool_release, (qpl_job_pool_t pool, qpl_job *job_ptr)) {
+    QPL_BAD_PTR_RET(pool);
+    QPL_BAD_PTR_RET(job_ptr);
+
+    auto *const job_begin_ptr = reinterpret_cast<uint8_t *>(job_ptr);
+    auto *const jobs_end_ptr  = pool->jobs_ptr + static_cast<size_t>(pool->job_stride) * pool->capacity;
+
+    QPL_BADARG_RET(job_begin_ptr < pool->jobs_ptr || job_begin_ptr >= jobs_end_ptr, QPL_STS_INVALID_PARAM_ERR);
+    QPL_BADARG_RET(0u != (job_begin_ptr - pool->jobs_ptr) % pool->job_stride, QPL_STS_INVALID_PARAM_ERR);
+
+    const auto index = static_cast<uint32_t>((job_begin_ptr - pool->jobs_ptr) / pool->job_stride);
+
+    // Internal states and pointers to them stay valid, so only the public fields are reset
+    qpl::core_sw::util::set_zeros(job_begin_ptr, static_cast<uint32_t>(offsetof(qpl_job, numa_id)));
+    qpl::core_sw::util::set_zeros(reinterpret_cast<uint8_t *>(&job_ptr->param_low_64),
+                                  static_cast<uint32_t>(sizeof(qpl_job) - offsetof(qpl_job, param_low_64)));
+    job_ptr->numa_id = pool->numa_node;
+
+    uint64_t head = pool->head.load(std::memory_order_relaxed);
+
+    do {
+        pool->next_ptr[index].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+    } while (!pool->head.compare_exchange_weak(head,
+                                               own_job_pool_pack_head(head, index),
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN(qpl_status, qpl_job_pool_destroy, (qpl_job_pool_t pool)) {
+    QPL_BAD_PTR_RET(pool);
+
+    auto status = QPL_STS_OK;
+
+    for (uint32_t i = 0u; i < pool->capacity; i++) {
+        auto fini_status = qpl_fini_job(reinterpret_cast<qpl_job *>(pool->jobs_ptr + static_cast<size_t>(pool->job_stride) * i));
+
+        if (QPL_STS_OK == status) {
+            status = fini_status;
+        }
+    }
+
+    own_job_pool_free(pool, pool->allocated_size);
+
+    return status;
+}
+
+}
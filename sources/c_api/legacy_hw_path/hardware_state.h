@@ -79,6 +79,8 @@ typedef struct {
     uint32_t                 descriptor_not_submitted;
     bool                     job_is_submitted;
     uint32_t                 verify_aecs_hw_read_offset;                   /**< AECS read offset for verify AECS */
+    bool                     job_is_done_in_software;                      /**< Auto path job fell back to the software path */
+    uint32_t                 software_status;                              /**< Status of the software fallback for hw_check_job */
 } qpl_hw_state;
 
 #ifdef __cplusplus
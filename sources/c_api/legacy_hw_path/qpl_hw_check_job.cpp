@@ -249,7 +249,9 @@ extern "C" qpl_status hw_check_job (qpl_job * qpl_job_ptr) {
     auto *cfg_ptr  = GET_DCFG(state_ptr);
 
     if (!state_ptr->job_is_submitted) {
-        return QPL_STS_JOB_NOT_SUBMITTED;
+        // The auto path job was completed by the software path on submission
+        return (state_ptr->job_is_done_in_software) ? static_cast<qpl_status>(state_ptr->software_status)
+                                                    : QPL_STS_JOB_NOT_SUBMITTED;
     }
 
     if (0u == comp_ptr->status) {
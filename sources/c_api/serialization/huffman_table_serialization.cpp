@@ -31,6 +31,12 @@ extern "C" {
  * This could be improved in the future if necessary by introducing
  * size_t flatten_table_size(const T &table) {}, with T covering various internal structures
  * such as qplc_huffman_table_default_format, isal_hufftables, hw_compression_huffman_table, etc.
+ *
+ * Storage scheme for a table serialized in compact format:
+ * |meta structure|deflate header|
+ *
+ * The format is marked by serialization::compact_format_flag in the stored meta.flags,
+ * both tables are rebuilt from the code lengths stored in the deflate header during deserialization.
  */
 
 /**
@@ -46,9 +52,6 @@ qpl_status qpl_huffman_table_get_serialized_size(const qpl_huffman_table_t table
     OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(size_ptr))
     QPL_BADARG_RET(options.format > serialization_raw, QPL_STS_SERIALIZATION_FORMAT_ERROR)
 
-    if (options.format != serialization_raw)
-        return QPL_STS_NOT_SUPPORTED_MODE_ERR;
-
     auto meta_ptr = reinterpret_cast<huffman_table_meta_t*>(table);
     if (meta_ptr->algorithm != compression_algorithm_e::deflate)
         return QPL_STS_NOT_SUPPORTED_MODE_ERR;
@@ -57,6 +60,14 @@ qpl_status qpl_huffman_table_get_serialized_size(const qpl_huffman_table_t table
     size_t meta_size = 0;
     qpl::ml::serialization::get_meta_size(*meta_ptr, &meta_size);
 
+    if (options.format == serialization_compact) {
+        auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(table);
+
+        *size_ptr = meta_size + table_impl->get_compact_stream_size();
+
+        return QPL_STS_OK;
+    }
+
     // todo: consider moving to a separate function to get table sizes,
     //       might be useful for the future, if we decide to use actual
     //       flatten size vs sizeof(struct) or if the internal table impl
@@ -98,21 +109,32 @@ qpl_status qpl_huffman_table_serialize(const qpl_huffman_table_t table,
     if (stream_buffer_size == 0)
         return QPL_STS_SIZE_ERR;
 
-    if (options.format != serialization_raw)
-        return QPL_STS_NOT_SUPPORTED_MODE_ERR;
-
     auto meta_ptr = reinterpret_cast<huffman_table_meta_t*>(table);
     if (meta_ptr->algorithm != compression_algorithm_e::deflate)
         return QPL_STS_NOT_SUPPORTED_MODE_ERR;
 
+    size_t offset = 0;
+    qpl::ml::serialization::get_meta_size(*meta_ptr, &offset);
+
+    if (options.format == serialization_compact) {
+        auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(table);
+
+        if (stream_buffer_size < offset + table_impl->get_compact_stream_size())
+            return QPL_STS_SIZE_ERR;
+
+        huffman_table_meta_t compact_meta = *meta_ptr;
+        compact_meta.flags |= qpl::ml::serialization::compact_format_flag;
+
+        qpl::ml::serialization::serialize_meta(compact_meta, stream_buffer);
+
+        return static_cast<qpl_status>(table_impl->write_to_compact_stream(stream_buffer + offset));
+    }
+
     // todo: move impl to a special namespace to reflect meta struct version,
     // to accommodate future implementations
     // e.g. qpl::ml::serialization::v1::serialize_meta
     qpl::ml::serialization::serialize_meta(*meta_ptr, stream_buffer);
 
-    size_t offset = 0;
-    qpl::ml::serialization::get_meta_size(*meta_ptr, &offset);
-
     if (meta_ptr->algorithm == compression_algorithm_e::deflate) {
         auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(table);
 
@@ -196,10 +218,14 @@ qpl_status qpl_huffman_table_deserialize(const uint8_t *const stream_buffer,
     size_t offset = 0;
     qpl::ml::serialization::get_meta_size(*meta_ptr, &offset);
 
+    const bool is_compact = meta_ptr->flags & qpl::ml::serialization::compact_format_flag;
+
     if (meta_ptr->algorithm == compression_algorithm_e::deflate) {
         auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::deflate>*>(*table_ptr);
 
-        status = static_cast<qpl_status>(table_impl->init_with_stream(stream_buffer + offset));
+        status = is_compact
+                 ? static_cast<qpl_status>(table_impl->init_with_compact_stream(stream_buffer + offset))
+                 : static_cast<qpl_status>(table_impl->init_with_stream(stream_buffer + offset));
     }
     if (meta_ptr->algorithm == compression_algorithm_e::huffman_only) {
         auto table_impl = reinterpret_cast<huffman_table_t<compression_algorithm_e::huffman_only>*>(*table_ptr);
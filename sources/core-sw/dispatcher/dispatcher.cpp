@@ -37,12 +37,15 @@ unsigned long long _xgetbv(unsigned int index) {
 #define CPUID_AVX512VL      0x80000000
 #define CPUID_AVX512BW      0x40000000
 #define CPUID_AVX512DQ      0x00020000
+#define CPUID_AVX2          0x00000020
+#define CPUID_BMI2          0x00000100
 #define EXC_OSXSAVE         0x08000000 // 27th  bit
 
 // CPUID_AVX512_MASK covers all the instructions used in middle-layer.
 // Intel® Intelligent Storage Acceleration Library (Intel® ISA-L) component has
 // a standalone dispatching logic and has its own masks.
 #define CPUID_AVX512_MASK (CPUID_AVX512F | CPUID_AVX512CD | CPUID_AVX512VL | CPUID_AVX512BW | CPUID_AVX512DQ)
+#define CPUID_AVX2_MASK   (CPUID_AVX2 | CPUID_BMI2)
 
 namespace qpl::core_sw::dispatcher {
 class kernel_dispatcher_singleton
@@ -56,63 +59,115 @@ public:
 static kernel_dispatcher_singleton g_kernel_dispatcher_singleton;
 
 extern unpack_table_t px_unpack_table;
+extern unpack_table_t avx2_unpack_table;
 extern unpack_table_t avx512_unpack_table;
 
 extern pack_index_table_t px_pack_index_table;
+extern pack_index_table_t avx2_pack_index_table;
 extern pack_index_table_t avx512_pack_index_table;
 
 extern unpack_prle_table_t px_unpack_prle_table;
+extern unpack_prle_table_t avx2_unpack_prle_table;
 extern unpack_prle_table_t avx512_unpack_prle_table;
 
+extern prle_run_length_table_t px_prle_run_length_table;
+extern prle_run_length_table_t avx2_prle_run_length_table;
+extern prle_run_length_table_t avx512_prle_run_length_table;
+
+extern prle_find_equal_octet_table_t px_prle_find_equal_octet_table;
+extern prle_find_equal_octet_table_t avx2_prle_find_equal_octet_table;
+extern prle_find_equal_octet_table_t avx512_prle_find_equal_octet_table;
+
 extern scan_i_table_t px_scan_i_table;
+extern scan_i_table_t avx2_scan_i_table;
 extern scan_i_table_t avx512_scan_i_table;
 
 extern scan_table_t px_scan_table;
+extern scan_table_t avx2_scan_table;
 extern scan_table_t avx512_scan_table;
 
+extern scan_nu1u_table_t px_scan_nu1u_table;
+extern scan_nu1u_table_t avx2_scan_nu1u_table;
+extern scan_nu1u_table_t avx512_scan_nu1u_table;
+
+extern scan_64u_i_table_t px_scan_64u_i_table;
+extern scan_64u_i_table_t avx2_scan_64u_i_table;
+extern scan_64u_i_table_t avx512_scan_64u_i_table;
+
 extern pack_table_t px_pack_table;
+extern pack_table_t avx2_pack_table;
 extern pack_table_t avx512_pack_table;
 
 extern extract_table_t px_extract_table;
+extern extract_table_t avx2_extract_table;
 extern extract_table_t avx512_extract_table;
 
 extern extract_i_table_t px_extract_i_table;
+extern extract_i_table_t avx2_extract_i_table;
 extern extract_i_table_t avx512_extract_i_table;
 
 extern aggregates_table_t px_aggregates_table;
+extern aggregates_table_t avx2_aggregates_table;
 extern aggregates_table_t avx512_aggregates_table;
 
+extern aggregates_64u_table_t px_aggregates_64u_table;
+extern aggregates_64u_table_t avx2_aggregates_64u_table;
+extern aggregates_64u_table_t avx512_aggregates_64u_table;
+
 extern select_table_t px_select_table;
+extern select_table_t avx2_select_table;
 extern select_table_t avx512_select_table;
 
 extern select_i_table_t px_select_i_table;
+extern select_i_table_t avx2_select_i_table;
 extern select_i_table_t avx512_select_i_table;
 
+extern select_bit_mask_table_t px_select_bit_mask_table;
+extern select_bit_mask_table_t avx2_select_bit_mask_table;
+extern select_bit_mask_table_t avx512_select_bit_mask_table;
+
 extern expand_table_t px_expand_table;
+extern expand_table_t avx2_expand_table;
 extern expand_table_t avx512_expand_table;
 
 extern memory_copy_table_t px_memory_copy_table;
+extern memory_copy_table_t avx2_memory_copy_table;
 extern memory_copy_table_t avx512_memory_copy_table;
 
 extern zero_table_t px_zero_table;
+extern zero_table_t avx2_zero_table;
 extern zero_table_t avx512_zero_table;
 
 extern move_table_t px_move_table;
+extern move_table_t avx2_move_table;
 extern move_table_t avx512_move_table;
 
 extern crc64_table_t px_crc64_table;
+extern crc64_table_t avx2_crc64_table;
 extern crc64_table_t avx512_crc64_table;
 
+extern crc64_init_context_table_t px_crc64_init_context_table;
+extern crc64_init_context_table_t avx2_crc64_init_context_table;
+extern crc64_init_context_table_t avx512_crc64_init_context_table;
+
+extern crc64_with_context_table_t px_crc64_with_context_table;
+extern crc64_with_context_table_t avx2_crc64_with_context_table;
+extern crc64_with_context_table_t avx512_crc64_with_context_table;
+
 extern xor_checksum_table_t px_xor_checksum_table;
+extern xor_checksum_table_t avx2_xor_checksum_table;
 extern xor_checksum_table_t avx512_xor_checksum_table;
 
 extern deflate_table_t px_deflate_table;
+extern deflate_table_t avx2_deflate_table;
 extern deflate_table_t avx512_deflate_table;
 
 extern deflate_fix_table_t px_deflate_fix_table;
+extern deflate_fix_table_t avx2_deflate_fix_table;
 extern deflate_fix_table_t avx512_deflate_fix_table;
 
 extern setup_dictionary_table_t px_setup_dictionary_table;
+extern setup_dictionary_table_t avx2_setup_dictionary_table;
 extern setup_dictionary_table_t avx512_setup_dictionary_table;
 
 
@@ -121,6 +176,7 @@ auto detect_platform() -> arch_t {
     int    cpu_info[4];
     cpuid(cpu_info, 7);
     bool avx512_support_cpu  = ((cpu_info[1] & CPUID_AVX512_MASK) == CPUID_AVX512_MASK);
+    bool avx2_support_cpu    = ((cpu_info[1] & CPUID_AVX2_MASK) == CPUID_AVX2_MASK);
 
     cpuid(cpu_info, 1);
     bool os_uses_XSAVE_XSTORE = cpu_info[2] & EXC_OSXSAVE;
@@ -128,10 +184,14 @@ auto detect_platform() -> arch_t {
     // Check if XGETBV enabled for application use
     if (os_uses_XSAVE_XSTORE) {
         unsigned long long xcr_feature_mask = _xgetbv(0);
-        // Check if OPMASK state and ZMM state are enabled
-        if ((xcr_feature_mask & 0xe0) == 0xe0) {
-             // Check if XMM state and YMM state are enabled
-             if ((xcr_feature_mask & 0x6) == 0x6) {
+        // Check if XMM state and YMM state are enabled
+        if ((xcr_feature_mask & 0x6) == 0x6) {
+            // Check if AVX2 features are supported
+            if (avx2_support_cpu) {
+                detected_platform = arch_t::avx2_arch;
+            }
+            // Check if OPMASK state and ZMM state are enabled
+            if ((xcr_feature_mask & 0xe0) == 0xe0) {
                 // Check if AVX512 features are supported
                 if (avx512_support_cpu) {
                     detected_platform = arch_t::avx512_arch;
@@ -144,8 +204,8 @@ auto detect_platform() -> arch_t {
 }
 
 auto get_unpack_index(const uint32_t flag_be, const uint32_t bit_width) -> uint32_t {
-    uint32_t input_be_shift = (flag_be) ? 32u : 0u;
-    // Unpack function table contains 64 entries - starts from 1-32 bit-width for le_format, then 1-32 for BE input
+    uint32_t input_be_shift = (flag_be) ? 64u : 0u;
+    // Unpack function table contains 128 entries - starts from 1-64 bit-width for le_format, then 1-64 for BE input
     uint32_t unpack_index   = input_be_shift + bit_width - 1u;
 
     return unpack_index;
@@ -164,6 +224,10 @@ auto get_unpack_prle_index(const uint32_t bit_width) -> uint32_t {
     return BITS_2_DATA_TYPE_INDEX(bit_width);
 }
 
+auto get_pack_prle_index(const uint32_t bit_width) -> uint32_t {
+    return BITS_2_DATA_TYPE_INDEX(bit_width);
+}
+
 auto kernels_dispatcher::get_instance() noexcept -> kernels_dispatcher & {
     static kernels_dispatcher instance{};
 
@@ -180,22 +244,22 @@ auto get_scan_index(const uint32_t bit_width, const uint32_t scan_flavor_index)
 }
 
 auto get_extract_index(const uint32_t bit_width) -> uint32_t {
-    // Extract function table contains 3 entries for 8u, 16u & 32u unpacked data;
-    uint32_t extract_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+    // Extract function table contains 4 entries for 8u, 16u, 32u & 64u unpacked data;
+    uint32_t extract_index = BITS_2_WIDE_DATA_TYPE_INDEX(bit_width);
 
     return extract_index;
 }
 
 auto get_select_index(const uint32_t bit_width) -> uint32_t {
-    // Select function table contains 3 entries for 8u, 16u & 32u unpacked data;
-    uint32_t select_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+    // Select function table contains 4 entries for 8u, 16u, 32u & 64u unpacked data;
+    uint32_t select_index = BITS_2_WIDE_DATA_TYPE_INDEX(bit_width);
 
     return select_index;
 }
 
 auto get_expand_index(const uint32_t bit_width) -> uint32_t {
-    // Expand function table contains 3 entries for 8u, 16u & 32u unpacked data;
-    uint32_t expand_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+    // Expand function table contains 4 entries for 8u, 16u, 32u & 64u unpacked data;
+    uint32_t expand_index = BITS_2_WIDE_DATA_TYPE_INDEX(bit_width);
 
     return expand_index;
 }
@@ -211,10 +275,13 @@ auto get_pack_bits_index(const uint32_t flag_be,
                          const uint32_t src_bit_width,
                          const uint32_t out_bit_width) -> uint32_t {
     uint32_t pack_array_index = src_bit_width - 1u;
-    uint32_t input_be_shift   = (flag_be) ? 35 : 0u; // 35
-    // Unpack function table contains 70 (2 * 35) entries - starts from 1-32 bit-width
-    // for le_format + 8u16u|8u32u|16u32u cases, then the same for BE input
-    if (out_bit_width) {
+    uint32_t input_be_shift   = (flag_be) ? 67u : 0u;
+    // Pack function table contains 134 (2 * 67) entries - starts from 1-32 bit-width
+    // for le_format + 8u16u|8u32u|16u32u cases + 33-64 bit-width, then the same for BE input
+    if (32u < src_bit_width) {
+        // 64-bit data is always written as is: nominal output only
+        pack_array_index = src_bit_width + 2u;
+    } else if (out_bit_width) {
         // Apply output modification for nominal array output
         if (8u >= src_bit_width) {
             switch (out_bit_width) {
@@ -276,6 +343,14 @@ auto kernels_dispatcher::get_unpack_prle_table() const noexcept -> const unpack_
     return *unpack_prle_table_ptr_;
 }
 
+auto kernels_dispatcher::get_prle_run_length_table() const noexcept -> const prle_run_length_table_t & {
+    return *prle_run_length_table_ptr_;
+}
+
+auto kernels_dispatcher::get_prle_find_equal_octet_table() const noexcept -> const prle_find_equal_octet_table_t & {
+    return *prle_find_equal_octet_table_ptr_;
+}
+
 auto kernels_dispatcher::get_pack_index_table() const noexcept -> const pack_index_table_t & {
     return *pack_index_table_ptr_;
 }
@@ -292,10 +367,22 @@ auto kernels_dispatcher::get_scan_table() const noexcept -> const scan_table_t &
     return *scan_table_ptr_;
 }
 
+auto kernels_dispatcher::get_scan_nu1u_table() const noexcept -> const scan_nu1u_table_t & {
+    return *scan_nu1u_table_ptr_;
+}
+
+auto kernels_dispatcher::get_scan_64u_i_table() const noexcept -> const scan_64u_i_table_t & {
+    return *scan_64u_i_table_ptr_;
+}
+
 auto kernels_dispatcher::get_aggregates_table() const noexcept -> const aggregates_table_t & {
     return *aggregates_table_ptr_;
 }
 
+auto kernels_dispatcher::get_aggregates_64u_table() const noexcept -> const aggregates_64u_table_t & {
+    return *aggregates_64u_table_ptr_;
+}
+
 auto kernels_dispatcher::get_extract_table() const noexcept -> const extract_table_t & {
     return *extract_table_ptr_;
 }
@@ -312,6 +399,10 @@ auto kernels_dispatcher::get_select_i_table() const noexcept -> const select_i_t
     return *select_i_table_ptr_;
 }
 
+auto kernels_dispatcher::get_select_bit_mask_table() const noexcept -> const select_bit_mask_table_t & {
+    return *select_bit_mask_table_ptr_;
+}
+
 auto kernels_dispatcher::get_memory_copy_table() const noexcept -> const memory_copy_table_t & {
     return *memory_copy_table_ptr_;
 }
@@ -328,6 +419,14 @@ auto kernels_dispatcher::get_crc64_table() const noexcept -> const crc64_table_t
     return *crc64_table_ptr_;
 }
 
+auto kernels_dispatcher::get_crc64_init_context_table() const noexcept -> const crc64_init_context_table_t & {
+    return *crc64_init_context_table_ptr_;
+}
+
+auto kernels_dispatcher::get_crc64_with_context_table() const noexcept -> const crc64_with_context_table_t & {
+    return *crc64_with_context_table_ptr_;
+}
+
 auto kernels_dispatcher::get_xor_checksum_table() const noexcept -> const xor_checksum_table_t & {
     return *xor_checksum_table_ptr_;
 }
@@ -357,43 +456,90 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             unpack_table_ptr_                = &avx512_unpack_table;
             // This is a bug, should be fixed, avx512_prle kernel fails the tests
             unpack_prle_table_ptr_           = &px_unpack_prle_table;
+            prle_run_length_table_ptr_       = &avx512_prle_run_length_table;
+            prle_find_equal_octet_table_ptr_ = &avx512_prle_find_equal_octet_table;
             pack_index_table_ptr_            = &avx512_pack_index_table;
             pack_table_ptr_                  = &avx512_pack_table;
             scan_i_table_ptr_                = &avx512_scan_i_table;
             scan_table_ptr_                  = &avx512_scan_table;
+            scan_nu1u_table_ptr_             = &avx512_scan_nu1u_table;
+            scan_64u_i_table_ptr_            = &avx512_scan_64u_i_table;
             extract_table_ptr_               = &avx512_extract_table;
             extract_i_table_ptr_             = &avx512_extract_i_table;
             aggregates_table_ptr_            = &avx512_aggregates_table;
+            aggregates_64u_table_ptr_        = &avx512_aggregates_64u_table;
             select_table_ptr_                = &avx512_select_table;
             select_i_table_ptr_              = &avx512_select_i_table;
+            select_bit_mask_table_ptr_       = &avx512_select_bit_mask_table;
             expand_table_ptr_                = &avx512_expand_table;
             memory_copy_table_ptr_           = &avx512_memory_copy_table;
             zero_table_ptr_                  = &avx512_zero_table;
             move_table_ptr_                  = &avx512_move_table;
             crc64_table_ptr_                 = &avx512_crc64_table;
+            crc64_init_context_table_ptr_    = &avx512_crc64_init_context_table;
+            crc64_with_context_table_ptr_    = &avx512_crc64_with_context_table;
             xor_checksum_table_ptr_          = &avx512_xor_checksum_table;
             deflate_table_ptr_               = &avx512_deflate_table;
             deflate_fix_table_ptr_           = &avx512_deflate_fix_table;
             setup_dictionary_table_ptr_      = &avx512_setup_dictionary_table;
             break;
         }
+        case arch_t::avx2_arch: {
+            unpack_table_ptr_                = &avx2_unpack_table;
+            unpack_prle_table_ptr_           = &avx2_unpack_prle_table;
+            prle_run_length_table_ptr_       = &avx2_prle_run_length_table;
+            prle_find_equal_octet_table_ptr_ = &avx2_prle_find_equal_octet_table;
+            pack_index_table_ptr_            = &avx2_pack_index_table;
+            pack_table_ptr_                  = &avx2_pack_table;
+            scan_i_table_ptr_                = &avx2_scan_i_table;
+            scan_table_ptr_                  = &avx2_scan_table;
+            scan_nu1u_table_ptr_             = &avx2_scan_nu1u_table;
+            scan_64u_i_table_ptr_            = &avx2_scan_64u_i_table;
+            extract_table_ptr_               = &avx2_extract_table;
+            extract_i_table_ptr_             = &avx2_extract_i_table;
+            aggregates_table_ptr_            = &avx2_aggregates_table;
+            aggregates_64u_table_ptr_        = &avx2_aggregates_64u_table;
+            select_table_ptr_                = &avx2_select_table;
+            select_i_table_ptr_              = &avx2_select_i_table;
+            select_bit_mask_table_ptr_       = &avx2_select_bit_mask_table;
+            expand_table_ptr_                = &avx2_expand_table;
+            memory_copy_table_ptr_           = &avx2_memory_copy_table;
+            zero_table_ptr_                  = &avx2_zero_table;
+            move_table_ptr_                  = &avx2_move_table;
+            crc64_table_ptr_                 = &avx2_crc64_table;
+            crc64_init_context_table_ptr_    = &avx2_crc64_init_context_table;
+            crc64_with_context_table_ptr_    = &avx2_crc64_with_context_table;
+            xor_checksum_table_ptr_          = &avx2_xor_checksum_table;
+            deflate_table_ptr_               = &avx2_deflate_table;
+            deflate_fix_table_ptr_           = &avx2_deflate_fix_table;
+            setup_dictionary_table_ptr_      = &avx2_setup_dictionary_table;
+            break;
+        }
         default: {
             unpack_table_ptr_                = &px_unpack_table;
             unpack_prle_table_ptr_           = &px_unpack_prle_table;
+            prle_run_length_table_ptr_       = &px_prle_run_length_table;
+            prle_find_equal_octet_table_ptr_ = &px_prle_find_equal_octet_table;
             pack_index_table_ptr_            = &px_pack_index_table;
             pack_table_ptr_                  = &px_pack_table;
             scan_i_table_ptr_                = &px_scan_i_table;
             scan_table_ptr_                  = &px_scan_table;
+            scan_nu1u_table_ptr_             = &px_scan_nu1u_table;
+            scan_64u_i_table_ptr_            = &px_scan_64u_i_table;
             extract_table_ptr_               = &px_extract_table;
             extract_i_table_ptr_             = &px_extract_i_table;
             aggregates_table_ptr_            = &px_aggregates_table;
+            aggregates_64u_table_ptr_        = &px_aggregates_64u_table;
             select_table_ptr_                = &px_select_table;
             select_i_table_ptr_              = &px_select_i_table;
+            select_bit_mask_table_ptr_       = &px_select_bit_mask_table;
             expand_table_ptr_                = &px_expand_table;
             memory_copy_table_ptr_           = &px_memory_copy_table;
             zero_table_ptr_                  = &px_zero_table;
             move_table_ptr_                  = &px_move_table;
             crc64_table_ptr_                 = &px_crc64_table;
+            crc64_init_context_table_ptr_    = &px_crc64_init_context_table;
+            crc64_with_context_table_ptr_    = &px_crc64_with_context_table;
             xor_checksum_table_ptr_          = &px_xor_checksum_table;
             deflate_table_ptr_               = &px_deflate_table;
             deflate_fix_table_ptr_           = &px_deflate_fix_table;
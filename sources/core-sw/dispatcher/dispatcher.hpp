@@ -25,6 +25,8 @@
 
 #define BITS_2_DATA_TYPE_INDEX(x) (OWN_MIN_((((x) - 1u) >> 3u), 2u))
 
+#define BITS_2_WIDE_DATA_TYPE_INDEX(x) (((x) > 32u) ? 3u : BITS_2_DATA_TYPE_INDEX(x))
+
 namespace qpl::core_sw::dispatcher {
 enum arch_t {
     px_arch     = 0,
@@ -40,6 +42,8 @@ auto get_pack_index(const uint32_t flag_be, const uint32_t out_bit_width, const
 
 auto get_unpack_prle_index(const uint32_t bit_width) -> uint32_t;
 
+auto get_pack_prle_index(const uint32_t bit_width) -> uint32_t;
+
 auto get_scan_index(const uint32_t bit_width, const uint32_t scan_flavor_index) -> uint32_t;
 
 auto get_extract_index(const uint32_t bit_width) -> uint32_t;
@@ -56,43 +60,54 @@ auto get_aggregates_index(const uint32_t src_bit_width) -> uint32_t;
 
 auto get_memory_copy_index(const uint32_t bit_width) -> uint32_t;
 
-using unpack_table_t = std::array<qplc_unpack_bits_t_ptr, 64>;
+using unpack_table_t = std::array<qplc_unpack_bits_t_ptr, 128>;
 
 using pack_index_table_t = std::array<qplc_pack_index_t_ptr, 8>;
 
 using unpack_prle_table_t = std::array<qplc_unpack_prle_t_ptr, 3>;
+using prle_run_length_table_t = std::array<qplc_prle_run_length_t_ptr, 3>;
+using prle_find_equal_octet_table_t = std::array<qplc_prle_find_equal_octet_t_ptr, 3>;
 
 using scan_i_table_t = std::array<qplc_scan_i_t_ptr, 24>;
 using scan_table_t = std::array<qplc_scan_t_ptr, 24>;
+using scan_nu1u_table_t = std::array<qplc_scan_nu1u_t_ptr, 8>;
+using scan_64u_i_table_t = std::array<qplc_scan_64u_i_t_ptr, 8>;
 
-using pack_table_t = std::array<qplc_pack_bits_t_ptr, 70>;
+using pack_table_t = std::array<qplc_pack_bits_t_ptr, 134>;
 
 using extract_table_t = std::array<qplc_extract_t_ptr, 3>;
-using extract_i_table_t = std::array<qplc_extract_i_t_ptr, 3>;
+using extract_i_table_t = std::array<qplc_extract_i_t_ptr, 4>;
 
 using aggregates_table_t = std::array<qplc_aggregates_t_ptr, 4>;
+using aggregates_64u_table_t = std::array<qplc_aggregates_64u_t_ptr, 1>;
 
-using select_table_t = std::array<qplc_select_t_ptr, 3>;
+using select_table_t = std::array<qplc_select_t_ptr, 4>;
 using select_i_table_t = std::array<qplc_select_i_t_ptr, 3>;
+using select_bit_mask_table_t = std::array<qplc_select_bit_mask_t_ptr, 4>;
 
-using expand_table_t = std::array<qplc_expand_t_ptr, 3>;
+using expand_table_t = std::array<qplc_expand_t_ptr, 4>;
 
 using memory_copy_table_t = std::array<qplc_copy_t_ptr, 3>;
 using zero_table_t = std::array<qplc_zero_t_ptr, 1>;
 using move_table_t = std::array<qplc_move_t_ptr, 1>;
 
 using crc64_table_t = std::array<qplc_crc64_t_ptr, 1>;
+using crc64_init_context_table_t = std::array<qplc_crc64_init_context_t_ptr, 1>;
+using crc64_with_context_table_t = std::array<qplc_crc64_with_context_t_ptr, 1>;
 using xor_checksum_table_t = std::array<qplc_xor_checksum_t_ptr, 1>;
 
-using deflate_table_t = std::array<void*, 3u>;
+using deflate_table_t = std::array<void*, 4u>;
 
 using deflate_fix_table_t = std::array<void*, 1u>;
 
 using setup_dictionary_table_t = std::array<void*, 1u>;
 
 using aggregates_function_ptr_t = aggregates_table_t::value_type;
+using aggregates_64u_function_ptr_t = aggregates_64u_table_t::value_type;
 using extract_function_ptr_t    = extract_table_t::value_type;
 using scan_function_ptr         = scan_table_t::value_type;
+using scan_nu1u_function_ptr    = scan_nu1u_table_t::value_type;
+using scan_64u_i_function_ptr   = scan_64u_i_table_t::value_type;
 
 class kernels_dispatcher final {
 public:
@@ -106,16 +121,26 @@ public:
 
     [[nodiscard]] auto get_unpack_prle_table() const noexcept -> const unpack_prle_table_t &;
 
+    [[nodiscard]] auto get_prle_run_length_table() const noexcept -> const prle_run_length_table_t &;
+
+    [[nodiscard]] auto get_prle_find_equal_octet_table() const noexcept -> const prle_find_equal_octet_table_t &;
+
     [[nodiscard]] auto get_pack_index_table() const noexcept -> const pack_index_table_t &;
 
     [[nodiscard]] auto get_pack_table() const noexcept -> const pack_table_t &;
 
     [[nodiscard]] auto get_aggregates_table() const noexcept -> const aggregates_table_t &;
 
+    [[nodiscard]] auto get_aggregates_64u_table() const noexcept -> const aggregates_64u_table_t &;
+
     [[nodiscard]] auto get_scan_i_table() const noexcept -> const scan_i_table_t &;
 
     [[nodiscard]] auto get_scan_table() const noexcept -> const scan_table_t &;
 
+    [[nodiscard]] auto get_scan_nu1u_table() const noexcept -> const scan_nu1u_table_t &;
+
+    [[nodiscard]] auto get_scan_64u_i_table() const noexcept -> const scan_64u_i_table_t &;
+
     [[nodiscard]] auto get_extract_table() const noexcept -> const extract_table_t &;
 
     [[nodiscard]] auto get_extract_i_table() const noexcept -> const extract_i_table_t &;
@@ -124,6 +149,8 @@ public:
 
     [[nodiscard]] auto get_select_i_table() const noexcept -> const select_i_table_t &;
 
+    [[nodiscard]] auto get_select_bit_mask_table() const noexcept -> const select_bit_mask_table_t &;
+
     [[nodiscard]] auto get_expand_table() const noexcept -> const expand_table_t &;
 
     [[nodiscard]] auto get_memory_copy_table() const noexcept -> const memory_copy_table_t &;
@@ -134,6 +161,10 @@ public:
 
     [[nodiscard]] auto get_crc64_table() const noexcept -> const crc64_table_t &;
 
+    [[nodiscard]] auto get_crc64_init_context_table() const noexcept -> const crc64_init_context_table_t &;
+
+    [[nodiscard]] auto get_crc64_with_context_table() const noexcept -> const crc64_with_context_table_t &;
+
     [[nodiscard]] auto get_xor_checksum_table() const noexcept -> const xor_checksum_table_t &;
 
     [[nodiscard]] auto get_deflate_table() const noexcept -> const deflate_table_t &;
@@ -148,20 +179,28 @@ protected:
 private:
     unpack_table_t                  *unpack_table_ptr_                  = nullptr;
     unpack_prle_table_t             *unpack_prle_table_ptr_             = nullptr;
+    prle_run_length_table_t         *prle_run_length_table_ptr_         = nullptr;
+    prle_find_equal_octet_table_t   *prle_find_equal_octet_table_ptr_   = nullptr;
     pack_index_table_t              *pack_index_table_ptr_              = nullptr;
     pack_table_t                    *pack_table_ptr_                    = nullptr;
     scan_i_table_t                  *scan_i_table_ptr_                  = nullptr;
     scan_table_t                    *scan_table_ptr_                    = nullptr;
+    scan_nu1u_table_t               *scan_nu1u_table_ptr_               = nullptr;
+    scan_64u_i_table_t              *scan_64u_i_table_ptr_              = nullptr;
     extract_table_t                 *extract_table_ptr_                 = nullptr;
     extract_i_table_t               *extract_i_table_ptr_               = nullptr;
     aggregates_table_t              *aggregates_table_ptr_              = nullptr;
+    aggregates_64u_table_t          *aggregates_64u_table_ptr_          = nullptr;
     select_table_t                  *select_table_ptr_                  = nullptr;
     select_i_table_t                *select_i_table_ptr_                = nullptr;
+    select_bit_mask_table_t         *select_bit_mask_table_ptr_         = nullptr;
     expand_table_t                  *expand_table_ptr_                  = nullptr;
     memory_copy_table_t             *memory_copy_table_ptr_             = nullptr;
     zero_table_t                    *zero_table_ptr_                    = nullptr;
     move_table_t                    *move_table_ptr_                    = nullptr;
     crc64_table_t                   *crc64_table_ptr_                   = nullptr;
+    crc64_init_context_table_t      *crc64_init_context_table_ptr_      = nullptr;
+    crc64_with_context_table_t      *crc64_with_context_table_ptr_      = nullptr;
     xor_checksum_table_t            *xor_checksum_table_ptr_            = nullptr;
     deflate_table_t                 *deflate_table_ptr_                 = nullptr;
     deflate_fix_table_t             *deflate_fix_table_ptr_             = nullptr;
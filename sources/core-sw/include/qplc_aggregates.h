@@ -36,6 +36,13 @@ typedef void (*qplc_aggregates_t_ptr)(const uint8_t *src_ptr,
                                       uint32_t *sum_ptr,
                                       uint32_t *index_ptr);
 
+typedef void (*qplc_aggregates_64u_t_ptr)(const uint8_t *src_ptr,
+                                          uint32_t length,
+                                          uint64_t *min_value_ptr,
+                                          uint64_t *max_value_ptr,
+                                          uint64_t *sum_ptr,
+                                          uint32_t *index_ptr);
+
 /**
  * @name qplc_bit_aggregates_8u
  *
@@ -100,6 +107,31 @@ OWN_QPLC_API(void, qplc_aggregates_32u, (const uint8_t *src_ptr,
         uint32_t *index_ptr))
 /** @} */
 
+/**
+ * @name qplc_aggregates_64u
+ *
+ * @brief Array-aggregates function for 64u input data, calculates minimum and maximum vector values and
+ *        sum of all vector elements modulo 2^64.
+ *
+ * @param[in]      src_ptr        pointer to source vector
+ * @param[in]      length         length of source vector in elements (qwords)
+ * @param[in,out]  min_value_ptr  pointer to min value over input vector
+ * @param[in,out]  max_value_ptr  pointer to max value over input vector
+ * @param[in,out]  sum_ptr        pointer to the sum of all elements in the source vector
+ * @param[in,out]  index_ptr      is not used (unreferenced parameter)
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_aggregates_64u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint64_t *min_value_ptr,
+        uint64_t *max_value_ptr,
+        uint64_t *sum_ptr,
+        uint32_t *index_ptr))
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -136,16 +136,16 @@ static const qplc_unpack_bits_t_ptr qplc_unpack_bits_array[] = {
 };
 
 /**
- * @brief Packing input data in 8u, 16u or 32u integers format to integers of any-bit-width, LE or BE.
+ * @brief Packing input data in 8u, 16u, 32u or 64u integers format to integers of any-bit-width, LE or BE.
  *
- * @param[in]   src_ptr       pointer to source vector in 8u, 16u or 32u integers format
+ * @param[in]   src_ptr       pointer to source vector in 8u, 16u, 32u or 64u integers format
  * @param[in]   num_elements  number of source integers to pack
  * @param[out]  dst_ptr       pointer to packed data in any-bit-width format (LE or BE)
  * @param[in]   start_bit     bit position in the first byte of destination to start from
  *
  * @note Parameters:  (uint8_t *src_ptr, uint32_t num_elements, uint8_t *dst_ptr, uint32_t start_bit)
- * @note Pack function table contains 70 (2 * 35) entries - starts from 1-32 bit-width for LE + [8u16u|8u32u|16u32u],
- *                                                          then the same for BE output
+ * @note Pack function table contains 134 (2 * 67) entries - starts from 1-32 bit-width for LE + [8u16u|8u32u|16u32u]
+ *                                                            + 33-64 bit-width, then the same for BE output
  * @note Index calculation: outputBeShift = (QPL_FLAG_OUT_BE & qpl_job_ptr->flags) ? 32u : 0u;
  * @note                    packIndex = outputBeShift + bit_width - 1u;
  *
@@ -188,6 +188,38 @@ static const qplc_pack_bits_t_ptr qplc_pack_bits_array[] = {
         CALL_CORE_FUN(qplc_pack_8u16u),
         CALL_CORE_FUN(qplc_pack_8u32u),
         CALL_CORE_FUN(qplc_pack_16u32u),
+        CALL_CORE_FUN(qplc_pack_64u33u),
+        CALL_CORE_FUN(qplc_pack_64u34u),
+        CALL_CORE_FUN(qplc_pack_64u35u),
+        CALL_CORE_FUN(qplc_pack_64u36u),
+        CALL_CORE_FUN(qplc_pack_64u37u),
+        CALL_CORE_FUN(qplc_pack_64u38u),
+        CALL_CORE_FUN(qplc_pack_64u39u),
+        CALL_CORE_FUN(qplc_pack_64u40u),
+        CALL_CORE_FUN(qplc_pack_64u41u),
+        CALL_CORE_FUN(qplc_pack_64u42u),
+        CALL_CORE_FUN(qplc_pack_64u43u),
+        CALL_CORE_FUN(qplc_pack_64u44u),
+        CALL_CORE_FUN(qplc_pack_64u45u),
+        CALL_CORE_FUN(qplc_pack_64u46u),
+        CALL_CORE_FUN(qplc_pack_64u47u),
+        CALL_CORE_FUN(qplc_pack_64u48u),
+        CALL_CORE_FUN(qplc_pack_64u49u),
+        CALL_CORE_FUN(qplc_pack_64u50u),
+        CALL_CORE_FUN(qplc_pack_64u51u),
+        CALL_CORE_FUN(qplc_pack_64u52u),
+        CALL_CORE_FUN(qplc_pack_64u53u),
+        CALL_CORE_FUN(qplc_pack_64u54u),
+        CALL_CORE_FUN(qplc_pack_64u55u),
+        CALL_CORE_FUN(qplc_pack_64u56u),
+        CALL_CORE_FUN(qplc_pack_64u57u),
+        CALL_CORE_FUN(qplc_pack_64u58u),
+        CALL_CORE_FUN(qplc_pack_64u59u),
+        CALL_CORE_FUN(qplc_pack_64u60u),
+        CALL_CORE_FUN(qplc_pack_64u61u),
+        CALL_CORE_FUN(qplc_pack_64u62u),
+        CALL_CORE_FUN(qplc_pack_64u63u),
+        CALL_CORE_FUN(qplc_pack_64u64u),
         // BE starts here
         CALL_CORE_FUN(qplc_pack_be_8u1u),
         CALL_CORE_FUN(qplc_pack_be_8u2u),
@@ -223,7 +255,39 @@ static const qplc_pack_bits_t_ptr qplc_pack_bits_array[] = {
         CALL_CORE_FUN(qplc_pack_be_32u32u),
         CALL_CORE_FUN(qplc_pack_be_8u16u),
         CALL_CORE_FUN(qplc_pack_be_8u32u),
-        CALL_CORE_FUN(qplc_pack_be_16u32u)
+        CALL_CORE_FUN(qplc_pack_be_16u32u),
+        CALL_CORE_FUN(qplc_pack_be_64u33u),
+        CALL_CORE_FUN(qplc_pack_be_64u34u),
+        CALL_CORE_FUN(qplc_pack_be_64u35u),
+        CALL_CORE_FUN(qplc_pack_be_64u36u),
+        CALL_CORE_FUN(qplc_pack_be_64u37u),
+        CALL_CORE_FUN(qplc_pack_be_64u38u),
+        CALL_CORE_FUN(qplc_pack_be_64u39u),
+        CALL_CORE_FUN(qplc_pack_be_64u40u),
+        CALL_CORE_FUN(qplc_pack_be_64u41u),
+        CALL_CORE_FUN(qplc_pack_be_64u42u),
+        CALL_CORE_FUN(qplc_pack_be_64u43u),
+        CALL_CORE_FUN(qplc_pack_be_64u44u),
+        CALL_CORE_FUN(qplc_pack_be_64u45u),
+        CALL_CORE_FUN(qplc_pack_be_64u46u),
+        CALL_CORE_FUN(qplc_pack_be_64u47u),
+        CALL_CORE_FUN(qplc_pack_be_64u48u),
+        CALL_CORE_FUN(qplc_pack_be_64u49u),
+        CALL_CORE_FUN(qplc_pack_be_64u50u),
+        CALL_CORE_FUN(qplc_pack_be_64u51u),
+        CALL_CORE_FUN(qplc_pack_be_64u52u),
+        CALL_CORE_FUN(qplc_pack_be_64u53u),
+        CALL_CORE_FUN(qplc_pack_be_64u54u),
+        CALL_CORE_FUN(qplc_pack_be_64u55u),
+        CALL_CORE_FUN(qplc_pack_be_64u56u),
+        CALL_CORE_FUN(qplc_pack_be_64u57u),
+        CALL_CORE_FUN(qplc_pack_be_64u58u),
+        CALL_CORE_FUN(qplc_pack_be_64u59u),
+        CALL_CORE_FUN(qplc_pack_be_64u60u),
+        CALL_CORE_FUN(qplc_pack_be_64u61u),
+        CALL_CORE_FUN(qplc_pack_be_64u62u),
+        CALL_CORE_FUN(qplc_pack_be_64u63u),
+        CALL_CORE_FUN(qplc_pack_be_64u64u)
 };
 
 /*------- End qplc_api.h -------*/
@@ -13,6 +13,9 @@
  *          - @ref qplc_crc32_byte_8u
  *          - @ref qplc_crc32_with_polynomial_32u
  *          - @ref qplc_xor_checksum_8u
+ *          - @ref qplc_crc64
+ *          - @ref qplc_crc64_init_context
+ *          - @ref qplc_crc64_with_context
  *
  */
 
@@ -25,12 +28,37 @@
 extern "C" {
 #endif
 
+#define QPLC_CRC64_SLICES_COUNT 8u /**< Number of lookup tables used by slicing-by-8 CRC64 calculation */
+
+/**
+ * @brief Polynomial-dependent data that can be computed once and reused for CRC64 calculation
+ *
+ * @note Optimized implementations use folding and Barrett reduction constants,
+ *       generic implementation uses slicing-by-8 lookup tables
+ */
+typedef struct {
+    uint64_t polynomial;                                    /**< 64-bit CRC polynomial */
+    uint64_t fold_constants[4];                             /**< x^T mod polynomial constants for folding */
+    uint64_t barrett_constant;                              /**< floor(x^128 / polynomial) for Barrett reduction */
+    uint64_t slice_tables[QPLC_CRC64_SLICES_COUNT][256];    /**< Lookup tables for slicing-by-8 */
+    uint8_t  be_flag;                                       /**< Endianness the context was built for */
+} qplc_crc64_context;
+
 typedef uint64_t (*qplc_crc64_t_ptr)(const uint8_t *src_ptr,
                                      uint32_t length,
                                      uint64_t polynomial,
                                      uint8_t be_flag,
                                      uint8_t inversion_flag);
 
+typedef void (*qplc_crc64_init_context_t_ptr)(uint64_t polynomial,
+                                              uint8_t be_flag,
+                                              qplc_crc64_context *context_ptr);
+
+typedef uint64_t (*qplc_crc64_with_context_t_ptr)(const uint8_t *src_ptr,
+                                                  uint32_t length,
+                                                  const qplc_crc64_context *context_ptr,
+                                                  uint8_t inversion_flag);
+
 typedef uint32_t (*qplc_xor_checksum_t_ptr)(const uint8_t *buf,
                                             uint32_t len,
                                             uint32_t init_xor);
@@ -69,6 +97,36 @@ OWN_QPLC_API(uint64_t, qplc_crc64, (const uint8_t *src_ptr,
         uint8_t be_flag,
         uint8_t inversion_flag))
 
+/*
+ * @brief Precomputes polynomial-dependent data for @ref qplc_crc64_with_context
+ *
+ * @param[in]  polynomial       - 64-bit CRC polynomial
+ * @param[in]  be_flag          - endianness flag:
+ *                                  0 - little endian format;
+ *                                  1 - big endian format;
+ * @param[out] context_ptr      - pointer to the context to fill
+ */
+OWN_QPLC_API(void, qplc_crc64_init_context, (uint64_t polynomial,
+        uint8_t be_flag,
+        qplc_crc64_context *context_ptr))
+
+/*
+ * @brief CRC64 checksum calculation for data buffer using precomputed context
+ *
+ * @param[in]  src_ptr          - pointer to the data buffer
+ * @param[in]  length           - length of the buffer
+ * @param[in]  context_ptr      - context filled by @ref qplc_crc64_init_context
+ * @param[in]  inversion_flag   - bitwise inversion flag:
+ *                                  0 - no inversion;
+ *                                  1 - bitwise inversion of the initial and final CRC;
+ *
+ * @return CRC64 checksum value
+ */
+OWN_QPLC_API(uint64_t, qplc_crc64_with_context, (const uint8_t *src_ptr,
+        uint32_t length,
+        const qplc_crc64_context *context_ptr,
+        uint8_t inversion_flag))
+
 #ifdef __cplusplus
 }
 #endif
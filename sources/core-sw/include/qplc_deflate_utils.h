@@ -39,6 +39,13 @@ typedef uint32_t(*qplc_slow_deflate_icf_body_t_ptr)(uint8_t *current_ptr,
                                                     isal_mod_hist *histogram_ptr,
                                                     deflate_icf_stream *icf_stream_ptr);
 
+typedef uint32_t(*qplc_optimal_deflate_icf_body_t_ptr)(uint8_t *current_ptr,
+                                                       const uint8_t *const lower_bound_ptr,
+                                                       const uint8_t *const upper_bound_ptr,
+                                                       deflate_hash_table_t *hash_table_ptr,
+                                                       isal_mod_hist *histogram_ptr,
+                                                       deflate_icf_stream *icf_stream_ptr);
+
 typedef void(*qplc_setup_dictionary_t_ptr)(uint8_t *dictionary_ptr,
                                            uint32_t dictionary_size,
                                            deflate_hash_table_t *hash_table_ptr);
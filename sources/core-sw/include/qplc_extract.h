@@ -15,7 +15,7 @@
  * @brief Contains Intel® Query Processing Library (Intel® QPL) Core API for `Extract` operation
  *
  * @details Core APIs implement the following functionalities:
- *      -   Extract analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
+ *      -   Extract analytics operation in-place kernels for 8u, 16u, 32u and 64u input data and 8u output.
  *      -   Extract analytics operation out-of-place kernels for 8u, 16u and 32u input data and 8u output.
  *
  */
@@ -45,7 +45,7 @@ typedef qplc_status_t (*qplc_extract_t_ptr)(const uint8_t *src_ptr,
 /**
  * @name qplc_extract_<input bit-width><output bit-width>_i
  *
- * @brief Extract analytics operation in-place kernels for 8u, 16u and 32u input data
+ * @brief Extract analytics operation in-place kernels for 8u, 16u, 32u and 64u input data
  *
  * @param[in,out]  src_dst_ptr  pointer to source and destination vector (in-place operation)
  * @param[in]      length       length of source and destination vector in elements
@@ -76,6 +76,12 @@ OWN_QPLC_API(qplc_status_t, qplc_extract_32u_i, (uint8_t *src_dst_ptr,
         uint32_t *index_ptr,
         uint32_t low_value,
         uint32_t high_value))
+
+OWN_QPLC_API(qplc_status_t, qplc_extract_64u_i, (uint8_t *src_dst_ptr,
+        uint32_t length,
+        uint32_t *index_ptr,
+        uint32_t low_value,
+        uint32_t high_value))
 /** @} */
 
 /**
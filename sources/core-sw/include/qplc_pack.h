@@ -17,10 +17,11 @@
  * to required output format - nominal bit array, array of integers, or to indexes.
  *
  * @details Core pack APIs implement the following functionalities:
- *      -   Packing kernels for 8u, 16u and 32u input data and 1..32u output data;
- *      -   Packing kernels for 8u, 16u and 32u input data and 1..32u output data in BE format;
+ *      -   Packing kernels for 8u, 16u, 32u and 64u input data and 1..64u output data;
+ *      -   Packing kernels for 8u, 16u, 32u and 64u input data and 1..64u output data in BE format;
  *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation;
- *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation in BE format.
+ *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation in BE format;
+ *      -   Run detection kernels for 8u, 16u and 32u input data used by the PRLE (Parquet RLE) encoder.
  *
  */
 
@@ -44,6 +45,12 @@ typedef qplc_status_t (*qplc_pack_vector_t_ptr)(const uint8_t *src_ptr,
                                                 uint32_t start_bit_or_dst_length,
                                                 uint32_t *index_ptr);
 
+typedef uint32_t (*qplc_prle_run_length_t_ptr)(const uint8_t *src_ptr,
+                                               uint32_t num_elements,
+                                               uint32_t value);
+
+typedef uint32_t (*qplc_prle_find_equal_octet_t_ptr)(const uint8_t *src_ptr,
+                                                     uint32_t num_octets);
 typedef qplc_status_t (*qplc_pack_index_t_ptr)(const uint8_t *src_ptr,
                                                uint32_t num_elements,
                                                uint8_t **pp_dst,
@@ -54,15 +61,15 @@ typedef qplc_status_t (*qplc_pack_index_t_ptr)(const uint8_t *src_ptr,
 /**
  * @name qplc_pack_<byte order><input bit-width><output bit-width>
  *
- * @brief Packing input data in 8u, 16u or 32u integers format to integers of any-bit-width, LE or BE.
+ * @brief Packing input data in 8u, 16u, 32u or 64u integers format to integers of any-bit-width, LE or BE.
  *
- * @param[in]     src_ptr        pointer to source vector in 8u, 16u or 32u integers format
+ * @param[in]     src_ptr        pointer to source vector in 8u, 16u, 32u or 64u integers format
  * @param[in]     num_elements number of source integers to pack
  * @param[out]    dst_ptr        pointer to packed data in any-bit-width format (LE or BE)
  * @param[in]     start_bit    bit position in the first byte of destination to start from
  *
- * @note Pack function table contains 70 (2 * 35) entries - starts from 1-32 bit-width for LE + [8u16u|8u32u|16u32u],
- *       then the same for BE output
+ * @note Pack function table contains 134 (2 * 67) entries - starts from 1-32 bit-width for LE + [8u16u|8u32u|16u32u]
+ *       + 33-64 bit-width, then the same for BE output
  *
  * @return
  *      - n/a (void).
@@ -252,6 +259,166 @@ OWN_QPLC_API(void, qplc_pack_16u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr,
         uint32_t start_bit))
 
+OWN_QPLC_API(void, qplc_pack_64u33u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u34u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u35u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u36u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u37u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u38u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u39u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u40u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u41u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u42u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u43u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u44u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u45u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u46u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u47u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u48u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u49u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u50u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u51u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u52u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u53u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u54u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u55u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u56u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u57u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u58u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u59u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u60u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u61u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u62u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u63u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
 OWN_QPLC_API(void, qplc_pack_be_8u1u, (const uint8_t *src_ptr,
         uint32_t num_elements,
         uint8_t *dst_ptr,
@@ -436,6 +603,166 @@ OWN_QPLC_API(void, qplc_pack_be_16u32u, (const uint8_t *src_ptr,
         uint32_t num_elements,
         uint8_t *dst_ptr,
         uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u33u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u34u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u35u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u36u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u37u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u38u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u39u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u40u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u41u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u42u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u43u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u44u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u45u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u46u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u47u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u48u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u49u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u50u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u51u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u52u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u53u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u54u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u55u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u56u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u57u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u58u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u59u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u60u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u61u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u62u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u63u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit))
 /** @} */
 
 /**
@@ -501,6 +828,45 @@ OWN_QPLC_API(qplc_status_t, qplc_pack_index_be_8u32u, (const uint8_t *src_ptr,
         uint32_t *index_ptr))
 /** @} */
 
+/**
+ * @name qplc_prle_run_length_<input bit-width>
+ *
+ * @brief Counts the leading elements of the source vector that are equal to the given value.
+ *
+ * @param[in]  src_ptr       pointer to source vector in 8u, 16u or 32u integers format
+ * @param[in]  num_elements  number of source integers to check
+ * @param[in]  value         value of the run
+ *
+ * @return
+ *      - length of the run, num_elements if all elements are equal to the value.
+ * @{
+ */
+OWN_QPLC_API(uint32_t, qplc_prle_run_length_8u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value))
+
+OWN_QPLC_API(uint32_t, qplc_prle_run_length_16u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value))
+
+OWN_QPLC_API(uint32_t, qplc_prle_run_length_32u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value))
+/** @} */
+
+/**
+ * @name qplc_prle_find_equal_octet_<input bit-width>
+ *
+ * @brief Searches for the first octet (group of 8 elements) of the source vector whose elements are all equal.
+ *
+ * @param[in]  src_ptr     pointer to source vector in 8u, 16u or 32u integers format
+ * @param[in]  num_octets  number of octets in the source vector
+ *
+ * @return
+ *      - index of the first octet with equal elements, num_octets if there is no such octet.
+ * @{
+ */
+OWN_QPLC_API(uint32_t, qplc_prle_find_equal_octet_8u, (const uint8_t *src_ptr, uint32_t num_octets))
+
+OWN_QPLC_API(uint32_t, qplc_prle_find_equal_octet_16u, (const uint8_t *src_ptr, uint32_t num_octets))
+
+OWN_QPLC_API(uint32_t, qplc_prle_find_equal_octet_32u, (const uint8_t *src_ptr, uint32_t num_octets))
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,9 @@
  * @details Scan Core APIs implement the following functionalities:
  *      -   Scan analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
  *      -   Scan analytics operation out-of-place kernels for 8u, 16u and 32u input data and 8u output.
+ *      -   Fused scan analytics operation kernels for packed 1..32-bit LE input data and nominal bit vector output
+ *          with aggregates calculation.
+ *      -   Scan analytics operation in-place kernels for 64u input data with 64-bit parameters and 8u output.
  *
  */
 
@@ -40,6 +43,23 @@ typedef void (*qplc_scan_t_ptr)(const uint8_t *src_ptr,
                                 uint32_t low_value,
                                 uint32_t high_value);
 
+typedef void (*qplc_scan_64u_i_t_ptr)(uint8_t *src_dst_ptr,
+                                      uint32_t length,
+                                      uint64_t low_value,
+                                      uint64_t high_value);
+
+typedef void (*qplc_scan_nu1u_t_ptr)(const uint8_t *src_ptr,
+                                     uint32_t length,
+                                     uint32_t bit_width,
+                                     uint32_t low_value,
+                                     uint32_t high_value,
+                                     uint8_t *dst_ptr,
+                                     uint32_t start_bit,
+                                     uint32_t *min_value_ptr,
+                                     uint32_t *max_value_ptr,
+                                     uint32_t *sum_ptr,
+                                     uint32_t *index_ptr);
+
 /**
  * @name qplc_scan_<comparison type><input bit-width><output bit-width>_i
  *
@@ -342,6 +362,185 @@ OWN_QPLC_API(void, qplc_scan_not_range_32u8u, (const uint8_t *src_ptr,
         uint32_t high_value))
 /** @} */
 
+/**
+ * @name qplc_scan_<comparison type>_nu1u
+ *
+ * @brief Fused scan analytics operation kernels for packed 1..32-bit LE input data and nominal bit vector output.
+ *
+ * @param[in]      src_ptr        pointer to source vector of packed n-bit integers, starts from the byte boundary
+ * @param[in]      length         length of source vector in elements
+ * @param[in]      bit_width      bit width of source elements (1..32)
+ * @param[in]      low_value      low value for scan operation
+ * @param[in]      high_value     high value for scan operation
+ * @param[in,out]  dst_ptr        pointer to the byte of destination bit vector that contains start_bit
+ * @param[in]      start_bit      number of already written bits in the first destination byte (0..7)
+ * @param[in,out]  min_value_ptr  pointer to index of the first set bit, OWN_MAX_32U if no set bits were met
+ * @param[in,out]  max_value_ptr  pointer to index of the last set bit
+ * @param[in,out]  sum_ptr        pointer to number of set bits
+ * @param[in,out]  index_ptr      pointer to index of the first element, advanced by length
+ *
+ * @note Elements are unpacked, compared and packed into the destination bit vector in a single pass without
+ *       intermediate buffers, aggregates are calculated on the resulting bits in the same pass.
+ * @note Bits of the first destination byte below start_bit are preserved, destination is written exactly
+ *       up to the last result bit.
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_scan_eq_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_ne_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_lt_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_le_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_gt_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_ge_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_range_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_not_range_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint32_t low_value,
+        uint32_t high_value,
+        uint8_t *dst_ptr,
+        uint32_t start_bit,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr))
+/** @} */
+
+/**
+ * @name qplc_scan_<comparison type>_64u8u_i
+ *
+ * @brief Scan analytics operation in-place kernels for 64u input data and 8u output.
+ *
+ * @param[in,out]  src_dst_ptr  pointer to source vector of 64u integers, is overwritten with 8u results
+ * @param[in]      length       length of source vector in elements
+ * @param[in]      low_value    64-bit low value for scan operation
+ * @param[in]      high_value   64-bit high value for scan operation
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_scan_eq_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_ne_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_lt_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_le_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_gt_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_ge_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_range_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_not_range_64u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint64_t low_value,
+        uint64_t high_value))
+/** @} */
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,9 @@
  *
  * @details Core APIs implement the following functionalities:
  *      -   Select analytics operation in-place kernels for 8u, 16u and 32u input/output data.
- *      -   Select analytics operation out-of-place kernels for 8u, 16u and 32u input/output data.
+ *      -   Select analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input/output data.
+ *      -   Select analytics operation kernels with the packed bit vector mask for 8u, 16u, 32u and 64u input/output
+ *          data.
  *
  */
 
@@ -35,6 +37,12 @@ typedef qplc_status_t (*qplc_select_t_ptr)(const uint8_t *src_ptr,
                                            const uint8_t *src2_ptr,
                                            uint8_t *dst_ptr,
                                            uint32_t length);
+
+typedef qplc_status_t (*qplc_select_bit_mask_t_ptr)(const uint8_t *src_ptr,
+                                                    const uint8_t *src2_ptr,
+                                                    uint32_t src2_start_bit,
+                                                    uint8_t *dst_ptr,
+                                                    uint32_t length);
 /**
  * @name qplc_select_<input bit-width>_i
  *
@@ -66,7 +74,7 @@ OWN_QPLC_API(qplc_status_t, qplc_select_32u_i, (uint8_t * src_dst_ptr,
 /**
  * @name qplc_select_<input bit-width>
  *
- * @brief Select analytics operation out-of-place kernels for 8u, 16u and 32u input data
+ * @brief Select analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input data
  *
  * @param[in]   src_ptr   pointer to source vector
  * @param[in]   src2_ptr  pointer to the source #2 vector (mask)
@@ -94,6 +102,55 @@ OWN_QPLC_API(qplc_status_t, qplc_select_32u, (const uint8_t *src_ptr,
         const uint8_t *src2_ptr,
         uint8_t *dst_ptr,
         uint32_t length))
+
+OWN_QPLC_API(qplc_status_t, qplc_select_64u, (const uint8_t *src_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length))
+/** @} */
+
+/**
+ * @name qplc_select_bit_mask_<input bit-width>
+ *
+ * @brief Select analytics operation kernels for 8u, 16u, 32u and 64u input data with the packed bit vector mask
+ *
+ * @param[in]   src_ptr         pointer to source vector
+ * @param[in]   src2_ptr        pointer to the source #2 vector (little-endian bit vector mask)
+ * @param[in]   src2_start_bit  index of the first mask bit in the first byte of src2_ptr (0..7)
+ * @param[out]  dst_ptr         pointer to destination vector
+ * @param[in]   length          length of source vector in elements
+ *
+ * @note Select operation puts values from src_ptr to dst_ptr if corresponding mask bit is set.
+ *       The mask is read without the unpacking, empty 64-bit mask words are skipped.
+ *       The destination must be able to hold length elements, as the selected elements are stored by vectors.
+ *
+ * @return
+ *      - number of selected elements.
+ * @{
+ */
+OWN_QPLC_API(qplc_status_t, qplc_select_bit_mask_8u, (const uint8_t *src_ptr,
+        const uint8_t *src2_ptr,
+        uint32_t src2_start_bit,
+        uint8_t *dst_ptr,
+        uint32_t length))
+
+OWN_QPLC_API(qplc_status_t, qplc_select_bit_mask_16u, (const uint8_t *src_ptr,
+        const uint8_t *src2_ptr,
+        uint32_t src2_start_bit,
+        uint8_t *dst_ptr,
+        uint32_t length))
+
+OWN_QPLC_API(qplc_status_t, qplc_select_bit_mask_32u, (const uint8_t *src_ptr,
+        const uint8_t *src2_ptr,
+        uint32_t src2_start_bit,
+        uint8_t *dst_ptr,
+        uint32_t length))
+
+OWN_QPLC_API(qplc_status_t, qplc_select_bit_mask_64u, (const uint8_t *src_ptr,
+        const uint8_t *src2_ptr,
+        uint32_t src2_start_bit,
+        uint8_t *dst_ptr,
+        uint32_t length))
 /** @} */
 
 #ifdef __cplusplus
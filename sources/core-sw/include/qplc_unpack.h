@@ -17,9 +17,9 @@
  *        word and dword size
  *
  * @details Core unpack APIs implement the following functionalities:
- *      -   Unpacking n-bit integers' vector to 8u, 16u or 32u integers;
+ *      -   Unpacking n-bit integers' vector to 8u, 16u, 32u or 64u integers;
  *      -   Unpacking input data in PRLE format to 8u, 16u or 32u integers;
- *      -   Unpacking n-bit integers' vector in BE format to 8u, 16u or 32u integers.
+ *      -   Unpacking n-bit integers' vector in BE format to 8u, 16u, 32u or 64u integers.
  *
  */
 
@@ -48,12 +48,12 @@ typedef qplc_status_t (*qplc_unpack_prle_t_ptr)(uint8_t **pp_src,
 /**
  * @name qplc_unpack_<input bit-width><output bit-width>
  *
- * @brief Unpacking input data in format of any-bit-width, LE or BE, to vector of 8u, 16u or 32u integers.
+ * @brief Unpacking input data in format of any-bit-width, LE or BE, to vector of 8u, 16u, 32u or 64u integers.
  *
  * @param[in]   src_ptr       pointer to source vector in packed any-bit-width integers format
  * @param[in]   num_elements  number of n-bit integers to unpack
  * @param[in]   start_bit     bit position in the first byte to start from
- * @param[out]  dst_ptr       pointer to unpacked data in 8u, 16u or 32u format (depends on bit width)
+ * @param[out]  dst_ptr       pointer to unpacked data in 8u, 16u, 32u or 64u format (depends on bit width)
  *
  *
  * @return
@@ -220,6 +220,166 @@ OWN_QPLC_API(void, qplc_unpack_32u32u, (const uint8_t *src_ptr,
         uint32_t start_bit,
         uint8_t *dst_ptr))
 
+OWN_QPLC_API(void, qplc_unpack_33u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_34u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_35u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_36u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_37u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_38u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_39u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_40u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_41u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_42u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_43u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_44u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_45u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_46u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_47u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_48u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_49u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_50u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_51u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_52u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_53u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_54u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_55u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_56u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_57u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_58u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_59u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_60u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_61u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_62u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_63u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_64u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
 OWN_QPLC_API(void, qplc_unpack_be_1u8u, (const uint8_t *src_ptr,
         uint32_t num_elements,
         uint32_t start_bit,
@@ -379,6 +539,166 @@ OWN_QPLC_API(void, qplc_unpack_be_32u32u, (const uint8_t *src_ptr,
         uint32_t num_elements,
         uint32_t start_bit,
         uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_33u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_34u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_35u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_36u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_37u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_38u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_39u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_40u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_41u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_42u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_43u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_44u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_45u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_46u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_47u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_48u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_49u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_50u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_51u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_52u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_53u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_54u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_55u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_56u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_57u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_58u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_59u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_60u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_61u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_62u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_63u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
+
+OWN_QPLC_API(void, qplc_unpack_be_64u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr))
 /** @} */
 
 /**
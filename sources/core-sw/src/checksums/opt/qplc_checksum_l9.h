@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+* @brief Contains AVX2 implementation of functions for checksum
+*
+*@details Function list :
+*               -@ref l9_qplc_crc64
+*               -@ref l9_qplc_crc64_be
+*               -@ref l9_qplc_crc64_init_context
+*               -@ref l9_qplc_crc64_with_context
+*/
+
+#ifndef OWN_CHECKSUM_L9_H
+#define OWN_CHECKSUM_L9_H
+
+#include "own_qplc_defs.h"
+#include "qplc_checksum.h"
+#include "own_crc64_pclmul.h"
+#include "immintrin.h"
+
+OWN_OPT_FUN(uint64_t, l9_qplc_crc64, (const uint8_t *src_ptr,
+                                      uint32_t length,
+                                      uint64_t polynomial,
+                                      uint8_t inversion_flag)) {
+    uint64_t crc64_k[4]    = {0u, 0u, 0u, 0u};
+    uint64_t crc64_barrett = 0u;
+
+    if (length > 512u) {
+        own_crc64_init(polynomial, crc64_k, &crc64_barrett);
+    }
+    else if (length >= 16u) {
+        own_crc64_init_no_unroll(polynomial, crc64_k, &crc64_barrett);
+    }
+
+    return own_crc64_fold(src_ptr, length, polynomial, crc64_k, crc64_barrett, inversion_flag);
+}
+
+OWN_OPT_FUN(uint64_t, l9_qplc_crc64_be, (const uint8_t *src_ptr,
+                                         uint32_t length,
+                                         uint64_t polynomial,
+                                         uint8_t inversion_flag)) {
+    uint64_t crc64_k[4]    = {0u, 0u, 0u, 0u};
+    uint64_t crc64_barrett = 0u;
+
+    if (length > 512u) {
+        own_crc64_init_be(polynomial, crc64_k, &crc64_barrett);
+    }
+    else if (length >= 16u) {
+        own_crc64_init_no_unroll_be(polynomial, crc64_k, &crc64_barrett);
+    }
+
+    return own_crc64_fold_be(src_ptr, length, polynomial, crc64_k, crc64_barrett, inversion_flag);
+}
+
+OWN_OPT_FUN(void, l9_qplc_crc64_init_context, (uint64_t polynomial,
+                                               uint8_t be_flag,
+                                               qplc_crc64_context *context_ptr)) {
+    context_ptr->polynomial = polynomial;
+    context_ptr->be_flag    = be_flag;
+
+    // Full set of constants is calculated, so the context is valid for any length
+    if (be_flag) {
+        own_crc64_init_be(polynomial, context_ptr->fold_constants, &context_ptr->barrett_constant);
+    }
+    else {
+        own_crc64_init(polynomial, context_ptr->fold_constants, &context_ptr->barrett_constant);
+    }
+}
+
+OWN_OPT_FUN(uint64_t, l9_qplc_crc64_with_context, (const uint8_t *src_ptr,
+                                                   uint32_t length,
+                                                   const qplc_crc64_context *context_ptr,
+                                                   uint8_t inversion_flag)) {
+    if (context_ptr->be_flag) {
+        return own_crc64_fold_be(src_ptr,
+                                 length,
+                                 context_ptr->polynomial,
+                                 context_ptr->fold_constants,
+                                 context_ptr->barrett_constant,
+                                 inversion_flag);
+    }
+
+    return own_crc64_fold(src_ptr,
+                          length,
+                          context_ptr->polynomial,
+                          context_ptr->fold_constants,
+                          context_ptr->barrett_constant,
+                          inversion_flag);
+}
+
+#endif // OWN_CHECKSUM_L9_H
@@ -13,16 +13,24 @@
  *          - @ref qplc_crc32_byte_8u
  *          - @ref qplc_crc32_with_polynomial_32u
  *          - @ref qplc_xor_checksum_8u
+ *          - @ref qplc_crc64
+ *          - @ref qplc_crc64_init_context
+ *          - @ref qplc_crc64_with_context
  *
  */
 
 #include "own_qplc_defs.h"
 #include "own_qplc_data.h"
+#include "qplc_checksum.h"
 
 #if PLATFORM >= K0
 
 #include "opt/qplc_checksum_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_checksum_l9.h"
+
 #endif
 
 /**
@@ -86,7 +94,7 @@ OWN_QPLC_FUN(uint32_t, qplc_xor_checksum_8u,
 #endif
 }
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 /**
  * @brief helper for bits/bytes reflecting
@@ -201,6 +209,92 @@ static uint64_t own_crc64_finalize(uint64_t crc, uint64_t polynomial, uint8_t be
     return crc ^ own_bit_byte_swap_64(polynomial);
 }
 
+/**
+ * @brief Slicing-by-8 lookup tables initializer
+ *
+ * @note slice_tables[k][i] holds the CRC of the byte i followed by k zero bytes
+ */
+static void own_crc64_init_slice_tables(uint64_t slice_tables[QPLC_CRC64_SLICES_COUNT][256],
+                                        uint64_t polynomial,
+                                        uint8_t be_flag) {
+    own_crc64_init_lookup_table(slice_tables[0], polynomial, be_flag);
+
+    for (uint32_t slice = 1u; slice < QPLC_CRC64_SLICES_COUNT; slice++) {
+        for (uint32_t i = 0u; i < 256u; i++) {
+            uint64_t crc = slice_tables[slice - 1u][i];
+
+            if (be_flag) {
+                slice_tables[slice][i] = slice_tables[0][crc & 0xFF] ^ (crc >> 8u);
+            }
+            else {
+                slice_tables[slice][i] = slice_tables[0][crc >> 56u] ^ (crc << 8u);
+            }
+        }
+    }
+}
+
+/**
+ * @brief CRC64 calculator that processes 8 bytes per step
+ */
+static uint64_t own_crc64_update_slice_by_8(const uint8_t *src_ptr,
+                                            uint32_t length,
+                                            const uint64_t slice_tables[QPLC_CRC64_SLICES_COUNT][256],
+                                            uint64_t crc,
+                                            uint8_t be_flag) {
+    const uint8_t *const end_ptr = src_ptr + length;
+
+    if (be_flag) {
+        while (end_ptr - src_ptr >= 8) {
+            uint64_t data = 0u;
+
+            for (uint32_t i = 0u; i < 8u; i++) {
+                data |= ((uint64_t) src_ptr[i]) << (8u * i);
+            }
+
+            crc ^= data;
+            crc = slice_tables[7][crc & 0xFF] ^
+                  slice_tables[6][(crc >> 8u) & 0xFF] ^
+                  slice_tables[5][(crc >> 16u) & 0xFF] ^
+                  slice_tables[4][(crc >> 24u) & 0xFF] ^
+                  slice_tables[3][(crc >> 32u) & 0xFF] ^
+                  slice_tables[2][(crc >> 40u) & 0xFF] ^
+                  slice_tables[1][(crc >> 48u) & 0xFF] ^
+                  slice_tables[0][crc >> 56u];
+            src_ptr += 8u;
+        }
+
+        while (src_ptr < end_ptr) {
+            crc = slice_tables[0][*src_ptr++ ^ (crc & 0xFF)] ^ (crc >> 8u);
+        }
+    }
+    else {
+        while (end_ptr - src_ptr >= 8) {
+            uint64_t data = 0u;
+
+            for (uint32_t i = 0u; i < 8u; i++) {
+                data = (data << 8u) | src_ptr[i];
+            }
+
+            crc ^= data;
+            crc = slice_tables[7][crc >> 56u] ^
+                  slice_tables[6][(crc >> 48u) & 0xFF] ^
+                  slice_tables[5][(crc >> 40u) & 0xFF] ^
+                  slice_tables[4][(crc >> 32u) & 0xFF] ^
+                  slice_tables[3][(crc >> 24u) & 0xFF] ^
+                  slice_tables[2][(crc >> 16u) & 0xFF] ^
+                  slice_tables[1][(crc >> 8u) & 0xFF] ^
+                  slice_tables[0][crc & 0xFF];
+            src_ptr += 8u;
+        }
+
+        while (src_ptr < end_ptr) {
+            crc = slice_tables[0][*src_ptr++ ^ (crc >> 56u)] ^ (crc << 8u);
+        }
+    }
+
+    return crc;
+}
+
 #endif
 
 /*
@@ -233,6 +327,15 @@ OWN_QPLC_FUN(uint64_t, qplc_crc64, (const uint8_t *src_ptr,
         crc = CALL_OPT_FUNCTION(k0_qplc_crc64)(src_ptr, length, polynomial, inversion_flag);
         return crc;
     }
+#elif PLATFORM == L9
+    if (be_flag) {
+        crc = CALL_OPT_FUNCTION(l9_qplc_crc64_be)(src_ptr, length, polynomial, inversion_flag);
+        return crc;
+    }
+    else {
+        crc = CALL_OPT_FUNCTION(l9_qplc_crc64)(src_ptr, length, polynomial, inversion_flag);
+        return crc;
+    }
 #else
     uint64_t lookup_table[256];
 
@@ -247,3 +350,59 @@ OWN_QPLC_FUN(uint64_t, qplc_crc64, (const uint8_t *src_ptr,
     return crc;
 #endif
 }
+
+/*
+ * @brief Precomputes polynomial-dependent data for @ref qplc_crc64_with_context
+ *
+ * @param[in]  polynomial       - 64-bit CRC polynomial
+ * @param[in]  be_flag          - endianness flag:
+ *                                  0 - little endian format;
+ *                                  1 - big endian format;
+ * @param[out] context_ptr      - pointer to the context to fill
+ */
+OWN_QPLC_FUN(void, qplc_crc64_init_context, (uint64_t polynomial,
+                                             uint8_t be_flag,
+                                             qplc_crc64_context *context_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_crc64_init_context)(polynomial, be_flag, context_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_crc64_init_context)(polynomial, be_flag, context_ptr);
+#else
+    context_ptr->polynomial = polynomial;
+    context_ptr->be_flag    = be_flag;
+
+    own_crc64_init_slice_tables(context_ptr->slice_tables, polynomial, be_flag);
+#endif
+}
+
+/*
+ * @brief CRC64 checksum calculation for data buffer using precomputed context
+ *
+ * @param[in]  src_ptr          - pointer to the data buffer
+ * @param[in]  length           - length of the buffer
+ * @param[in]  context_ptr      - context filled by @ref qplc_crc64_init_context
+ * @param[in]  inversion_flag   - bitwise inversion flag:
+ *                                  0 - no inversion;
+ *                                  1 - bitwise inversion of the initial and final CRC;
+ *
+ * @return CRC64 checksum value
+ */
+OWN_QPLC_FUN(uint64_t, qplc_crc64_with_context, (const uint8_t *src_ptr,
+                                                 uint32_t length,
+                                                 const qplc_crc64_context *context_ptr,
+                                                 uint8_t inversion_flag)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_crc64_with_context)(src_ptr, length, context_ptr, inversion_flag);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_crc64_with_context)(src_ptr, length, context_ptr, inversion_flag);
+#else
+    const uint64_t polynomial = context_ptr->polynomial;
+    const uint8_t  be_flag    = context_ptr->be_flag;
+
+    uint64_t crc = own_crc64_init_crc(polynomial, be_flag, inversion_flag);
+
+    crc = own_crc64_update_slice_by_8(src_ptr, length, context_ptr->slice_tables, crc, be_flag);
+
+    return own_crc64_finalize(crc, polynomial, be_flag, inversion_flag);
+#endif
+}
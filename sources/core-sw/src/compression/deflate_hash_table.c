@@ -30,13 +30,13 @@
 OWN_QPLC_FUN(void, deflate_hash_table_reset,(deflate_hash_table_t *const hash_table_ptr)) {
     CALL_CORE_FUN(qplc_set_32u)((uint32_t) OWN_UNINITIALIZED_INDEX_32u,
                                 (uint32_t *) hash_table_ptr->hash_table_ptr,
-                                OWN_HIGH_HASH_TABLE_SIZE);
+                                hash_table_ptr->hash_mask + 1u);
 
     CALL_CORE_FUN(qplc_zero_8u)((uint8_t *) hash_table_ptr->hash_story_ptr,
-                                OWN_HIGH_HASH_TABLE_SIZE * 4u);
+                                (hash_table_ptr->window_mask + 1u) * 4u);
 }
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 void own_deflate_hash_table_update(deflate_hash_table_t *const hash_table_ptr,
                                    const uint32_t new_index,
@@ -47,7 +47,7 @@ void own_deflate_hash_table_update(deflate_hash_table_t *const hash_table_ptr,
     // Update hash table
     hash_table_ptr->hash_table_ptr[hash_value] = new_index;
 
-    hash_table_ptr->hash_story_ptr[new_index & hash_table_ptr->hash_mask] = current_index;
+    hash_table_ptr->hash_story_ptr[new_index & hash_table_ptr->window_mask] = current_index;
 }
 
 #endif
@@ -19,7 +19,7 @@
 
 /* ------ Internal functions implementation ------ */
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 static inline uint32_t own_get_match_length_table_index(const uint32_t match_length) {
     // Based on tables on page 11 in RFC 1951
@@ -87,11 +87,12 @@ OWN_QPLC_FUN(void, deflate_histogram_reset, (deflate_histogram_t *const histogra
     // TODO make the logic of an assignment dependent on compression level
 
     // Simple assignment
-    histogram_ptr->table.hash_mask  = OWN_BUILD_MASK(12u);
-    histogram_ptr->table.attempts   = 4096u;
-    histogram_ptr->table.good_match = 32u;
-    histogram_ptr->table.nice_match = 258u;
-    histogram_ptr->table.lazy_match = 258u;
+    histogram_ptr->table.hash_mask   = OWN_BUILD_MASK(12u);
+    histogram_ptr->table.window_mask = OWN_BUILD_MASK(12u);
+    histogram_ptr->table.attempts    = 4096u;
+    histogram_ptr->table.good_match  = 32u;
+    histogram_ptr->table.nice_match  = 258u;
+    histogram_ptr->table.lazy_match  = 258u;
 
     CALL_CORE_FUN(deflate_hash_table_reset(&histogram_ptr->table));
 
@@ -100,7 +101,7 @@ OWN_QPLC_FUN(void, deflate_histogram_reset, (deflate_histogram_t *const histogra
 }
 
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 void deflate_histogram_update_match(deflate_histogram_t *const histogram_ptr, const deflate_match_t match) {
     // Histogram update
@@ -0,0 +1,681 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file deflate_optimal_icf.c
+ * @brief contains implementation of the cost-driven (optimal) parsing of the input into ICF
+ */
+
+#include "stdint.h"
+#include "stdbool.h"
+
+#include "igzip_lib.h"
+#include "encode_df.h"
+
+#include "own_qplc_defs.h"
+
+#include "deflate_hash_table.h"
+#include "deflate_optimal_icf.h"
+#include "deflate_defs.h"
+
+#define OWN_UNINITIALIZED_INDEX_32u 0x80000000u  /**> Value of empty hash table entry */
+#define OWN_MAXIMAL_MATCH_LENGTH    258u         /**> Longest match allowed by Deflate */
+#define OWN_LIT_LEN_SYMBOLS         286u         /**> Number of literal/length symbols used by Deflate */
+#define OWN_DISTANCE_SYMBOLS        30u          /**> Number of distance symbols used by Deflate */
+#define OWN_END_OF_BLOCK_SYMBOL     256u
+#define OWN_FIRST_LENGTH_SYMBOL     257u
+
+#define OWN_COST_SHIFT              4u                      /**> Costs are measured in 1/16 of bit */
+#define OWN_MAXIMAL_SYMBOL_COST     (15u << OWN_COST_SHIFT) /**> Deflate code length limit */
+#define OWN_INFINITE_COST           0xFFFFFFFFu
+
+#define OWN_LENGTH_BIT_COUNT        9u  /**> Path entry keeps the length in low bits and the distance in high bits */
+#define OWN_LENGTH_MASK             ((1u << OWN_LENGTH_BIT_COUNT) - 1u)
+
+/**
+ * Estimation of the dynamic block header: fixed fields, code lengths of the code lengths alphabet
+ * and a code length per used symbol
+ */
+#define OWN_HEADER_FIXED_BITS       (17u + 19u * 3u)
+#define OWN_HEADER_BITS_PER_SYMBOL  5u
+
+typedef struct {
+    uint32_t literal[256];                            /**< Cost of the literal */
+    uint32_t length[OWN_MAXIMAL_MATCH_LENGTH + 1u];   /**< Cost of the length symbol and its extra bits */
+    uint32_t distance[OWN_DISTANCE_SYMBOLS];          /**< Cost of the distance symbol and its extra bits */
+} own_cost_model_t;
+
+typedef struct {
+    uint32_t lit_len[OWN_LIT_LEN_SYMBOLS];
+    uint32_t distance[OWN_DISTANCE_SYMBOLS];
+} own_symbol_statistics_t;
+
+/**
+ * 16 * log2(1 + i / 32) rounded, mantissa part of @ref own_log2
+ */
+static const uint8_t own_log2_mantissa_table[32] = {
+        0u, 1u, 1u, 2u, 3u, 3u, 4u, 5u, 5u, 6u, 6u, 7u, 7u, 8u, 8u, 9u,
+        9u, 10u, 10u, 11u, 11u, 12u, 12u, 13u, 13u, 13u, 14u, 14u, 15u, 15u, 15u, 16u
+};
+
+static inline uint32_t own_bit_scan_reverse(uint32_t value) {
+    uint32_t msb = 0u;
+
+    if (value >= (1u << 16u)) { value >>= 16u; msb += 16u; }
+    if (value >= (1u << 8u))  { value >>= 8u;  msb += 8u; }
+    if (value >= (1u << 4u))  { value >>= 4u;  msb += 4u; }
+    if (value >= (1u << 2u))  { value >>= 2u;  msb += 2u; }
+    if (value >= (1u << 1u))  { msb += 1u; }
+
+    return msb;
+}
+
+/**
+ * @brief Fixed-point log2 in 1/16 of bit, value must be positive
+ */
+static inline uint32_t own_log2(uint32_t value) {
+    const uint32_t msb      = own_bit_scan_reverse(value);
+    const uint32_t mantissa = (msb >= 5u) ? (value >> (msb - 5u)) & 31u : (value << (5u - msb)) & 31u;
+
+    return (msb << OWN_COST_SHIFT) + own_log2_mantissa_table[mantissa];
+}
+
+static inline uint32_t own_get_length_symbol(uint32_t length, uint32_t *extra_bits_count_ptr) {
+    if (length <= 10u) {
+        *extra_bits_count_ptr = 0u;
+        return OWN_FIRST_LENGTH_SYMBOL + length - 3u;
+    }
+
+    if (length == OWN_MAXIMAL_MATCH_LENGTH) {
+        *extra_bits_count_ptr = 0u;
+        return OWN_LIT_LEN_SYMBOLS - 1u;
+    }
+
+    const uint32_t value            = length - 3u;
+    const uint32_t extra_bits_count = own_bit_scan_reverse(value) - 2u;
+
+    *extra_bits_count_ptr = extra_bits_count;
+    return OWN_FIRST_LENGTH_SYMBOL + 4u + 4u * extra_bits_count + ((value >> extra_bits_count) & 3u);
+}
+
+static inline uint32_t own_get_distance_symbol(uint32_t distance,
+                                               uint32_t *extra_bits_count_ptr,
+                                               uint32_t *extra_bits_ptr) {
+    if (distance <= 4u) {
+        *extra_bits_count_ptr = 0u;
+        *extra_bits_ptr       = 0u;
+        return distance - 1u;
+    }
+
+    const uint32_t value            = distance - 1u;
+    const uint32_t msb              = own_bit_scan_reverse(value);
+    const uint32_t extra_bits_count = msb - 1u;
+
+    *extra_bits_count_ptr = extra_bits_count;
+    *extra_bits_ptr       = value & ((1u << extra_bits_count) - 1u);
+    return 2u * msb + ((value >> extra_bits_count) & 1u);
+}
+
+static inline uint32_t own_get_symbol_cost(uint32_t frequency, uint32_t total_log) {
+    // Unused symbol is estimated as the one met half a time
+    const uint32_t cost = (frequency == 0u) ? total_log + (1u << OWN_COST_SHIFT) : total_log - own_log2(frequency);
+
+    return QPL_MAX(1u << OWN_COST_SHIFT, QPL_MIN(cost, OWN_MAXIMAL_SYMBOL_COST));
+}
+
+/**
+ * @brief Builds the costs of the fixed Huffman codes, they are used while there are no statistics yet
+ */
+static void own_build_fixed_cost_model(own_cost_model_t *model_ptr) {
+    for (uint32_t literal = 0u; literal < 256u; literal++) {
+        model_ptr->literal[literal] = ((literal < 144u) ? 8u : 9u) << OWN_COST_SHIFT;
+    }
+
+    for (uint32_t length = OWN_MINIMAL_MATCH_LENGTH; length <= OWN_MAXIMAL_MATCH_LENGTH; length++) {
+        uint32_t       extra_bits_count = 0u;
+        const uint32_t symbol           = own_get_length_symbol(length, &extra_bits_count);
+
+        model_ptr->length[length] = (((symbol < 280u) ? 7u : 8u) + extra_bits_count) << OWN_COST_SHIFT;
+    }
+
+    for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+        const uint32_t extra_bits_count = (symbol < 4u) ? 0u : (symbol >> 1u) - 1u;
+
+        model_ptr->distance[symbol] = (5u + extra_bits_count) << OWN_COST_SHIFT;
+    }
+}
+
+/**
+ * @brief Builds the costs as the entropy of the symbols with the given frequencies
+ */
+static void own_build_cost_model(const own_symbol_statistics_t *statistics_ptr, own_cost_model_t *model_ptr) {
+    uint32_t lit_len_cost[OWN_LIT_LEN_SYMBOLS];
+    uint32_t lit_len_total  = 1u;
+    uint32_t distance_total = 1u;
+
+    for (uint32_t symbol = 0u; symbol < OWN_LIT_LEN_SYMBOLS; symbol++) {
+        lit_len_total += statistics_ptr->lit_len[symbol];
+    }
+
+    for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+        distance_total += statistics_ptr->distance[symbol];
+    }
+
+    const uint32_t lit_len_log  = own_log2(lit_len_total);
+    const uint32_t distance_log = own_log2(distance_total);
+
+    for (uint32_t symbol = 0u; symbol < OWN_LIT_LEN_SYMBOLS; symbol++) {
+        lit_len_cost[symbol] = own_get_symbol_cost(statistics_ptr->lit_len[symbol], lit_len_log);
+    }
+
+    for (uint32_t literal = 0u; literal < 256u; literal++) {
+        model_ptr->literal[literal] = lit_len_cost[literal];
+    }
+
+    for (uint32_t length = OWN_MINIMAL_MATCH_LENGTH; length <= OWN_MAXIMAL_MATCH_LENGTH; length++) {
+        uint32_t       extra_bits_count = 0u;
+        const uint32_t symbol           = own_get_length_symbol(length, &extra_bits_count);
+
+        model_ptr->length[length] = lit_len_cost[symbol] + (extra_bits_count << OWN_COST_SHIFT);
+    }
+
+    for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+        const uint32_t extra_bits_count = (symbol < 4u) ? 0u : (symbol >> 1u) - 1u;
+
+        model_ptr->distance[symbol] = own_get_symbol_cost(statistics_ptr->distance[symbol], distance_log)
+                                      + (extra_bits_count << OWN_COST_SHIFT);
+    }
+}
+
+/**
+ * @brief Converts the block histogram (lengths are counted per value) into the symbol statistics
+ */
+static void own_get_histogram_statistics(const isal_mod_hist *histogram_ptr,
+                                         own_symbol_statistics_t *statistics_ptr) {
+    for (uint32_t symbol = 0u; symbol < OWN_FIRST_LENGTH_SYMBOL; symbol++) {
+        statistics_ptr->lit_len[symbol] = histogram_ptr->ll_hist[symbol];
+    }
+
+    for (uint32_t symbol = OWN_FIRST_LENGTH_SYMBOL; symbol < OWN_LIT_LEN_SYMBOLS; symbol++) {
+        statistics_ptr->lit_len[symbol] = 0u;
+    }
+
+    for (uint32_t length = 3u; length <= OWN_MAXIMAL_MATCH_LENGTH; length++) {
+        uint32_t extra_bits_count = 0u;
+
+        statistics_ptr->lit_len[own_get_length_symbol(length, &extra_bits_count)] +=
+                histogram_ptr->ll_hist[length + LEN_OFFSET];
+    }
+
+    for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+        statistics_ptr->distance[symbol] = histogram_ptr->d_hist[symbol];
+    }
+}
+
+static uint64_t own_get_alphabet_bits(const uint32_t *frequencies_ptr, uint32_t symbols_count) {
+    uint64_t bits  = 0u;
+    uint32_t total = 0u;
+
+    for (uint32_t symbol = 0u; symbol < symbols_count; symbol++) {
+        total += frequencies_ptr[symbol];
+    }
+
+    if (total == 0u) {
+        return 0u;
+    }
+
+    const uint32_t total_log = own_log2(total);
+
+    for (uint32_t symbol = 0u; symbol < symbols_count; symbol++) {
+        if (frequencies_ptr[symbol] != 0u) {
+            bits += (uint64_t) frequencies_ptr[symbol] * (total_log - own_log2(frequencies_ptr[symbol]));
+        }
+    }
+
+    return bits;
+}
+
+/**
+ * @brief Estimates the size of the symbols encoded with the Huffman codes built by their statistics,
+ *        extra bits are not counted
+ */
+static inline uint64_t own_get_statistics_bits(const own_symbol_statistics_t *statistics_ptr) {
+    return own_get_alphabet_bits(statistics_ptr->lit_len, OWN_LIT_LEN_SYMBOLS)
+           + own_get_alphabet_bits(statistics_ptr->distance, OWN_DISTANCE_SYMBOLS);
+}
+
+static inline uint64_t own_get_header_bits(const own_symbol_statistics_t *statistics_ptr) {
+    uint32_t used_symbols = 0u;
+
+    for (uint32_t symbol = 0u; symbol < OWN_LIT_LEN_SYMBOLS; symbol++) {
+        used_symbols += (statistics_ptr->lit_len[symbol] != 0u);
+    }
+
+    for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+        used_symbols += (statistics_ptr->distance[symbol] != 0u);
+    }
+
+    return (uint64_t) (OWN_HEADER_FIXED_BITS + used_symbols * OWN_HEADER_BITS_PER_SYMBOL) << OWN_COST_SHIFT;
+}
+
+/**
+ * @brief Checks if the segment is encoded better in the separate block than in the end of the current one
+ */
+static bool own_is_block_split_profitable(const own_symbol_statistics_t *block_statistics_ptr,
+                                          const own_symbol_statistics_t *segment_statistics_ptr) {
+    own_symbol_statistics_t joint_statistics;
+
+    for (uint32_t symbol = 0u; symbol < OWN_LIT_LEN_SYMBOLS; symbol++) {
+        joint_statistics.lit_len[symbol] = block_statistics_ptr->lit_len[symbol]
+                                           + segment_statistics_ptr->lit_len[symbol];
+    }
+
+    for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+        joint_statistics.distance[symbol] = block_statistics_ptr->distance[symbol]
+                                            + segment_statistics_ptr->distance[symbol];
+    }
+
+    const uint64_t joint_bits = own_get_statistics_bits(&joint_statistics);
+    const uint64_t split_bits = own_get_statistics_bits(block_statistics_ptr)
+                                + own_get_statistics_bits(segment_statistics_ptr)
+                                + own_get_header_bits(segment_statistics_ptr);
+
+    return split_bits < joint_bits;
+}
+
+static inline uint32_t own_get_hash(const uint8_t *string_ptr, uint32_t hash_mask) {
+    return ((*(uint32_t *) string_ptr * 0x9E3779B1u) >> 16u) & hash_mask;
+}
+
+/**
+ * @brief Puts the positions into the hash table, the positions inserted by the previous calls are skipped
+ */
+static void own_insert_positions(deflate_hash_table_t *hash_table_ptr,
+                                 const uint8_t *const lower_bound_ptr,
+                                 const uint8_t *begin_ptr,
+                                 const uint8_t *end_ptr) {
+    for (const uint8_t *string_ptr = begin_ptr; string_ptr < end_ptr; string_ptr++) {
+        const uint32_t index      = (uint32_t) (string_ptr - lower_bound_ptr);
+        const uint32_t hash_value = own_get_hash(string_ptr, hash_table_ptr->hash_mask);
+        const uint32_t head_index = hash_table_ptr->hash_table_ptr[hash_value];
+
+        if (head_index == OWN_UNINITIALIZED_INDEX_32u || head_index < index) {
+            hash_table_ptr->hash_table_ptr[hash_value]                        = index;
+            hash_table_ptr->hash_story_ptr[index & hash_table_ptr->window_mask] = head_index;
+        }
+    }
+}
+
+static inline uint32_t own_get_match_length(const uint8_t *first_ptr,
+                                            const uint8_t *second_ptr,
+                                            uint32_t maximal_length) {
+    uint32_t length = 0u;
+
+    while (length + sizeof(uint64_t) <= maximal_length &&
+           *(uint64_t *) (first_ptr + length) == *(uint64_t *) (second_ptr + length)) {
+        length += sizeof(uint64_t);
+    }
+
+    while (length < maximal_length && first_ptr[length] == second_ptr[length]) {
+        length++;
+    }
+
+    return length;
+}
+
+/**
+ * @brief Finds the matches for the position, every next match is longer than the previous one
+ *
+ * @details Chain goes from the closest positions, so every length is taken with the shortest distance.
+ *          Matches are stored in the path entry format.
+ *
+ * @return number of the matches
+ */
+static uint32_t own_find_matches(const deflate_hash_table_t *hash_table_ptr,
+                                 const uint8_t *const lower_bound_ptr,
+                                 const uint8_t *string_ptr,
+                                 uint32_t maximal_length,
+                                 uint32_t *matches_ptr) {
+    const uint32_t window_size    = hash_table_ptr->window_mask + 1u;
+    const uint32_t index          = (uint32_t) (string_ptr - lower_bound_ptr);
+    uint32_t       match_index    = hash_table_ptr->hash_story_ptr[index & hash_table_ptr->window_mask];
+    uint32_t       attempts       = QPL_MIN(hash_table_ptr->attempts, OWN_OPTIMAL_MAX_ATTEMPTS);
+    uint32_t       longest_length = OWN_MINIMAL_MATCH_LENGTH - 1u;
+    uint32_t       matches_count  = 0u;
+
+    while (attempts > 0u && match_index < index && index - match_index <= window_size) {
+        const uint8_t *const match_ptr = lower_bound_ptr + match_index;
+
+        // Candidate can't be longer than the found match if it differs at its last byte
+        const uint32_t length = (match_ptr[longest_length] == string_ptr[longest_length])
+                                ? own_get_match_length(match_ptr, string_ptr, maximal_length)
+                                : 0u;
+
+        if (length > longest_length) {
+            matches_ptr[matches_count++] = length | ((index - match_index) << OWN_LENGTH_BIT_COUNT);
+
+            if (length >= hash_table_ptr->nice_match || length == maximal_length) {
+                break;
+            }
+
+            if (length > hash_table_ptr->good_match && longest_length <= hash_table_ptr->good_match) {
+                attempts >>= 2u;
+            }
+
+            longest_length = length;
+        }
+
+        const uint32_t next_index = hash_table_ptr->hash_story_ptr[match_index & hash_table_ptr->window_mask];
+
+        if (next_index >= match_index) {
+            break;
+        }
+
+        match_index = next_index;
+        attempts--;
+    }
+
+    return matches_count;
+}
+
+/**
+ * @brief Matches found by the first parsing pass, they are reused by the next passes
+ *
+ * @details Each searched position has the number of the matches followed by the matches. If the cache is over,
+ *          the rest of the positions are searched by every pass.
+ */
+typedef struct {
+    uint32_t *begin_ptr;
+    uint32_t *next_ptr;
+    uint32_t *end_ptr;
+    uint32_t cached_positions;   /**< Number of the first positions of the segment stored in the cache */
+    bool     is_filled;          /**< Cache is written by the first pass and read by the next ones */
+} own_match_cache_t;
+
+static inline void own_relax_path(uint32_t *cost_ptr,
+                                  uint32_t *path_ptr,
+                                  uint32_t position,
+                                  uint32_t length,
+                                  uint32_t distance,
+                                  uint32_t cost) {
+    if (cost < cost_ptr[position + length]) {
+        cost_ptr[position + length] = cost;
+        path_ptr[position + length] = length | (distance << OWN_LENGTH_BIT_COUNT);
+    }
+}
+
+/**
+ * @brief Finds the cheapest sequence of literals and matches for the segment by the given cost model
+ *
+ * @details cost_ptr[i] is the cost of the cheapest parsing of the first i bytes,
+ *          path_ptr[i] is the length and the distance of the last literal or match in it
+ */
+static void own_find_shortest_path(const deflate_hash_table_t *hash_table_ptr,
+                                   const uint8_t *const lower_bound_ptr,
+                                   const uint8_t *segment_ptr,
+                                   uint32_t segment_size,
+                                   uint32_t match_positions,
+                                   const own_cost_model_t *model_ptr,
+                                   own_match_cache_t *cache_ptr,
+                                   uint32_t *cost_ptr,
+                                   uint32_t *path_ptr) {
+    uint32_t search_buffer[OWN_MAXIMAL_MATCH_LENGTH];
+    uint32_t long_match_end = 0u;
+    uint32_t long_distance  = 0u;
+    uint32_t extra_bits_count;
+    uint32_t extra_bits;
+
+    cost_ptr[0] = 0u;
+    for (uint32_t position = 1u; position <= segment_size; position++) {
+        cost_ptr[position] = OWN_INFINITE_COST;
+    }
+
+    cache_ptr->next_ptr = cache_ptr->begin_ptr;
+
+    for (uint32_t position = 0u; position < segment_size; position++) {
+        const uint8_t *const string_ptr     = segment_ptr + position;
+        const uint32_t       current_cost   = cost_ptr[position];
+        const uint32_t       maximal_length = QPL_MIN(OWN_MAXIMAL_MATCH_LENGTH, segment_size - position);
+
+        own_relax_path(cost_ptr, path_ptr, position, 1u, 0u, current_cost + model_ptr->literal[*string_ptr]);
+
+        if (position >= match_positions || maximal_length < OWN_MINIMAL_MATCH_LENGTH) {
+            continue;
+        }
+
+        // Positions covered by a nice match are not searched, the rest of the match is the only candidate
+        if (position < long_match_end) {
+            const uint32_t length = QPL_MIN(long_match_end - position, maximal_length);
+
+            if (length >= OWN_MINIMAL_MATCH_LENGTH) {
+                const uint32_t symbol = own_get_distance_symbol(long_distance, &extra_bits_count, &extra_bits);
+
+                own_relax_path(cost_ptr, path_ptr, position, length, long_distance,
+                               current_cost + model_ptr->length[length] + model_ptr->distance[symbol]);
+            }
+            continue;
+        }
+
+        uint32_t *matches_ptr   = search_buffer;
+        uint32_t matches_count  = 0u;
+
+        if (cache_ptr->is_filled && position < cache_ptr->cached_positions) {
+            matches_count = *cache_ptr->next_ptr;
+            matches_ptr   = cache_ptr->next_ptr + 1u;
+
+            cache_ptr->next_ptr += matches_count + 1u;
+        } else {
+            matches_count = own_find_matches(hash_table_ptr, lower_bound_ptr, string_ptr, maximal_length, matches_ptr);
+
+            if (!cache_ptr->is_filled && position < cache_ptr->cached_positions) {
+                if ((uint32_t) (cache_ptr->end_ptr - cache_ptr->next_ptr) > matches_count) {
+                    *cache_ptr->next_ptr++ = matches_count;
+
+                    for (uint32_t i = 0u; i < matches_count; i++) {
+                        *cache_ptr->next_ptr++ = matches_ptr[i];
+                    }
+                } else {
+                    cache_ptr->cached_positions = position;
+                }
+            }
+        }
+
+        uint32_t shortest_length = OWN_MINIMAL_MATCH_LENGTH;
+
+        for (uint32_t i = 0u; i < matches_count; i++) {
+            const uint32_t length    = matches_ptr[i] & OWN_LENGTH_MASK;
+            const uint32_t distance  = matches_ptr[i] >> OWN_LENGTH_BIT_COUNT;
+            const uint32_t symbol    = own_get_distance_symbol(distance, &extra_bits_count, &extra_bits);
+            const uint32_t base_cost = current_cost + model_ptr->distance[symbol];
+
+            for (; shortest_length <= length; shortest_length++) {
+                own_relax_path(cost_ptr, path_ptr, position, shortest_length, distance,
+                               base_cost + model_ptr->length[shortest_length]);
+            }
+
+            if (length >= hash_table_ptr->nice_match) {
+                long_match_end = position + length;
+                long_distance  = distance;
+            }
+        }
+    }
+
+    cache_ptr->is_filled = true;
+}
+
+/**
+ * @brief Collects the path from the end of the segment, the entries are stored reversed in the end of tokens_ptr
+ *
+ * @return number of the literals and matches
+ */
+static uint32_t own_trace_path(const uint32_t *path_ptr, uint32_t segment_size, uint32_t *tokens_ptr) {
+    uint32_t tokens_count = 0u;
+
+    for (uint32_t position = segment_size; position > 0u;) {
+        const uint32_t token = path_ptr[position];
+
+        tokens_count++;
+        tokens_ptr[segment_size - tokens_count] = token;
+        position -= token & OWN_LENGTH_MASK;
+    }
+
+    return tokens_count;
+}
+
+static void own_get_path_statistics(const uint8_t *segment_ptr,
+                                    const uint32_t *tokens_ptr,
+                                    uint32_t tokens_count,
+                                    own_symbol_statistics_t *statistics_ptr) {
+    uint32_t extra_bits_count;
+    uint32_t extra_bits;
+
+    for (uint32_t symbol = 0u; symbol < OWN_LIT_LEN_SYMBOLS; symbol++) {
+        statistics_ptr->lit_len[symbol] = 0u;
+    }
+
+    for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+        statistics_ptr->distance[symbol] = 0u;
+    }
+
+    for (uint32_t i = 0u; i < tokens_count; i++) {
+        const uint32_t length   = tokens_ptr[i] & OWN_LENGTH_MASK;
+        const uint32_t distance = tokens_ptr[i] >> OWN_LENGTH_BIT_COUNT;
+
+        if (length == 1u) {
+            statistics_ptr->lit_len[*segment_ptr]++;
+        } else {
+            statistics_ptr->lit_len[own_get_length_symbol(length, &extra_bits_count)]++;
+            statistics_ptr->distance[own_get_distance_symbol(distance, &extra_bits_count, &extra_bits)]++;
+        }
+
+        segment_ptr += length;
+    }
+
+    // End of block is always present
+    statistics_ptr->lit_len[OWN_END_OF_BLOCK_SYMBOL]++;
+}
+
+static void own_write_path(const uint8_t *segment_ptr,
+                           const uint32_t *tokens_ptr,
+                           uint32_t tokens_count,
+                           isal_mod_hist *histogram_ptr,
+                           deflate_icf_stream *icf_stream_ptr) {
+    uint32_t extra_bits_count;
+    uint32_t extra_bits;
+
+    for (uint32_t i = 0u; i < tokens_count; i++) {
+        const uint32_t length   = tokens_ptr[i] & OWN_LENGTH_MASK;
+        const uint32_t distance = tokens_ptr[i] >> OWN_LENGTH_BIT_COUNT;
+
+        if (length == 1u) {
+            histogram_ptr->ll_hist[*segment_ptr]++;
+
+            *(uint32_t *) icf_stream_ptr->next_ptr = *segment_ptr
+                                                     | (LITERAL_DISTANCE_IN_ICF << LIT_LEN_BIT_COUNT);
+        } else {
+            const uint32_t symbol = own_get_distance_symbol(distance, &extra_bits_count, &extra_bits);
+
+            histogram_ptr->ll_hist[length + LEN_OFFSET]++;
+            histogram_ptr->d_hist[symbol]++;
+
+            *(uint32_t *) icf_stream_ptr->next_ptr = (length + LEN_OFFSET)
+                                                     | (symbol << LIT_LEN_BIT_COUNT)
+                                                     | (extra_bits << (LIT_LEN_BIT_COUNT + DIST_LIT_BIT_COUNT));
+        }
+
+        icf_stream_ptr->next_ptr++;
+        segment_ptr += length;
+    }
+}
+
+OWN_QPLC_FUN(uint32_t, optimal_deflate_icf_body, (uint8_t * current_ptr,
+        const uint8_t        *const lower_bound_ptr,
+        const uint8_t        *const upper_bound_ptr,
+        deflate_hash_table_t *hash_table_ptr,
+        isal_mod_hist        *histogram_ptr,
+        deflate_icf_stream   *icf_stream_ptr)) {
+    own_cost_model_t        model;
+    own_symbol_statistics_t block_statistics;
+    own_symbol_statistics_t segment_statistics;
+
+    const uint32_t window_size           = hash_table_ptr->window_mask + 1u;
+    uint32_t       total_bytes_processed = 0u;
+
+    while (current_ptr < upper_bound_ptr) {
+        // Segment is parsed in the end of the free ICF space, its ICF is written to the beginning,
+        // the matches are cached in between. One more entry is left for the end of block
+        const uint32_t free_entries   = (uint32_t) (icf_stream_ptr->end_ptr - icf_stream_ptr->next_ptr);
+        const uint32_t bytes_left     = (uint32_t) (upper_bound_ptr - current_ptr);
+        const uint32_t available_size = (free_entries > 3u) ? (free_entries - 3u) / 5u : 0u;
+        const uint32_t segment_size   = QPL_MIN(QPL_MIN(OWN_OPTIMAL_SEGMENT_SIZE, window_size),
+                                                QPL_MIN(bytes_left, available_size));
+
+        if (segment_size == 0u || (segment_size < OWN_OPTIMAL_MIN_SEGMENT_SIZE && segment_size < bytes_left)) {
+            break;
+        }
+
+        uint32_t *const cost_ptr = (uint32_t *) (icf_stream_ptr->end_ptr) - 2u * (segment_size + 1u);
+        uint32_t *const path_ptr = cost_ptr + segment_size + 1u;
+
+        own_match_cache_t cache = {(uint32_t *) (icf_stream_ptr->next_ptr + segment_size),
+                                   (uint32_t *) (icf_stream_ptr->next_ptr + segment_size), cost_ptr,
+                                   segment_size, false};
+
+        // Matches are not searched at the last bytes of the input, they are not hashed
+        const uint32_t match_positions = (bytes_left >= OWN_BYTES_FOR_HASH_CALCULATION)
+                                         ? QPL_MIN(segment_size, bytes_left - OWN_BYTES_FOR_HASH_CALCULATION + 1u)
+                                         : 0u;
+
+        own_insert_positions(hash_table_ptr, lower_bound_ptr, current_ptr, current_ptr + match_positions);
+        own_get_histogram_statistics(histogram_ptr, &block_statistics);
+
+        const bool is_block_empty = (icf_stream_ptr->next_ptr == icf_stream_ptr->begin_ptr);
+
+        uint32_t tokens_count = 0u;
+        uint32_t *tokens_ptr  = cost_ptr;
+
+        for (uint32_t iteration = 0u; iteration < OWN_OPTIMAL_ITERATIONS; iteration++) {
+            if (iteration == 0u) {
+                if (is_block_empty) {
+                    own_build_fixed_cost_model(&model);
+                } else {
+                    own_build_cost_model(&block_statistics, &model);
+                }
+            } else {
+                for (uint32_t symbol = 0u; symbol < OWN_LIT_LEN_SYMBOLS; symbol++) {
+                    segment_statistics.lit_len[symbol] += block_statistics.lit_len[symbol];
+                }
+
+                for (uint32_t symbol = 0u; symbol < OWN_DISTANCE_SYMBOLS; symbol++) {
+                    segment_statistics.distance[symbol] += block_statistics.distance[symbol];
+                }
+
+                own_build_cost_model(&segment_statistics, &model);
+            }
+
+            own_find_shortest_path(hash_table_ptr, lower_bound_ptr, current_ptr, segment_size, match_positions,
+                                   &model, &cache, cost_ptr, path_ptr);
+
+            // Costs are not needed anymore, the tokens are put in their place
+            tokens_count = own_trace_path(path_ptr, segment_size, cost_ptr);
+            tokens_ptr   = cost_ptr + segment_size - tokens_count;
+
+            own_get_path_statistics(current_ptr, tokens_ptr, tokens_count, &segment_statistics);
+        }
+
+        // The segment is left for the next block if it is cheaper to encode it separately
+        if (!is_block_empty && own_is_block_split_profitable(&block_statistics, &segment_statistics)) {
+            break;
+        }
+
+        own_write_path(current_ptr, tokens_ptr, tokens_count, histogram_ptr, icf_stream_ptr);
+
+        current_ptr += segment_size;
+        total_bytes_processed += segment_size;
+    }
+
+    return total_bytes_processed;
+}
@@ -26,13 +26,13 @@
 #endif
 
 #if PLATFORM < K0
-uint32_t encode_literals(uint8_t *current_ptr,
-                         const uint8_t *upper_bound_ptr,
-                         const uint8_t *lower_bound_ptr,
-                         deflate_hash_table_t *hash_table_ptr,
-                         struct isal_hufftables *huffman_table_ptr,
-                         struct BitBuf2 *bit_writer_ptr,
-                         bool safe) {
+static uint32_t encode_literals(uint8_t *current_ptr,
+                                const uint8_t *upper_bound_ptr,
+                                const uint8_t *lower_bound_ptr,
+                                deflate_hash_table_t *hash_table_ptr,
+                                struct isal_hufftables *huffman_table_ptr,
+                                struct BitBuf2 *bit_writer_ptr,
+                                bool safe) {
     uint32_t bytes_processed = 0;
 
     if (true == safe) {
@@ -95,12 +95,12 @@ uint32_t encode_literals(uint8_t *current_ptr,
     return bytes_processed;
 }
 
-uint32_t encode_match(uint8_t *current_ptr,
-                      const uint8_t *lower_bound_ptr,
-                      deflate_hash_table_t *hash_table_ptr,
-                      const deflate_match_t match,
-                      struct isal_hufftables *huffman_table_ptr,
-                      struct BitBuf2 *bit_writer_ptr) {
+static uint32_t encode_match(uint8_t *current_ptr,
+                             const uint8_t *lower_bound_ptr,
+                             deflate_hash_table_t *hash_table_ptr,
+                             const deflate_match_t match,
+                             struct isal_hufftables *huffman_table_ptr,
+                             struct BitBuf2 *bit_writer_ptr) {
     uint32_t bytes_processed       = 0;
     uint32_t total_bytes_processed = 0;
 
@@ -162,10 +162,10 @@ OWN_QPLC_FUN(uint32_t,slow_deflate_body,(uint8_t *current_ptr,
     // Main cycle
     while (current_ptr < (upper_bound_ptr - OWN_MINIMAL_MATCH_LENGTH) && !is_full(bit_writer_ptr)) {
         // Variables 
-        const deflate_match_t longest_match = get_lazy_best_match(hash_table_ptr,
-                                                                  lower_bound_ptr,
-                                                                  current_ptr,
-                                                                  upper_bound_ptr - OWN_MINIMAL_MATCH_LENGTH);
+        const deflate_match_t longest_match = CALL_CORE_FUN(get_lazy_best_match)(hash_table_ptr,
+                                                                                 lower_bound_ptr,
+                                                                                 current_ptr,
+                                                                                 upper_bound_ptr - OWN_MINIMAL_MATCH_LENGTH);
 
         if (longest_match.length >= OWN_MINIMAL_MATCH_LENGTH) {
             bytes_processed = encode_match(current_ptr,
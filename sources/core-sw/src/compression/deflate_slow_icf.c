@@ -29,13 +29,13 @@ typedef struct deflate_icf_stream deflate_icf_stream;
 
 #if PLATFORM < K0
 
-uint32_t process_literals(uint8_t *current_ptr,
-                          const uint8_t *upper_bound_ptr,
-                          const uint8_t *lower_bound_ptr,
-                          deflate_hash_table_t *hash_table_ptr,
-                          isal_mod_hist *histogram_ptr,
-                          deflate_icf_stream *icf_stream_ptr,
-                          bool safe) {
+static uint32_t process_literals(uint8_t *current_ptr,
+                                 const uint8_t *upper_bound_ptr,
+                                 const uint8_t *lower_bound_ptr,
+                                 deflate_hash_table_t *hash_table_ptr,
+                                 isal_mod_hist *histogram_ptr,
+                                 deflate_icf_stream *icf_stream_ptr,
+                                 bool safe) {
     uint32_t bytes_processed = 0;
 
     // Main cycle
@@ -91,12 +91,12 @@ uint32_t process_literals(uint8_t *current_ptr,
     return bytes_processed;
 }
 
-uint32_t process_match(uint8_t *current_ptr,
-                       const uint8_t *lower_bound_ptr,
-                       deflate_hash_table_t *hash_table_ptr,
-                       isal_mod_hist *histogram_ptr,
-                       const deflate_match_t match,
-                       deflate_icf_stream *icf_stream_ptr) {
+static uint32_t process_match(uint8_t *current_ptr,
+                              const uint8_t *lower_bound_ptr,
+                              deflate_hash_table_t *hash_table_ptr,
+                              isal_mod_hist *histogram_ptr,
+                              const deflate_match_t match,
+                              deflate_icf_stream *icf_stream_ptr) {
     uint32_t bytes_processed       = 0;
     uint32_t total_bytes_processed = 0;
 
@@ -158,10 +158,10 @@ OWN_QPLC_FUN(uint32_t, slow_deflate_icf_body, (uint8_t * current_ptr,
     while (current_ptr < (upper_bound_ptr - OWN_MINIMAL_MATCH_LENGTH) &&
            icf_stream_ptr->next_ptr < icf_stream_ptr->end_ptr - 1) {
         // Variables
-        const deflate_match_t longest_match = get_lazy_best_match(hash_table_ptr,
-                                                                  lower_bound_ptr,
-                                                                  current_ptr,
-                                                                  upper_bound_ptr - OWN_MINIMAL_MATCH_LENGTH);
+        const deflate_match_t longest_match = CALL_CORE_FUN(get_lazy_best_match)(hash_table_ptr,
+                                                                                 lower_bound_ptr,
+                                                                                 current_ptr,
+                                                                                 upper_bound_ptr - OWN_MINIMAL_MATCH_LENGTH);
 
         if (longest_match.length >= OWN_MINIMAL_MATCH_LENGTH) {
             bytes_processed = process_match(current_ptr,
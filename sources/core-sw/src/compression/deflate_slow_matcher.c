@@ -9,23 +9,68 @@
 #include "crc.h"
 
 #include "deflate_defs.h"
+#include "deflate_slow_matcher.h"
+#include "own_qplc_defs.h"
+
+#if PLATFORM >= L9
+#include "immintrin.h"
+#endif
 
 #if PLATFORM < K0
 
+#define OWN_MAXIMAL_MATCH_LENGTH 258u  /**> Maximal match length in deflate */
+
+static inline uint32_t own_get_first_mismatch_byte(uint64_t difference) {
+#if PLATFORM >= L9
+    return (uint32_t) _tzcnt_u64(difference) / OWN_BYTE_WIDTH;
+#else
+    uint32_t index = 0u;
+
+    while (0u == (difference & 0xFFu)) {
+        difference >>= OWN_BYTE_WIDTH;
+        index++;
+    }
+
+    return index;
+#endif
+}
+
 static inline uint32_t compare_strings(const uint8_t *const first_ptr,
                                        const uint8_t *const second_ptr,
                                        const uint8_t *const upper_bound_ptr) {
     // Variables
     uint32_t match_length = 0u;
 
-    // Main cycle
     if (first_ptr >= second_ptr) {
         return match_length;
     }
 
-    while ((first_ptr[match_length] == second_ptr[match_length]) &&
-           (second_ptr + match_length < upper_bound_ptr) &&
-           match_length <= 257u) {
+    const uint32_t max_length = QPL_MIN(OWN_MAXIMAL_MATCH_LENGTH, (uint32_t) (upper_bound_ptr - second_ptr));
+
+#if PLATFORM >= L9
+    // Compare by 32 bytes, the first mismatch is found in the compare mask
+    for (; match_length + sizeof(__m256i) <= max_length; match_length += sizeof(__m256i)) {
+        const __m256i first_bytes  = _mm256_loadu_si256((const __m256i *) (first_ptr + match_length));
+        const __m256i second_bytes = _mm256_loadu_si256((const __m256i *) (second_ptr + match_length));
+        const uint32_t equal_mask  = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(first_bytes, second_bytes));
+
+        if (OWN_MAX_32U != equal_mask) {
+            return match_length + (uint32_t) _tzcnt_u32(~equal_mask);
+        }
+    }
+#endif
+
+    // Compare by 8 bytes, the first mismatch is the lowest non-zero byte of the difference
+    for (; match_length + sizeof(uint64_t) <= max_length; match_length += sizeof(uint64_t)) {
+        const uint64_t difference = *(const uint64_t *) (first_ptr + match_length) ^
+                                    *(const uint64_t *) (second_ptr + match_length);
+
+        if (0u != difference) {
+            return match_length + own_get_first_mismatch_byte(difference);
+        }
+    }
+
+    while (match_length < max_length && first_ptr[match_length] == second_ptr[match_length]) {
         match_length++;
     }
 
@@ -48,6 +93,7 @@ static inline deflate_match_t get_best_match(const deflate_hash_table_t *const h
     uint32_t match_score                = 0u;
 #endif
     uint32_t current_number_of_attempts = hash_table_ptr->attempts;
+    const uint32_t window_size          = hash_table_ptr->window_mask + 1u;
 
     deflate_match_t best_match = {match_length,
                                   (uint32_t) (current_match_ptr - lower_bound_ptr),
@@ -55,7 +101,7 @@ static inline deflate_match_t get_best_match(const deflate_hash_table_t *const h
                                   hash_value,
                                   (uint8_t *) string_ptr};
 
-    if (index == OWN_UNINITIALIZED_INDEX || best_match.offset > OWN_MAXIMAL_OFFSET) {
+    if (index == OWN_UNINITIALIZED_INDEX || best_match.offset > window_size) {
         // This was the first time we have faced this hash value
         return best_match;
     }
@@ -73,6 +119,10 @@ static inline deflate_match_t get_best_match(const deflate_hash_table_t *const h
     best_match.score = match_score;
 #endif
 
+    if (match_length >= hash_table_ptr->nice_match) {
+        return best_match;
+    }
+
     // Perform a "good match" logic from Zlib
     if (match_length > hash_table_ptr->good_match) {
         /*
@@ -82,16 +132,30 @@ static inline deflate_match_t get_best_match(const deflate_hash_table_t *const h
         current_number_of_attempts >>= 2u;
     }
 
-    index = hash_table_ptr->hash_story_ptr[index & hash_table_ptr->hash_mask];
+    index = hash_table_ptr->hash_story_ptr[index & hash_table_ptr->window_mask];
 
     while (index != OWN_UNINITIALIZED_INDEX &&
            attempt_number < current_number_of_attempts) {
-        if ((string_ptr - (lower_bound_ptr + index)) > OWN_MAXIMAL_OFFSET) {
+        if ((string_ptr - (lower_bound_ptr + index)) > window_size) {
             break;
         }
 
-        current_match_ptr = (uint8_t *) (lower_bound_ptr + index);
-        match_length      = compare_strings(current_match_ptr, string_ptr, upper_bound_ptr);
+        const uint32_t current_index = index;
+        current_match_ptr = (uint8_t *) (lower_bound_ptr + current_index);
+
+        // Going to next iteration
+        index = hash_table_ptr->hash_story_ptr[current_index & hash_table_ptr->window_mask];
+        attempt_number++;
+
+#ifndef SCORE_FUNCTION
+        // The candidate can't be longer than the best match if the byte that would extend the match differs
+        if (current_match_ptr >= string_ptr ||
+            current_match_ptr[best_match.length] != string_ptr[best_match.length]) {
+            continue;
+        }
+#endif
+
+        match_length = compare_strings(current_match_ptr, string_ptr, upper_bound_ptr);
 #ifdef SCORE_FUNCTION
         match_score = own_score_function(match_length, string_ptr - current_match_ptr);
 #endif
@@ -102,35 +166,37 @@ static inline deflate_match_t get_best_match(const deflate_hash_table_t *const h
 #else
         if (best_match.length < match_length) {
 #endif
-            best_match.index  = index;
+            best_match.index  = current_index;
             best_match.length = match_length;
 #ifdef SCORE_FUNCTION
             best_match.score = match_score;
 #endif
             best_match.offset = (uint32_t) (string_ptr - current_match_ptr);
 
-            if (best_match.length >= 258u) {
+            if (best_match.length >= hash_table_ptr->nice_match) {
                 break;
             }
         }
-
-        // Going to next iteration
-        index = hash_table_ptr->hash_story_ptr[index & hash_table_ptr->hash_mask];
-        attempt_number++;
     }
 
     return best_match;
 }
 
-deflate_match_t get_lazy_best_match(const deflate_hash_table_t *const hash_table_ptr,
-                                    const uint8_t *const lower_bound_ptr,
-                                    const uint8_t *const string_ptr,
-                                    const uint8_t *const upper_bound_ptr) {
+OWN_QPLC_FUN(deflate_match_t, get_lazy_best_match, (const deflate_hash_table_t *const hash_table_ptr,
+                                                    const uint8_t *const lower_bound_ptr,
+                                                    const uint8_t *const string_ptr,
+                                                    const uint8_t *const upper_bound_ptr)) {
     // Variables
     const uint8_t *current_ptr = string_ptr + 1u;
 
     // Getting initial matches for "lazy matching" logic from Zlib
-    deflate_match_t longest_match      = get_best_match(hash_table_ptr, lower_bound_ptr, string_ptr, upper_bound_ptr);
+    deflate_match_t longest_match = get_best_match(hash_table_ptr, lower_bound_ptr, string_ptr, upper_bound_ptr);
+
+    if (longest_match.length >= hash_table_ptr->lazy_match) {
+        // The match is good enough, the next position is not searched
+        return longest_match;
+    }
+
     deflate_match_t next_longest_match = get_best_match(hash_table_ptr, lower_bound_ptr, current_ptr, upper_bound_ptr);
 
     // Searching for the longest match
@@ -21,7 +21,7 @@
 
 #endif
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 static inline uint32_t bsr(uint32_t val) {
     uint32_t msb = 0;
@@ -98,14 +98,12 @@ static inline uint32_t own_get_offset_table_index(const uint32_t offset) {
         return 18 + (offset - 1) / 512;
     } else if (offset <= 4096) {
         return 20 + (offset - 1) / 1024;
-#if defined(DEFLATE_WINDOW_SIZE_ABOVE_4K)
-        } else if (offset <= 8192) {
-            return 22 + (offset - 1) / 2048;
-        } else if (offset <= 16384) {
-            return 24 + (offset - 1) / 4096;
-        } else if (offset <= 32768) {
-            return 26 + (offset - 1) / 8192;
-#endif
+    } else if (offset <= 8192) {
+        return 22 + (offset - 1) / 2048;
+    } else if (offset <= 16384) {
+        return 24 + (offset - 1) / 4096;
+    } else if (offset <= 32768) {
+        return 26 + (offset - 1) / 8192;
     } else {
         // ~0 is an invalid distance code
         return ~0u;
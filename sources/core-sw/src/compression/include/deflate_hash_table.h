@@ -30,6 +30,7 @@ typedef struct {
     uint32_t *hash_table_ptr;    /**< Pointer to the main hash-table */
     uint32_t *hash_story_ptr;    /**< Pointer to sub-hash-table that stores history of matches */
     uint32_t hash_mask;          /**< Bit-mask that is used to cropping hash-values to not overflow the table */
+    uint32_t window_mask;        /**< Bit-mask of the history window, sub-hash-table has an entry per window position */
     uint32_t attempts;           /**< Number of attempts to find a better match in sub-hash-table */
     uint32_t good_match;         /**< Length of the match that stops searching when reached */
     uint32_t nice_match;         /**< Stop searching when match length is longer or equal to this */
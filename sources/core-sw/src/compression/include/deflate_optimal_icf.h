@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPLC_DEFLATE_OPTIMAL_ICF_H_
+#define QPLC_DEFLATE_OPTIMAL_ICF_H_
+
+#include "igzip_level_buf_structs.h"
+
+#include "deflate_hash_table.h"
+#include "deflate_defs.h"
+
+#include "own_qplc_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OWN_OPTIMAL_SEGMENT_SIZE     4096u  /**> Maximal number of positions parsed at once */
+#define OWN_OPTIMAL_MIN_SEGMENT_SIZE 1024u  /**> Block is finished if less positions fit into the ICF buffer */
+#define OWN_OPTIMAL_ITERATIONS       2u     /**> Number of parsing passes with the refined cost model */
+#define OWN_OPTIMAL_MAX_ATTEMPTS     1024u  /**> Limit of the hash chain search, it is done at every position */
+
+typedef struct isal_mod_hist      isal_mod_hist;
+typedef struct deflate_icf_stream deflate_icf_stream;
+
+/**
+ * @brief Parses the input into ICF with the minimal estimated bit cost
+ *
+ * @details The input is processed by segments. Each segment is parsed several times by the shortest path search
+ *          over the positions, the symbol costs of the next pass are taken from the statistics of the previous one.
+ *          Matches are searched by the first pass only.
+ *          The free part of the ICF buffer is used as the work area, so the block is finished earlier than
+ *          with @ref slow_deflate_icf_body. The function also returns early if the statistics of the segment
+ *          differ enough from the block ones to start a new block with it.
+ *
+ * @return number of the processed bytes
+ */
+OWN_QPLC_FUN(uint32_t, optimal_deflate_icf_body, (uint8_t *current_ptr,
+    const uint8_t        *const lower_bound_ptr,
+    const uint8_t        *const upper_bound_ptr,
+    deflate_hash_table_t *hash_table_ptr,
+    isal_mod_hist        *histogram_ptr,
+    deflate_icf_stream   *icf_stream_ptr));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QPLC_DEFLATE_OPTIMAL_ICF_H_
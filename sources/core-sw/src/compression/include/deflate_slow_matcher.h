@@ -15,10 +15,15 @@
 extern "C" {
 #endif
 
-deflate_match_t get_lazy_best_match(const deflate_hash_table_t *const hash_table_ptr,
-                                    const uint8_t *const lower_bound_ptr,
-                                    const uint8_t *const string_ptr,
-                                    const uint8_t *const upper_bound_ptr);
+/**
+ * @brief Finds the longest match at the given position with the lazy evaluation of the next positions
+ *
+ * @note The matcher is built for every platform below @ref K0, so it is called with @ref CALL_CORE_FUN
+ */
+OWN_QPLC_API(deflate_match_t, get_lazy_best_match, (const deflate_hash_table_t *const hash_table_ptr,
+                                                    const uint8_t *const lower_bound_ptr,
+                                                    const uint8_t *const string_ptr,
+                                                    const uint8_t *const upper_bound_ptr))
 
 #ifdef __cplusplus
 }
@@ -117,17 +117,15 @@ OWN_OPT_FUN(uint32_t,k0_slow_deflate_icf_body,(uint8_t* current_ptr,
     int                  indx_src = (int)(current_ptr - lower_bound_ptr);
     int                  indx_dst = 0;
     int                  hash_mask = hash_table_ptr->hash_mask;
-    int                  win_mask = QPLC_DEFLATE_MAXIMAL_OFFSET - 1;
+    int                  win_mask = (int)hash_table_ptr->window_mask;
     int                  hash_key = 0;
     int                  bound, win_bound, tmp, candidat, index;
-    uint32_t             win_size = QPLC_DEFLATE_MAXIMAL_OFFSET;
+    uint32_t             win_size = hash_table_ptr->window_mask + 1u;
     uint16_t             dist;
     uint8_t              length;
 
     {
-        /* The general case has been replaced with a fixed case for perfpormance reason. */
-        //int chain_length_current = hash_table_ptr->attempts;
-        int chain_length_current = 256;
+        int chain_length_current = (int)hash_table_ptr->attempts;
 
         int good_match = hash_table_ptr->good_match;
         int nice_match = hash_table_ptr->nice_match;
@@ -137,14 +137,13 @@ OWN_OPT_FUN(uint32_t, k0_slow_deflate_body,(uint8_t* current_ptr,
     int      src_len = (int)(upper_bound_ptr - lower_bound_ptr) - (MAX_MATCH + MIN_MATCH4 - 1);
     int      indx_src = (int)(current_ptr - lower_bound_ptr);
     int      hash_mask = hash_table_ptr->hash_mask;
-    int      win_mask = QPLC_DEFLATE_MAXIMAL_OFFSET - 1;
+    int      win_mask = (int)hash_table_ptr->window_mask;
     int      hash_key = 0;
     int      bound, win_bound, tmp, candidat, index;
-    uint32_t win_size = QPLC_DEFLATE_MAXIMAL_OFFSET;
+    uint32_t win_size = hash_table_ptr->window_mask + 1u;
 
     {
-        //        int chain_length_current = hash_table_ptr->attempts;
-        int chain_length_current = 256; /* temporary */
+        int chain_length_current = (int)hash_table_ptr->attempts;
         int good_match = hash_table_ptr->good_match;
         int nice_match = hash_table_ptr->nice_match;
         int lazy_match = hash_table_ptr->lazy_match;
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 helpers shared by the unpack functions for 8u, 16u and 32u output
+ *
+ * @details Each group of 8 elements takes exactly bit_width bytes of the input, so every element of a group
+ *          has the same byte offset and bit shift relative to the group start. These offsets are turned
+ *          into a byte shuffle control and a shift vector once per call, and every group is unpacked into
+ *          8 dwords with a gather-free shuffle, variable shift and mask. Bit widths up to 25 are supported,
+ *          so that every element fits into 4 bytes after the shuffle.
+ *
+ */
+
+#ifndef OWN_UNPACK_L9_H
+#define OWN_UNPACK_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+typedef struct {
+    __m256i  shuffle;         /**< Byte shuffle control, 4 bytes per element */
+    __m256i  shift;           /**< Bit shift of every element inside its dword */
+    __m256i  mask;            /**< Element mask */
+    uint32_t high_offset;     /**< Byte offset of the 5th element of a group */
+    uint32_t groups_count;    /**< Number of 8-element groups that can be unpacked without input overread */
+} own_l9_unpack_state_t;
+
+OWN_QPLC_INLINE(void, own_l9_unpack_init, (uint32_t num_elements,
+                                           uint32_t start_bit,
+                                           uint32_t bit_width,
+                                           own_l9_unpack_state_t *state_ptr)) {
+    OWN_ALIGNED_ARRAY(uint8_t shuffle[32], 32u);
+    OWN_ALIGNED_ARRAY(uint32_t shift[8], 32u);
+    uint32_t high_offset = (start_bit + 4u * bit_width) >> 3u;
+    uint64_t src_length  = ((uint64_t) start_bit + (uint64_t) num_elements * bit_width + 7u) >> 3u;
+
+    for (uint32_t idx = 0u; idx < 8u; idx++) {
+        uint32_t bit_offset  = start_bit + idx * bit_width;
+        uint32_t lane_offset = (idx < 4u) ? 0u : high_offset;
+
+        for (uint32_t byte_idx = 0u; byte_idx < 4u; byte_idx++) {
+            shuffle[idx * 4u + byte_idx] = (uint8_t) ((bit_offset >> 3u) - lane_offset + byte_idx);
+        }
+        shift[idx] = bit_offset & 7u;
+    }
+
+    state_ptr->shuffle     = _mm256_load_si256((const __m256i *) shuffle);
+    state_ptr->shift       = _mm256_load_si256((const __m256i *) shift);
+    state_ptr->mask        = _mm256_set1_epi32((int) OWN_BIT_MASK(bit_width));
+    state_ptr->high_offset = high_offset;
+
+    // Both 16-byte loads of the last group must stay inside the source
+    if (src_length < high_offset + 16u) {
+        state_ptr->groups_count = 0u;
+    } else {
+        uint64_t groups_count = (src_length - high_offset - 16u) / bit_width + 1u;
+        state_ptr->groups_count = (uint32_t) QPL_MIN(groups_count, (uint64_t) (num_elements >> 3u));
+    }
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_unpack_8x32u, (const uint8_t *src_ptr, const own_l9_unpack_state_t *state_ptr)) {
+    __m256i srcmm = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) src_ptr)),
+                                            _mm_loadu_si128((const __m128i *) (src_ptr + state_ptr->high_offset)),
+                                            1);
+
+    srcmm = _mm256_shuffle_epi8(srcmm, state_ptr->shuffle);
+    srcmm = _mm256_srlv_epi32(srcmm, state_ptr->shift);
+    return _mm256_and_si256(srcmm, state_ptr->mask);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_unpack_element, (const uint8_t *src_ptr, uint32_t bit_offset, uint32_t bit_width)) {
+    const uint8_t *byte_ptr   = src_ptr + (bit_offset >> 3u);
+    uint32_t       shift      = bit_offset & 7u;
+    uint32_t       bytes      = (shift + bit_width + 7u) >> 3u;
+    uint32_t       value      = 0u;
+
+    for (uint32_t idx = 0u; idx < bytes; idx++) {
+        value |= ((uint32_t) byte_ptr[idx]) << (idx * 8u);
+    }
+    return (value >> shift) & (uint32_t) OWN_BIT_MASK(bit_width);
+}
+
+#endif // OWN_UNPACK_L9_H
@@ -13,6 +13,7 @@
   *          - @ref qplc_aggregates_8u
   *          - @ref qplc_aggregates_16u
   *          - @ref qplc_aggregates_32u
+  *          - @ref qplc_aggregates_64u
   */
 #ifndef OWN_AGGREGATES_H
 #define OWN_AGGREGATES_H
@@ -501,5 +502,31 @@ There is the problem with compiler of MSVC2017.
 #endif
 #endif
 
+// ********************** 64u ****************************** //
+
+OWN_OPT_FUN(void, k0_qplc_aggregates_64u, (const uint8_t *src_ptr,
+    uint32_t length,
+    uint64_t *min_value_ptr,
+    uint64_t *max_value_ptr,
+    uint64_t *sum_ptr)) {
+    const uint64_t *src_64u_ptr = (const uint64_t *) src_ptr;
+    __m512i        z_min        = _mm512_set1_epi64((int64_t) *min_value_ptr);
+    __m512i        z_max        = _mm512_set1_epi64((int64_t) *max_value_ptr);
+    __m512i        z_sum        = _mm512_setzero_si512();
+
+    for (uint32_t idx = 0u; idx < length; idx += 8u) {
+        // Masked out lanes keep the current min and max, zeroes do not change the sum
+        const __mmask8 msk8   = (__mmask8) OWN_BIT_MASK(QPL_MIN(length - idx, 8u));
+        const __m512i  z_data = _mm512_maskz_loadu_epi64(msk8, (void const *) (src_64u_ptr + idx));
+
+        z_min = _mm512_mask_min_epu64(z_min, msk8, z_min, z_data);
+        z_max = _mm512_mask_max_epu64(z_max, msk8, z_max, z_data);
+        z_sum = _mm512_add_epi64(z_sum, z_data);
+    }
+
+    *min_value_ptr = _mm512_reduce_min_epu64(z_min);
+    *max_value_ptr = _mm512_reduce_max_epu64(z_max);
+    *sum_ptr      += (uint64_t) _mm512_reduce_add_epi64(z_sum);
+}
 
 #endif // OWN_AGGREGATES_H
@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for calculating aggregates for nominal bit vector and nominal array
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_bit_aggregates_8u
+ *          - @ref l9_qplc_aggregates_8u
+ *          - @ref l9_qplc_aggregates_16u
+ *          - @ref l9_qplc_aggregates_32u
+ */
+#ifndef OWN_AGGREGATES_L9_H
+#define OWN_AGGREGATES_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_add_32u, (__m256i srcmm)) {
+    __m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(srcmm), _mm256_extracti128_si256(srcmm, 1));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0x4E));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0xB1));
+    return (uint32_t) _mm_cvtsi128_si32(sum128);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_min_32u, (__m256i srcmm)) {
+    __m128i min128 = _mm_min_epu32(_mm256_castsi256_si128(srcmm), _mm256_extracti128_si256(srcmm, 1));
+    min128 = _mm_min_epu32(min128, _mm_shuffle_epi32(min128, 0x4E));
+    min128 = _mm_min_epu32(min128, _mm_shuffle_epi32(min128, 0xB1));
+    return (uint32_t) _mm_cvtsi128_si32(min128);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_max_32u, (__m256i srcmm)) {
+    __m128i max128 = _mm_max_epu32(_mm256_castsi256_si128(srcmm), _mm256_extracti128_si256(srcmm, 1));
+    max128 = _mm_max_epu32(max128, _mm_shuffle_epi32(max128, 0x4E));
+    max128 = _mm_max_epu32(max128, _mm_shuffle_epi32(max128, 0xB1));
+    return (uint32_t) _mm_cvtsi128_si32(max128);
+}
+
+// ********************** bit ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_bit_aggregates_8u, (const uint8_t *src_ptr,
+                                              uint32_t length,
+                                              uint32_t *min_value_ptr,
+                                              uint32_t *max_value_ptr,
+                                              uint32_t *sum_ptr,
+                                              uint32_t *index_ptr)) {
+    uint32_t length32  = length & (-32);
+    uint32_t index     = *index_ptr;
+    uint32_t min_value = *min_value_ptr;
+    uint32_t max_value = *max_value_ptr;
+    uint32_t sum       = 0u;
+    __m256i  zeromm    = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i  srcmm = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        uint32_t mask  = ~((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(srcmm, zeromm)));
+
+        if (0u != mask) {
+            if (OWN_MAX_32U == min_value) {
+                min_value = idx + index + (uint32_t) _tzcnt_u32(mask);
+            }
+            max_value = idx + index + 31u - (uint32_t) _lzcnt_u32(mask);
+            sum += (uint32_t) _mm_popcnt_u32(mask);
+        }
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        sum += src_ptr[idx];
+        if (OWN_MAX_32U == min_value) {
+            min_value = (0u == src_ptr[idx]) ? min_value : idx + index;
+        }
+        max_value = (0u == src_ptr[idx]) ? max_value : idx + index;
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr += length;
+}
+
+// ********************** 8u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_8u, (const uint8_t *src_ptr,
+                                          uint32_t length,
+                                          uint32_t *min_value_ptr,
+                                          uint32_t *max_value_ptr,
+                                          uint32_t *sum_ptr)) {
+    uint32_t length32 = length & (-32);
+    uint32_t min_value = *min_value_ptr;
+    uint32_t max_value = *max_value_ptr;
+    uint32_t sum       = 0u;
+
+    if (0u != length32) {
+        __m256i minmm = _mm256_set1_epi8((char) 0xFF);
+        __m256i maxmm = _mm256_setzero_si256();
+        __m256i summm = _mm256_setzero_si256();
+
+        for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+            __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+
+            minmm = _mm256_min_epu8(minmm, srcmm);
+            maxmm = _mm256_max_epu8(maxmm, srcmm);
+            summm = _mm256_add_epi32(summm, _mm256_sad_epu8(srcmm, _mm256_setzero_si256()));
+        }
+
+        // Widen byte-wise min/max to dwords before the horizontal reduction
+        __m256i lowmm = _mm256_set1_epi32(0xFF);
+        minmm = _mm256_min_epu8(minmm, _mm256_srli_epi32(minmm, 8u));
+        minmm = _mm256_min_epu8(minmm, _mm256_srli_epi32(minmm, 16u));
+        maxmm = _mm256_max_epu8(maxmm, _mm256_srli_epi32(maxmm, 8u));
+        maxmm = _mm256_max_epu8(maxmm, _mm256_srli_epi32(maxmm, 16u));
+
+        uint32_t vector_min = own_l9_reduce_min_32u(_mm256_and_si256(minmm, lowmm));
+        uint32_t vector_max = own_l9_reduce_max_32u(_mm256_and_si256(maxmm, lowmm));
+
+        min_value = (vector_min < min_value) ? vector_min : min_value;
+        max_value = (vector_max > max_value) ? vector_max : max_value;
+        sum       = own_l9_reduce_add_32u(summm);
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        sum += src_ptr[idx];
+        min_value = (src_ptr[idx] < min_value) ? src_ptr[idx] : min_value;
+        max_value = (src_ptr[idx] > max_value) ? src_ptr[idx] : max_value;
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+}
+
+// ********************** 16u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_16u, (const uint8_t *src_ptr,
+                                           uint32_t length,
+                                           uint32_t *min_value_ptr,
+                                           uint32_t *max_value_ptr,
+                                           uint32_t *sum_ptr)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    uint32_t length16 = length & (-16);
+    uint32_t min_value = *min_value_ptr;
+    uint32_t max_value = *max_value_ptr;
+    uint32_t sum       = 0u;
+
+    if (0u != length16) {
+        __m256i minmm = _mm256_set1_epi16((short) OWN_MAX_16U);
+        __m256i maxmm = _mm256_setzero_si256();
+        __m256i summm = _mm256_setzero_si256();
+        __m256i lowmm = _mm256_set1_epi32(OWN_MAX_16U);
+
+        for (uint32_t idx = 0u; idx < length16; idx += 16u) {
+            __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx));
+
+            minmm = _mm256_min_epu16(minmm, srcmm);
+            maxmm = _mm256_max_epu16(maxmm, srcmm);
+            summm = _mm256_add_epi32(summm, _mm256_and_si256(srcmm, lowmm));
+            summm = _mm256_add_epi32(summm, _mm256_srli_epi32(srcmm, 16u));
+        }
+
+        minmm = _mm256_min_epu16(minmm, _mm256_srli_epi32(minmm, 16u));
+        maxmm = _mm256_max_epu16(maxmm, _mm256_srli_epi32(maxmm, 16u));
+
+        uint32_t vector_min = own_l9_reduce_min_32u(_mm256_and_si256(minmm, lowmm));
+        uint32_t vector_max = own_l9_reduce_max_32u(_mm256_and_si256(maxmm, lowmm));
+
+        min_value = (vector_min < min_value) ? vector_min : min_value;
+        max_value = (vector_max > max_value) ? vector_max : max_value;
+        sum       = own_l9_reduce_add_32u(summm);
+    }
+
+    for (uint32_t idx = length16; idx < length; idx++) {
+        sum += src_16u_ptr[idx];
+        min_value = (src_16u_ptr[idx] < min_value) ? src_16u_ptr[idx] : min_value;
+        max_value = (src_16u_ptr[idx] > max_value) ? src_16u_ptr[idx] : max_value;
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+}
+
+// ********************** 32u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_32u, (const uint8_t *src_ptr,
+                                           uint32_t length,
+                                           uint32_t *min_value_ptr,
+                                           uint32_t *max_value_ptr,
+                                           uint32_t *sum_ptr)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    uint32_t length8  = length & (-8);
+    uint32_t min_value = *min_value_ptr;
+    uint32_t max_value = *max_value_ptr;
+    uint32_t sum       = 0u;
+
+    if (0u != length8) {
+        __m256i minmm = _mm256_set1_epi32((int) OWN_MAX_32U);
+        __m256i maxmm = _mm256_setzero_si256();
+        __m256i summm = _mm256_setzero_si256();
+
+        for (uint32_t idx = 0u; idx < length8; idx += 8u) {
+            __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx));
+
+            minmm = _mm256_min_epu32(minmm, srcmm);
+            maxmm = _mm256_max_epu32(maxmm, srcmm);
+            summm = _mm256_add_epi32(summm, srcmm);
+        }
+
+        uint32_t vector_min = own_l9_reduce_min_32u(minmm);
+        uint32_t vector_max = own_l9_reduce_max_32u(maxmm);
+
+        min_value = (vector_min < min_value) ? vector_min : min_value;
+        max_value = (vector_max > max_value) ? vector_max : max_value;
+        sum       = own_l9_reduce_add_32u(summm);
+    }
+
+    for (uint32_t idx = length8; idx < length; idx++) {
+        sum += src_32u_ptr[idx];
+        min_value = (src_32u_ptr[idx] < min_value) ? src_32u_ptr[idx] : min_value;
+        max_value = (src_32u_ptr[idx] > max_value) ? src_32u_ptr[idx] : max_value;
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+}
+
+#endif // OWN_AGGREGATES_L9_H
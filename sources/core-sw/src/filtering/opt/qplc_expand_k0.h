@@ -12,6 +12,7 @@
   *          - @ref k0_qplc_expand_8u
   *          - @ref k0_qplc_expand_16u
   *          - @ref k0_qplc_expand_32u
+  *          - @ref k0_qplc_expand_64u
 *
   */
 #ifndef OWN_EXPAND_H
@@ -293,5 +294,48 @@ OWN_OPT_FUN(uint32_t, k0_qplc_qplc_expand_32u, (const uint8_t* src1_ptr,
     return expanded;
 }
 
+// ********************** 64u ****************************** //
+OWN_OPT_FUN(uint32_t, k0_qplc_expand_64u, (const uint8_t *src1_ptr,
+    uint32_t length_1,
+    const uint8_t *src2_ptr,
+    uint32_t *length_2_ptr,
+    uint8_t *dst_ptr)) {
+    uint64_t *src_64u_ptr = (uint64_t *) src1_ptr;
+    uint64_t *dst_64u_ptr = (uint64_t *) dst_ptr;
+    uint32_t length_2     = *length_2_ptr;
+    uint32_t expanded     = 0u;
+    uint32_t idx          = 0u;
+
+    while (idx < length_2) {
+        const uint32_t  group_length = QPL_MIN(length_2 - idx, 8u);
+        const __mmask16 group_mask   = (__mmask16) OWN_BIT_MASK(group_length);
+        const __mmask8  expand_mask  = (__mmask8) _mm_cmpneq_epi8_mask(_mm_maskz_loadu_epi8(group_mask, src2_ptr + idx),
+                                                                       _mm_setzero_si128());
+        const uint32_t  num_data     = (uint32_t) _mm_popcnt_u32((uint32_t) expand_mask);
+
+        if ((expanded + num_data) > length_1) {
+            break;
+        }
+
+        // Expand load reads exactly num_data source elements
+        __m512i z_data = _mm512_maskz_expandloadu_epi64(expand_mask, src_64u_ptr + expanded);
+
+        _mm512_mask_storeu_epi64(dst_64u_ptr + idx, (__mmask8) group_mask, z_data);
+        expanded += num_data;
+        idx      += group_length;
+    }
+
+    // The group that runs out of the source elements is finished element by element
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_64u_ptr[idx] = src_64u_ptr[expanded++];
+        } else {
+            dst_64u_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
 
 #endif // OWN_EXPAND_H
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for expand
+ *
+ * @details Expand is the inverse of select: the mask byte of every output element is turned into a bit mask
+ *          and the packed source elements are deposited into the set positions with PDEP (8u, 16u)
+ *          or with a dword permutation whose indices are deposited the same way (32u). A group of elements is
+ *          processed while the source surely has enough elements for it, the rest is done by the generic code.
+ *
+ *          Function list:
+ *          - @ref l9_qplc_expand_8u
+ *          - @ref l9_qplc_expand_16u
+ *          - @ref l9_qplc_expand_32u
+ *
+ */
+
+#ifndef OWN_EXPAND_L9_H
+#define OWN_EXPAND_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Returns bit mask of non-zero bytes for 8 bytes of the mask vector
+ */
+OWN_QPLC_INLINE(uint32_t, own_l9_expand_mask_8, (const uint8_t *src2_ptr)) {
+    const __m128i mask_mm = _mm_loadl_epi64((const __m128i *) src2_ptr);
+
+    return (~((uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(mask_mm, _mm_setzero_si128())))) & 0xFFu;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_expand_8u, (const uint8_t *src1_ptr,
+                                          uint32_t length_1,
+                                          const uint8_t *src2_ptr,
+                                          uint32_t *length_2_ptr,
+                                          uint8_t *dst_ptr)) {
+    const uint32_t length_2 = *length_2_ptr;
+    uint32_t       expanded = 0u;
+    uint32_t       idx      = 0u;
+
+    // 8 source bytes are read for every 8 output elements
+    for (; (idx + 8u <= length_2) && (expanded + 8u <= length_1); idx += 8u) {
+        const uint32_t mask8     = own_l9_expand_mask_8(src2_ptr + idx);
+        const uint64_t byte_mask = _pdep_u64(mask8, 0x0101010101010101ULL) * 0xFFu;
+
+        *(uint64_t *) (dst_ptr + idx) = _pdep_u64(*(const uint64_t *) (src1_ptr + expanded), byte_mask);
+        expanded += (uint32_t) _mm_popcnt_u32(mask8);
+    }
+
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_ptr[idx] = src1_ptr[expanded++];
+        } else {
+            dst_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_expand_16u, (const uint8_t *src1_ptr,
+                                           uint32_t length_1,
+                                           const uint8_t *src2_ptr,
+                                           uint32_t *length_2_ptr,
+                                           uint8_t *dst_ptr)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src1_ptr;
+    uint16_t       *dst_16u_ptr = (uint16_t *) dst_ptr;
+    const uint32_t length_2     = *length_2_ptr;
+    uint32_t       expanded     = 0u;
+    uint32_t       idx          = 0u;
+
+    // 4 source words are read for every 4 output elements
+    for (; (idx + 8u <= length_2) && (expanded + 8u <= length_1); idx += 8u) {
+        const uint32_t mask8 = own_l9_expand_mask_8(src2_ptr + idx);
+
+        for (uint32_t i = 0u; i < 8u; i += 4u) {
+            const uint32_t mask4     = (mask8 >> i) & 0x0Fu;
+            const uint64_t word_mask = _pdep_u64(mask4, 0x0001000100010001ULL) * 0xFFFFu;
+
+            *(uint64_t *) (dst_16u_ptr + idx + i) = _pdep_u64(*(const uint64_t *) (src_16u_ptr + expanded), word_mask);
+            expanded += (uint32_t) _mm_popcnt_u32(mask4);
+        }
+    }
+
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_16u_ptr[idx] = src_16u_ptr[expanded++];
+        } else {
+            dst_16u_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_expand_32u, (const uint8_t *src1_ptr,
+                                           uint32_t length_1,
+                                           const uint8_t *src2_ptr,
+                                           uint32_t *length_2_ptr,
+                                           uint8_t *dst_ptr)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src1_ptr;
+    uint32_t       *dst_32u_ptr = (uint32_t *) dst_ptr;
+    const uint32_t length_2     = *length_2_ptr;
+    uint32_t       expanded     = 0u;
+    uint32_t       idx          = 0u;
+
+    // 8 source dwords are read for every 8 output elements
+    for (; (idx + 8u <= length_2) && (expanded + 8u <= length_1); idx += 8u) {
+        const uint32_t mask8     = own_l9_expand_mask_8(src2_ptr + idx);
+        const uint64_t byte_mask = _pdep_u64(mask8, 0x0101010101010101ULL) * 0xFFu;
+
+        // The set positions get the indices 0, 1, 2... of the packed elements, the others are zeroed below
+        const __m256i  index_mm  = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long) _pdep_u64(0x0706050403020100ULL,
+                                                                                                byte_mask)));
+        const __m256i  select_mm = _mm256_cvtepi8_epi32(_mm_cvtsi64_si128((long long) byte_mask));
+        const __m256i  src_mm    = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + expanded));
+
+        _mm256_storeu_si256((__m256i *) (dst_32u_ptr + idx),
+                            _mm256_and_si256(_mm256_permutevar8x32_epi32(src_mm, index_mm), select_mm));
+        expanded += (uint32_t) _mm_popcnt_u32(mask8);
+    }
+
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_32u_ptr[idx] = src_32u_ptr[expanded++];
+        } else {
+            dst_32u_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
+
+#endif // OWN_EXPAND_L9_H
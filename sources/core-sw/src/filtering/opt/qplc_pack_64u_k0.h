@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of packing qwords to 33..64-bit data
+ *
+ * @details Each group of 8 elements takes exactly bit_width bytes of the output, so all groups share the same
+ *          layout. Every output qword is assembled from the (at most) 3 elements that overlap it with permutes
+ *          and variable shifts. The bits of the last element that fall into the byte shared with the next group
+ *          are carried over in a scalar register. Stores of the trailing group are masked, so no byte past the
+ *          output is touched.
+ *
+ *          Function list:
+ *          - @ref k0_qplc_pack_64u_nu
+ *
+ */
+
+#ifndef OWN_PACK_64U_K0_H
+#define OWN_PACK_64U_K0_H
+
+#include "own_qplc_defs.h"
+
+#define OWN_PACK_64U_K0_CANDIDATES 3u /**< Max number of 33+ bit elements overlapping one output qword */
+
+OWN_QPLC_INLINE(__mmask64, own_k0_pack_bytes_mask, (uint32_t bytes)) {
+    return (bytes >= 64u) ? (__mmask64) UINT64_MAX : (__mmask64) OWN_BIT_MASK(bytes);
+}
+
+OWN_QPLC_INLINE(__m512i, own_k0_pack_64u_group, (__m512i src_mm,
+    const __m512i *index_mm,
+    const __m512i *left_shift_mm,
+    const __m512i *right_shift_mm)) {
+    const __m512i zero_mm   = _mm512_setzero_si512();
+    __m512i       result_mm = zero_mm;
+
+    for (uint32_t i = 0u; i < OWN_PACK_64U_K0_CANDIDATES; i++) {
+        // Indices 8 and above select zero, shifts by 64 bits give zero for the element that doesn't overlap
+        const __m512i value_mm = _mm512_permutex2var_epi64(src_mm, index_mm[i], zero_mm);
+
+        result_mm = _mm512_or_si512(result_mm, _mm512_sllv_epi64(value_mm, left_shift_mm[i]));
+        result_mm = _mm512_or_si512(result_mm, _mm512_srlv_epi64(value_mm, right_shift_mm[i]));
+    }
+
+    return result_mm;
+}
+
+OWN_OPT_FUN(void, k0_qplc_pack_64u_nu, (const uint8_t *src_ptr,
+    uint32_t num_elements,
+    uint32_t bit_width,
+    uint8_t *dst_ptr,
+    uint32_t start_bit)) {
+    OWN_ALIGNED_64_ARRAY(int64_t index[OWN_PACK_64U_K0_CANDIDATES][8]);
+    OWN_ALIGNED_64_ARRAY(int64_t left_shift[OWN_PACK_64U_K0_CANDIDATES][8]);
+    OWN_ALIGNED_64_ARRAY(int64_t right_shift[OWN_PACK_64U_K0_CANDIDATES][8]);
+    __m512i index_mm[OWN_PACK_64U_K0_CANDIDATES];
+    __m512i left_shift_mm[OWN_PACK_64U_K0_CANDIDATES];
+    __m512i right_shift_mm[OWN_PACK_64U_K0_CANDIDATES];
+
+    for (int64_t lane = 0; lane < 8; lane++) {
+        const int64_t qword_bit     = lane * (int64_t) OWN_QWORD_WIDTH;
+        const int64_t first_element = (qword_bit > (int64_t) start_bit)
+                                      ? (qword_bit - (int64_t) start_bit) / (int64_t) bit_width
+                                      : 0;
+
+        for (uint32_t i = 0u; i < OWN_PACK_64U_K0_CANDIDATES; i++) {
+            const int64_t element = first_element + (int64_t) i;
+            const int64_t offset  = (int64_t) start_bit + element * (int64_t) bit_width - qword_bit;
+
+            index[i][lane]       = QPL_MIN(element, 8);
+            left_shift[i][lane]  = (0 <= offset) ? offset : (int64_t) OWN_QWORD_WIDTH;
+            right_shift[i][lane] = (0 > offset) ? -offset : (int64_t) OWN_QWORD_WIDTH;
+        }
+    }
+
+    for (uint32_t i = 0u; i < OWN_PACK_64U_K0_CANDIDATES; i++) {
+        index_mm[i]       = _mm512_load_si512(index[i]);
+        left_shift_mm[i]  = _mm512_load_si512(left_shift[i]);
+        right_shift_mm[i] = _mm512_load_si512(right_shift[i]);
+    }
+
+    // Bits below start_bit in the first byte are kept, then every group passes its trailing bits to the next one
+    uint64_t carry = (uint64_t) (*dst_ptr) & OWN_BIT_MASK(start_bit);
+
+    while (8u <= num_elements) {
+        const __m512i src_mm = _mm512_loadu_si512(src_ptr);
+        __m512i result_mm    = own_k0_pack_64u_group(src_mm, index_mm, left_shift_mm, right_shift_mm);
+
+        result_mm = _mm512_or_si512(result_mm, _mm512_zextsi128_si512(_mm_cvtsi64_si128((int64_t) carry)));
+        _mm512_mask_storeu_epi8(dst_ptr, own_k0_pack_bytes_mask(bit_width), result_mm);
+
+        carry = (0u < start_bit) ? ((const uint64_t *) src_ptr)[7] >> (bit_width - start_bit) : 0u;
+
+        src_ptr      += 8u * sizeof(uint64_t);
+        dst_ptr      += bit_width;
+        num_elements -= 8u;
+    }
+
+    if (0u < num_elements) {
+        const __m512i src_mm = _mm512_maskz_loadu_epi64((__mmask8) OWN_BIT_MASK(num_elements), src_ptr);
+        __m512i result_mm    = own_k0_pack_64u_group(src_mm, index_mm, left_shift_mm, right_shift_mm);
+
+        result_mm = _mm512_or_si512(result_mm, _mm512_zextsi128_si512(_mm_cvtsi64_si128((int64_t) carry)));
+        _mm512_mask_storeu_epi8(dst_ptr,
+                                own_k0_pack_bytes_mask(OWN_BITS_2_BYTE(start_bit + num_elements * bit_width)),
+                                result_mm);
+    } else if (0u < start_bit) {
+        *dst_ptr = (uint8_t) carry;
+    }
+}
+
+#endif // OWN_PACK_64U_K0_H
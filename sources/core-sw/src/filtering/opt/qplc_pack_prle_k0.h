@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of run detection functions used by the PRLE (Parquet RLE) encoder
+ *
+ * @details The run length is found with a single compare against the broadcast value per 64 bytes. Octets of equal
+ *          elements are found by broadcasting the first element of every octet over the octet and comparing
+ *          qwords, an octet is equal when all its qwords match. Tails are read with masked loads.
+ *
+ *          Function list:
+ *          - @ref k0_qplc_prle_run_length_8u
+ *          - @ref k0_qplc_prle_run_length_16u
+ *          - @ref k0_qplc_prle_run_length_32u
+ *          - @ref k0_qplc_prle_find_equal_octet_8u
+ *          - @ref k0_qplc_prle_find_equal_octet_16u
+ *          - @ref k0_qplc_prle_find_equal_octet_32u
+ *
+ */
+
+#ifndef OWN_PACK_PRLE_K0_H
+#define OWN_PACK_PRLE_K0_H
+
+#include "own_qplc_defs.h"
+
+// Shuffle that copies the first byte of every qword to the whole qword
+static const uint8_t p_prle_octet_8u_shuffle[64] = {
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 8u, 8u, 8u, 8u, 8u, 8u, 8u,
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 8u, 8u, 8u, 8u, 8u, 8u, 8u,
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 8u, 8u, 8u, 8u, 8u, 8u, 8u,
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 8u, 8u, 8u, 8u, 8u, 8u, 8u};
+
+// Shuffle that copies the first word of every 128-bit lane to the whole lane
+static const uint8_t p_prle_octet_16u_shuffle[64] = {
+    0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u,
+    0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u,
+    0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u,
+    0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u};
+
+// Permutation that copies the first dword of every 256-bit half to the whole half
+static const uint32_t p_prle_octet_32u_permute[16] = {
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 8u, 8u, 8u, 8u, 8u, 8u, 8u};
+
+OWN_OPT_FUN(uint32_t, k0_qplc_prle_run_length_8u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+    const __m512i value_mm = _mm512_set1_epi8((char) value);
+    uint32_t      idx      = 0u;
+
+    for (; idx + 64u <= num_elements; idx += 64u) {
+        const __mmask64 mask = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(src_ptr + idx), value_mm);
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u64(mask);
+        }
+    }
+
+    if (idx < num_elements) {
+        const __mmask64 tail_mask = (__mmask64) OWN_BIT_MASK(num_elements - idx);
+        const __mmask64 mask      = _mm512_mask_cmpneq_epi8_mask(tail_mask,
+                                                                 _mm512_maskz_loadu_epi8(tail_mask, src_ptr + idx),
+                                                                 value_mm);
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u64(mask);
+        }
+    }
+
+    return num_elements;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_prle_run_length_16u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    const __m512i  value_mm     = _mm512_set1_epi16((short) value);
+    uint32_t       idx          = 0u;
+
+    for (; idx + 32u <= num_elements; idx += 32u) {
+        const __mmask32 mask = _mm512_cmpneq_epi16_mask(_mm512_loadu_si512(src_16u_ptr + idx), value_mm);
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    if (idx < num_elements) {
+        const __mmask32 tail_mask = (__mmask32) OWN_BIT_MASK(num_elements - idx);
+        const __mmask32 mask      = _mm512_mask_cmpneq_epi16_mask(tail_mask,
+                                                                  _mm512_maskz_loadu_epi16(tail_mask,
+                                                                                           src_16u_ptr + idx),
+                                                                  value_mm);
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    return num_elements;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_prle_run_length_32u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    const __m512i  value_mm     = _mm512_set1_epi32((int) value);
+    uint32_t       idx          = 0u;
+
+    for (; idx + 16u <= num_elements; idx += 16u) {
+        const __mmask16 mask = _mm512_cmpneq_epi32_mask(_mm512_loadu_si512(src_32u_ptr + idx), value_mm);
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    if (idx < num_elements) {
+        const __mmask16 tail_mask = (__mmask16) OWN_BIT_MASK(num_elements - idx);
+        const __mmask16 mask      = _mm512_mask_cmpneq_epi32_mask(tail_mask,
+                                                                  _mm512_maskz_loadu_epi32(tail_mask,
+                                                                                           src_32u_ptr + idx),
+                                                                  value_mm);
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    return num_elements;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_prle_find_equal_octet_8u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+    // An octet is a single qword, 8 octets per vector
+    const __m512i shuffle_mm = _mm512_loadu_si512(p_prle_octet_8u_shuffle);
+    uint32_t      idx        = 0u;
+
+    for (; idx + 8u <= num_octets; idx += 8u) {
+        const __m512i src_mm = _mm512_loadu_si512(src_ptr + idx * 8u);
+        const __mmask8 mask  = _mm512_cmpeq_epi64_mask(src_mm, _mm512_shuffle_epi8(src_mm, shuffle_mm));
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    if (idx < num_octets) {
+        const __mmask8 tail_mask = (__mmask8) OWN_BIT_MASK(num_octets - idx);
+        const __m512i  src_mm    = _mm512_maskz_loadu_epi64(tail_mask, src_ptr + idx * 8u);
+        const __mmask8 mask      = _mm512_mask_cmpeq_epi64_mask(tail_mask,
+                                                                src_mm,
+                                                                _mm512_shuffle_epi8(src_mm, shuffle_mm));
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    return num_octets;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_prle_find_equal_octet_16u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+    // An octet is two qwords, 4 octets per vector
+    const __m512i shuffle_mm = _mm512_loadu_si512(p_prle_octet_16u_shuffle);
+    uint32_t      idx        = 0u;
+
+    for (; idx + 4u <= num_octets; idx += 4u) {
+        const __m512i  src_mm = _mm512_loadu_si512(src_ptr + idx * 16u);
+        const uint32_t qwords = _mm512_cmpeq_epi64_mask(src_mm, _mm512_shuffle_epi8(src_mm, shuffle_mm));
+        const uint32_t mask   = qwords & (qwords >> 1u) & 0x55u;
+
+        if (0u != mask) {
+            return idx + ((uint32_t) _tzcnt_u32(mask) >> 1u);
+        }
+    }
+
+    if (idx < num_octets) {
+        const __mmask8 tail_mask = (__mmask8) OWN_BIT_MASK((num_octets - idx) * 2u);
+        const __m512i  src_mm    = _mm512_maskz_loadu_epi64(tail_mask, src_ptr + idx * 16u);
+        const uint32_t qwords    = _mm512_mask_cmpeq_epi64_mask(tail_mask,
+                                                                src_mm,
+                                                                _mm512_shuffle_epi8(src_mm, shuffle_mm));
+        const uint32_t mask      = qwords & (qwords >> 1u) & 0x55u;
+
+        if (0u != mask) {
+            return idx + ((uint32_t) _tzcnt_u32(mask) >> 1u);
+        }
+    }
+
+    return num_octets;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_prle_find_equal_octet_32u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+    // An octet is four qwords, 2 octets per vector
+    const __m512i permute_mm = _mm512_loadu_si512(p_prle_octet_32u_permute);
+    uint32_t      idx        = 0u;
+
+    for (; idx + 2u <= num_octets; idx += 2u) {
+        const __m512i  src_mm = _mm512_loadu_si512(src_ptr + idx * 32u);
+        const uint32_t qwords = _mm512_cmpeq_epi64_mask(src_mm, _mm512_permutexvar_epi32(permute_mm, src_mm));
+        const uint32_t mask   = qwords & (qwords >> 1u) & (qwords >> 2u) & (qwords >> 3u) & 0x11u;
+
+        if (0u != mask) {
+            return idx + ((uint32_t) _tzcnt_u32(mask) >> 2u);
+        }
+    }
+
+    if (idx < num_octets) {
+        // At most one octet is left
+        const __mmask8 tail_mask = (__mmask8) 0x0Fu;
+        const __m512i  src_mm    = _mm512_maskz_loadu_epi64(tail_mask, src_ptr + idx * 32u);
+        const uint32_t qwords    = _mm512_mask_cmpeq_epi64_mask(tail_mask,
+                                                                src_mm,
+                                                                _mm512_permutexvar_epi32(permute_mm, src_mm));
+
+        if (0x0Fu == qwords) {
+            return idx;
+        }
+    }
+
+    return num_octets;
+}
+
+#endif // OWN_PACK_PRLE_K0_H
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of run detection functions used by the PRLE (Parquet RLE) encoder
+ *
+ * @details The run length is found with a compare against the broadcast value per 32 bytes. Octets of equal
+ *          elements are found by broadcasting the first element of every octet over the octet, an octet is
+ *          equal when all its bytes match. Tails are processed by the generic code.
+ *
+ *          Function list:
+ *          - @ref l9_qplc_prle_run_length_8u
+ *          - @ref l9_qplc_prle_run_length_16u
+ *          - @ref l9_qplc_prle_run_length_32u
+ *          - @ref l9_qplc_prle_find_equal_octet_8u
+ *          - @ref l9_qplc_prle_find_equal_octet_16u
+ *
+ * @note An octet of 32u elements fills the whole vector, the generic code that stops at the first unequal element
+ *       is faster for it.
+ *
+ */
+
+#ifndef OWN_PACK_PRLE_L9_H
+#define OWN_PACK_PRLE_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+OWN_OPT_FUN(uint32_t, l9_qplc_prle_run_length_8u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+    const __m256i value_mm = _mm256_set1_epi8((char) value);
+    uint32_t      idx      = 0u;
+
+    for (; idx + 32u <= num_elements; idx += 32u) {
+        const __m256i  src_mm = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        const uint32_t mask   = ~((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(src_mm, value_mm)));
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    while ((idx < num_elements) && (value == src_ptr[idx])) {
+        idx++;
+    }
+
+    return idx;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_prle_run_length_16u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    const __m256i  value_mm     = _mm256_set1_epi16((short) value);
+    uint32_t       idx          = 0u;
+
+    for (; idx + 16u <= num_elements; idx += 16u) {
+        const __m256i  src_mm = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx));
+        const uint32_t mask   = ~((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi16(src_mm, value_mm)));
+
+        if (0u != mask) {
+            return idx + ((uint32_t) _tzcnt_u32(mask) >> 1u);
+        }
+    }
+
+    while ((idx < num_elements) && (value == src_16u_ptr[idx])) {
+        idx++;
+    }
+
+    return idx;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_prle_run_length_32u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    const __m256i  value_mm     = _mm256_set1_epi32((int) value);
+    uint32_t       idx          = 0u;
+
+    for (; idx + 8u <= num_elements; idx += 8u) {
+        const __m256i  src_mm = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx));
+        const uint32_t mask   = ~((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi32(src_mm, value_mm)));
+
+        if (0u != mask) {
+            return idx + ((uint32_t) _tzcnt_u32(mask) >> 2u);
+        }
+    }
+
+    while ((idx < num_elements) && (value == src_32u_ptr[idx])) {
+        idx++;
+    }
+
+    return idx;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_prle_find_equal_octet_8u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+    // An octet is a single qword, 4 octets per vector
+    const __m256i shuffle_mm = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8,
+                                                0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8);
+    const uint64_t *src_64u_ptr = (const uint64_t *) src_ptr;
+    uint32_t       idx          = 0u;
+
+    for (; idx + 4u <= num_octets; idx += 4u) {
+        const __m256i  src_mm = _mm256_loadu_si256((const __m256i *) (src_64u_ptr + idx));
+        const uint32_t mask   = (uint32_t) _mm256_movemask_pd(
+                _mm256_castsi256_pd(_mm256_cmpeq_epi64(src_mm, _mm256_shuffle_epi8(src_mm, shuffle_mm))));
+
+        if (0u != mask) {
+            return idx + (uint32_t) _tzcnt_u32(mask);
+        }
+    }
+
+    for (; idx < num_octets; idx++) {
+        const uint64_t octet = src_64u_ptr[idx];
+
+        if (octet == (octet & 0xFFu) * 0x0101010101010101LLu) {
+            return idx;
+        }
+    }
+
+    return num_octets;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_prle_find_equal_octet_16u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+    // An octet is a 128-bit lane, 2 octets per vector
+    const __m256i shuffle_mm = _mm256_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+                                                0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1);
+    uint32_t      idx        = 0u;
+
+    for (; idx + 2u <= num_octets; idx += 2u) {
+        const __m256i  src_mm = _mm256_loadu_si256((const __m256i *) (src_ptr + idx * 16u));
+        const uint32_t bytes  = (uint32_t) _mm256_movemask_epi8(
+                _mm256_cmpeq_epi16(src_mm, _mm256_shuffle_epi8(src_mm, shuffle_mm)));
+
+        if (0x0000FFFFu == (bytes & 0x0000FFFFu)) {
+            return idx;
+        }
+
+        if (0xFFFF0000u == (bytes & 0xFFFF0000u)) {
+            return idx + 1u;
+        }
+    }
+
+    if (idx < num_octets) {
+        // At most one octet is left
+        const __m128i  src_mm = _mm_loadu_si128((const __m128i *) (src_ptr + idx * 16u));
+        const uint32_t bytes  = (uint32_t) _mm_movemask_epi8(
+                _mm_cmpeq_epi16(src_mm, _mm_shuffle_epi8(src_mm, _mm256_castsi256_si128(shuffle_mm))));
+
+        if (0xFFFFu == bytes) {
+            return idx;
+        }
+    }
+
+    return num_octets;
+}
+
+#endif // OWN_PACK_PRLE_L9_H
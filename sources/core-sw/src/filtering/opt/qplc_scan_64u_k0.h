@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of in-place scan functions for 64u input data with 64-bit parameters
+ *
+ * @details 8 qwords are compared into a mask register at a time, the mask is expanded to 8 result bytes.
+ *          Loads and stores of the trailing elements are masked.
+ *
+ *          Function list:
+ *          - @ref k0_qplc_scan_eq_64u8u_i
+ *          - @ref k0_qplc_scan_ne_64u8u_i
+ *          - @ref k0_qplc_scan_lt_64u8u_i
+ *          - @ref k0_qplc_scan_le_64u8u_i
+ *          - @ref k0_qplc_scan_gt_64u8u_i
+ *          - @ref k0_qplc_scan_ge_64u8u_i
+ *          - @ref k0_qplc_scan_range_64u8u_i
+ *          - @ref k0_qplc_scan_not_range_64u8u_i
+ *
+ */
+
+#ifndef OWN_SCAN_64U_K0_H
+#define OWN_SCAN_64U_K0_H
+
+#include "own_qplc_defs.h"
+
+OWN_QPLC_INLINE(void, own_k0_store_scan_64u_mask, (uint8_t *dst_ptr, __mmask8 scan_mask, uint32_t elements)) {
+    const __m128i result = _mm_maskz_mov_epi8((__mmask16) scan_mask, _mm_set1_epi8(1));
+
+    _mm_mask_storeu_epi8(dst_ptr, (__mmask16) OWN_BIT_MASK(elements), result);
+}
+
+#define OWN_K0_SCAN_64U_FUN(name, predicate)                                                                  \
+OWN_OPT_FUN(void, k0_qplc_scan_##name##_64u8u_i, (uint8_t *src_dst_ptr,                                       \
+    uint32_t length,                                                                                          \
+    uint64_t low_value)) {                                                                                    \
+    const __m512i low_value_mm = _mm512_set1_epi64((int64_t) low_value);                                      \
+    uint8_t       *src_ptr     = src_dst_ptr;                                                                 \
+    uint8_t       *dst_ptr     = src_dst_ptr;                                                                 \
+                                                                                                              \
+    while (0u < length) {                                                                                     \
+        const uint32_t elements  = QPL_MIN(length, 8u);                                                       \
+        const __m512i  src_mm    = _mm512_maskz_loadu_epi64((__mmask8) OWN_BIT_MASK(elements), src_ptr);      \
+        const __mmask8 scan_mask = _mm512_cmp_epu64_mask(src_mm, low_value_mm, predicate);                    \
+        own_k0_store_scan_64u_mask(dst_ptr, scan_mask, elements);                                             \
+                                                                                                              \
+        src_ptr += elements * sizeof(uint64_t);                                                               \
+        dst_ptr += elements;                                                                                  \
+        length  -= elements;                                                                                  \
+    }                                                                                                         \
+}
+
+OWN_K0_SCAN_64U_FUN(eq, _MM_CMPINT_EQ)
+OWN_K0_SCAN_64U_FUN(ne, _MM_CMPINT_NE)
+OWN_K0_SCAN_64U_FUN(lt, _MM_CMPINT_LT)
+OWN_K0_SCAN_64U_FUN(le, _MM_CMPINT_LE)
+OWN_K0_SCAN_64U_FUN(gt, _MM_CMPINT_NLE)
+OWN_K0_SCAN_64U_FUN(ge, _MM_CMPINT_NLT)
+
+OWN_QPLC_INLINE(void, own_k0_scan_range_64u8u_i, (uint8_t *src_dst_ptr,
+    uint32_t length,
+    uint64_t low_value,
+    uint64_t high_value,
+    __mmask8 invert_mask)) {
+    // value in [low, high] is the same as (value - low) <= (high - low) for unsigned values
+    const __m512i low_value_mm = _mm512_set1_epi64((int64_t) low_value);
+    const __m512i span_mm      = _mm512_set1_epi64((int64_t) (high_value - low_value));
+    uint8_t       *src_ptr     = src_dst_ptr;
+    uint8_t       *dst_ptr     = src_dst_ptr;
+
+    if (low_value > high_value) {
+        while (0u < length) {
+            const uint32_t elements = QPL_MIN(length, 8u);
+
+            own_k0_store_scan_64u_mask(dst_ptr, invert_mask, elements);
+
+            dst_ptr += elements;
+            length  -= elements;
+        }
+        return;
+    }
+
+    while (0u < length) {
+        const uint32_t elements = QPL_MIN(length, 8u);
+        const __m512i  src_mm   = _mm512_maskz_loadu_epi64((__mmask8) OWN_BIT_MASK(elements), src_ptr);
+        const __mmask8 in_range = _mm512_cmp_epu64_mask(_mm512_sub_epi64(src_mm, low_value_mm),
+                                                        span_mm,
+                                                        _MM_CMPINT_LE);
+
+        own_k0_store_scan_64u_mask(dst_ptr, in_range ^ invert_mask, elements);
+
+        src_ptr += elements * sizeof(uint64_t);
+        dst_ptr += elements;
+        length  -= elements;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_range_64u8u_i, (uint8_t *src_dst_ptr,
+    uint32_t length,
+    uint64_t low_value,
+    uint64_t high_value)) {
+    own_k0_scan_range_64u8u_i(src_dst_ptr, length, low_value, high_value, 0u);
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_not_range_64u8u_i, (uint8_t *src_dst_ptr,
+    uint32_t length,
+    uint64_t low_value,
+    uint64_t high_value)) {
+    own_k0_scan_range_64u8u_i(src_dst_ptr, length, low_value, high_value, 0xFFu);
+}
+
+#endif // OWN_SCAN_64U_K0_H
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of all functions for scan analytics operation
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_scan_lt_8u
+ *          - @ref l9_qplc_scan_lt_16u8u
+ *          - @ref l9_qplc_scan_lt_32u8u
+ *          - @ref l9_qplc_scan_le_8u
+ *          - @ref l9_qplc_scan_le_16u8u
+ *          - @ref l9_qplc_scan_le_32u8u
+ *          - @ref l9_qplc_scan_gt_8u
+ *          - @ref l9_qplc_scan_gt_16u8u
+ *          - @ref l9_qplc_scan_gt_32u8u
+ *          - @ref l9_qplc_scan_ge_8u
+ *          - @ref l9_qplc_scan_ge_16u8u
+ *          - @ref l9_qplc_scan_ge_32u8u
+ *          - @ref l9_qplc_scan_eq_8u
+ *          - @ref l9_qplc_scan_eq_16u8u
+ *          - @ref l9_qplc_scan_eq_32u8u
+ *          - @ref l9_qplc_scan_ne_8u
+ *          - @ref l9_qplc_scan_ne_16u8u
+ *          - @ref l9_qplc_scan_ne_32u8u
+ *          - @ref l9_qplc_scan_range_8u
+ *          - @ref l9_qplc_scan_range_16u8u
+ *          - @ref l9_qplc_scan_range_32u8u
+ *          - @ref l9_qplc_scan_not_range_8u
+ *          - @ref l9_qplc_scan_not_range_16u8u
+ *          - @ref l9_qplc_scan_not_range_32u8u
+ *
+ */
+
+#ifndef OWN_SCAN_L9_H
+#define OWN_SCAN_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Scan comparators, AVX2 has no unsigned compare, so they are expressed through min/max
+ */
+typedef enum {
+    own_l9_scan_eq,
+    own_l9_scan_ne,
+    own_l9_scan_lt,
+    own_l9_scan_le,
+    own_l9_scan_gt,
+    own_l9_scan_ge,
+    own_l9_scan_range,
+    own_l9_scan_not_range
+} own_l9_scan_comparator_t;
+
+#define OWN_L9_SCAN_KERNEL(name, bits)                                                                   \
+OWN_QPLC_INLINE(__m256i, name, (__m256i srcmm, __m256i lowmm, __m256i highmm,                            \
+                                own_l9_scan_comparator_t comparator)) {                                  \
+    switch (comparator) {                                                                                \
+    case own_l9_scan_eq:                                                                                 \
+        return _mm256_cmpeq_epi##bits(srcmm, lowmm);                                                     \
+    case own_l9_scan_ne:                                                                                 \
+        return _mm256_andnot_si256(_mm256_cmpeq_epi##bits(srcmm, lowmm), _mm256_set1_epi32(-1));         \
+    case own_l9_scan_lt:                                                                                 \
+        return _mm256_andnot_si256(_mm256_cmpeq_epi##bits(_mm256_max_epu##bits(srcmm, lowmm), srcmm),    \
+                                   _mm256_set1_epi32(-1));                                               \
+    case own_l9_scan_le:                                                                                 \
+        return _mm256_cmpeq_epi##bits(_mm256_min_epu##bits(srcmm, lowmm), srcmm);                        \
+    case own_l9_scan_gt:                                                                                 \
+        return _mm256_andnot_si256(_mm256_cmpeq_epi##bits(_mm256_min_epu##bits(srcmm, lowmm), srcmm),    \
+                                   _mm256_set1_epi32(-1));                                               \
+    case own_l9_scan_ge:                                                                                 \
+        return _mm256_cmpeq_epi##bits(_mm256_max_epu##bits(srcmm, lowmm), srcmm);                        \
+    case own_l9_scan_range:                                                                              \
+        return _mm256_and_si256(_mm256_cmpeq_epi##bits(_mm256_max_epu##bits(srcmm, lowmm), srcmm),       \
+                                _mm256_cmpeq_epi##bits(_mm256_min_epu##bits(srcmm, highmm), srcmm));     \
+    default:                                                                                             \
+        return _mm256_andnot_si256(                                                                      \
+                _mm256_and_si256(_mm256_cmpeq_epi##bits(_mm256_max_epu##bits(srcmm, lowmm), srcmm),      \
+                                 _mm256_cmpeq_epi##bits(_mm256_min_epu##bits(srcmm, highmm), srcmm)),    \
+                _mm256_set1_epi32(-1));                                                                  \
+    }                                                                                                    \
+}
+
+OWN_L9_SCAN_KERNEL(own_l9_scan_8u_kernel, 8)
+OWN_L9_SCAN_KERNEL(own_l9_scan_16u_kernel, 16)
+OWN_L9_SCAN_KERNEL(own_l9_scan_32u_kernel, 32)
+
+OWN_QPLC_INLINE(uint8_t, own_l9_scan_scalar, (uint32_t value, uint32_t low_value, uint32_t high_value,
+                                              own_l9_scan_comparator_t comparator)) {
+    switch (comparator) {
+    case own_l9_scan_eq:
+        return (value == low_value) ? 1u : 0u;
+    case own_l9_scan_ne:
+        return (value != low_value) ? 1u : 0u;
+    case own_l9_scan_lt:
+        return (value < low_value) ? 1u : 0u;
+    case own_l9_scan_le:
+        return (value <= low_value) ? 1u : 0u;
+    case own_l9_scan_gt:
+        return (value > low_value) ? 1u : 0u;
+    case own_l9_scan_ge:
+        return (value >= low_value) ? 1u : 0u;
+    case own_l9_scan_range:
+        return (value >= low_value && value <= high_value) ? 1u : 0u;
+    default:
+        return (value < low_value || value > high_value) ? 1u : 0u;
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+                                       uint32_t length,
+                                       uint32_t low_value,
+                                       uint32_t high_value,
+                                       own_l9_scan_comparator_t comparator)) {
+    uint32_t length32 = length & (-32);
+    __m256i  lowmm    = _mm256_set1_epi8((char) low_value);
+    __m256i  highmm   = _mm256_set1_epi8((char) high_value);
+    __m256i  onemm    = _mm256_set1_epi8(1);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        __m256i dstmm = own_l9_scan_8u_kernel(srcmm, lowmm, highmm, comparator);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + idx), _mm256_and_si256(dstmm, onemm));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_ptr[idx], low_value, high_value, comparator);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+                                          uint32_t length,
+                                          uint32_t low_value,
+                                          uint32_t high_value,
+                                          own_l9_scan_comparator_t comparator)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    uint32_t length32 = length & (-32);
+    __m256i  lowmm    = _mm256_set1_epi16((short) low_value);
+    __m256i  highmm   = _mm256_set1_epi16((short) high_value);
+    __m256i  onemm    = _mm256_set1_epi8(1);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx));
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx + 16u));
+        __m256i dstmm0 = own_l9_scan_16u_kernel(srcmm0, lowmm, highmm, comparator);
+        __m256i dstmm1 = own_l9_scan_16u_kernel(srcmm1, lowmm, highmm, comparator);
+
+        // Packing works within 128-bit lanes, so qwords should be reordered afterwards
+        __m256i dstmm = _mm256_packs_epi16(dstmm0, dstmm1);
+        dstmm = _mm256_permute4x64_epi64(dstmm, 0xD8);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + idx), _mm256_and_si256(dstmm, onemm));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_16u_ptr[idx], low_value, high_value, comparator);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+                                          uint32_t length,
+                                          uint32_t low_value,
+                                          uint32_t high_value,
+                                          own_l9_scan_comparator_t comparator)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    uint32_t length32 = length & (-32);
+    __m256i  lowmm    = _mm256_set1_epi32((int) low_value);
+    __m256i  highmm   = _mm256_set1_epi32((int) high_value);
+    __m256i  onemm    = _mm256_set1_epi8(1);
+    __m256i  permutemm = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i dstmm0 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx)),
+                                                lowmm, highmm, comparator);
+        __m256i dstmm1 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx + 8u)),
+                                                lowmm, highmm, comparator);
+        __m256i dstmm2 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx + 16u)),
+                                                lowmm, highmm, comparator);
+        __m256i dstmm3 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx + 24u)),
+                                                lowmm, highmm, comparator);
+
+        // Packing works within 128-bit lanes, so dwords should be reordered afterwards
+        __m256i dstmm = _mm256_packs_epi16(_mm256_packs_epi32(dstmm0, dstmm1), _mm256_packs_epi32(dstmm2, dstmm3));
+        dstmm = _mm256_permutevar8x32_epi32(dstmm, permutemm);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + idx), _mm256_and_si256(dstmm, onemm));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_32u_ptr[idx], low_value, high_value, comparator);
+    }
+}
+
+#define OWN_L9_SCAN_FUN(comparator_name, type_name)                                                      \
+OWN_OPT_FUN(void, l9_qplc_scan_##comparator_name##_##type_name, (const uint8_t *src_ptr,                 \
+                                                                  uint8_t *dst_ptr,                      \
+                                                                  uint32_t length,                       \
+                                                                  uint32_t low_value)) {                 \
+    own_l9_scan_##type_name(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_##comparator_name); \
+}
+
+#define OWN_L9_SCAN_RANGE_FUN(comparator_name, type_name)                                                \
+OWN_OPT_FUN(void, l9_qplc_scan_##comparator_name##_##type_name, (const uint8_t *src_ptr,                 \
+                                                                  uint8_t *dst_ptr,                      \
+                                                                  uint32_t length,                       \
+                                                                  uint32_t low_value,                    \
+                                                                  uint32_t high_value)) {                \
+    own_l9_scan_##type_name(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_##comparator_name); \
+}
+
+OWN_L9_SCAN_FUN(eq, 8u)
+OWN_L9_SCAN_FUN(eq, 16u8u)
+OWN_L9_SCAN_FUN(eq, 32u8u)
+OWN_L9_SCAN_FUN(ne, 8u)
+OWN_L9_SCAN_FUN(ne, 16u8u)
+OWN_L9_SCAN_FUN(ne, 32u8u)
+OWN_L9_SCAN_FUN(lt, 8u)
+OWN_L9_SCAN_FUN(lt, 16u8u)
+OWN_L9_SCAN_FUN(lt, 32u8u)
+OWN_L9_SCAN_FUN(le, 8u)
+OWN_L9_SCAN_FUN(le, 16u8u)
+OWN_L9_SCAN_FUN(le, 32u8u)
+OWN_L9_SCAN_FUN(gt, 8u)
+OWN_L9_SCAN_FUN(gt, 16u8u)
+OWN_L9_SCAN_FUN(gt, 32u8u)
+OWN_L9_SCAN_FUN(ge, 8u)
+OWN_L9_SCAN_FUN(ge, 16u8u)
+OWN_L9_SCAN_FUN(ge, 32u8u)
+OWN_L9_SCAN_RANGE_FUN(range, 8u)
+OWN_L9_SCAN_RANGE_FUN(range, 16u8u)
+OWN_L9_SCAN_RANGE_FUN(range, 32u8u)
+OWN_L9_SCAN_RANGE_FUN(not_range, 8u)
+OWN_L9_SCAN_RANGE_FUN(not_range, 16u8u)
+OWN_L9_SCAN_RANGE_FUN(not_range, 32u8u)
+
+#endif // OWN_SCAN_L9_H
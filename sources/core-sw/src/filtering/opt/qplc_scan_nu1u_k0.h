@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 helpers for fused scan functions with packed n-bit input and nominal bit vector output
+ *
+ * @details Each group of 16 elements takes exactly 2 * bit_width bytes of the input, so all groups share the same
+ *          layout. Every element is assembled in a dword lane from the two source dwords that contain it
+ *          with two permutes and two variable shifts, then compared as `(value - base) <= span` into a mask
+ *          register. Source loads of the trailing blocks are masked by the remaining input size.
+ *
+ */
+
+#ifndef OWN_SCAN_NU1U_K0_H
+#define OWN_SCAN_NU1U_K0_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+typedef struct {
+    __m512i  low_index;       /**< Index of the source dword that contains the element start */
+    __m512i  high_index;      /**< Index of the next source dword */
+    __m512i  low_shift;       /**< Right shift of the low source dword */
+    __m512i  high_shift;      /**< Left shift of the high source dword, 32 for elements inside one dword */
+    __m512i  mask;            /**< Element mask */
+    __m512i  base;            /**< Low boundary of the range, subtracted from every element */
+    __m512i  span;            /**< Range length, elements not greater than span after subtraction match */
+    uint32_t bit_width;       /**< Source bit width */
+    uint32_t blocks_count;    /**< Number of 64-element blocks that can be processed without masked loads */
+} own_k0_scan_nu1u_state_t;
+
+OWN_QPLC_INLINE(void, own_k0_scan_nu1u_init, (uint32_t length,
+                                              uint32_t bit_width,
+                                              uint32_t base,
+                                              uint32_t span,
+                                              own_k0_scan_nu1u_state_t *state_ptr)) {
+    uint64_t src_length = ((uint64_t) length * bit_width + 7u) >> 3u;
+    __m512i  offsetmm   = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+                                                               8, 9, 10, 11, 12, 13, 14, 15),
+                                             _mm512_set1_epi32((int) bit_width));
+
+    state_ptr->low_index  = _mm512_srli_epi32(offsetmm, 5);
+    state_ptr->high_index = _mm512_add_epi32(state_ptr->low_index, _mm512_set1_epi32(1));
+    state_ptr->low_shift  = _mm512_and_si512(offsetmm, _mm512_set1_epi32(31));
+    state_ptr->high_shift = _mm512_sub_epi32(_mm512_set1_epi32(32), state_ptr->low_shift);
+    state_ptr->mask       = _mm512_set1_epi32((int) OWN_BIT_MASK(bit_width));
+    state_ptr->base       = _mm512_set1_epi32((int) base);
+    state_ptr->span       = _mm512_set1_epi32((int) span);
+    state_ptr->bit_width  = bit_width;
+
+    // 64-byte load of the last group of a block must stay inside the source
+    if (src_length < 6u * bit_width + 64u) {
+        state_ptr->blocks_count = 0u;
+    } else {
+        uint64_t blocks_count = (src_length - 6u * bit_width - 64u) / (8u * bit_width) + 1u;
+        state_ptr->blocks_count = (uint32_t) QPL_MIN(blocks_count, (uint64_t) (length >> 6u));
+    }
+}
+
+OWN_QPLC_INLINE(uint16_t, own_k0_scan_nu1u_16, (__m512i srcmm, const own_k0_scan_nu1u_state_t *state_ptr)) {
+    __m512i lowmm  = _mm512_permutexvar_epi32(state_ptr->low_index, srcmm);
+    __m512i highmm = _mm512_permutexvar_epi32(state_ptr->high_index, srcmm);
+
+    lowmm = _mm512_or_si512(_mm512_srlv_epi32(lowmm, state_ptr->low_shift),
+                            _mm512_sllv_epi32(highmm, state_ptr->high_shift));
+    lowmm = _mm512_sub_epi32(_mm512_and_si512(lowmm, state_ptr->mask), state_ptr->base);
+
+    return (uint16_t) _mm512_cmple_epu32_mask(lowmm, state_ptr->span);
+}
+
+/**
+ * @brief Scans 64 elements that start at src_ptr, bit i of the result is set if element i is in the range
+ */
+OWN_QPLC_INLINE(uint64_t, own_k0_scan_nu1u_64, (const uint8_t *src_ptr, const own_k0_scan_nu1u_state_t *state_ptr)) {
+    uint32_t group_bytes = 2u * state_ptr->bit_width;
+
+    return ((uint64_t) own_k0_scan_nu1u_16(_mm512_loadu_si512(src_ptr), state_ptr))
+           | ((uint64_t) own_k0_scan_nu1u_16(_mm512_loadu_si512(src_ptr + group_bytes), state_ptr) << 16u)
+           | ((uint64_t) own_k0_scan_nu1u_16(_mm512_loadu_si512(src_ptr + 2u * group_bytes), state_ptr) << 32u)
+           | ((uint64_t) own_k0_scan_nu1u_16(_mm512_loadu_si512(src_ptr + 3u * group_bytes), state_ptr) << 48u);
+}
+
+/**
+ * @brief Scans up to 64 elements that start at src_ptr, bit i of the result is set if element i is in the range
+ *
+ * @note Bits above count are undefined, only the bytes that contain these elements are read
+ */
+OWN_QPLC_INLINE(uint64_t, own_k0_scan_nu1u_tail, (const uint8_t *src_ptr,
+                                                  uint32_t count,
+                                                  const own_k0_scan_nu1u_state_t *state_ptr)) {
+    uint32_t group_bytes = 2u * state_ptr->bit_width;
+    uint32_t src_length  = OWN_BITS_2_BYTE(count * state_ptr->bit_width);
+    uint64_t mask        = 0u;
+
+    for (uint32_t group = 0u, offset = 0u; offset < src_length; group++, offset += group_bytes) {
+        uint32_t  remaining = src_length - offset;
+        __mmask64 load_mask = (remaining >= 64u) ? (__mmask64) ~0ULL : (__mmask64) OWN_BIT_MASK(remaining);
+        __m512i   srcmm     = _mm512_maskz_loadu_epi8(load_mask, (const void *) (src_ptr + offset));
+
+        mask |= ((uint64_t) own_k0_scan_nu1u_16(srcmm, state_ptr)) << (group * 16u);
+    }
+
+    return mask;
+}
+
+#endif // OWN_SCAN_NU1U_K0_H
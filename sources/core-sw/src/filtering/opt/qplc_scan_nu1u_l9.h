@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 helpers for fused scan functions with packed n-bit input and nominal bit vector output
+ *
+ * @details Each group of 8 elements takes exactly bit_width bytes of the input, so all groups share the same
+ *          layout. Every element is assembled in a dword lane from the two source dwords that contain it
+ *          with two permutes and two variable shifts, then compared as `(value - base) <= span`.
+ *          Unpacked elements never leave the registers.
+ *
+ */
+
+#ifndef OWN_SCAN_NU1U_L9_H
+#define OWN_SCAN_NU1U_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+typedef struct {
+    __m256i  low_index;       /**< Index of the source dword that contains the element start */
+    __m256i  high_index;      /**< Index of the next source dword */
+    __m256i  low_shift;       /**< Right shift of the low source dword */
+    __m256i  high_shift;      /**< Left shift of the high source dword, 32 for elements inside one dword */
+    __m256i  mask;            /**< Element mask */
+    __m256i  base;            /**< Low boundary of the range, subtracted from every element */
+    __m256i  span;            /**< Range length, elements not greater than span after subtraction match */
+    uint32_t bit_width;       /**< Source bit width */
+    uint32_t blocks_count;    /**< Number of 64-element blocks that can be processed without input overread */
+} own_l9_scan_nu1u_state_t;
+
+OWN_QPLC_INLINE(void, own_l9_scan_nu1u_init, (uint32_t length,
+                                              uint32_t bit_width,
+                                              uint32_t base,
+                                              uint32_t span,
+                                              own_l9_scan_nu1u_state_t *state_ptr)) {
+    uint64_t src_length = ((uint64_t) length * bit_width + 7u) >> 3u;
+    __m256i  offsetmm   = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                             _mm256_set1_epi32((int) bit_width));
+
+    state_ptr->low_index  = _mm256_srli_epi32(offsetmm, 5);
+    state_ptr->high_index = _mm256_add_epi32(state_ptr->low_index, _mm256_set1_epi32(1));
+    state_ptr->low_shift  = _mm256_and_si256(offsetmm, _mm256_set1_epi32(31));
+    state_ptr->high_shift = _mm256_sub_epi32(_mm256_set1_epi32(32), state_ptr->low_shift);
+    state_ptr->mask       = _mm256_set1_epi32((int) OWN_BIT_MASK(bit_width));
+    state_ptr->base       = _mm256_set1_epi32((int) base);
+    state_ptr->span       = _mm256_set1_epi32((int) span);
+    state_ptr->bit_width  = bit_width;
+
+    // 32-byte load of the last group of a block must stay inside the source
+    if (src_length < 7u * bit_width + 32u) {
+        state_ptr->blocks_count = 0u;
+    } else {
+        uint64_t blocks_count = (src_length - 7u * bit_width - 32u) / (8u * bit_width) + 1u;
+        state_ptr->blocks_count = (uint32_t) QPL_MIN(blocks_count, (uint64_t) (length >> 6u));
+    }
+}
+
+/**
+ * @brief Scans 64 elements that start at src_ptr, bit i of the result is set if element i is in the range
+ */
+OWN_QPLC_INLINE(uint64_t, own_l9_scan_nu1u_64, (const uint8_t *src_ptr, const own_l9_scan_nu1u_state_t *state_ptr)) {
+    uint64_t mask = 0u;
+
+    for (uint32_t group = 0u; group < 8u; group++) {
+        __m256i srcmm  = _mm256_loadu_si256((const __m256i *) (src_ptr + group * state_ptr->bit_width));
+        __m256i lowmm  = _mm256_permutevar8x32_epi32(srcmm, state_ptr->low_index);
+        __m256i highmm = _mm256_permutevar8x32_epi32(srcmm, state_ptr->high_index);
+
+        lowmm = _mm256_or_si256(_mm256_srlv_epi32(lowmm, state_ptr->low_shift),
+                                _mm256_sllv_epi32(highmm, state_ptr->high_shift));
+        lowmm = _mm256_sub_epi32(_mm256_and_si256(lowmm, state_ptr->mask), state_ptr->base);
+        lowmm = _mm256_cmpeq_epi32(_mm256_min_epu32(lowmm, state_ptr->span), lowmm);
+
+        mask |= ((uint64_t) (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(lowmm))) << (group * 8u);
+    }
+
+    return mask;
+}
+
+#endif // OWN_SCAN_NU1U_L9_H
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX-512 helpers for select functions with the packed bit vector mask
+ *
+ * @details The mask word is used as the compress mask directly. 8-bit and 16-bit elements are compressed
+ *          in place if the build targets AVX512_VBMI2, otherwise they are widened to dwords by 16 elements.
+ *          Every compressed vector is stored completely, the extra elements are overwritten by the next ones
+ *          and never go past the current block in the destination. Empty mask parts are skipped.
+ *
+ */
+
+#ifndef OWN_SELECT_BIT_MASK_K0_H
+#define OWN_SELECT_BIT_MASK_K0_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+OWN_QPLC_INLINE(uint32_t, own_k0_select_bit_mask_8u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+#if defined(__AVX512VBMI2__)
+    __m512i data = _mm512_maskz_compress_epi8((__mmask64) mask, _mm512_loadu_si512((__m512i const *) src_ptr));
+
+    _mm512_storeu_si512((__m512i *) dst_ptr, data);
+
+    return (uint32_t) _mm_popcnt_u64(mask);
+#else
+    uint32_t selected = 0u;
+
+    for (; 0u != mask; mask >>= 16u, src_ptr += 16u) {
+        __mmask16 group_mask = (__mmask16) mask;
+
+        if (0u != group_mask) {
+            __m512i data = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i const *) src_ptr));
+
+            data = _mm512_maskz_compress_epi32(group_mask, data);
+            _mm_storeu_si128((__m128i *) (dst_ptr + selected), _mm512_cvtepi32_epi8(data));
+            selected += (uint32_t) _mm_popcnt_u32((uint32_t) group_mask);
+        }
+    }
+
+    return selected;
+#endif
+}
+
+OWN_QPLC_INLINE(uint32_t, own_k0_select_bit_mask_16u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+    uint32_t selected = 0u;
+
+#if defined(__AVX512VBMI2__)
+    for (; 0u != mask; mask >>= 32u, src_ptr += 32u * sizeof(uint16_t)) {
+        __mmask32 group_mask = (__mmask32) mask;
+
+        if (0u != group_mask) {
+            __m512i data = _mm512_loadu_si512((__m512i const *) src_ptr);
+
+            data = _mm512_maskz_compress_epi16(group_mask, data);
+            _mm512_storeu_si512((__m512i *) (dst_ptr + selected * sizeof(uint16_t)), data);
+            selected += (uint32_t) _mm_popcnt_u32((uint32_t) group_mask);
+        }
+    }
+#else
+    for (; 0u != mask; mask >>= 16u, src_ptr += 16u * sizeof(uint16_t)) {
+        __mmask16 group_mask = (__mmask16) mask;
+
+        if (0u != group_mask) {
+            __m512i data = _mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i const *) src_ptr));
+
+            data = _mm512_maskz_compress_epi32(group_mask, data);
+            _mm256_storeu_si256((__m256i *) (dst_ptr + selected * sizeof(uint16_t)), _mm512_cvtepi32_epi16(data));
+            selected += (uint32_t) _mm_popcnt_u32((uint32_t) group_mask);
+        }
+    }
+#endif
+
+    return selected;
+}
+
+OWN_QPLC_INLINE(uint32_t, own_k0_select_bit_mask_32u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+    uint32_t selected = 0u;
+
+    for (; 0u != mask; mask >>= 16u, src_ptr += 16u * sizeof(uint32_t)) {
+        __mmask16 group_mask = (__mmask16) mask;
+
+        if (0u != group_mask) {
+            __m512i data = _mm512_maskz_compress_epi32(group_mask, _mm512_loadu_si512((__m512i const *) src_ptr));
+
+            _mm512_storeu_si512((__m512i *) (dst_ptr + selected * sizeof(uint32_t)), data);
+            selected += (uint32_t) _mm_popcnt_u32((uint32_t) group_mask);
+        }
+    }
+
+    return selected;
+}
+
+OWN_QPLC_INLINE(uint32_t, own_k0_select_bit_mask_64u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+    uint32_t selected = 0u;
+
+    for (; 0u != mask; mask >>= 8u, src_ptr += 8u * sizeof(uint64_t)) {
+        __mmask8 group_mask = (__mmask8) mask;
+
+        if (0u != group_mask) {
+            __m512i data = _mm512_maskz_compress_epi64(group_mask, _mm512_loadu_si512((__m512i const *) src_ptr));
+
+            _mm512_storeu_si512((__m512i *) (dst_ptr + selected * sizeof(uint64_t)), data);
+            selected += (uint32_t) _mm_popcnt_u32((uint32_t) group_mask);
+        }
+    }
+
+    return selected;
+}
+
+#endif // OWN_SELECT_BIT_MASK_K0_H
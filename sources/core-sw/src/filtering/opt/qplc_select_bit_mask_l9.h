@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 helpers for select functions with the packed bit vector mask
+ *
+ * @details Elements are compacted in 8-byte groups with PEXT, the byte mask for it is expanded from the mask bits
+ *          with PDEP. 32-bit elements are compacted by the dword permute, the permutation for 8 elements is built
+ *          the same way from the identity index list, 64-bit elements are permuted as pairs of dwords.
+ *          Every group is stored completely, the extra elements are overwritten by the next groups and never go
+ *          past the current block in the destination.
+ *          Empty mask groups are skipped.
+ *
+ */
+
+#ifndef OWN_SELECT_BIT_MASK_L9_H
+#define OWN_SELECT_BIT_MASK_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+#define OWN_L9_SELECT_BYTES_SPREAD 0x0101010101010101ULL /**< Mask bit to byte lane expansion */
+#define OWN_L9_SELECT_WORDS_SPREAD 0x0001000100010001ULL /**< Mask bit to word lane expansion */
+#define OWN_L9_SELECT_IDENTITY     0x0706050403020100ULL /**< Dword indices of the identity permutation */
+#define OWN_L9_SELECT_PAIRS_SPREAD 0x55u                 /**< Mask bit to dword pair expansion */
+
+OWN_QPLC_INLINE(uint32_t, own_l9_select_bit_mask_8u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+    uint32_t selected = 0u;
+
+    for (; 0u != mask; mask >>= 8u, src_ptr += 8u) {
+        uint64_t group_mask = mask & 0xFFu;
+
+        if (0u != group_mask) {
+            uint64_t lanes = _pdep_u64(group_mask, OWN_L9_SELECT_BYTES_SPREAD) * 0xFFu;
+
+            *(uint64_t *) (dst_ptr + selected) = _pext_u64(*(const uint64_t *) src_ptr, lanes);
+            selected += (uint32_t) _mm_popcnt_u64(group_mask);
+        }
+    }
+
+    return selected;
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_select_bit_mask_16u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+    uint32_t selected = 0u;
+
+    for (; 0u != mask; mask >>= 4u, src_ptr += 8u) {
+        uint64_t group_mask = mask & 0xFu;
+
+        if (0u != group_mask) {
+            uint64_t lanes = _pdep_u64(group_mask, OWN_L9_SELECT_WORDS_SPREAD) * 0xFFFFu;
+
+            *(uint64_t *) (dst_ptr + selected * sizeof(uint16_t)) = _pext_u64(*(const uint64_t *) src_ptr, lanes);
+            selected += (uint32_t) _mm_popcnt_u64(group_mask);
+        }
+    }
+
+    return selected;
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_select_bit_mask_32u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+    uint32_t selected = 0u;
+
+    for (; 0u != mask; mask >>= 8u, src_ptr += 8u * sizeof(uint32_t)) {
+        uint64_t group_mask = mask & 0xFFu;
+
+        if (0u != group_mask) {
+            uint64_t lanes   = _pdep_u64(group_mask, OWN_L9_SELECT_BYTES_SPREAD) * 0xFFu;
+            __m256i  indices = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long) _pext_u64(OWN_L9_SELECT_IDENTITY,
+                                                                                            lanes)));
+            __m256i  data    = _mm256_loadu_si256((__m256i const *) src_ptr);
+
+            _mm256_storeu_si256((__m256i *) (dst_ptr + selected * sizeof(uint32_t)),
+                                _mm256_permutevar8x32_epi32(data, indices));
+            selected += (uint32_t) _mm_popcnt_u64(group_mask);
+        }
+    }
+
+    return selected;
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_select_bit_mask_64u, (const uint8_t *src_ptr, uint64_t mask, uint8_t *dst_ptr)) {
+    uint32_t selected = 0u;
+
+    for (; 0u != mask; mask >>= 4u, src_ptr += 4u * sizeof(uint64_t)) {
+        uint64_t group_mask = mask & 0xFu;
+
+        if (0u != group_mask) {
+            uint64_t pairs   = _pdep_u64(group_mask, OWN_L9_SELECT_PAIRS_SPREAD) * 3u;
+            uint64_t lanes   = _pdep_u64(pairs, OWN_L9_SELECT_BYTES_SPREAD) * 0xFFu;
+            __m256i  indices = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long) _pext_u64(OWN_L9_SELECT_IDENTITY,
+                                                                                            lanes)));
+            __m256i  data    = _mm256_loadu_si256((__m256i const *) src_ptr);
+
+            _mm256_storeu_si256((__m256i *) (dst_ptr + selected * sizeof(uint64_t)),
+                                _mm256_permutevar8x32_epi32(data, indices));
+            selected += (uint32_t) _mm_popcnt_u64(group_mask);
+        }
+    }
+
+    return selected;
+}
+
+#endif // OWN_SELECT_BIT_MASK_L9_H
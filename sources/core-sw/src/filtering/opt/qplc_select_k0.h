@@ -15,6 +15,7 @@
   *          - @ref qplc_select_8u
   *          - @ref qplc_select_16u
   *          - @ref qplc_select_32u
+  *          - @ref qplc_select_64u
   *
   */
 
@@ -168,4 +169,29 @@ OWN_OPT_FUN(uint32_t, k0_qplc_select_32u, (const uint8_t* src_ptr,
     return selected;
 }
 
+OWN_OPT_FUN(uint32_t, k0_qplc_select_64u, (const uint8_t *src_ptr,
+    const uint8_t *src2_ptr,
+    uint8_t *dst_ptr,
+    uint32_t length)) {
+    uint64_t *src_64u_ptr = (uint64_t *) src_ptr;
+    uint64_t *dst_64u_ptr = (uint64_t *) dst_ptr;
+    uint32_t selected     = 0u;
+
+    for (uint32_t idx = 0u; idx < length; idx += 8u) {
+        const uint32_t  group_length = QPL_MIN(length - idx, 8u);
+        const __mmask16 group_mask   = (__mmask16) OWN_BIT_MASK(group_length);
+        const __mmask8  select_mask  = (__mmask8) _mm_cmpneq_epi8_mask(_mm_maskz_loadu_epi8(group_mask, src2_ptr + idx),
+                                                                       _mm_setzero_si128());
+
+        if (0u != select_mask) {
+            __m512i z_data = _mm512_maskz_loadu_epi64((__mmask8) group_mask, src_64u_ptr + idx);
+
+            // Compress store writes exactly the selected elements, so the same function serves in-place select
+            _mm512_mask_compressstoreu_epi64(dst_64u_ptr + selected, select_mask, z_data);
+            selected += (uint32_t) _mm_popcnt_u32((uint32_t) select_mask);
+        }
+    }
+    return selected;
+}
+
 #endif // OWN_SELECT_H
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of all functions for select analytics operation
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_select_8u
+ *          - @ref l9_qplc_select_16u
+ *          - @ref l9_qplc_select_32u
+ *
+ * @note Output is written exactly up to the number of selected elements, so the same functions are used
+ *       for in-place select: destination position never overtakes source position.
+ *
+ */
+
+#ifndef OWN_SELECT_L9_H
+#define OWN_SELECT_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Returns bit mask of non-zero bytes for 32 bytes of the mask vector
+ */
+OWN_QPLC_INLINE(uint32_t, own_l9_select_mask_32, (const uint8_t *src2_ptr)) {
+    __m256i maskmm = _mm256_loadu_si256((const __m256i *) src2_ptr);
+
+    return ~((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(maskmm, _mm256_setzero_si256())));
+}
+
+/******** out-of-place select functions ********/
+
+OWN_OPT_FUN(uint32_t, l9_qplc_select_8u, (const uint8_t *src_ptr,
+                                          const uint8_t *src2_ptr,
+                                          uint8_t *dst_ptr,
+                                          uint32_t length)) {
+    uint32_t length32 = length & (-32);
+    uint32_t selected = 0u;
+    uint64_t packed_data  = 0u;  // Selected bytes that are not stored yet
+    uint32_t packed_count = 0u;  // Number of bytes in packed_data, always less than 8
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        uint32_t mask = own_l9_select_mask_32(src2_ptr + idx);
+
+        for (uint32_t idx_inloop = idx; 0u != mask; idx_inloop += 8u, mask >>= 8u) {
+            uint32_t mask8 = mask & 0xFFu;
+
+            if (0u != mask8) {
+                uint64_t src_data   = *(const uint64_t *) (src_ptr + idx_inloop);
+                uint64_t byte_mask  = _pdep_u64(mask8, 0x0101010101010101ULL) * 0xFFu;
+                uint64_t compressed = _pext_u64(src_data, byte_mask);
+                uint32_t count      = (uint32_t) _mm_popcnt_u32(mask8);
+
+                packed_data |= compressed << (packed_count * 8u);
+                packed_count += count;
+
+                if (packed_count >= 8u) {
+                    *(uint64_t *) (dst_ptr + selected) = packed_data;
+                    selected += 8u;
+                    packed_count -= 8u;
+                    packed_data = (0u == packed_count) ? 0u : compressed >> ((count - packed_count) * 8u);
+                }
+            }
+        }
+    }
+
+    for (uint32_t idx = 0u; idx < packed_count; idx++) {
+        dst_ptr[selected++] = (uint8_t) (packed_data >> (idx * 8u));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (src2_ptr[idx] != 0u) {
+            dst_ptr[selected++] = src_ptr[idx];
+        }
+    }
+    return selected;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_select_16u, (const uint8_t *src_ptr,
+                                           const uint8_t *src2_ptr,
+                                           uint8_t *dst_ptr,
+                                           uint32_t length)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    uint16_t       *dst_16u_ptr = (uint16_t *) dst_ptr;
+    uint32_t length32 = length & (-32);
+    uint32_t selected = 0u;
+    uint64_t packed_data  = 0u;  // Selected words that are not stored yet
+    uint32_t packed_count = 0u;  // Number of words in packed_data, always less than 4
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        uint32_t mask = own_l9_select_mask_32(src2_ptr + idx);
+
+        for (uint32_t idx_inloop = idx; 0u != mask; idx_inloop += 4u, mask >>= 4u) {
+            uint32_t mask4 = mask & 0xFu;
+
+            if (0u != mask4) {
+                uint64_t src_data   = *(const uint64_t *) (src_16u_ptr + idx_inloop);
+                uint64_t word_mask  = _pdep_u64(mask4, 0x0001000100010001ULL) * 0xFFFFu;
+                uint64_t compressed = _pext_u64(src_data, word_mask);
+                uint32_t count      = (uint32_t) _mm_popcnt_u32(mask4);
+
+                packed_data |= compressed << (packed_count * 16u);
+                packed_count += count;
+
+                if (packed_count >= 4u) {
+                    *(uint64_t *) (dst_16u_ptr + selected) = packed_data;
+                    selected += 4u;
+                    packed_count -= 4u;
+                    packed_data = (0u == packed_count) ? 0u : compressed >> ((count - packed_count) * 16u);
+                }
+            }
+        }
+    }
+
+    for (uint32_t idx = 0u; idx < packed_count; idx++) {
+        dst_16u_ptr[selected++] = (uint16_t) (packed_data >> (idx * 16u));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (src2_ptr[idx] != 0u) {
+            dst_16u_ptr[selected++] = src_16u_ptr[idx];
+        }
+    }
+    return selected;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_select_32u, (const uint8_t *src_ptr,
+                                           const uint8_t *src2_ptr,
+                                           uint8_t *dst_ptr,
+                                           uint32_t length)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    uint32_t       *dst_32u_ptr = (uint32_t *) dst_ptr;
+    uint32_t length32 = length & (-32);
+    uint32_t selected = 0u;
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        uint32_t mask = own_l9_select_mask_32(src2_ptr + idx);
+
+        for (uint32_t idx_inloop = idx; 0u != mask; idx_inloop += 8u, mask >>= 8u) {
+            uint32_t mask8 = mask & 0xFFu;
+
+            if (0u != mask8) {
+                // Build permutation indices of the selected dwords from the bit mask
+                uint64_t byte_mask = _pdep_u64(mask8, 0x0101010101010101ULL) * 0xFFu;
+                uint64_t indices   = _pext_u64(0x0706050403020100ULL, byte_mask);
+                uint32_t count     = (uint32_t) _mm_popcnt_u32(mask8);
+                __m256i  permutemm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long) indices));
+                __m256i  storemm   = _mm256_cmpgt_epi32(_mm256_set1_epi32((int) count),
+                                                        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+                __m256i  srcmm     = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx_inloop));
+
+                _mm256_maskstore_epi32((int *) (dst_32u_ptr + selected), storemm,
+                                       _mm256_permutevar8x32_epi32(srcmm, permutemm));
+                selected += count;
+            }
+        }
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (src2_ptr[idx] != 0u) {
+            dst_32u_ptr[selected++] = src_32u_ptr[idx];
+        }
+    }
+    return selected;
+}
+
+#endif // OWN_SELECT_L9_H
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for unpacking 9..15-bit data to 16u
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_unpack_Nu16u
+ *
+ */
+
+#ifndef OWN_UNPACK_16U_L9_H
+#define OWN_UNPACK_16U_L9_H
+
+#include "own_qplc_defs.h"
+#include "own_unpack_l9.h"
+
+OWN_OPT_FUN(void, l9_qplc_unpack_Nu16u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint32_t bit_width,
+        uint8_t *dst_ptr)) {
+    own_l9_unpack_state_t state;
+
+    src_ptr += start_bit >> 3u;
+    start_bit &= 7u;
+    own_l9_unpack_init(num_elements, start_bit, bit_width, &state);
+
+    for (uint32_t idx = 0u; idx < state.groups_count; idx++) {
+        __m256i dstmm = own_l9_unpack_8x32u(src_ptr, &state);
+
+        _mm_storeu_si128((__m128i *) dst_ptr, _mm_packus_epi32(_mm256_castsi256_si128(dstmm),
+                                                              _mm256_extracti128_si256(dstmm, 1)));
+        src_ptr += bit_width;
+        dst_ptr += 8u * sizeof(uint16_t);
+    }
+
+    num_elements -= state.groups_count * 8u;
+    uint16_t *dst_16u_ptr = (uint16_t *) dst_ptr;
+    for (uint32_t idx = 0u; idx < num_elements; idx++) {
+        dst_16u_ptr[idx] = (uint16_t) own_l9_unpack_element(src_ptr, start_bit + idx * bit_width, bit_width);
+    }
+}
+
+#endif // OWN_UNPACK_16U_L9_H
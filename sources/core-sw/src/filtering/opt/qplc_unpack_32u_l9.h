@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for unpacking 17..25-bit data to 32u
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_unpack_Nu32u
+ *
+ */
+
+#ifndef OWN_UNPACK_32U_L9_H
+#define OWN_UNPACK_32U_L9_H
+
+#include "own_qplc_defs.h"
+#include "own_unpack_l9.h"
+
+OWN_OPT_FUN(void, l9_qplc_unpack_Nu32u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint32_t bit_width,
+        uint8_t *dst_ptr)) {
+    own_l9_unpack_state_t state;
+
+    src_ptr += start_bit >> 3u;
+    start_bit &= 7u;
+    own_l9_unpack_init(num_elements, start_bit, bit_width, &state);
+
+    for (uint32_t idx = 0u; idx < state.groups_count; idx++) {
+        _mm256_storeu_si256((__m256i *) dst_ptr, own_l9_unpack_8x32u(src_ptr, &state));
+        src_ptr += bit_width;
+        dst_ptr += 8u * sizeof(uint32_t);
+    }
+
+    num_elements -= state.groups_count * 8u;
+    uint32_t *dst_32u_ptr = (uint32_t *) dst_ptr;
+    for (uint32_t idx = 0u; idx < num_elements; idx++) {
+        dst_32u_ptr[idx] = (uint32_t) own_l9_unpack_element(src_ptr, start_bit + idx * bit_width, bit_width);
+    }
+}
+
+#endif // OWN_UNPACK_32U_L9_H
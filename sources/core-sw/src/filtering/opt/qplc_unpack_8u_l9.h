@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for unpacking 1..7-bit data to 8u
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_unpack_Nu8u
+ *
+ */
+
+#ifndef OWN_UNPACK_8U_L9_H
+#define OWN_UNPACK_8U_L9_H
+
+#include "own_qplc_defs.h"
+#include "own_unpack_l9.h"
+
+OWN_OPT_FUN(void, l9_qplc_unpack_Nu8u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint32_t bit_width,
+        uint8_t *dst_ptr)) {
+    own_l9_unpack_state_t state;
+
+    src_ptr += start_bit >> 3u;
+    start_bit &= 7u;
+    own_l9_unpack_init(num_elements, start_bit, bit_width, &state);
+
+    for (uint32_t idx = 0u; idx < state.groups_count; idx++) {
+        __m256i dstmm = own_l9_unpack_8x32u(src_ptr, &state);
+        __m128i packmm = _mm_packus_epi16(_mm_packus_epi32(_mm256_castsi256_si128(dstmm),
+                                                           _mm256_extracti128_si256(dstmm, 1)),
+                                          _mm_setzero_si128());
+
+        _mm_storel_epi64((__m128i *) dst_ptr, packmm);
+        src_ptr += bit_width;
+        dst_ptr += 8u;
+    }
+
+    num_elements -= state.groups_count * 8u;
+    for (uint32_t idx = 0u; idx < num_elements; idx++) {
+        dst_ptr[idx] = (uint8_t) own_l9_unpack_element(src_ptr, start_bit + idx * bit_width, bit_width);
+    }
+}
+
+#endif // OWN_UNPACK_8U_L9_H
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of unpacking 33..64-bit big-endian data to qwords
+ *
+ * @details Same layout as for the little-endian data: each group of 8 elements takes bit_width bytes. Source
+ *          qwords are byte-swapped first, so the bit stream reads from the top of every qword, and every
+ *          element is assembled from the two qwords that contain it and shifted down to the bottom of the lane.
+ *
+ *          Function list:
+ *          - @ref k0_qplc_unpack_be_Nu64u
+ *
+ */
+
+#ifndef OWN_UNPACK_BE_64U_K0_H
+#define OWN_UNPACK_BE_64U_K0_H
+
+#include "own_qplc_defs.h"
+
+OWN_ALIGNED_64_ARRAY(static uint8_t swap_bytes_table_64u[64]) = {
+    7u, 6u, 5u, 4u, 3u, 2u, 1u, 0u, 15u, 14u, 13u, 12u, 11u, 10u, 9u, 8u,
+    7u, 6u, 5u, 4u, 3u, 2u, 1u, 0u, 15u, 14u, 13u, 12u, 11u, 10u, 9u, 8u,
+    7u, 6u, 5u, 4u, 3u, 2u, 1u, 0u, 15u, 14u, 13u, 12u, 11u, 10u, 9u, 8u,
+    7u, 6u, 5u, 4u, 3u, 2u, 1u, 0u, 15u, 14u, 13u, 12u, 11u, 10u, 9u, 8u};
+
+OWN_QPLC_INLINE(__mmask64, own_k0_bytes_mask, (uint32_t bytes)) {
+    return (bytes >= 64u) ? (__mmask64) UINT64_MAX : (__mmask64) OWN_BIT_MASK(bytes);
+}
+
+OWN_OPT_FUN(void, k0_qplc_unpack_be_Nu64u, (const uint8_t *src_ptr,
+    uint32_t num_elements,
+    uint32_t start_bit,
+    uint32_t bit_width,
+    uint8_t *dst_ptr)) {
+    const __m512i swap_bytes   = _mm512_load_si512(swap_bytes_table_64u);
+    const __m512i lane_idx     = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m512i bit_offset   = _mm512_add_epi64(_mm512_set1_epi64(start_bit),
+                                                  _mm512_mullo_epi64(lane_idx, _mm512_set1_epi64(bit_width)));
+    const __m512i high_idx     = _mm512_srli_epi64(bit_offset, 6u);
+    const __m512i low_idx      = _mm512_add_epi64(high_idx, _mm512_set1_epi64(1));
+    const __m512i high_shift   = _mm512_and_si512(bit_offset, _mm512_set1_epi64(OWN_QWORD_WIDTH - 1u));
+    const __m512i low_shift    = _mm512_sub_epi64(_mm512_set1_epi64(OWN_QWORD_WIDTH), high_shift);
+    const __m512i result_shift = _mm512_set1_epi64(OWN_QWORD_WIDTH - bit_width);
+
+    while (0u < num_elements) {
+        const uint32_t  elements = QPL_MIN(num_elements, 8u);
+        const uint32_t  bytes    = OWN_BITS_2_BYTE(start_bit + elements * bit_width);
+        const __mmask8  out_mask = (__mmask8) OWN_BIT_MASK(elements);
+
+        __m512i src_low  = _mm512_maskz_loadu_epi8(own_k0_bytes_mask(bytes), src_ptr);
+        __m512i src_high = _mm512_maskz_loadu_epi8(own_k0_bytes_mask((bytes > 64u) ? bytes - 64u : 0u),
+                                                   src_ptr + 64u);
+
+        src_low  = _mm512_shuffle_epi8(src_low, swap_bytes);
+        src_high = _mm512_shuffle_epi8(src_high, swap_bytes);
+
+        __m512i high_qword = _mm512_permutex2var_epi64(src_low, high_idx, src_high);
+        __m512i low_qword  = _mm512_permutex2var_epi64(src_low, low_idx, src_high);
+
+        // Shift by 64 bits gives zero, so the element that ends on a qword boundary takes nothing from the next one
+        __m512i result = _mm512_or_si512(_mm512_sllv_epi64(high_qword, high_shift),
+                                         _mm512_srlv_epi64(low_qword, low_shift));
+        result = _mm512_srlv_epi64(result, result_shift);
+
+        _mm512_mask_storeu_epi64(dst_ptr, out_mask, result);
+
+        src_ptr      += bit_width;
+        dst_ptr      += elements * sizeof(uint64_t);
+        num_elements -= elements;
+    }
+}
+
+#endif // OWN_UNPACK_BE_64U_K0_H
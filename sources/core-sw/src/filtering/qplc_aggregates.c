@@ -13,6 +13,7 @@
  *          - @ref qplc_aggregates_8u
  *          - @ref qplc_aggregates_16u
  *          - @ref qplc_aggregates_32u
+ *          - @ref qplc_aggregates_64u
  */
 
 #include "own_qplc_defs.h"
@@ -21,6 +22,10 @@
 
 #include "opt/qplc_aggregates_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_aggregates_l9.h"
+
 #endif
 
 
@@ -32,6 +37,8 @@ OWN_QPLC_FUN(void, qplc_bit_aggregates_8u, (const uint8_t *src_ptr,
         uint32_t *index_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_bit_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_bit_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
 #else
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
@@ -52,6 +59,8 @@ OWN_QPLC_FUN(void, qplc_aggregates_8u, (const uint8_t *src_ptr,
         uint32_t *UNREFERENCED_PARAMETER(index_ptr))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_aggregates_8u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
 #else
     for (uint32_t idx = 0u; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
@@ -69,6 +78,8 @@ OWN_QPLC_FUN(void, qplc_aggregates_16u, (const uint8_t *src_ptr,
         uint32_t *UNREFERENCED_PARAMETER(index_ptr))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_aggregates_16u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_aggregates_16u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
 #else
     const uint16_t *src_16u_ptr = (uint16_t *) src_ptr;
 
@@ -88,6 +99,8 @@ OWN_QPLC_FUN(void, qplc_aggregates_32u, (const uint8_t *src_ptr,
         uint32_t *UNREFERENCED_PARAMETER(index_ptr))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_aggregates_32u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_aggregates_32u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
 #else
     const uint32_t *src_32u_ptr = (uint32_t *) src_ptr;
 
@@ -98,3 +111,22 @@ OWN_QPLC_FUN(void, qplc_aggregates_32u, (const uint8_t *src_ptr,
     }
 #endif
 }
+
+OWN_QPLC_FUN(void, qplc_aggregates_64u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint64_t *min_value_ptr,
+        uint64_t *max_value_ptr,
+        uint64_t *sum_ptr,
+        uint32_t *UNREFERENCED_PARAMETER(index_ptr))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_aggregates_64u)(src_ptr, length, min_value_ptr, max_value_ptr, sum_ptr);
+#else
+    const uint64_t *src_64u_ptr = (uint64_t *) src_ptr;
+
+    for (uint32_t idx = 0u; idx < length; idx++) {
+        *sum_ptr += src_64u_ptr[idx];
+        *min_value_ptr = (src_64u_ptr[idx] < *min_value_ptr) ? src_64u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_64u_ptr[idx] > *max_value_ptr) ? src_64u_ptr[idx] : *max_value_ptr;
+    }
+#endif
+}
@@ -12,6 +12,7 @@
  *          - @ref qplc_expand_8u
  *          - @ref qplc_expand_16u
  *          - @ref qplc_expand_32u
+ *          - @ref qplc_expand_64u
  */
 
 #include "own_qplc_defs.h"
@@ -20,6 +21,10 @@
 
 #include "opt/qplc_expand_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_expand_l9.h"
+
 #endif
 
 
@@ -32,6 +37,8 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_8u, (const uint8_t *src1_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_qplc_expand_8u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_expand_8u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
 #else
 
     uint32_t expanded = 0u;
@@ -57,6 +64,8 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_16u, (const uint8_t *src1_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_qplc_expand_16u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_expand_16u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
 #else
 
     uint16_t *src_16u_ptr = (uint16_t *) src1_ptr;
@@ -84,6 +93,8 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_32u, (const uint8_t *src1_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_qplc_expand_32u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_expand_32u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
 #else
 
     uint32_t *src_32u_ptr = (uint32_t *) src1_ptr;
@@ -103,3 +114,30 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_32u, (const uint8_t *src1_ptr,
     return expanded;
 #endif
 }
+
+OWN_QPLC_FUN(uint32_t, qplc_expand_64u, (const uint8_t *src1_ptr,
+        uint32_t length_1,
+        const uint8_t *src2_ptr,
+        uint32_t *length_2_ptr,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_expand_64u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#else
+
+    uint64_t *src_64u_ptr = (uint64_t *) src1_ptr;
+    uint64_t *dst_64u_ptr = (uint64_t *) dst_ptr;
+    uint32_t expanded     = 0u;
+    uint32_t idx;
+
+    for (idx = 0u; idx < *length_2_ptr; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_64u_ptr[idx] = src_64u_ptr[expanded++];
+        } else {
+            dst_64u_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+#endif
+}
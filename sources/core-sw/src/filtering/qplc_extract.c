@@ -12,6 +12,7 @@
  *          - @ref qplc_extract_8u_i
  *          - @ref qplc_extract_16u_i
  *          - @ref qplc_extract_32u_i
+ *          - @ref qplc_extract_64u_i
  *          - @ref qplc_extract_8u
  *          - @ref qplc_extract_16u
  *          - @ref qplc_extract_32u
@@ -107,6 +108,35 @@ OWN_QPLC_FUN(uint32_t, qplc_extract_32u_i, (uint8_t * src_dst_ptr,
     return (stop - start);
 }
 
+OWN_QPLC_FUN(uint32_t, qplc_extract_64u_i, (uint8_t * src_dst_ptr,
+        uint32_t length,
+        uint32_t * index_ptr,
+        uint32_t low_value,
+        uint32_t high_value)) {
+    uint32_t start;
+    uint32_t stop;
+    uint8_t  *src_ptr = (uint8_t *) src_dst_ptr;
+    uint8_t  *dst_ptr = (uint8_t *) src_dst_ptr;
+
+    if ((*index_ptr + length) < low_value) {
+        *index_ptr += length;
+        return 0u;
+    }
+    if (*index_ptr > high_value) {
+        return 0u;
+    }
+
+    start = (*index_ptr < low_value) ? (low_value - *index_ptr) : 0u;
+    stop  = ((*index_ptr + length) > high_value) ? (high_value + 1u - *index_ptr) : length;
+
+    if (0u != start) {
+        src_ptr += start * sizeof(uint64_t);
+        CALL_CORE_FUN(qplc_move_8u)(src_ptr, dst_ptr, (stop - start) * (uint32_t) sizeof(uint64_t));
+    }
+    *index_ptr += length;
+    return (stop - start);
+}
+
 /******** out-of-place scan functions ********/
 
 OWN_QPLC_FUN(uint32_t, qplc_extract_8u, (const uint8_t *src_ptr,
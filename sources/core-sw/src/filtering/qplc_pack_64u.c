@@ -0,0 +1,501 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for packing qwords to 33..64-bit data
+ *
+ * @details Function list:
+ *          - @ref qplc_pack_64u33u
+ *          - @ref qplc_pack_64u34u
+ *          - @ref qplc_pack_64u35u
+ *          - @ref qplc_pack_64u36u
+ *          - @ref qplc_pack_64u37u
+ *          - @ref qplc_pack_64u38u
+ *          - @ref qplc_pack_64u39u
+ *          - @ref qplc_pack_64u40u
+ *          - @ref qplc_pack_64u41u
+ *          - @ref qplc_pack_64u42u
+ *          - @ref qplc_pack_64u43u
+ *          - @ref qplc_pack_64u44u
+ *          - @ref qplc_pack_64u45u
+ *          - @ref qplc_pack_64u46u
+ *          - @ref qplc_pack_64u47u
+ *          - @ref qplc_pack_64u48u
+ *          - @ref qplc_pack_64u49u
+ *          - @ref qplc_pack_64u50u
+ *          - @ref qplc_pack_64u51u
+ *          - @ref qplc_pack_64u52u
+ *          - @ref qplc_pack_64u53u
+ *          - @ref qplc_pack_64u54u
+ *          - @ref qplc_pack_64u55u
+ *          - @ref qplc_pack_64u56u
+ *          - @ref qplc_pack_64u57u
+ *          - @ref qplc_pack_64u58u
+ *          - @ref qplc_pack_64u59u
+ *          - @ref qplc_pack_64u60u
+ *          - @ref qplc_pack_64u61u
+ *          - @ref qplc_pack_64u62u
+ *          - @ref qplc_pack_64u63u
+ *          - @ref qplc_pack_64u64u
+ */
+#include "own_qplc_defs.h"
+
+#if PLATFORM >= K0
+
+#include "opt/qplc_pack_64u_k0.h"
+
+#endif
+
+OWN_QPLC_INLINE(void, qplc_pack_64u_nu, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t bit_width,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+    uint64_t *src_64u_ptr = (uint64_t *) src_ptr;
+    int32_t  bits_in_buf  = (int32_t) start_bit;
+    uint64_t src          = (uint64_t) (*dst_ptr) & OWN_BIT_MASK(start_bit);
+
+    // Only the first byte of the destination is read, so the output buffer may end right after the last element
+    while (0u < num_elements) {
+        uint64_t value = *src_64u_ptr;
+
+        src |= value << bits_in_buf;
+        bits_in_buf += (int32_t) bit_width;
+
+        if (OWN_QWORD_WIDTH <= (uint32_t) bits_in_buf) {
+            *(uint64_t *) dst_ptr = src;
+            dst_ptr += sizeof(uint64_t);
+            bits_in_buf -= OWN_QWORD_WIDTH;
+            src = (0 < bits_in_buf) ? value >> (bit_width - (uint32_t) bits_in_buf) : 0u;
+        }
+
+        src_64u_ptr++;
+        num_elements--;
+    }
+
+    while (0 < bits_in_buf) {
+        *dst_ptr = (uint8_t) (src);
+        bits_in_buf -= OWN_BYTE_WIDTH;
+        dst_ptr++;
+        src >>= OWN_BYTE_WIDTH;
+    }
+}
+
+// ********************** 33u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u33u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 33u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 33u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 34u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u34u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 34u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 34u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 35u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u35u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 35u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 35u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 36u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u36u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 36u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 36u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 37u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u37u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 37u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 37u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 38u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u38u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 38u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 38u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 39u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u39u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 39u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 39u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 40u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u40u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 40u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 40u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 41u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u41u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 41u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 41u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 42u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u42u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 42u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 42u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 43u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u43u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 43u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 43u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 44u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u44u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 44u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 44u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 45u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u45u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 45u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 45u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 46u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u46u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 46u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 46u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 47u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u47u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 47u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 47u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 48u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u48u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 48u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 48u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 49u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u49u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 49u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 49u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 50u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u50u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 50u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 50u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 51u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u51u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 51u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 51u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 52u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u52u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 52u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 52u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 53u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u53u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 53u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 53u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 54u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u54u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 54u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 54u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 55u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u55u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 55u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 55u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 56u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u56u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 56u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 56u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 57u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u57u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 57u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 57u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 58u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u58u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 58u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 58u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 59u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u59u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 59u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 59u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 60u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u60u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 60u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 60u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 61u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u61u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 61u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 61u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 62u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u62u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 62u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 62u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 63u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u63u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 63u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 63u, dst_ptr, start_bit);
+#endif
+}
+
+// ********************** 64u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint8_t *dst_ptr,
+        uint32_t start_bit)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_pack_64u_nu)(src_ptr, num_elements, 64u, dst_ptr, start_bit);
+#else
+    qplc_pack_64u_nu(src_ptr, num_elements, 64u, dst_ptr, start_bit);
+#endif
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of run detection functions used by the PRLE (Parquet RLE) encoder
+ *
+ * @details The encoder writes bit-packed octets until it meets an octet of equal elements, then extends the run
+ *          of that value as far as it goes. Both searches are done by the functions below.
+ *
+ *          Function list:
+ *          - @ref qplc_prle_run_length_8u
+ *          - @ref qplc_prle_run_length_16u
+ *          - @ref qplc_prle_run_length_32u
+ *          - @ref qplc_prle_find_equal_octet_8u
+ *          - @ref qplc_prle_find_equal_octet_16u
+ *          - @ref qplc_prle_find_equal_octet_32u
+ *
+ */
+
+#include "own_qplc_defs.h"
+
+#if PLATFORM >= K0
+#include "opt/qplc_pack_prle_k0.h"
+#elif PLATFORM == L9
+#include "opt/qplc_pack_prle_l9.h"
+#endif
+
+#define OWN_OCTET_BYTES_MASK_8U 0x0101010101010101LLu /**< Multiplier that copies a byte to every byte of a qword */
+
+OWN_QPLC_FUN(uint32_t, qplc_prle_run_length_8u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_prle_run_length_8u)(src_ptr, num_elements, value);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_prle_run_length_8u)(src_ptr, num_elements, value);
+#else
+    uint32_t idx = 0u;
+
+    while ((idx < num_elements) && (value == src_ptr[idx])) {
+        idx++;
+    }
+
+    return idx;
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_prle_run_length_16u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_prle_run_length_16u)(src_ptr, num_elements, value);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_prle_run_length_16u)(src_ptr, num_elements, value);
+#else
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    uint32_t       idx          = 0u;
+
+    while ((idx < num_elements) && (value == src_16u_ptr[idx])) {
+        idx++;
+    }
+
+    return idx;
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_prle_run_length_32u, (const uint8_t *src_ptr, uint32_t num_elements, uint32_t value)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_prle_run_length_32u)(src_ptr, num_elements, value);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_prle_run_length_32u)(src_ptr, num_elements, value);
+#else
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    uint32_t       idx          = 0u;
+
+    while ((idx < num_elements) && (value == src_32u_ptr[idx])) {
+        idx++;
+    }
+
+    return idx;
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_prle_find_equal_octet_8u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_prle_find_equal_octet_8u)(src_ptr, num_octets);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_prle_find_equal_octet_8u)(src_ptr, num_octets);
+#else
+    const uint64_t *src_64u_ptr = (const uint64_t *) src_ptr;
+
+    for (uint32_t idx = 0u; idx < num_octets; idx++) {
+        // An octet of 8u elements is a single qword, it consists of equal bytes if it is equal to its first byte
+        // copied to every byte
+        const uint64_t octet = src_64u_ptr[idx];
+
+        if (octet == (octet & 0xFFu) * OWN_OCTET_BYTES_MASK_8U) {
+            return idx;
+        }
+    }
+
+    return num_octets;
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_prle_find_equal_octet_16u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_prle_find_equal_octet_16u)(src_ptr, num_octets);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_prle_find_equal_octet_16u)(src_ptr, num_octets);
+#else
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+
+    for (uint32_t idx = 0u; idx < num_octets; idx++) {
+        const uint16_t *octet_ptr = src_16u_ptr + idx * OWN_PARQUET_WIDTH;
+        uint32_t       i          = 1u;
+
+        while ((i < OWN_PARQUET_WIDTH) && (octet_ptr[0] == octet_ptr[i])) {
+            i++;
+        }
+
+        if (OWN_PARQUET_WIDTH == i) {
+            return idx;
+        }
+    }
+
+    return num_octets;
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_prle_find_equal_octet_32u, (const uint8_t *src_ptr, uint32_t num_octets)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_prle_find_equal_octet_32u)(src_ptr, num_octets);
+#else
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+
+    for (uint32_t idx = 0u; idx < num_octets; idx++) {
+        const uint32_t *octet_ptr = src_32u_ptr + idx * OWN_PARQUET_WIDTH;
+        uint32_t       i          = 1u;
+
+        while ((i < OWN_PARQUET_WIDTH) && (octet_ptr[0] == octet_ptr[i])) {
+            i++;
+        }
+
+        if (OWN_PARQUET_WIDTH == i) {
+            return idx;
+        }
+    }
+
+    return num_octets;
+#endif
+}
@@ -64,6 +64,8 @@
 
 #if PLATFORM >= K0
 #include "opt/qplc_scan_k0.h"
+#elif PLATFORM == L9
+#include "opt/qplc_scan_l9.h"
 #endif
 
 
@@ -74,6 +76,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -89,6 +93,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_16u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -107,6 +113,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_32u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -125,6 +133,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -140,6 +150,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_16u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -158,6 +170,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_32u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -176,6 +190,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -191,6 +207,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_16u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -209,6 +227,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_32u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -227,6 +247,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -242,6 +264,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_16u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -260,6 +284,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_32u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -278,6 +304,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -293,6 +321,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_16u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -311,6 +341,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_32u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -329,6 +361,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -344,6 +378,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_16u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -362,6 +398,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_32u8u_i, (uint8_t *src_dst_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -377,6 +415,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_8u_i, (uint8_t *src_dst_ptr, uint32_t length,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -389,6 +429,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_16u8u_i, (uint8_t *src_dst_ptr, uint32_t leng
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -404,6 +446,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_32u8u_i, (uint8_t *src_dst_ptr, uint32_t leng
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -419,6 +463,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_8u_i, (uint8_t *src_dst_ptr, uint32_t len
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -431,6 +477,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_16u8u_i, (uint8_t *src_dst_ptr, uint32_t
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t *src_ptr = (uint16_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -446,6 +494,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_32u8u_i, (uint8_t *src_dst_ptr, uint32_t
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t *src_ptr = (uint32_t *)src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -467,6 +517,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_8u)(src_ptr, dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -483,6 +535,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_16u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_16u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -501,6 +555,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_32u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_32u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -519,6 +575,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_8u)(src_ptr, dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -535,6 +593,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_16u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_16u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -553,6 +613,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_32u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_32u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -571,6 +633,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_8u)(src_ptr, dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -587,6 +651,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_16u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_16u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -605,6 +671,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_32u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_32u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -623,6 +691,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_8u)(src_ptr, dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -639,6 +709,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_16u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_16u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -657,6 +729,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_32u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_32u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -675,6 +749,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_8u)(src_ptr, dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -691,6 +767,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_16u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_16u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -709,6 +787,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_32u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_32u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -727,6 +807,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_8u)(src_ptr, dst_ptr, length, low_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -743,6 +825,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_16u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_16u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -761,6 +845,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_32u8u, (const uint8_t *src_ptr,
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_32u8u)(src_ptr, dst_ptr, length, low_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -775,6 +861,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -787,6 +875,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_16u8u, (const uint8_t *src_ptr, uint8_t *dst_
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -801,6 +891,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_32u8u, (const uint8_t *src_ptr, uint8_t *dst_
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -815,6 +907,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_8u, (const uint8_t *src_ptr, uint8_t *dst
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0u; idx < length; idx++)
     {
@@ -827,6 +921,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_16u8u, (const uint8_t *src_ptr, uint8_t *
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t *p_src_16u = (uint16_t *)src_ptr;
 
@@ -841,6 +937,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_32u8u, (const uint8_t *src_ptr, uint8_t *
 {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t *p_src_32u = (uint32_t *)src_ptr;
 
@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of fused scan functions for packed n-bit input and nominal bit vector output
+ *
+ * @details Every function unpacks, compares, packs the result into the destination bit vector and calculates
+ *          aggregates on the result in a single pass over the source, 64 elements at a time, without
+ *          intermediate buffers. All scan flavors are reduced to the unsigned range check
+ *          `(value - base) <= span` with optional inversion of the result.
+ *
+ *          Function list:
+ *          - @ref qplc_scan_eq_nu1u
+ *          - @ref qplc_scan_ne_nu1u
+ *          - @ref qplc_scan_lt_nu1u
+ *          - @ref qplc_scan_le_nu1u
+ *          - @ref qplc_scan_gt_nu1u
+ *          - @ref qplc_scan_ge_nu1u
+ *          - @ref qplc_scan_range_nu1u
+ *          - @ref qplc_scan_not_range_nu1u
+ *
+ */
+
+#include "own_qplc_defs.h"
+
+#if PLATFORM >= K0
+#include "opt/qplc_scan_nu1u_k0.h"
+#elif PLATFORM == L9
+#include "opt/qplc_scan_nu1u_l9.h"
+#endif
+
+#define OWN_SCAN_NU1U_BLOCK 64u      /**< Number of elements processed at a time */
+#define OWN_SCAN_NU1U_INVERT (~0ULL) /**< Result mask inversion */
+
+OWN_QPLC_INLINE(uint32_t, own_scan_nu1u_popcnt, (uint64_t mask)) {
+#if PLATFORM >= L9
+    return (uint32_t) _mm_popcnt_u64(mask);
+#else
+    mask = mask - ((mask >> 1u) & 0x5555555555555555ULL);
+    mask = (mask & 0x3333333333333333ULL) + ((mask >> 2u) & 0x3333333333333333ULL);
+    mask = (mask + (mask >> 4u)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (uint32_t) ((mask * 0x0101010101010101ULL) >> 56u);
+#endif
+}
+
+OWN_QPLC_INLINE(uint32_t, own_scan_nu1u_first_bit, (uint64_t mask)) {
+#if PLATFORM >= L9
+    return (uint32_t) _tzcnt_u64(mask);
+#else
+    uint32_t idx = 0u;
+
+    while (0u == (mask & 1u)) {
+        mask >>= 1u;
+        idx++;
+    }
+    return idx;
+#endif
+}
+
+OWN_QPLC_INLINE(uint32_t, own_scan_nu1u_last_bit, (uint64_t mask)) {
+#if PLATFORM >= L9
+    return 63u - (uint32_t) _lzcnt_u64(mask);
+#else
+    uint32_t idx = 63u;
+
+    while (0u == (mask >> idx)) {
+        idx--;
+    }
+    return idx;
+#endif
+}
+
+/**
+ * @brief Scans up to 64 elements that start at src_ptr, reads exactly the bytes that contain these elements
+ */
+OWN_QPLC_INLINE(uint64_t, own_scan_nu1u_block, (const uint8_t *src_ptr,
+                                                uint32_t count,
+                                                uint32_t bit_width,
+                                                uint32_t base,
+                                                uint32_t span)) {
+    uint32_t value_mask  = (uint32_t) OWN_BIT_MASK(bit_width);
+    uint64_t bit_buffer  = 0u;
+    uint32_t bits_in_buf = 0u;
+    uint64_t mask        = 0u;
+
+    for (uint32_t idx = 0u; idx < count; idx++) {
+        while (bits_in_buf < bit_width) {
+            bit_buffer |= ((uint64_t) *src_ptr) << bits_in_buf;
+            bits_in_buf += OWN_BYTE_WIDTH;
+            src_ptr++;
+        }
+
+        uint32_t value = (uint32_t) bit_buffer & value_mask;
+        bit_buffer >>= bit_width;
+        bits_in_buf -= bit_width;
+
+        mask |= ((uint64_t) ((uint32_t) (value - base) <= span)) << idx;
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Accumulates aggregates for the nominal bit vector block that starts at the given element index
+ */
+OWN_QPLC_INLINE(void, own_scan_nu1u_aggregates, (uint64_t mask,
+                                                 uint32_t index,
+                                                 uint32_t *min_value_ptr,
+                                                 uint32_t *max_value_ptr,
+                                                 uint32_t *sum_ptr)) {
+    if (0u != mask) {
+        if (OWN_MAX_32U == *min_value_ptr) {
+            *min_value_ptr = index + own_scan_nu1u_first_bit(mask);
+        }
+        *max_value_ptr = index + own_scan_nu1u_last_bit(mask);
+        *sum_ptr += own_scan_nu1u_popcnt(mask);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_scan_nu1u, (const uint8_t *src_ptr,
+                                      uint32_t length,
+                                      uint32_t bit_width,
+                                      uint32_t base,
+                                      uint32_t span,
+                                      uint64_t invert,
+                                      uint8_t *dst_ptr,
+                                      uint32_t start_bit,
+                                      uint32_t *min_value_ptr,
+                                      uint32_t *max_value_ptr,
+                                      uint32_t *sum_ptr,
+                                      uint32_t *index_ptr)) {
+    uint32_t index        = *index_ptr;
+    uint32_t min_value    = *min_value_ptr;
+    uint32_t max_value    = *max_value_ptr;
+    uint32_t sum          = 0u;
+    uint32_t block_bytes  = bit_width * (OWN_SCAN_NU1U_BLOCK / OWN_BYTE_WIDTH);
+    uint32_t blocks_count = length / OWN_SCAN_NU1U_BLOCK;
+    uint32_t tail_length  = length % OWN_SCAN_NU1U_BLOCK;
+    uint32_t block        = 0u;
+
+    // Result bits that are not stored yet, the first destination byte is completed with the new bits.
+    // Every full block adds 64 bits, so exactly start_bit bits are left unstored after each of them.
+    uint64_t bit_buffer   = (0u != start_bit) ? (uint64_t) (dst_ptr[0] & OWN_BIT_MASK(start_bit)) : 0u;
+
+#if PLATFORM >= K0
+    own_k0_scan_nu1u_state_t state;
+
+    own_k0_scan_nu1u_init(length, bit_width, base, span, &state);
+
+    for (; block < state.blocks_count; block++) {
+        uint64_t mask = own_k0_scan_nu1u_64(src_ptr + (size_t) block * block_bytes, &state) ^ invert;
+
+        own_scan_nu1u_aggregates(mask, index + block * OWN_SCAN_NU1U_BLOCK, &min_value, &max_value, &sum);
+        *(uint64_t *) dst_ptr = bit_buffer | (mask << start_bit);
+        bit_buffer = (mask >> (63u - start_bit)) >> 1u;
+        dst_ptr += sizeof(uint64_t);
+    }
+#elif PLATFORM == L9
+    own_l9_scan_nu1u_state_t state;
+
+    own_l9_scan_nu1u_init(length, bit_width, base, span, &state);
+
+    for (; block < state.blocks_count; block++) {
+        uint64_t mask = own_l9_scan_nu1u_64(src_ptr + (size_t) block * block_bytes, &state) ^ invert;
+
+        own_scan_nu1u_aggregates(mask, index + block * OWN_SCAN_NU1U_BLOCK, &min_value, &max_value, &sum);
+        *(uint64_t *) dst_ptr = bit_buffer | (mask << start_bit);
+        bit_buffer = (mask >> (63u - start_bit)) >> 1u;
+        dst_ptr += sizeof(uint64_t);
+    }
+#endif
+
+    // Full blocks that are too close to the source end for the wide loads
+    for (; block < blocks_count; block++) {
+#if PLATFORM >= K0
+        uint64_t mask = own_k0_scan_nu1u_tail(src_ptr + (size_t) block * block_bytes, OWN_SCAN_NU1U_BLOCK, &state);
+#else
+        uint64_t mask = own_scan_nu1u_block(src_ptr + (size_t) block * block_bytes,
+                                            OWN_SCAN_NU1U_BLOCK, bit_width, base, span);
+#endif
+        mask ^= invert;
+
+        own_scan_nu1u_aggregates(mask, index + block * OWN_SCAN_NU1U_BLOCK, &min_value, &max_value, &sum);
+        *(uint64_t *) dst_ptr = bit_buffer | (mask << start_bit);
+        bit_buffer = (mask >> (63u - start_bit)) >> 1u;
+        dst_ptr += sizeof(uint64_t);
+    }
+
+    uint32_t bits_in_buf = start_bit;
+
+    if (0u != tail_length) {
+#if PLATFORM >= K0
+        uint64_t mask = own_k0_scan_nu1u_tail(src_ptr + (size_t) block * block_bytes, tail_length, &state);
+#else
+        uint64_t mask = own_scan_nu1u_block(src_ptr + (size_t) block * block_bytes,
+                                            tail_length, bit_width, base, span);
+#endif
+        mask = (mask ^ invert) & OWN_BIT_MASK(tail_length);
+
+        own_scan_nu1u_aggregates(mask, index + block * OWN_SCAN_NU1U_BLOCK, &min_value, &max_value, &sum);
+        bit_buffer |= mask << start_bit;
+        bits_in_buf += tail_length;
+
+        if (bits_in_buf >= 64u) {
+            *(uint64_t *) dst_ptr = bit_buffer;
+            bit_buffer = mask >> (64u - start_bit);
+            bits_in_buf -= 64u;
+            dst_ptr += sizeof(uint64_t);
+        }
+    }
+
+    for (uint32_t idx = 0u; idx < OWN_BITS_2_BYTE(bits_in_buf); idx++) {
+        dst_ptr[idx] = (uint8_t) (bit_buffer >> (idx * OWN_BYTE_WIDTH));
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr += length;
+}
+
+#define OWN_SCAN_NU1U_FUN(flavor, base, span, invert)                                           \
+OWN_QPLC_FUN(void, qplc_scan_##flavor##_nu1u, (const uint8_t *src_ptr,                          \
+                                               uint32_t length,                                 \
+                                               uint32_t bit_width,                              \
+                                               uint32_t low_value,                              \
+                                               uint32_t high_value,                             \
+                                               uint8_t *dst_ptr,                                \
+                                               uint32_t start_bit,                              \
+                                               uint32_t *min_value_ptr,                         \
+                                               uint32_t *max_value_ptr,                         \
+                                               uint32_t *sum_ptr,                               \
+                                               uint32_t *index_ptr)) {                          \
+    (void) high_value;                                                                          \
+    own_scan_nu1u(src_ptr, length, bit_width, (base), (span), (invert),                         \
+                  dst_ptr, start_bit, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);        \
+}
+
+// value == low
+OWN_SCAN_NU1U_FUN(eq, low_value, 0u, 0u)
+// value != low
+OWN_SCAN_NU1U_FUN(ne, low_value, 0u, OWN_SCAN_NU1U_INVERT)
+// value < low is the same as !(value >= low)
+OWN_SCAN_NU1U_FUN(lt, low_value, OWN_MAX_32U - low_value, OWN_SCAN_NU1U_INVERT)
+// value <= low
+OWN_SCAN_NU1U_FUN(le, 0u, low_value, 0u)
+// value > low is the same as !(value <= low)
+OWN_SCAN_NU1U_FUN(gt, 0u, low_value, OWN_SCAN_NU1U_INVERT)
+// value >= low
+OWN_SCAN_NU1U_FUN(ge, low_value, OWN_MAX_32U - low_value, 0u)
+// low <= value <= high, empty range (low > high) is an inverted full range
+OWN_SCAN_NU1U_FUN(range,
+                  (low_value <= high_value) ? low_value : 0u,
+                  (low_value <= high_value) ? high_value - low_value : OWN_MAX_32U,
+                  (low_value <= high_value) ? 0u : OWN_SCAN_NU1U_INVERT)
+// value < low || value > high
+OWN_SCAN_NU1U_FUN(not_range,
+                  (low_value <= high_value) ? low_value : 0u,
+                  (low_value <= high_value) ? high_value - low_value : OWN_MAX_32U,
+                  (low_value <= high_value) ? OWN_SCAN_NU1U_INVERT : 0u)
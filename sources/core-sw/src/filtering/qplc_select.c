@@ -15,6 +15,7 @@
  *          - @ref qplc_select_8u
  *          - @ref qplc_select_16u
  *          - @ref qplc_select_32u
+ *          - @ref qplc_select_64u
  *
  */
 
@@ -24,11 +25,17 @@
 
 #include "opt/qplc_select_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_select_l9.h"
+
 #endif
 
 OWN_QPLC_FUN(uint32_t, qplc_select_8u_i, (uint8_t * src_dst_ptr, const uint8_t *src2_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_8u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_8u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
 #else
     uint8_t  *src_ptr = src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -46,6 +53,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_8u_i, (uint8_t * src_dst_ptr, const uint8_t *
 OWN_QPLC_FUN(uint32_t, qplc_select_16u_i, (uint8_t * src_dst_ptr, const uint8_t *src2_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_16u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_16u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
 #else
     uint16_t *src_ptr = (uint16_t *) src_dst_ptr;
     uint16_t *dst_ptr = (uint16_t *) src_dst_ptr;
@@ -63,6 +72,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_16u_i, (uint8_t * src_dst_ptr, const uint8_t
 OWN_QPLC_FUN(uint32_t, qplc_select_32u_i, (uint8_t * src_dst_ptr, const uint8_t *src2_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_32u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_32u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
 #else
     uint32_t *src_ptr = (uint32_t *) src_dst_ptr;
     uint32_t *dst_ptr = (uint32_t *) src_dst_ptr;
@@ -85,6 +96,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_8u, (const uint8_t *src_ptr,
         uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_8u)(src_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_8u)(src_ptr, src2_ptr, dst_ptr, length);
 #else
     uint32_t selected = 0u;
 
@@ -103,6 +116,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_16u, (const uint8_t *src_ptr,
         uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_16u)(src_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_16u)(src_ptr, src2_ptr, dst_ptr, length);
 #else
     uint16_t *src_16u_ptr = (uint16_t *) src_ptr;
     uint16_t *dst_16u_ptr = (uint16_t *) dst_ptr;
@@ -123,6 +138,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_32u, (const uint8_t *src_ptr,
         uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_32u)(src_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_32u)(src_ptr, src2_ptr, dst_ptr, length);
 #else
     uint32_t *src_32u_ptr = (uint32_t *) src_ptr;
     uint32_t *dst_32u_ptr = (uint32_t *) dst_ptr;
@@ -136,3 +153,23 @@ OWN_QPLC_FUN(uint32_t, qplc_select_32u, (const uint8_t *src_ptr,
     return selected;
 #endif
 }
+
+OWN_QPLC_FUN(uint32_t, qplc_select_64u, (const uint8_t *src_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_select_64u)(src_ptr, src2_ptr, dst_ptr, length);
+#else
+    uint64_t *src_64u_ptr = (uint64_t *) src_ptr;
+    uint64_t *dst_64u_ptr = (uint64_t *) dst_ptr;
+    uint32_t selected     = 0u;
+
+    for (uint32_t idx = 0u; idx < length; idx++) {
+        if (src2_ptr[idx] != 0u) {
+            dst_64u_ptr[selected++] = src_64u_ptr[idx];
+        }
+    }
+    return selected;
+#endif
+}
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of select functions with the packed bit vector mask
+ *
+ * @details The mask is read 64 bits at a time straight from the source #2 stream, without unpacking
+ *          it into a byte per element. Blocks with an empty mask word are skipped without touching the source,
+ *          so the low selectivity masks cost a single load and compare per 64 elements.
+ *
+ *          Function list:
+ *          - @ref qplc_select_bit_mask_8u
+ *          - @ref qplc_select_bit_mask_16u
+ *          - @ref qplc_select_bit_mask_32u
+ *          - @ref qplc_select_bit_mask_64u
+ *
+ */
+
+#include "own_qplc_defs.h"
+
+#if PLATFORM >= K0
+#include "opt/qplc_select_bit_mask_k0.h"
+#elif PLATFORM == L9
+#include "opt/qplc_select_bit_mask_l9.h"
+#endif
+
+#define OWN_SELECT_BIT_MASK_BLOCK 64u /**< Number of elements processed at a time */
+
+/**
+ * @brief Loads 64 mask bits that start at the given bit of the first byte
+ */
+OWN_QPLC_INLINE(uint64_t, own_select_bit_mask_load_64, (const uint8_t *src2_ptr, uint32_t start_bit)) {
+    uint64_t mask = *(const uint64_t *) src2_ptr;
+
+    // The 9th byte is read only if the bits really cross it
+    if (0u != start_bit) {
+        mask = (mask >> start_bit) | (((uint64_t) src2_ptr[sizeof(uint64_t)]) << (64u - start_bit));
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Loads up to 64 mask bits that start at the given bit of the first byte,
+ *        reads exactly the bytes that contain these bits
+ */
+OWN_QPLC_INLINE(uint64_t, own_select_bit_mask_load_tail, (const uint8_t *src2_ptr,
+                                                          uint32_t start_bit,
+                                                          uint32_t count)) {
+    uint32_t bytes_count = OWN_BITS_2_BYTE(start_bit + count);
+    uint64_t mask        = 0u;
+
+    for (uint32_t idx = 0u; idx < QPL_MIN(bytes_count, sizeof(uint64_t)); idx++) {
+        mask |= ((uint64_t) src2_ptr[idx]) << (idx * OWN_BYTE_WIDTH);
+    }
+
+    mask >>= start_bit;
+
+    // Less than 64 bits are loaded, so the 9th byte is needed only if they start in the middle of the first one
+    if (bytes_count > sizeof(uint64_t)) {
+        mask |= ((uint64_t) src2_ptr[sizeof(uint64_t)]) << (64u - start_bit);
+    }
+
+    return mask & OWN_BIT_MASK(count);
+}
+
+/**
+ * @brief Selects the elements of a block by the set bits of the mask, skips empty mask bytes
+ */
+#define OWN_SELECT_BIT_MASK_BLOCK_FUN(type, width)                                               \
+OWN_QPLC_INLINE(uint32_t, own_select_bit_mask_block_##width, (const uint8_t *src_ptr,           \
+                                                              uint64_t mask,                    \
+                                                              uint8_t *dst_ptr)) {              \
+    const type##_t *src_elements_ptr = (const type##_t *) src_ptr;                              \
+    type##_t       *dst_elements_ptr = (type##_t *) dst_ptr;                                    \
+    uint32_t       selected          = 0u;                                                      \
+                                                                                                \
+    for (uint32_t idx = 0u; 0u != mask; idx += OWN_BYTE_WIDTH, mask >>= OWN_BYTE_WIDTH) {       \
+        for (uint32_t bits = (uint32_t) mask & 0xFFu, bit = idx; 0u != bits; bits >>= 1u, bit++) { \
+            dst_elements_ptr[selected] = src_elements_ptr[bit];                                 \
+            selected += bits & 1u;                                                              \
+        }                                                                                       \
+    }                                                                                           \
+                                                                                                \
+    return selected;                                                                            \
+}
+
+OWN_SELECT_BIT_MASK_BLOCK_FUN(uint8, 8u)
+OWN_SELECT_BIT_MASK_BLOCK_FUN(uint16, 16u)
+OWN_SELECT_BIT_MASK_BLOCK_FUN(uint32, 32u)
+OWN_SELECT_BIT_MASK_BLOCK_FUN(uint64, 64u)
+
+#if PLATFORM >= K0
+#define OWN_SELECT_BIT_MASK_OPT_BLOCK(width) own_k0_select_bit_mask_##width
+#elif PLATFORM == L9
+#define OWN_SELECT_BIT_MASK_OPT_BLOCK(width) own_l9_select_bit_mask_##width
+#else
+#define OWN_SELECT_BIT_MASK_OPT_BLOCK(width) own_select_bit_mask_block_##width
+#endif
+
+#define OWN_SELECT_BIT_MASK_FUN(type, width)                                                    \
+OWN_QPLC_FUN(uint32_t, qplc_select_bit_mask_##width, (const uint8_t *src_ptr,                   \
+                                                      const uint8_t *src2_ptr,                  \
+                                                      uint32_t src2_start_bit,                  \
+                                                      uint8_t *dst_ptr,                         \
+                                                      uint32_t length)) {                       \
+    uint32_t blocks_count = length / OWN_SELECT_BIT_MASK_BLOCK;                                 \
+    uint32_t tail_length  = length % OWN_SELECT_BIT_MASK_BLOCK;                                 \
+    uint32_t selected     = 0u;                                                                 \
+                                                                                                \
+    for (uint32_t block = 0u; block < blocks_count; block++) {                                  \
+        uint64_t mask = own_select_bit_mask_load_64(src2_ptr + block * sizeof(uint64_t), src2_start_bit); \
+                                                                                                \
+        if (0u != mask) {                                                                       \
+            selected += OWN_SELECT_BIT_MASK_OPT_BLOCK(width)(                                    \
+                src_ptr + (size_t) block * OWN_SELECT_BIT_MASK_BLOCK * sizeof(type##_t),        \
+                mask,                                                                           \
+                dst_ptr + (size_t) selected * sizeof(type##_t));                                \
+        }                                                                                       \
+    }                                                                                           \
+                                                                                                \
+    if (0u != tail_length) {                                                                    \
+        uint64_t mask = own_select_bit_mask_load_tail(src2_ptr + blocks_count * sizeof(uint64_t), \
+                                                      src2_start_bit,                           \
+                                                      tail_length);                             \
+                                                                                                \
+        selected += own_select_bit_mask_block_##width(                                           \
+            src_ptr + (size_t) blocks_count * OWN_SELECT_BIT_MASK_BLOCK * sizeof(type##_t),     \
+            mask,                                                                               \
+            dst_ptr + (size_t) selected * sizeof(type##_t));                                    \
+    }                                                                                           \
+                                                                                                \
+    return selected;                                                                            \
+}
+
+OWN_SELECT_BIT_MASK_FUN(uint8, 8u)
+OWN_SELECT_BIT_MASK_FUN(uint16, 16u)
+OWN_SELECT_BIT_MASK_FUN(uint32, 32u)
+OWN_SELECT_BIT_MASK_FUN(uint64, 64u)
@@ -73,12 +73,20 @@ OWN_QPLC_INLINE(void, qplc_unpack_Nu16u, (const uint8_t *src_ptr,
 
 #endif
 
+#if PLATFORM == L9
+
+#include "opt/qplc_unpack_16u_l9.h"
+
+#endif
+
 OWN_QPLC_FUN(void, qplc_unpack_9u16u, (const uint8_t *src_ptr,
         uint32_t num_elements,
         uint32_t start_bit,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_9u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu16u)(src_ptr, num_elements, start_bit, 9u, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 9u, dst_ptr);
 #endif
@@ -90,6 +98,8 @@ OWN_QPLC_FUN(void, qplc_unpack_10u16u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_10u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu16u)(src_ptr, num_elements, start_bit, 10u, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 10u, dst_ptr);
 #endif
@@ -101,6 +111,8 @@ OWN_QPLC_FUN(void, qplc_unpack_11u16u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_11u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu16u)(src_ptr, num_elements, start_bit, 11u, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 11u, dst_ptr);
 #endif
@@ -112,6 +124,8 @@ OWN_QPLC_FUN(void, qplc_unpack_12u16u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_12u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu16u)(src_ptr, num_elements, start_bit, 12u, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 12u, dst_ptr);
 #endif
@@ -123,6 +137,8 @@ OWN_QPLC_FUN(void, qplc_unpack_13u16u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_13u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu16u)(src_ptr, num_elements, start_bit, 13u, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 13u, dst_ptr);
 #endif
@@ -134,6 +150,8 @@ OWN_QPLC_FUN(void, qplc_unpack_14u16u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_14u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu16u)(src_ptr, num_elements, start_bit, 14u, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 14u, dst_ptr);
 #endif
@@ -145,6 +163,8 @@ OWN_QPLC_FUN(void, qplc_unpack_15u16u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_15u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu16u)(src_ptr, num_elements, start_bit, 15u, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 15u, dst_ptr);
 #endif
@@ -104,6 +104,12 @@ OWN_QPLC_INLINE(void, qplc_unpack_Nu32u, (const uint8_t *src_ptr,
 
 #endif
 
+#if PLATFORM == L9
+
+#include "opt/qplc_unpack_32u_l9.h"
+
+#endif
+
 // ********************** 17u ****************************** //
 
 OWN_QPLC_FUN(void, qplc_unpack_17u32u, (const uint8_t *src_ptr,
@@ -112,6 +118,8 @@ OWN_QPLC_FUN(void, qplc_unpack_17u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_17u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 17u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 17u, dst_ptr);
 #endif
@@ -125,6 +133,8 @@ OWN_QPLC_FUN(void, qplc_unpack_18u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_18u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 18u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 18u, dst_ptr);
 #endif
@@ -138,6 +148,8 @@ OWN_QPLC_FUN(void, qplc_unpack_19u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_19u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 19u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 19u, dst_ptr);
 #endif
@@ -151,6 +163,8 @@ OWN_QPLC_FUN(void, qplc_unpack_20u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_20u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 20u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 20u, dst_ptr);
 #endif
@@ -164,6 +178,8 @@ OWN_QPLC_FUN(void, qplc_unpack_21u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_21u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 21u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 21u, dst_ptr);
 #endif
@@ -177,6 +193,8 @@ OWN_QPLC_FUN(void, qplc_unpack_22u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_22u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 22u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 22u, dst_ptr);
 #endif
@@ -190,6 +208,8 @@ OWN_QPLC_FUN(void, qplc_unpack_23u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_23u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 23u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 23u, dst_ptr);
 #endif
@@ -203,6 +223,8 @@ OWN_QPLC_FUN(void, qplc_unpack_24u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_24u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 24u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 24u, dst_ptr);
 #endif
@@ -216,6 +238,8 @@ OWN_QPLC_FUN(void, qplc_unpack_25u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_25u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu32u)(src_ptr, num_elements, start_bit, 25u, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 25u, dst_ptr);
 #endif
@@ -0,0 +1,513 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for unpacking 33..64-bit data to qwords
+ *
+ * @details Function list:
+ *          - @ref qplc_unpack_33u64u
+ *          - @ref qplc_unpack_34u64u
+ *          - @ref qplc_unpack_35u64u
+ *          - @ref qplc_unpack_36u64u
+ *          - @ref qplc_unpack_37u64u
+ *          - @ref qplc_unpack_38u64u
+ *          - @ref qplc_unpack_39u64u
+ *          - @ref qplc_unpack_40u64u
+ *          - @ref qplc_unpack_41u64u
+ *          - @ref qplc_unpack_42u64u
+ *          - @ref qplc_unpack_43u64u
+ *          - @ref qplc_unpack_44u64u
+ *          - @ref qplc_unpack_45u64u
+ *          - @ref qplc_unpack_46u64u
+ *          - @ref qplc_unpack_47u64u
+ *          - @ref qplc_unpack_48u64u
+ *          - @ref qplc_unpack_49u64u
+ *          - @ref qplc_unpack_50u64u
+ *          - @ref qplc_unpack_51u64u
+ *          - @ref qplc_unpack_52u64u
+ *          - @ref qplc_unpack_53u64u
+ *          - @ref qplc_unpack_54u64u
+ *          - @ref qplc_unpack_55u64u
+ *          - @ref qplc_unpack_56u64u
+ *          - @ref qplc_unpack_57u64u
+ *          - @ref qplc_unpack_58u64u
+ *          - @ref qplc_unpack_59u64u
+ *          - @ref qplc_unpack_60u64u
+ *          - @ref qplc_unpack_61u64u
+ *          - @ref qplc_unpack_62u64u
+ *          - @ref qplc_unpack_63u64u
+ *          - @ref qplc_unpack_64u64u
+ *
+ */
+
+#include "own_qplc_defs.h"
+#include "qplc_unpack.h"
+
+#if PLATFORM >= K0
+
+#include "opt/qplc_unpack_64u_k0.h"
+
+#endif
+
+OWN_QPLC_INLINE(void, qplc_unpack_Nu64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint32_t bit_width,
+        uint8_t *dst_ptr)) {
+    uint64_t mask         = OWN_QWORD_BIT_MASK(bit_width);
+    uint64_t *dst64u_ptr  = (uint64_t *) dst_ptr;
+    uint64_t bit_position = start_bit;
+
+    // Every element but the last one is followed by another 33+ bits, so 9 bytes can be read for it
+    for (uint32_t idx = 1u; idx < num_elements; idx++) {
+        const uint8_t  *byte_ptr = src_ptr + (bit_position >> 3u);
+        const uint32_t shift     = (uint32_t) (bit_position & OWN_BYTE_BIT_MASK);
+        uint64_t       value     = (*(uint64_t *) byte_ptr) >> shift;
+
+        if (OWN_QWORD_WIDTH < shift + bit_width) {
+            value |= ((uint64_t) byte_ptr[sizeof(uint64_t)]) << (OWN_QWORD_WIDTH - shift);
+        }
+
+        *dst64u_ptr = value & mask;
+        dst64u_ptr++;
+        bit_position += bit_width;
+    }
+
+    if (0u < num_elements) {
+        const uint8_t  *byte_ptr = src_ptr + (bit_position >> 3u);
+        const uint32_t shift     = (uint32_t) (bit_position & OWN_BYTE_BIT_MASK);
+        const uint32_t bytes     = OWN_BITS_2_BYTE(shift + bit_width);
+        uint64_t       value     = 0u;
+
+        for (uint32_t i = 0u; i < QPL_MIN(bytes, (uint32_t) sizeof(uint64_t)); i++) {
+            value |= ((uint64_t) byte_ptr[i]) << (i * OWN_BYTE_WIDTH);
+        }
+
+        value >>= shift;
+
+        if (sizeof(uint64_t) < bytes) {
+            value |= ((uint64_t) byte_ptr[sizeof(uint64_t)]) << (OWN_QWORD_WIDTH - shift);
+        }
+
+        *dst64u_ptr = value & mask;
+    }
+}
+
+// ********************** 33u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_33u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 33u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 33u, dst_ptr);
+#endif
+}
+
+// ********************** 34u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_34u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 34u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 34u, dst_ptr);
+#endif
+}
+
+// ********************** 35u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_35u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 35u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 35u, dst_ptr);
+#endif
+}
+
+// ********************** 36u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_36u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 36u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 36u, dst_ptr);
+#endif
+}
+
+// ********************** 37u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_37u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 37u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 37u, dst_ptr);
+#endif
+}
+
+// ********************** 38u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_38u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 38u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 38u, dst_ptr);
+#endif
+}
+
+// ********************** 39u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_39u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 39u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 39u, dst_ptr);
+#endif
+}
+
+// ********************** 40u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_40u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 40u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 40u, dst_ptr);
+#endif
+}
+
+// ********************** 41u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_41u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 41u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 41u, dst_ptr);
+#endif
+}
+
+// ********************** 42u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_42u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 42u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 42u, dst_ptr);
+#endif
+}
+
+// ********************** 43u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_43u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 43u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 43u, dst_ptr);
+#endif
+}
+
+// ********************** 44u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_44u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 44u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 44u, dst_ptr);
+#endif
+}
+
+// ********************** 45u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_45u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 45u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 45u, dst_ptr);
+#endif
+}
+
+// ********************** 46u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_46u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 46u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 46u, dst_ptr);
+#endif
+}
+
+// ********************** 47u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_47u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 47u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 47u, dst_ptr);
+#endif
+}
+
+// ********************** 48u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_48u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 48u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 48u, dst_ptr);
+#endif
+}
+
+// ********************** 49u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_49u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 49u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 49u, dst_ptr);
+#endif
+}
+
+// ********************** 50u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_50u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 50u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 50u, dst_ptr);
+#endif
+}
+
+// ********************** 51u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_51u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 51u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 51u, dst_ptr);
+#endif
+}
+
+// ********************** 52u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_52u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 52u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 52u, dst_ptr);
+#endif
+}
+
+// ********************** 53u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_53u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 53u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 53u, dst_ptr);
+#endif
+}
+
+// ********************** 54u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_54u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 54u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 54u, dst_ptr);
+#endif
+}
+
+// ********************** 55u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_55u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 55u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 55u, dst_ptr);
+#endif
+}
+
+// ********************** 56u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_56u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 56u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 56u, dst_ptr);
+#endif
+}
+
+// ********************** 57u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_57u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 57u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 57u, dst_ptr);
+#endif
+}
+
+// ********************** 58u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_58u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 58u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 58u, dst_ptr);
+#endif
+}
+
+// ********************** 59u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_59u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 59u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 59u, dst_ptr);
+#endif
+}
+
+// ********************** 60u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_60u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 60u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 60u, dst_ptr);
+#endif
+}
+
+// ********************** 61u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_61u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 61u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 61u, dst_ptr);
+#endif
+}
+
+// ********************** 62u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_62u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 62u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 62u, dst_ptr);
+#endif
+}
+
+// ********************** 63u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_63u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 63u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 63u, dst_ptr);
+#endif
+}
+
+// ********************** 64u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_64u64u, (const uint8_t *src_ptr,
+        uint32_t num_elements,
+        uint32_t start_bit,
+        uint8_t *dst_ptr)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_unpack_Nu64u)(src_ptr, num_elements, start_bit, 64u, dst_ptr);
+#else
+    qplc_unpack_Nu64u(src_ptr, num_elements, start_bit, 64u, dst_ptr);
+#endif
+}
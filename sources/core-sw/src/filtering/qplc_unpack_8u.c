@@ -28,6 +28,10 @@
 
 #include "opt/qplc_unpack_8u_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_unpack_8u_l9.h"
+
 #endif
 
 // ********************** 1u ****************************** //
@@ -38,6 +42,8 @@ OWN_QPLC_FUN(void, qplc_unpack_1u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_1u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu8u)(src_ptr, num_elements, start_bit, 1u, dst_ptr);
 #else
     uint64_t bit_mask = 0x0101010101010101LLU;
     uint32_t i;
@@ -132,6 +138,8 @@ OWN_QPLC_FUN(void, qplc_unpack_2u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_2u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu8u)(src_ptr, num_elements, start_bit, 2u, dst_ptr);
 #else
     uint64_t bit_mask = 0x0303030303030303LLU;
     uint32_t i;
@@ -244,6 +252,8 @@ OWN_QPLC_FUN(void, qplc_unpack_3u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_3u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu8u)(src_ptr, num_elements, start_bit, 3u, dst_ptr);
 #else
     uint64_t bit_mask0 = 0x0007000007000007LLU;
     uint64_t bit_mask1 = 0x0700000700000700LLU;
@@ -441,6 +451,8 @@ OWN_QPLC_FUN(void, qplc_unpack_4u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_4u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu8u)(src_ptr, num_elements, start_bit, 4u, dst_ptr);
 #else
     uint64_t bit_mask = 0x0f0f0f0f0f0f0f0fLLU;
     uint32_t i;
@@ -592,6 +604,8 @@ OWN_QPLC_FUN(void, qplc_unpack_5u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_5u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu8u)(src_ptr, num_elements, start_bit, 5u, dst_ptr);
 #else
     uint64_t bit_mask0 = 0x00001f000000001fLLU;
     uint64_t bit_mask1 = 0x000000001f000000LLU;
@@ -750,6 +764,8 @@ OWN_QPLC_FUN(void, qplc_unpack_6u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_6u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu8u)(src_ptr, num_elements, start_bit, 6u, dst_ptr);
 #else
     qplc_unpack_Nu8u(src_ptr, num_elements, start_bit, 6u, dst_ptr);
 #endif
@@ -761,6 +777,8 @@ OWN_QPLC_FUN(void, qplc_unpack_7u8u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_7u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_unpack_Nu8u)(src_ptr, num_elements, start_bit, 7u, dst_ptr);
 #else
     qplc_unpack_Nu8u(src_ptr, num_elements, start_bit, 7u, dst_ptr);
 #endif
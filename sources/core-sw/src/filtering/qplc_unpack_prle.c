@@ -19,6 +19,39 @@
 #include "qplc_api.h"
 #include "qplc_memop.h"
 
+#define OWN_PRLE_HEADER_MAX_LENGTH 5u                /**< Max number of varint bytes in the PRLE header */
+#define OWN_PRLE_HEADER_MASK       0xFFFFFFFFFFLLu   /**< Mask for the longest PRLE header */
+#define OWN_PRLE_HEADER_STOP_MASK  0x8080808080LLu   /**< Continuation bits of the longest PRLE header */
+#define OWN_PRLE_HEADER_BYTE_MASK  0x0101010101LLu   /**< Lowest bit of every byte of the longest PRLE header */
+
+/**
+ * @brief Decodes the PRLE header from a qword without a branch per varint byte
+ *
+ * @note The qword must be readable, the bytes past the header are ignored
+ */
+OWN_QPLC_INLINE(uint32_t, ownc_decode_prle_header_64u, (const uint8_t *src_ptr,
+        uint32_t *format_ptr,
+        uint32_t *count_ptr)) {
+    const uint64_t header    = *(const uint64_t *) src_ptr & OWN_PRLE_HEADER_MASK;
+    const uint64_t stop_bits = ~header & OWN_PRLE_HEADER_STOP_MASK;
+    const uint64_t last_bit  = stop_bits & (0u - stop_bits);
+    const uint64_t used_mask = (0u == last_bit) ? OWN_PRLE_HEADER_MASK : ((last_bit << 1u) - 1u);
+    const uint64_t used      = header & used_mask;
+
+    // Concatenation of 7-bit groups, the lowest bit is the format, the other ones are the count
+    const uint64_t value = (used & 0x7Fu)
+                           | ((used >> 1u) & 0x3F80u)
+                           | ((used >> 2u) & 0x1FC000u)
+                           | ((used >> 3u) & 0xFE00000u)
+                           | ((used >> 4u) & 0x7F0000000LLu);
+
+    *format_ptr = (uint32_t) (value & OWN_LOW_BIT_MASK);
+    *count_ptr  = (uint32_t) (value >> 1u);
+
+    // Horizontal sum of the used bytes
+    return (uint32_t) ((((used_mask & OWN_PRLE_HEADER_BYTE_MASK) * OWN_PRLE_HEADER_BYTE_MASK) >> 32u) & 0xFFu);
+}
+
 OWN_QPLC_INLINE(qplc_status_t, ownc_decode_prle_header, (uint8_t * *pp_src,
         const uint8_t *src_stop_ptr,
         uint32_t      *format_ptr,
@@ -26,6 +59,11 @@ OWN_QPLC_INLINE(qplc_status_t, ownc_decode_prle_header, (uint8_t * *pp_src,
     OWN_RETURN_ERROR((*pp_src >= src_stop_ptr), QPLC_STS_SRC_IS_SHORT_ERR);
     uint32_t value;
 
+    if ((uint32_t) (src_stop_ptr - *pp_src) >= sizeof(uint64_t)) {
+        *pp_src += ownc_decode_prle_header_64u(*pp_src, format_ptr, count_ptr);
+        return QPLC_STS_OK;
+    }
+
     value = (uint32_t) (*(*pp_src)++);
     *format_ptr = value & OWN_LOW_BIT_MASK;
     *count_ptr  = OWN_PRLE_COUNT(value);
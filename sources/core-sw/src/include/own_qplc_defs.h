@@ -88,6 +88,7 @@ extern "C" {
 #define OWN_7_BYTE_WIDTH  56u                         /**< 7-byte width in bits */
 #define OWN_QWORD_WIDTH   64u                         /**< Qword width in bits */
 #define OWN_BIT_MASK(x) ((QPL_ONE_64U << (x)) - 1u)   /**< Bit mask below bit position */
+#define OWN_QWORD_BIT_MASK(x) (UINT64_MAX >> (OWN_QWORD_WIDTH - (x))) /**< Bit mask below bit position 1..64 */
 #define OWN_PARQUET_WIDTH 8u                          /**< Parquet size in elements (PRLE format) */
 #define OWN_LITERAL_OCTA_GROUP 1u                     /**< PRLE format description */
 #define OWN_VARINT_BYTE_1(x) (((x) & OWN_7_BIT_MASK) << 6u)   /**< 1st byte extraction for varint format */
@@ -188,6 +189,14 @@ OWN_QPLC_INLINE(uint32_t, qplc_swap_bytes_32u, (uint32_t value)) {
     return out_value.bit_buf;
 }
 
+/**
+ * @brief Inline 64u function for LE<->BE format conversions
+ */
+OWN_QPLC_INLINE(uint64_t, qplc_swap_bytes_64u, (uint64_t value)) {
+    return (((uint64_t) qplc_swap_bytes_32u((uint32_t) value)) << OWN_DWORD_WIDTH)
+           | (uint64_t) qplc_swap_bytes_32u((uint32_t) (value >> OWN_DWORD_WIDTH));
+}
+
 /**
  * @brief Inline helper to convert pointer to integer
  */
@@ -200,7 +209,7 @@ OWN_QPLC_INLINE(uint64_t, OWN_QPLC_UINT_PTR, (const void *ptr)) {
     return dd.cardinal;
 }
 
-#define OWN_QPLC_PACK_BE_INDEX_SHIFT 35u
+#define OWN_QPLC_PACK_BE_INDEX_SHIFT 67u
 
 /**
  * @brief Helper for calculating input bit width from pack index.
@@ -214,6 +223,8 @@ OWN_QPLC_INLINE(uint32_t, own_get_bit_width_from_index, (uint32_t pack_index)) {
     uint32_t bit_width = pack_index + 1u;
     bit_width = (33u == bit_width) ? OWN_WORD_WIDTH : bit_width;
     bit_width = (33u < bit_width) ? OWN_DWORD_WIDTH : bit_width;
+    // 33..64-bit outputs follow the 8u16u, 8u32u and 16u32u entries
+    bit_width = (35u <= pack_index) ? pack_index - 2u : bit_width;
     return bit_width;
 }
 
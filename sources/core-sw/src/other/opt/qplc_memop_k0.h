@@ -12,6 +12,9 @@
   *
   * @details Function list:
   *          - @ref k0_qplc_zero_8u
+  *          - @ref k0_qplc_set_8u
+  *          - @ref k0_qplc_set_16u
+  *          - @ref k0_qplc_set_32u
   *          - @ref k0_qplc_copy_8u
   */
 
@@ -111,6 +114,45 @@ OWN_OPT_FUN(void, k0_qplc_zero_8u, (uint8_t* dst_ptr, uint32_t length))
     k0_qplc_zero_8u_tail(dst_ptr, remaining_bytes);
 }
 
+// ********************** Set ****************************** //
+
+OWN_QPLC_INLINE(void, own_k0_set_8u, (__m512i value_mm, uint8_t *dst_ptr, uint32_t length)) {
+    uint32_t length_512u = length / sizeof(__m512i);
+
+    while (length_512u > 3u) {
+        _mm512_storeu_si512(dst_ptr, value_mm);
+        _mm512_storeu_si512(dst_ptr + 64u, value_mm);
+        _mm512_storeu_si512(dst_ptr + 128u, value_mm);
+        _mm512_storeu_si512(dst_ptr + 192u, value_mm);
+        dst_ptr += 256u;
+        length_512u -= 4u;
+    }
+
+    while (length_512u > 0u) {
+        _mm512_storeu_si512(dst_ptr, value_mm);
+        dst_ptr += 64u;
+        --length_512u;
+    }
+
+    uint32_t remaining_bytes = length % sizeof(__m512i);
+
+    if (remaining_bytes) {
+        _mm512_mask_storeu_epi8(dst_ptr, (__mmask64) OWN_BIT_MASK(remaining_bytes), value_mm);
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_set_8u, (uint8_t value, uint8_t *dst_ptr, uint32_t length)) {
+    own_k0_set_8u(_mm512_set1_epi8((char) value), dst_ptr, length);
+}
+
+OWN_OPT_FUN(void, k0_qplc_set_16u, (uint16_t value, uint16_t *dst_ptr, uint32_t length)) {
+    own_k0_set_8u(_mm512_set1_epi16((short) value), (uint8_t *) dst_ptr, length * sizeof(uint16_t));
+}
+
+OWN_OPT_FUN(void, k0_qplc_set_32u, (uint32_t value, uint32_t *dst_ptr, uint32_t length)) {
+    own_k0_set_8u(_mm512_set1_epi32((int) value), (uint8_t *) dst_ptr, length * sizeof(uint32_t));
+}
+
 OWN_QPLC_INLINE(void, own_copy_8u_unrolled, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
     const uint64_t *src_64u_ptr = (uint64_t *)src_ptr;
     uint64_t *dst_64u_ptr = (uint64_t *)dst_ptr;
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of functions for Intel® Query Processing Library (Intel® QPL)
+  * memory group functions
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_zero_8u
+  *          - @ref l9_qplc_set_8u
+  *          - @ref l9_qplc_set_16u
+  *          - @ref l9_qplc_set_32u
+  *          - @ref l9_qplc_copy_8u
+  */
+
+#ifndef OWN_MEMOP_L9_H
+#define OWN_MEMOP_L9_H
+
+#include "own_qplc_defs.h"
+#include "qplc_memop.h"
+#include "immintrin.h"
+
+OWN_QPLC_INLINE(void, own_l9_copy_8u_tail, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
+    const uint64_t *src_64u_ptr = (const uint64_t *)src_ptr;
+    uint64_t *dst_64u_ptr = (uint64_t *)dst_ptr;
+
+    uint32_t length_64u = length / sizeof(uint64_t);
+    uint32_t tail_start = length_64u * sizeof(uint64_t);
+
+    for (uint32_t i = 0u; i < length_64u; ++i) {
+        dst_64u_ptr[i] = src_64u_ptr[i];
+    }
+
+    for (uint32_t i = tail_start; i < length; ++i) {
+        dst_ptr[i] = src_ptr[i];
+    }
+}
+
+// ********************** Zero ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_zero_8u, (uint8_t* dst_ptr, uint32_t length))
+{
+    __m256i  zeromm      = _mm256_setzero_si256();
+    uint32_t length_256u = length / sizeof(__m256i);
+
+    while (length_256u > 3u) {
+        _mm256_storeu_si256((__m256i *)dst_ptr, zeromm);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 32u), zeromm);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 64u), zeromm);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 96u), zeromm);
+        dst_ptr += 128u;
+        length_256u -= 4u;
+    }
+
+    while (length_256u > 0u) {
+        _mm256_storeu_si256((__m256i *)dst_ptr, zeromm);
+        dst_ptr += 32u;
+        --length_256u;
+    }
+
+    uint32_t remaining_bytes = length % sizeof(__m256i);
+
+    if (remaining_bytes >= 16u) {
+        _mm_storeu_si128((__m128i *)dst_ptr, _mm_setzero_si128());
+        dst_ptr += 16u;
+        remaining_bytes -= 16u;
+    }
+
+    for (uint32_t i = 0u; i < remaining_bytes; i++) {
+        dst_ptr[i] = 0u;
+    }
+}
+
+// ********************** Set ****************************** //
+
+OWN_QPLC_INLINE(void, own_l9_set_8u, (__m256i value_mm, uint8_t *dst_ptr, uint32_t length)) {
+    uint32_t length_256u = length / sizeof(__m256i);
+
+    while (length_256u > 3u) {
+        _mm256_storeu_si256((__m256i *)dst_ptr, value_mm);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 32u), value_mm);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 64u), value_mm);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 96u), value_mm);
+        dst_ptr += 128u;
+        length_256u -= 4u;
+    }
+
+    while (length_256u > 0u) {
+        _mm256_storeu_si256((__m256i *)dst_ptr, value_mm);
+        dst_ptr += 32u;
+        --length_256u;
+    }
+
+    uint32_t remaining_bytes = length % sizeof(__m256i);
+
+    if (remaining_bytes >= 16u) {
+        _mm_storeu_si128((__m128i *)dst_ptr, _mm256_castsi256_si128(value_mm));
+        dst_ptr += 16u;
+        remaining_bytes -= 16u;
+    }
+
+    // The pattern period divides 8 bytes and the tail starts at a multiple of 16 bytes
+    uint64_t pattern = (uint64_t) _mm256_extract_epi64(value_mm, 0);
+
+    if (remaining_bytes >= 8u) {
+        *(uint64_t *)dst_ptr = pattern;
+        dst_ptr += 8u;
+        remaining_bytes -= 8u;
+    }
+
+    for (uint32_t i = 0u; i < remaining_bytes; i++) {
+        dst_ptr[i] = (uint8_t) (pattern >> (i * 8u));
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_set_8u, (uint8_t value, uint8_t *dst_ptr, uint32_t length)) {
+    own_l9_set_8u(_mm256_set1_epi8((char) value), dst_ptr, length);
+}
+
+OWN_OPT_FUN(void, l9_qplc_set_16u, (uint16_t value, uint16_t *dst_ptr, uint32_t length)) {
+    own_l9_set_8u(_mm256_set1_epi16((short) value), (uint8_t *) dst_ptr, length * sizeof(uint16_t));
+}
+
+OWN_OPT_FUN(void, l9_qplc_set_32u, (uint32_t value, uint32_t *dst_ptr, uint32_t length)) {
+    own_l9_set_8u(_mm256_set1_epi32((int) value), (uint8_t *) dst_ptr, length * sizeof(uint32_t));
+}
+
+// ********************** Copy ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_copy_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
+    uint32_t length_256u = length / sizeof(__m256i);
+    uint32_t tail        = length % sizeof(__m256i);
+
+    while (length_256u > 3u) {
+        __m256i ymm0 = _mm256_loadu_si256((const __m256i *)src_ptr);
+        __m256i ymm1 = _mm256_loadu_si256((const __m256i *)(src_ptr + 32u));
+        __m256i ymm2 = _mm256_loadu_si256((const __m256i *)(src_ptr + 64u));
+        __m256i ymm3 = _mm256_loadu_si256((const __m256i *)(src_ptr + 96u));
+        _mm256_storeu_si256((__m256i *)dst_ptr, ymm0);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 32u), ymm1);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 64u), ymm2);
+        _mm256_storeu_si256((__m256i *)(dst_ptr + 96u), ymm3);
+        src_ptr += 128u;
+        dst_ptr += 128u;
+        length_256u -= 4u;
+    }
+
+    while (length_256u > 0u) {
+        _mm256_storeu_si256((__m256i *)dst_ptr, _mm256_loadu_si256((const __m256i *)src_ptr));
+        src_ptr += 32u;
+        dst_ptr += 32u;
+        --length_256u;
+    }
+
+    own_l9_copy_8u_tail(src_ptr, dst_ptr, tail);
+}
+
+#endif // OWN_MEMOP_L9_H
@@ -51,6 +51,15 @@ void inline aggregates_empty_callback(const uint8_t *UNREFERENCED_PARAMETER(src_
     // Don't do anything, this is just a stub
 }
 
+void inline aggregates_64u_empty_callback(const uint8_t *UNREFERENCED_PARAMETER(src_ptr),
+                                          uint32_t UNREFERENCED_PARAMETER(length),
+                                          uint64_t *UNREFERENCED_PARAMETER(min_value_ptr),
+                                          uint64_t *UNREFERENCED_PARAMETER(max_value_ptr),
+                                          uint64_t *UNREFERENCED_PARAMETER(sum_ptr),
+                                          uint32_t *UNREFERENCED_PARAMETER(index_ptr)) {
+    // Don't do anything, this is just a stub
+}
+
 } // namespace qpl::ml::analytics
 
 #endif // ANALYTIC_DEFS_HPP
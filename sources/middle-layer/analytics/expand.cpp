@@ -168,6 +168,10 @@ auto call_expand<execution_path_t::software>(input_stream_t &input_stream,
 
     input_stream.calculate_checksums();
 
+    if (status_list::ok == status_code) {
+        status_code = output_stream.finalize();
+    }
+
     analytic_operation_result_t operation_result{};
 
     // Store operations result
@@ -177,7 +181,8 @@ auto call_expand<execution_path_t::software>(input_stream_t &input_stream,
     operation_result.checksums_.xor_   = input_stream.xor_checksum();
     operation_result.output_bytes_     = output_stream.bytes_written();
 
-    operation_result.last_bit_offset_ = (1u == output_stream.bit_width())
+    operation_result.last_bit_offset_ = (1u == output_stream.bit_width()
+                                         && stream_format_t::prle_format != output_stream.stream_format())
                                         ? input_stream.elements_left() & max_bit_index
                                         : 0u;
 
@@ -223,6 +228,17 @@ auto call_expand<execution_path_t::auto_detect>(input_stream_t &input_stream,
                                                 limited_buffer_t &unpack_mask_buffer,
                                                 limited_buffer_t &output_buffer,
                                                 int32_t numa_id) noexcept -> analytic_operation_result_t {
+    // The accelerator handles elements up to 32 bits only and doesn't write the PRLE format
+    if (input_stream.bit_width() > limits::max_bit_width
+        || stream_format_t::prle_format == output_stream.stream_format()) {
+        return call_expand<execution_path_t::software>(input_stream,
+                                                       mask_stream,
+                                                       output_stream,
+                                                       unpack_source_buffer,
+                                                       unpack_mask_buffer,
+                                                       output_buffer);
+    }
+
     auto hw_result = call_expand<execution_path_t::hardware>(input_stream,
                                                              mask_stream,
                                                              output_stream,
@@ -13,11 +13,35 @@
 
 namespace qpl::ml::analytics {
 
-template <analytic_pipeline pipeline_t>
+static inline void update_aggregates(const core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                     const uint8_t *elements_ptr,
+                                     const uint32_t elements_count,
+                                     aggregates_t &aggregates) noexcept {
+    aggregates_callback(elements_ptr,
+                        elements_count,
+                        &aggregates.min_value_,
+                        &aggregates.max_value_,
+                        &aggregates.sum_,
+                        &aggregates.index_);
+}
+
+static inline void update_aggregates(const core_sw::dispatcher::aggregates_64u_function_ptr_t aggregates_callback,
+                                     const uint8_t *elements_ptr,
+                                     const uint32_t elements_count,
+                                     aggregates_t &aggregates) noexcept {
+    aggregates_callback(elements_ptr,
+                        elements_count,
+                        &aggregates.wide_min_value_,
+                        &aggregates.wide_max_value_,
+                        &aggregates.wide_sum_,
+                        &aggregates.index_);
+}
+
+template <analytic_pipeline pipeline_t, class aggregates_function_t>
 static inline auto extract(input_stream_t &input_stream,
                            limited_buffer_t &buffer,
                            output_stream_t<array_stream> &output_stream,
-                           const core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                           const aggregates_function_t aggregates_callback,
                            aggregates_t &aggregates,
                            const uint32_t param_low,
                            const uint32_t param_high) noexcept -> uint32_t {
@@ -48,12 +72,7 @@ static inline auto extract(input_stream_t &input_stream,
                                                param_high);
 
         if (0u != extracted_elements) {
-            aggregates_callback(buffer.data(),
-                                extracted_elements,
-                                &aggregates.min_value_,
-                                &aggregates.max_value_,
-                                &aggregates.sum_,
-                                &aggregates.index_);
+            update_aggregates(aggregates_callback, buffer.data(), extracted_elements, aggregates);
 
             auto status = output_stream.perform_pack(buffer.data(),
                                                      extracted_elements);
@@ -161,9 +180,33 @@ auto call_extract<execution_path_t::software>(input_stream_t &input_stream,
                                       &aggregates_empty_callback :
                                       aggregates_table[aggregates_index];
 
-    if ((input_bit_width == 8u || input_bit_width == 16u || input_bit_width == 32u) &&
-        input_stream.stream_format() == stream_format_t::le_format &&
-        !input_stream.is_compressed()) {
+    if (input_bit_width > int_bits_size) {
+        // Elements wider than 32 bits are always unpacked to qwords and aggregated modulo 2^64
+        auto wide_aggregates_table    = core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_64u_table();
+        auto wide_aggregates_callback = (input_stream.are_aggregates_disabled()) ?
+                                        &aggregates_64u_empty_callback :
+                                        wide_aggregates_table[0];
+
+        if (input_stream.is_compressed()) {
+            status_code = extract<analytic_pipeline::inflate>(input_stream,
+                                                              temporary_buffer,
+                                                              output_stream,
+                                                              wide_aggregates_callback,
+                                                              aggregates,
+                                                              param_low,
+                                                              param_high);
+        } else {
+            status_code = extract<analytic_pipeline::simple>(input_stream,
+                                                             temporary_buffer,
+                                                             output_stream,
+                                                             wide_aggregates_callback,
+                                                             aggregates,
+                                                             param_low,
+                                                             param_high);
+        }
+    } else if ((input_bit_width == 8u || input_bit_width == 16u || input_bit_width == 32u) &&
+               input_stream.stream_format() == stream_format_t::le_format &&
+               !input_stream.is_compressed()) {
         auto     extract_table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_extract_table();
         uint32_t extract_index  = core_sw::dispatcher::get_extract_index(input_bit_width);
         auto     extract_kernel = extract_table[extract_index];
@@ -216,9 +259,13 @@ auto call_extract<execution_path_t::software>(input_stream_t &input_stream,
         }
     }
 
+    if (status_list::ok == status_code) {
+        status_code = output_stream.finalize();
+    }
+
     input_stream.calculate_checksums();
 
-    if (1u == output_stream.bit_width()) {
+    if (1u == output_stream.bit_width() && stream_format_t::prle_format != output_stream.stream_format()) {
         operation_result.last_bit_offset_ = ((param_high - param_low + 1u) * input_bit_width & max_bit_index);
     } else {
         operation_result.last_bit_offset_ = 0u;
@@ -240,6 +287,16 @@ auto call_extract<execution_path_t::auto_detect>(input_stream_t &input_stream,
                                                  uint32_t param_high,
                                                  limited_buffer_t &temporary_buffer,
                                                  int32_t numa_id) noexcept -> analytic_operation_result_t {
+    // The accelerator handles elements up to 32 bits only and doesn't write the PRLE format
+    if (input_stream.bit_width() > limits::max_bit_width
+        || stream_format_t::prle_format == output_stream.stream_format()) {
+        return call_extract<execution_path_t::software>(input_stream,
+                                                        output_stream,
+                                                        param_low,
+                                                        param_high,
+                                                        temporary_buffer);
+    }
+
     auto hw_result = call_extract<execution_path_t::hardware>(input_stream,
                                                               output_stream,
                                                               param_low,
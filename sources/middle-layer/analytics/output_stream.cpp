@@ -41,12 +41,54 @@ auto output_stream_t<bit_stream>::perform_pack(const uint8_t *buffer_ptr,
     return status;
 }
 
+template <>
+auto output_stream_t<bit_stream>::perform_scan(core_sw::dispatcher::scan_nu1u_function_ptr scan_kernel,
+                                               const uint8_t *source_ptr,
+                                               const uint32_t elements_count,
+                                               const uint32_t source_bit_width,
+                                               const uint32_t param_low,
+                                               const uint32_t param_high,
+                                               aggregates_t &aggregates) noexcept -> uint32_t {
+    if (elements_count > capacity_) {
+        return static_cast<uint32_t>(status_list::destination_is_short_error);
+    }
+
+    // Kernel completes the last partially written byte, so it starts from that byte
+    uint8_t *destination_ptr = (0u != start_bit_) ? destination_current_ptr_ - 1u : destination_current_ptr_;
+
+    scan_kernel(source_ptr,
+                elements_count,
+                source_bit_width,
+                param_low,
+                param_high,
+                destination_ptr,
+                start_bit_,
+                &aggregates.min_value_,
+                &aggregates.max_value_,
+                &aggregates.sum_,
+                &aggregates.index_);
+
+    destination_current_ptr_ = destination_ptr + util::bit_to_byte(start_bit_ + elements_count);
+    start_bit_ = (start_bit_ + elements_count) & 7u;
+
+    elements_written_ += elements_count;
+    capacity_ -= elements_count;
+
+    return status_list::ok;
+}
+
 template <>
 uint32_t output_stream_t<array_stream>::perform_pack(const uint8_t *buffer_ptr,
                                                      const uint32_t elements_count,
                                                      const bool UNREFERENCED_PARAMETER(is_start_bit_used)) noexcept {
     uint32_t status = status_list::ok;
 
+    if (stream_format_t::prle_format == stream_format_) {
+        elements_written_ += elements_count;
+
+        return prle_encoder_.encode(buffer_ptr, elements_count, destination_current_ptr_, end());
+    }
+
     if (bit_width_format_ == output_bit_width_format_t::same_as_input ||
         input_buffer_bit_width_ > 1u) {
         if (elements_count > capacity_) {
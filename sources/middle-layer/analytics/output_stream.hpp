@@ -11,6 +11,7 @@
 #include <iterator>
 
 #include "analytics_defs.hpp"
+#include "prle_encoder.hpp"
 #include "common/buffer.hpp"
 #include "util/util.hpp"
 
@@ -35,6 +36,29 @@ public:
                       uint32_t elements_count,
                       bool is_start_bit_used = true) noexcept -> uint32_t;
 
+    /**
+     * @brief Completes the output, PRLE stream closes its current runs here
+     */
+    auto finalize() noexcept -> uint32_t {
+        if (stream_format_t::prle_format == stream_format_) {
+            return prle_encoder_.flush(destination_current_ptr_, end());
+        }
+
+        return status_list::ok;
+    }
+
+    auto perform_scan(core_sw::dispatcher::scan_nu1u_function_ptr scan_kernel,
+                      const uint8_t *source_ptr,
+                      uint32_t elements_count,
+                      uint32_t source_bit_width,
+                      uint32_t param_low,
+                      uint32_t param_high,
+                      aggregates_t &aggregates) noexcept -> uint32_t;
+
+    [[nodiscard]] inline auto is_le_bit_vector() const noexcept -> bool {
+        return (1u == actual_bit_width_) && (stream_format_t::le_format == stream_format_);
+    }
+
     [[nodiscard]] inline auto elements_written() -> uint32_t {
         return elements_written_;
     }
@@ -91,7 +115,9 @@ private:
     uint8_t                               actual_bit_width_         = 0u;
     uint8_t                               input_buffer_bit_width_   = 0u;
     uint32_t                              elements_written_         = 0u;
+    uint32_t                              run_threshold_            = 0u;
     size_t                                capacity_                 = 0u;
+    prle_encoder_t                        prle_encoder_;
 };
 
 template <output_stream_type_t stream_type>
@@ -152,6 +178,12 @@ public:
         return *this;
     }
 
+    inline auto run_threshold(uint32_t value) noexcept -> builder & {
+        stream_.run_threshold_ = value;
+
+        return *this;
+    }
+
     template <execution_path_t path>
     inline auto build() noexcept -> output_stream_t<stream_type> {
         stream_.destination_current_ptr_ = stream_.data();
@@ -168,6 +200,10 @@ public:
 
             stream_.pack_index_kernel = pack_table[pack_index];
 
+            if (stream_format_t::prle_format == stream_.stream_format_) {
+                stream_.prle_encoder_.init(stream_.actual_bit_width_, stream_.run_threshold_);
+            }
+
             if constexpr(stream_type == array_stream) {
                 if (output_bit_width_format_t::same_as_input == stream_.bit_width_format_
                     || stream_.input_buffer_bit_width_ > 1) {
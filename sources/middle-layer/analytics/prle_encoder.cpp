@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include "prle_encoder.hpp"
+#include "util/util.hpp"
+
+namespace qpl::ml::analytics {
+
+constexpr uint32_t prle_block_elements  = 1024u; /**< Elements unpacked at once by pack_parquet_rle */
+constexpr uint32_t prle_varint_bits     = 7u;
+constexpr uint8_t  prle_varint_continue = 0x80u;
+constexpr uint8_t  prle_literal_run     = 1u;    /**< Lowest bit of the run header for bit-packed runs */
+
+void prle_encoder_t::init(const uint32_t bit_width, const uint32_t run_threshold) noexcept {
+    auto &dispatcher = core_sw::dispatcher::kernels_dispatcher::get_instance();
+
+    const uint32_t kernel_index = core_sw::dispatcher::get_pack_prle_index(bit_width);
+
+    pack_kernel_             = dispatcher.get_pack_table()[core_sw::dispatcher::get_pack_bits_index(0u, bit_width, 0u)];
+    run_length_kernel_       = dispatcher.get_prle_run_length_table()[kernel_index];
+    find_equal_octet_kernel_ = dispatcher.get_prle_find_equal_octet_table()[kernel_index];
+
+    bit_width_     = bit_width;
+    element_size_  = 1u << kernel_index;
+    run_threshold_ = (0u == run_threshold) ? prle_octet_size : run_threshold;
+}
+
+auto prle_encoder_t::encode(const uint8_t *source_ptr,
+                            const uint32_t elements_count,
+                            uint8_t *&destination_ptr,
+                            const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status {
+    auto status = write_bit_width(destination_ptr, destination_end_ptr);
+
+    uint32_t index = 0u;
+
+    while (status_list::ok == status && index < elements_count) {
+        const uint8_t *current_ptr = source_ptr + index * element_size_;
+
+        if (is_run_active_) {
+            const uint32_t length = run_length_kernel_(current_ptr, elements_count - index, run_value_);
+
+            run_length_ += length;
+            index       += length;
+
+            // Otherwise the run may go on in the next chunk
+            if (index < elements_count) {
+                status = close_repeated_run(destination_ptr, destination_end_ptr);
+            }
+        } else if (0u == pending_count_ && prle_octet_size <= elements_count - index) {
+            // Groups before the first group of equal elements are bit-packed at once
+            const uint32_t octets_count = (elements_count - index) / prle_octet_size;
+            const uint32_t equal_octet  = find_equal_octet_kernel_(current_ptr, octets_count);
+
+            status = write_literal_octets(current_ptr, equal_octet, destination_ptr, destination_end_ptr);
+            index += equal_octet * prle_octet_size;
+
+            if (equal_octet < octets_count) {
+                is_run_active_ = true;
+                run_value_     = get_element(source_ptr, index);
+                run_length_    = 0u;
+            }
+        } else {
+            // Elements are collected one by one until the current group is completed
+            status = append_pending(get_element(source_ptr, index), destination_ptr, destination_end_ptr);
+            index++;
+        }
+    }
+
+    return status;
+}
+
+auto prle_encoder_t::flush(uint8_t *&destination_ptr, const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status {
+    auto status = write_bit_width(destination_ptr, destination_end_ptr);
+
+    if (status_list::ok == status && is_run_active_) {
+        status = close_repeated_run(destination_ptr, destination_end_ptr);
+    }
+
+    if (status_list::ok == status && 0u != pending_count_) {
+        for (uint32_t i = pending_count_; i < prle_octet_size; i++) {
+            set_element(pending_.data(), i, 0u);
+        }
+
+        pending_count_ = 0u;
+        status         = write_literal_octets(pending_.data(), 1u, destination_ptr, destination_end_ptr);
+    }
+
+    close_literal_run();
+
+    return status;
+}
+
+auto prle_encoder_t::get_element(const uint8_t *source_ptr, const uint32_t index) const noexcept -> uint32_t {
+    switch (element_size_) {
+        case 1u: {
+            return source_ptr[index];
+        }
+        case 2u: {
+            return reinterpret_cast<const uint16_t *>(source_ptr)[index];
+        }
+        default: {
+            return reinterpret_cast<const uint32_t *>(source_ptr)[index];
+        }
+    }
+}
+
+void prle_encoder_t::set_element(uint8_t *destination_ptr, const uint32_t index, const uint32_t value) const noexcept {
+    switch (element_size_) {
+        case 1u: {
+            destination_ptr[index] = static_cast<uint8_t>(value);
+            break;
+        }
+        case 2u: {
+            reinterpret_cast<uint16_t *>(destination_ptr)[index] = static_cast<uint16_t>(value);
+            break;
+        }
+        default: {
+            reinterpret_cast<uint32_t *>(destination_ptr)[index] = value;
+        }
+    }
+}
+
+auto prle_encoder_t::write_bit_width(uint8_t *&destination_ptr,
+                                     const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status {
+    if (is_bit_width_written_) {
+        return status_list::ok;
+    }
+
+    if (destination_ptr >= destination_end_ptr) {
+        return status_list::destination_is_short_error;
+    }
+
+    *destination_ptr++    = static_cast<uint8_t>(bit_width_);
+    is_bit_width_written_ = true;
+
+    return status_list::ok;
+}
+
+auto prle_encoder_t::write_literal_octets(const uint8_t *source_ptr,
+                                          uint32_t octets_count,
+                                          uint8_t *&destination_ptr,
+                                          const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status {
+    while (0u != octets_count) {
+        if (nullptr == literal_header_ptr_) {
+            if (destination_ptr >= destination_end_ptr) {
+                return status_list::destination_is_short_error;
+            }
+
+            literal_header_ptr_ = destination_ptr++;
+            literal_octets_     = 0u;
+        }
+
+        // Every group of 8 elements takes exactly bit width bytes
+        const uint32_t octets = std::min(octets_count, prle_max_octets - literal_octets_);
+        const uint32_t bytes  = octets * bit_width_;
+
+        if (static_cast<uint32_t>(destination_end_ptr - destination_ptr) < bytes) {
+            return status_list::destination_is_short_error;
+        }
+
+        pack_kernel_(source_ptr, octets * prle_octet_size, destination_ptr, 0u);
+
+        source_ptr      += octets * prle_octet_size * element_size_;
+        destination_ptr += bytes;
+        literal_octets_ += octets;
+        octets_count    -= octets;
+
+        if (prle_max_octets == literal_octets_) {
+            close_literal_run();
+        }
+    }
+
+    return status_list::ok;
+}
+
+void prle_encoder_t::close_literal_run() noexcept {
+    if (nullptr != literal_header_ptr_) {
+        *literal_header_ptr_ = static_cast<uint8_t>((literal_octets_ << 1u) | prle_literal_run);
+        literal_header_ptr_  = nullptr;
+        literal_octets_      = 0u;
+    }
+}
+
+auto prle_encoder_t::close_repeated_run(uint8_t *&destination_ptr,
+                                        const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status {
+    is_run_active_ = false;
+
+    if (run_length_ < run_threshold_) {
+        // Short runs are bit-packed, no group is pending when a run starts, so the group is filled with the value
+        for (uint32_t i = 0u; i < prle_octet_size; i++) {
+            set_element(pending_.data(), i, run_value_);
+        }
+
+        for (uint32_t i = 0u; i < run_length_ / prle_octet_size; i++) {
+            auto status = write_literal_octets(pending_.data(), 1u, destination_ptr, destination_end_ptr);
+
+            if (status_list::ok != status) {
+                return status;
+            }
+        }
+
+        pending_count_ = run_length_ % prle_octet_size;
+
+        return status_list::ok;
+    }
+
+    close_literal_run();
+
+    const uint32_t value_bytes  = util::bit_to_byte(bit_width_);
+    uint64_t       header       = static_cast<uint64_t>(run_length_) << 1u;
+    uint32_t       header_bytes = 1u;
+
+    for (uint64_t rest = header >> prle_varint_bits; 0u != rest; rest >>= prle_varint_bits) {
+        header_bytes++;
+    }
+
+    if (static_cast<uint32_t>(destination_end_ptr - destination_ptr) < header_bytes + value_bytes) {
+        return status_list::destination_is_short_error;
+    }
+
+    for (; header >> prle_varint_bits; header >>= prle_varint_bits) {
+        *destination_ptr++ = static_cast<uint8_t>(header) | prle_varint_continue;
+    }
+
+    *destination_ptr++ = static_cast<uint8_t>(header);
+
+    for (uint32_t i = 0u; i < value_bytes; i++) {
+        *destination_ptr++ = static_cast<uint8_t>(run_value_ >> (i * byte_bits_size));
+    }
+
+    return status_list::ok;
+}
+
+auto prle_encoder_t::append_pending(const uint32_t value,
+                                    uint8_t *&destination_ptr,
+                                    const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status {
+    set_element(pending_.data(), pending_count_++, value);
+
+    if (prle_octet_size == pending_count_) {
+        pending_count_ = 0u;
+
+        return write_literal_octets(pending_.data(), 1u, destination_ptr, destination_end_ptr);
+    }
+
+    return status_list::ok;
+}
+
+auto pack_parquet_rle(const uint8_t *source_ptr,
+                      const uint32_t bit_width,
+                      const uint32_t number_of_elements,
+                      const uint32_t run_threshold,
+                      uint8_t *destination_ptr,
+                      const uint32_t destination_size,
+                      uint32_t &bytes_written) noexcept -> qpl_ml_status {
+    auto &dispatcher   = core_sw::dispatcher::kernels_dispatcher::get_instance();
+    auto unpack_kernel = dispatcher.get_unpack_table()[core_sw::dispatcher::get_unpack_index(0u, bit_width)];
+
+    std::array<uint32_t, prle_block_elements> block{};
+    prle_encoder_t encoder;
+
+    uint8_t       *current_ptr         = destination_ptr;
+    const uint8_t *destination_end_ptr = destination_ptr + destination_size;
+    auto          status               = status_list::ok;
+
+    encoder.init(bit_width, run_threshold);
+
+    // Blocks are multiples of 8 elements, so each of them starts from a byte boundary of the source
+    for (uint32_t offset = 0u; status_list::ok == status && offset < number_of_elements; offset += prle_block_elements) {
+        const uint32_t elements_count = std::min(prle_block_elements, number_of_elements - offset);
+        auto           *block_ptr    = reinterpret_cast<uint8_t *>(block.data());
+
+        unpack_kernel(source_ptr + (offset / byte_bits_size) * bit_width, elements_count, 0u, block_ptr);
+
+        status = encoder.encode(block_ptr, elements_count, current_ptr, destination_end_ptr);
+    }
+
+    if (status_list::ok == status) {
+        status = encoder.flush(current_ptr, destination_end_ptr);
+    }
+
+    bytes_written = static_cast<uint32_t>(current_ptr - destination_ptr);
+
+    return status;
+}
+
+}
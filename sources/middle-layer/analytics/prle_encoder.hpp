@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef PRLE_ENCODER_HPP
+#define PRLE_ENCODER_HPP
+
+#include <array>
+#include <cstdint>
+
+#include "common/defs.hpp"
+
+// core-sw
+#include "dispatcher.hpp"
+
+namespace qpl::ml::analytics {
+
+constexpr uint32_t prle_octet_size       = 8u;  /**< Number of elements in a bit-packed group */
+constexpr uint32_t prle_max_octets       = 63u; /**< Maximal number of groups in a bit-packed run with 1-byte header */
+constexpr uint32_t prle_max_element_size = 4u;  /**< Unpacked elements are 8u, 16u or 32u */
+
+/**
+ * @brief Encodes unpacked elements to the Parquet RLE/bit-packed hybrid format (PRLE)
+ *
+ * @details The stream starts with the bit width byte, as the qpl_p_parquet_rle parser expects. Elements are
+ *          bit-packed by groups of 8 until a group of equal elements is met, then the run of that value is
+ *          extended as far as it goes. Runs that are shorter than the threshold are bit-packed back. A bit-packed
+ *          run reserves its 1-byte header when it starts, the header is written when the run is closed.
+ *          The state is kept between calls, so runs and groups continue over the chunks of elements.
+ */
+class prle_encoder_t final {
+public:
+    prle_encoder_t() noexcept = default;
+
+    void init(uint32_t bit_width, uint32_t run_threshold) noexcept;
+
+    auto encode(const uint8_t *source_ptr,
+                uint32_t elements_count,
+                uint8_t *&destination_ptr,
+                const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status;
+
+    /**
+     * @brief Closes the current runs, the last incomplete group is padded with zero elements
+     */
+    auto flush(uint8_t *&destination_ptr, const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status;
+
+private:
+    [[nodiscard]] auto get_element(const uint8_t *source_ptr, uint32_t index) const noexcept -> uint32_t;
+
+    void set_element(uint8_t *destination_ptr, uint32_t index, uint32_t value) const noexcept;
+
+    auto write_bit_width(uint8_t *&destination_ptr, const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status;
+
+    auto write_literal_octets(const uint8_t *source_ptr,
+                              uint32_t octets_count,
+                              uint8_t *&destination_ptr,
+                              const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status;
+
+    void close_literal_run() noexcept;
+
+    auto close_repeated_run(uint8_t *&destination_ptr, const uint8_t *destination_end_ptr) noexcept -> qpl_ml_status;
+
+    auto append_pending(uint32_t value, uint8_t *&destination_ptr, const uint8_t *destination_end_ptr) noexcept
+    -> qpl_ml_status;
+
+    core_sw::dispatcher::pack_table_t::value_type                  pack_kernel_             = nullptr;
+    core_sw::dispatcher::prle_run_length_table_t::value_type       run_length_kernel_       = nullptr;
+    core_sw::dispatcher::prle_find_equal_octet_table_t::value_type find_equal_octet_kernel_ = nullptr;
+
+    std::array<uint8_t, prle_octet_size * prle_max_element_size> pending_{};
+
+    uint8_t  *literal_header_ptr_  = nullptr;
+    uint32_t literal_octets_       = 0u;
+    uint32_t pending_count_        = 0u;
+    uint32_t run_value_            = 0u;
+    uint32_t run_length_           = 0u;
+    uint32_t run_threshold_        = prle_octet_size;
+    uint32_t bit_width_            = 0u;
+    uint32_t element_size_         = 0u;
+    bool     is_run_active_        = false;
+    bool     is_bit_width_written_ = false;
+};
+
+/**
+ * @brief Encodes a little-endian packed column of 1..32-bit elements to the PRLE format
+ */
+auto pack_parquet_rle(const uint8_t *source_ptr,
+                      uint32_t bit_width,
+                      uint32_t number_of_elements,
+                      uint32_t run_threshold,
+                      uint8_t *destination_ptr,
+                      uint32_t destination_size,
+                      uint32_t &bytes_written) noexcept -> qpl_ml_status;
+
+}
+
+#endif // PRLE_ENCODER_HPP
@@ -39,6 +39,11 @@ static inline auto correct_input_param(const uint32_t source_bit_width,
     return (input_param & (std::numeric_limits<uint32_t>::max() >> (limits::max_bit_width - source_bit_width)));
 }
 
+static inline auto correct_input_param(const uint32_t source_bit_width,
+                                       const uint64_t input_param) noexcept -> uint64_t {
+    return (input_param & (std::numeric_limits<uint64_t>::max() >> (limits::max_sw_bit_width - source_bit_width)));
+}
+
 template <analytic_pipeline pipeline_t, comparator_t comparator>
 static inline auto scan(input_stream_t &input_stream,
                         limited_buffer_t &buffer,
@@ -85,6 +90,49 @@ static inline auto scan(input_stream_t &input_stream,
     return status_list::ok;
 }
 
+template <analytic_pipeline pipeline_t>
+static inline auto scan(input_stream_t &input_stream,
+                        limited_buffer_t &buffer,
+                        output_stream_t<bit_stream> &output_stream,
+                        core_sw::dispatcher::scan_64u_i_function_ptr scan_kernel,
+                        core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                        aggregates_t &aggregates,
+                        uint64_t param_low,
+                        uint64_t param_high) noexcept -> uint32_t {
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    while (!input_stream.is_processed()) {
+        auto unpack_result = input_stream.unpack<pipeline_t>(buffer);
+
+        if (status_list::ok != unpack_result.status) {
+            return unpack_result.status;
+        }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        scan_kernel(buffer.data(), elements_to_process, param_low, param_high);
+
+        aggregates_callback(buffer.data(),
+                            elements_to_process,
+                            &aggregates.min_value_,
+                            &aggregates.max_value_,
+                            &aggregates.sum_,
+                            &aggregates.index_);
+
+        auto status = output_stream.perform_pack(buffer.data(),
+                                                 elements_to_process);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+    }
+
+    return status_list::ok;
+}
+
 template <analytic_pipeline = analytic_pipeline::simple>
 static inline auto scan(input_stream_t &input_stream,
                         limited_buffer_t &buffer,
@@ -127,11 +175,46 @@ static inline auto scan(input_stream_t &input_stream,
     return status_list::ok;
 }
 
+template <analytic_pipeline = analytic_pipeline::simple>
+static inline auto scan(input_stream_t &input_stream,
+                        limited_buffer_t &buffer,
+                        output_stream_t<bit_stream> &output_stream,
+                        core_sw::dispatcher::scan_nu1u_function_ptr scan_kernel,
+                        aggregates_t &aggregates,
+                        uint32_t param_low,
+                        uint32_t param_high) noexcept -> uint32_t {
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    // Packed source goes directly to the output bit vector, no unpacked elements are stored in between
+    auto elements_to_process = input_stream.elements_left();
+    auto status              = output_stream.perform_scan(scan_kernel,
+                                                          input_stream.current_ptr(),
+                                                          elements_to_process,
+                                                          input_stream.bit_width(),
+                                                          param_low,
+                                                          param_high,
+                                                          aggregates);
+
+    if (status_list::ok != status) {
+        return status;
+    }
+
+    uint32_t length_in_bytes = util::bit_to_byte(elements_to_process * input_stream.bit_width());
+
+    input_stream.shift_current_ptr(length_in_bytes);
+    input_stream.add_elements_processed(elements_to_process);
+
+    return status_list::ok;
+}
+
 template <comparator_t comparator>
 static inline auto call_scan_sw(input_stream_t &input_stream,
                                 output_stream_t<bit_stream> &output_stream,
-                                const uint32_t param_low,
-                                const uint32_t param_high,
+                                const uint64_t param_low,
+                                const uint64_t param_high,
                                 limited_buffer_t &temporary_buffer) noexcept -> analytic_operation_result_t {
     auto input_bit_width    = input_stream.bit_width();
     auto output_bit_width   = output_stream.bit_width();
@@ -142,8 +225,8 @@ static inline auto call_scan_sw(input_stream_t &input_stream,
 
     uint32_t status_code = status_list::ok;
 
-    auto corrected_param_low  = correct_input_param(input_bit_width, param_low);
-    auto corrected_param_high = correct_input_param(input_bit_width, param_high);
+    auto corrected_param_low  = correct_input_param(input_bit_width, static_cast<uint32_t>(param_low));
+    auto corrected_param_high = correct_input_param(input_bit_width, static_cast<uint32_t>(param_high));
 
     auto aggregates_table    = core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
     auto aggregates_index    = core_sw::dispatcher::get_aggregates_index(1u);
@@ -151,9 +234,49 @@ static inline auto call_scan_sw(input_stream_t &input_stream,
                                 &aggregates_empty_callback :
                                 aggregates_table[aggregates_index];
 
-    if ((input_bit_width == 8 || input_bit_width == 16 || input_bit_width == 32) &&
-        input_stream.stream_format() == stream_format_t::le_format &&
-        !input_stream.is_compressed()) {
+    if (input_bit_width > int_bits_size) {
+        // Elements wider than 32 bits are always unpacked to qwords and scanned with 64-bit parameters
+        auto scan_table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_64u_i_table();
+        auto scan_kernel = scan_table[static_cast<uint32_t>(comparator)];
+
+        if (input_stream.is_compressed()) {
+            status_code = scan<analytic_pipeline::inflate>(input_stream,
+                                                           temporary_buffer,
+                                                           output_stream,
+                                                           scan_kernel,
+                                                           aggregates_callback,
+                                                           aggregates,
+                                                           correct_input_param(input_bit_width, param_low),
+                                                           correct_input_param(input_bit_width, param_high));
+        } else {
+            status_code = scan<analytic_pipeline::simple>(input_stream,
+                                                          temporary_buffer,
+                                                          output_stream,
+                                                          scan_kernel,
+                                                          aggregates_callback,
+                                                          aggregates,
+                                                          correct_input_param(input_bit_width, param_low),
+                                                          correct_input_param(input_bit_width, param_high));
+        }
+    } else if (input_stream.stream_format() == stream_format_t::le_format &&
+               !input_stream.is_compressed() &&
+               output_stream.is_le_bit_vector()) {
+        aggregates_t unused_aggregates{};
+
+        auto scan_table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_nu1u_table();
+        auto scan_kernel = scan_table[static_cast<uint32_t>(comparator)];
+
+        status_code = scan<analytic_pipeline::simple>(input_stream,
+                                                      temporary_buffer,
+                                                      output_stream,
+                                                      scan_kernel,
+                                                      (input_stream.are_aggregates_disabled()) ? unused_aggregates
+                                                                                               : aggregates,
+                                                      corrected_param_low,
+                                                      corrected_param_high);
+    } else if ((input_bit_width == 8 || input_bit_width == 16 || input_bit_width == 32) &&
+               input_stream.stream_format() == stream_format_t::le_format &&
+               !input_stream.is_compressed()) {
 
         auto scan_table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_table();
         auto scan_index  = core_sw::dispatcher::get_scan_index(input_bit_width, (uint32_t) comparator);
@@ -346,25 +469,30 @@ auto call_scan_multidescriptor(input_stream_t &input_stream,
 template <comparator_t comparator, execution_path_t path>
 auto call_scan(input_stream_t &input_stream,
                output_stream_t<bit_stream> &output_stream,
-               const uint32_t param_low,
-               const uint32_t param_high,
+               const uint64_t param_low,
+               const uint64_t param_high,
                limited_buffer_t &temporary_buffer,
                int32_t UNREFERENCED_PARAMETER(numa_id) = -1) noexcept -> analytic_operation_result_t {
     if constexpr (path == execution_path_t::auto_detect) {
+        // The accelerator handles elements up to 32 bits only
+        if (input_stream.bit_width() > limits::max_bit_width) {
+            return call_scan_sw<comparator>(input_stream, output_stream, param_low, param_high, temporary_buffer);
+        }
+
         analytic_operation_result_t hw_result{};
 
         if (is_operation_splittable(input_stream, output_stream)) {
             hw_result = call_scan_multidescriptor<comparator>(input_stream,
                                                               output_stream,
-                                                              param_low,
-                                                              param_high,
+                                                              static_cast<uint32_t>(param_low),
+                                                              static_cast<uint32_t>(param_high),
                                                               temporary_buffer,
                                                               numa_id);
         } else {
             hw_result = call_scan_hw<comparator>(input_stream,
                                                   output_stream,
-                                                  param_low,
-                                                  param_high,
+                                                  static_cast<uint32_t>(param_low),
+                                                  static_cast<uint32_t>(param_high),
                                                   temporary_buffer,
                                                   numa_id);
         }
@@ -378,15 +506,15 @@ auto call_scan(input_stream_t &input_stream,
         if (is_operation_splittable(input_stream, output_stream)) {
             return call_scan_multidescriptor<comparator>(input_stream,
                                                          output_stream,
-                                                         param_low,
-                                                         param_high,
+                                                         static_cast<uint32_t>(param_low),
+                                                         static_cast<uint32_t>(param_high),
                                                          temporary_buffer,
                                                          numa_id);
         } else {
             return call_scan_hw<comparator>(input_stream,
                                             output_stream,
-                                            param_low,
-                                            param_high,
+                                            static_cast<uint32_t>(param_low),
+                                            static_cast<uint32_t>(param_high),
                                             temporary_buffer,
                                             numa_id);
         }
@@ -0,0 +1,275 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <array>
+
+#include "scan_predicate.hpp"
+#include "simple_memory_ops.hpp"
+
+namespace qpl::ml::analytics {
+
+constexpr uint32_t predicate_block_words    = 128u;
+constexpr uint32_t predicate_word_bits      = 64u;
+constexpr uint32_t predicate_block_elements = predicate_block_words * predicate_word_bits;
+
+using predicate_block_t = std::array<uint64_t, predicate_block_words>;
+
+static inline auto count_set_bits(uint64_t word) noexcept -> uint32_t {
+    word = word - ((word >> 1u) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2u) & 0x3333333333333333ULL);
+    word = (word + (word >> 4u)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return static_cast<uint32_t>((word * 0x0101010101010101ULL) >> 56u);
+}
+
+static inline auto first_set_bit(uint64_t word) noexcept -> uint32_t {
+    uint32_t idx = 0u;
+
+    for (; 0u == (word & 1u); word >>= 1u) {
+        idx++;
+    }
+
+    return idx;
+}
+
+static inline auto last_set_bit(uint64_t word) noexcept -> uint32_t {
+    uint32_t idx = predicate_word_bits - 1u;
+
+    for (; 0u == (word >> idx); idx--) {
+    }
+
+    return idx;
+}
+
+/**
+ * @brief Checks that all bits of the first length bits of the block are equal to the given one
+ */
+static inline auto is_block_filled(const predicate_block_t &block, uint32_t length, bool value) noexcept -> bool {
+    const uint64_t fill       = value ? std::numeric_limits<uint64_t>::max() : 0u;
+    const uint32_t full_words = length / predicate_word_bits;
+    uint64_t       difference = 0u;
+
+    for (uint32_t word = 0u; word < full_words; word++) {
+        difference |= block[word] ^ fill;
+    }
+
+    if (0u != length % predicate_word_bits) {
+        difference |= (block[full_words] ^ fill) & util::build_mask<uint64_t>(length % predicate_word_bits);
+    }
+
+    return 0u == difference;
+}
+
+auto validate_predicate(const predicate_column_t *columns_ptr,
+                        uint32_t columns_count,
+                        const predicate_instruction_t *program_ptr,
+                        uint32_t program_length,
+                        uint32_t number_of_elements) noexcept -> qpl_ml_status {
+    if (0u == number_of_elements || 0u == columns_count) {
+        return status_list::size_error;
+    }
+
+    if (0u == program_length || program_length > predicate_max_instructions) {
+        return status_list::status_invalid_params;
+    }
+
+    for (uint32_t column = 0u; column < columns_count; column++) {
+        const auto &column_info = columns_ptr[column];
+
+        if (nullptr == column_info.data_ptr) {
+            return status_list::nullptr_error;
+        }
+
+        if (column_info.bit_width < limits::min_bit_width || column_info.bit_width > limits::max_bit_width) {
+            return status_list::bit_width_error;
+        }
+
+        const uint64_t column_bits = static_cast<uint64_t>(number_of_elements) * column_info.bit_width;
+
+        if (column_info.size < (column_bits + max_bit_index) / byte_bits_size) {
+            return status_list::source_is_short_error;
+        }
+    }
+
+    // The program is a postfix expression, so the stack depth is known before the evaluation
+    uint32_t depth = 0u;
+
+    for (uint32_t idx = 0u; idx < program_length; idx++) {
+        const auto &instruction = program_ptr[idx];
+
+        switch (instruction.opcode) {
+            case predicate_opcode_t::scan:
+                if (instruction.column_index >= columns_count
+                    || static_cast<uint32_t>(instruction.comparator) > static_cast<uint32_t>(out_of_range)) {
+                    return status_list::status_invalid_params;
+                }
+
+                if (++depth > predicate_max_depth) {
+                    return status_list::status_invalid_params;
+                }
+                break;
+            case predicate_opcode_t::conjunction:
+            case predicate_opcode_t::disjunction:
+                if (depth < 2u) {
+                    return status_list::status_invalid_params;
+                }
+
+                depth--;
+                break;
+            case predicate_opcode_t::negation:
+                if (depth < 1u) {
+                    return status_list::status_invalid_params;
+                }
+                break;
+            default:
+                return status_list::status_invalid_params;
+        }
+    }
+
+    return (1u == depth) ? status_list::ok : status_list::status_invalid_params;
+}
+
+auto scan_predicate(const predicate_column_t *columns_ptr,
+                    const predicate_instruction_t *program_ptr,
+                    uint32_t program_length,
+                    uint32_t number_of_elements,
+                    uint8_t *destination_ptr,
+                    aggregates_t &aggregates) noexcept -> uint32_t {
+    const auto &scan_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_nu1u_table();
+
+    std::array<predicate_block_t, predicate_max_depth> stack;
+
+    // Conjunction or disjunction that takes the subexpression starting at the instruction as its right operand.
+    // The subexpression is skipped for the block if the left operand already defines the result.
+    std::array<uint32_t, predicate_max_instructions> right_operand_owner;
+    std::array<uint32_t, predicate_max_depth>        operand_begin;
+    uint32_t                                          operands_count = 0u;
+
+    right_operand_owner.fill(program_length);
+
+    for (uint32_t idx = 0u; idx < program_length; idx++) {
+        switch (program_ptr[idx].opcode) {
+            case predicate_opcode_t::scan:
+                operand_begin[operands_count++] = idx;
+                break;
+            case predicate_opcode_t::conjunction:
+            case predicate_opcode_t::disjunction:
+                right_operand_owner[operand_begin[--operands_count]] = idx;
+                break;
+            case predicate_opcode_t::negation:
+                break;
+        }
+    }
+
+    for (uint32_t block_begin = 0u; block_begin < number_of_elements; block_begin += predicate_block_elements) {
+        const uint32_t block_length = std::min(predicate_block_elements, number_of_elements - block_begin);
+        const uint32_t block_words  = (block_length + predicate_word_bits - 1u) / predicate_word_bits;
+        uint32_t       depth        = 0u;
+
+        for (uint32_t idx = 0u; idx < program_length; idx++) {
+            const auto &instruction = program_ptr[idx];
+            const auto owner        = right_operand_owner[idx];
+
+            if (owner != program_length) {
+                const bool is_conjunction = (predicate_opcode_t::conjunction == program_ptr[owner].opcode);
+
+                // False AND x and true OR x are known without x, the left operand stays on the top as the result
+                if (is_block_filled(stack[depth - 1u], block_length, !is_conjunction)) {
+                    idx = owner;
+                    continue;
+                }
+            }
+
+            switch (instruction.opcode) {
+                case predicate_opcode_t::scan: {
+                    const auto &column      = columns_ptr[instruction.column_index];
+                    auto       &result      = stack[depth++];
+                    uint32_t   unused_index = 0u;
+                    aggregates_t unused_aggregates{};
+
+                    // The kernel stores the exact number of bytes for the last word
+                    result[block_words - 1u] = 0u;
+
+                    // Block begins at a multiple of 64 elements, so the column offset is always byte aligned
+                    scan_table[static_cast<uint32_t>(instruction.comparator)](
+                            column.data_ptr + static_cast<size_t>(block_begin / byte_bits_size) * column.bit_width,
+                            block_length,
+                            column.bit_width,
+                            correct_input_param(column.bit_width, instruction.param_low),
+                            correct_input_param(column.bit_width, instruction.param_high),
+                            reinterpret_cast<uint8_t *>(result.data()),
+                            0u,
+                            &unused_aggregates.min_value_,
+                            &unused_aggregates.max_value_,
+                            &unused_aggregates.sum_,
+                            &unused_index);
+                    break;
+                }
+                case predicate_opcode_t::conjunction: {
+                    const auto &right = stack[--depth];
+                    auto       &left  = stack[depth - 1u];
+
+                    for (uint32_t word = 0u; word < block_words; word++) {
+                        left[word] &= right[word];
+                    }
+                    break;
+                }
+                case predicate_opcode_t::disjunction: {
+                    const auto &right = stack[--depth];
+                    auto       &left  = stack[depth - 1u];
+
+                    for (uint32_t word = 0u; word < block_words; word++) {
+                        left[word] |= right[word];
+                    }
+                    break;
+                }
+                case predicate_opcode_t::negation: {
+                    auto &top = stack[depth - 1u];
+
+                    for (uint32_t word = 0u; word < block_words; word++) {
+                        top[word] = ~top[word];
+                    }
+                    break;
+                }
+            }
+        }
+
+        auto &result = stack[0];
+
+        // Negation sets the bits past the last element too
+        if (0u != block_length % predicate_word_bits) {
+            result[block_words - 1u] &= util::build_mask<uint64_t>(block_length % predicate_word_bits);
+        }
+
+        uint32_t last_word = block_words;
+
+        for (uint32_t word = 0u; word < block_words; word++) {
+            if (0u != result[word]) {
+                if (std::numeric_limits<uint32_t>::max() == aggregates.min_value_) {
+                    aggregates.min_value_ = block_begin + word * predicate_word_bits + first_set_bit(result[word]);
+                }
+
+                aggregates.sum_ += count_set_bits(result[word]);
+                last_word = word;
+            }
+        }
+
+        if (last_word != block_words) {
+            aggregates.max_value_ = block_begin + last_word * predicate_word_bits + last_set_bit(result[last_word]);
+        }
+
+        const auto block_bytes = static_cast<uint32_t>(util::bit_to_byte(block_length));
+        auto       result_ptr  = reinterpret_cast<const uint8_t *>(result.data());
+
+        core_sw::util::copy(result_ptr, result_ptr + block_bytes, destination_ptr + block_begin / byte_bits_size);
+    }
+
+    aggregates.index_ = number_of_elements;
+
+    return static_cast<uint32_t>(util::bit_to_byte(number_of_elements));
+}
+
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef SCAN_PREDICATE_OPERATION_HPP
+#define SCAN_PREDICATE_OPERATION_HPP
+
+#include "scan.hpp"
+
+namespace qpl::ml::analytics {
+
+enum class predicate_opcode_t : uint32_t {
+    scan        = 0, /**< Pushes the scan result of a column */
+    conjunction = 1, /**< Pops two bit vectors, pushes their AND */
+    disjunction = 2, /**< Pops two bit vectors, pushes their OR */
+    negation    = 3  /**< Inverts the bit vector on top */
+};
+
+struct predicate_instruction_t {
+    predicate_opcode_t opcode;
+    comparator_t       comparator;
+    uint32_t           column_index;
+    uint32_t           param_low;
+    uint32_t           param_high;
+};
+
+struct predicate_column_t {
+    const uint8_t *data_ptr;  /**< Little-endian packed array */
+    uint32_t      size;       /**< Column size in bytes */
+    uint32_t      bit_width;  /**< Element bit width, 1..32 */
+};
+
+constexpr uint32_t predicate_max_depth        = 8u;  /**< Maximal number of bit vectors on the evaluation stack */
+constexpr uint32_t predicate_max_instructions = 32u; /**< Maximal length of the predicate program */
+
+/**
+ * @brief Checks the columns and that the postfix program leaves exactly one bit vector on the stack
+ */
+auto validate_predicate(const predicate_column_t *columns_ptr,
+                        uint32_t columns_count,
+                        const predicate_instruction_t *program_ptr,
+                        uint32_t program_length,
+                        uint32_t number_of_elements) noexcept -> qpl_ml_status;
+
+/**
+ * @brief Evaluates the program over all columns and writes the resulting nominal bit vector
+ *
+ * @details Elements are processed by blocks that fit into the L1 cache together with the whole evaluation stack.
+ *          Every column is scanned by the fused packed-input kernel right into the stack, so each column
+ *          is read exactly once and intermediate bit vectors never go to memory.
+ *
+ * @return number of bytes written to destination_ptr
+ */
+auto scan_predicate(const predicate_column_t *columns_ptr,
+                    const predicate_instruction_t *program_ptr,
+                    uint32_t program_length,
+                    uint32_t number_of_elements,
+                    uint8_t *destination_ptr,
+                    aggregates_t &aggregates) noexcept -> uint32_t;
+
+}
+
+#endif // SCAN_PREDICATE_OPERATION_HPP
@@ -13,6 +13,84 @@
 
 namespace qpl::ml::analytics {
 
+template <analytic_pipeline pipeline_t>
+static inline auto select_by_bit_mask(input_stream_t &input_stream,
+                                      input_stream_t &mask_stream,
+                                      output_stream_t<array_stream> &output_stream,
+                                      limited_buffer_t &unpack_buffer,
+                                      limited_buffer_t &output_buffer,
+                                      core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                      aggregates_t &aggregates) noexcept -> uint32_t {
+    auto        table       = core_sw::dispatcher::kernels_dispatcher::get_instance().get_select_bit_mask_table();
+    const auto  index       = core_sw::dispatcher::get_select_index(input_stream.bit_width());
+    const auto  select_impl = table[index];
+
+    // The mask is consumed by bits, so its position is kept as a byte pointer and a bit offset in it
+    uint8_t  *mask_ptr      = mask_stream.current_ptr();
+    uint32_t mask_start_bit = 0u;
+
+    // Byte-aligned little-endian elements are selected right from the source, without the copy to unpack_buffer
+    const bool is_source_unpacked = (analytic_pipeline::simple == pipeline_t)
+                                    && (stream_format_t::le_format == input_stream.stream_format())
+                                    && (byte_bits_size == input_stream.bit_width()
+                                        || short_bits_size == input_stream.bit_width()
+                                        || int_bits_size == input_stream.bit_width()
+                                        || long_bits_size == input_stream.bit_width());
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(unpack_buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    // Main action
+    while (!input_stream.is_processed()) {
+        uint8_t  *source_ptr     = unpack_buffer.data();
+        uint32_t source_elements = 0u;
+
+        if (is_source_unpacked) {
+            source_elements = std::min(unpack_buffer.max_elements_count(), input_stream.elements_left());
+            source_ptr      = input_stream.current_ptr();
+
+            input_stream.add_elements_processed(source_elements);
+            input_stream.shift_current_ptr(source_elements * (input_stream.bit_width() / byte_bits_size));
+        } else {
+            auto unpack_result = input_stream.unpack<pipeline_t>(unpack_buffer);
+
+            if (status_list::ok != unpack_result.status) {
+                return unpack_result.status;
+            }
+
+            source_elements = unpack_result.unpacked_elements;
+        }
+
+        const auto elements_to_process = std::min(source_elements, mask_stream.elements_left());
+        const auto processed_elements  = select_impl(source_ptr,
+                                                     mask_ptr,
+                                                     mask_start_bit,
+                                                     output_buffer.data(),
+                                                     elements_to_process);
+
+        mask_ptr       += (mask_start_bit + elements_to_process) / byte_bits_size;
+        mask_start_bit  = (mask_start_bit + elements_to_process) % byte_bits_size;
+        mask_stream.add_elements_processed(elements_to_process);
+
+        if (processed_elements != 0) {
+            auto pack_status = output_stream.perform_pack(output_buffer.data(), processed_elements);
+            if (status_list::ok != pack_status) {
+                return pack_status;
+            }
+            aggregates_callback(output_buffer.data(),
+                                processed_elements,
+                                &aggregates.min_value_,
+                                &aggregates.max_value_,
+                                &aggregates.sum_,
+                                &aggregates.index_);
+        }
+    }
+
+    return status_list::ok;
+}
+
 template <analytic_pipeline pipeline_t>
 static inline auto select(input_stream_t &input_stream,
                           input_stream_t &mask_stream,
@@ -22,6 +100,17 @@ static inline auto select(input_stream_t &input_stream,
                           limited_buffer_t &output_buffer,
                           core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
                           aggregates_t &aggregates) noexcept -> uint32_t {
+    // Little-endian bit vector mask is read by the kernel directly, without unpacking to a byte per element
+    if (mask_stream.stream_format() == stream_format_t::le_format) {
+        return select_by_bit_mask<pipeline_t>(input_stream,
+                                              mask_stream,
+                                              output_stream,
+                                              unpack_buffer,
+                                              output_buffer,
+                                              aggregates_callback,
+                                              aggregates);
+    }
+
     auto        table       = core_sw::dispatcher::kernels_dispatcher::get_instance().get_select_table();
     const auto  index       = core_sw::dispatcher::get_select_index(input_stream.bit_width());
     const auto  select_impl = table[index];
@@ -67,7 +156,7 @@ static inline auto select(input_stream_t &input_stream,
                                                      elements_to_process);
 
         mask_ptr += elements_to_process;
-        source_ptr += util::bit_to_byte(elements_to_process * input_stream.bit_width());
+        source_ptr += util::bit_to_byte(elements_to_process * util::bit_width_to_bits(input_stream.bit_width()));
 
         mask_elements -= elements_to_process;
         source_elements -= elements_to_process;
@@ -151,6 +240,10 @@ auto call_select<execution_path_t::software>(input_stream_t &input_stream,
     }
     input_stream.calculate_checksums();
 
+    if (status_list::ok == status_code) {
+        status_code = output_stream.finalize();
+    }
+
     analytic_operation_result_t operation_result{};
 
     // Store operations result
@@ -160,7 +253,8 @@ auto call_select<execution_path_t::software>(input_stream_t &input_stream,
     operation_result.checksums_.xor_   = input_stream.xor_checksum();
     operation_result.output_bytes_     = output_stream.bytes_written();
 
-    operation_result.last_bit_offset_ = (1u == output_stream.bit_width())
+    operation_result.last_bit_offset_ = (1u == output_stream.bit_width()
+                                         && stream_format_t::prle_format != output_stream.stream_format())
                                         ? input_stream.elements_left() & max_bit_index
                                         : 0u;
 
@@ -206,6 +300,17 @@ auto call_select<execution_path_t::auto_detect>(input_stream_t &input_stream,
                                                 limited_buffer_t &set_buffer,
                                                 limited_buffer_t &output_buffer,
                                                 int32_t numa_id) noexcept -> analytic_operation_result_t {
+    // The accelerator handles elements up to 32 bits only and doesn't write the PRLE format
+    if (input_stream.bit_width() > limits::max_bit_width
+        || stream_format_t::prle_format == output_stream.stream_format()) {
+        return call_select<execution_path_t::software>(input_stream,
+                                                       mask_stream,
+                                                       output_stream,
+                                                       unpack_buffer,
+                                                       set_buffer,
+                                                       output_buffer);
+    }
+
     auto hw_result = call_select<execution_path_t::hardware>(input_stream,
                                                              mask_stream,
                                                              output_stream,
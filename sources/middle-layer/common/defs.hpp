@@ -61,6 +61,11 @@ struct aggregates_t {
     uint32_t max_value_ = 0;
     uint32_t sum_       = 0;
     uint32_t index_     = 0;
+
+    // Aggregates of the element values wider than 32 bits
+    uint64_t wide_min_value_ = std::numeric_limits<uint64_t>::max();
+    uint64_t wide_max_value_ = 0;
+    uint64_t wide_sum_       = 0;
 };
 
 enum class execution_path_t {
@@ -73,6 +78,7 @@ constexpr uint32_t bit_bits_size                = 1;
 constexpr uint32_t byte_bits_size               = 8;
 constexpr uint32_t short_bits_size              = 16;
 constexpr uint32_t int_bits_size                = 32;
+constexpr uint32_t long_bits_size               = 64;
 constexpr uint32_t bit_len_to_byte_shift_offset = 3;
 constexpr uint32_t max_bit_index                = 7;
 constexpr uint32_t qpl_1k                       = 1024;
@@ -80,7 +86,9 @@ constexpr uint32_t max_history_size             = 4 * qpl_1k;
 
 namespace limits {
 constexpr uint32_t max_bit_width    = int_bits_size;
+constexpr uint32_t max_sw_bit_width = long_bits_size;
 constexpr uint32_t min_bit_width    = bit_bits_size;
+constexpr uint32_t min_prle_run     = 8u; /**< Shorter runs of PRLE output are bit-packed */
 constexpr uint32_t max_set_size     = 15u;
 constexpr uint32_t set_buf_bit_size = (1u << max_set_size);
 constexpr uint32_t set_buf_size     = set_buf_bit_size / byte_bits_size;
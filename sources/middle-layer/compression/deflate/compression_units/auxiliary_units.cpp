@@ -92,6 +92,11 @@ auto init_compression(stream_t &stream, compression_state_t &state) noexcept ->
 
         if constexpr (std::is_same_v<deflate_state<execution_path_t::software>, stream_t>) {
             if (stream.mini_blocks_support() == mini_blocks_support_t::disabled) {
+                // Blocks written as stored ones may be smaller than the maximal stored block
+                const uint32_t min_block_size = stream.min_block_size();
+
+                stored_len += stored_block_header_length *
+                              ((stream.isal_stream_ptr_->avail_in + min_block_size - 1) / min_block_size);
                 stored_len = !stream.is_last_chunk() ? stored_len : stored_len + bit_buffer_slope_bytes * 2;
 
                 if (stream.isal_stream_ptr_->avail_out >= stored_len) {
@@ -252,6 +257,40 @@ template
 auto flush_bit_buffer<huffman_only_state<execution_path_t::software>>(huffman_only_state<execution_path_t::software> &stream,
                                                                       compression_state_t &state) noexcept -> qpl_ml_status;
 
+auto write_sync_flush(deflate_state<execution_path_t::software> &stream,
+                      compression_state_t &state) noexcept -> qpl_ml_status {
+    auto isal_state = &stream.isal_stream_ptr_->internal_state;
+    auto bit_buffer = &isal_state->bitbuf;
+
+    // The end of block and the empty stored block are written by two unchecked stores to the bit buffer
+    if (stream.isal_stream_ptr_->avail_out < 2u * bit_buffer_slope_bytes) {
+        return status_list::more_output_needed;
+    }
+
+    // Fixed and static blocks of a chunk that is not the last one stay open, dynamic blocks are already ended
+    if (stream.compression_mode() != dynamic_mode) {
+        auto status = write_end_of_block(stream, state);
+
+        if (status) {
+            return status;
+        }
+    }
+
+    stream.reset_bit_buffer();
+
+    // Empty non-final stored block: 3 header bits, padding to the byte boundary, LEN = 0x0000 and NLEN = 0xFFFF
+    const uint32_t flush_size    = (byte_bit_size - (bit_buffer->m_bit_count + 3u) % byte_bit_size) % byte_bit_size;
+    const uint64_t bits_to_write = static_cast<uint64_t>(0xFFFF0000u) << (flush_size + 3u);
+
+    write_bits(bit_buffer, bits_to_write, uint32_bit_size + flush_size + 3u);
+
+    stream.dump_bit_buffer();
+
+    state = compression_state_t::finish_compression_process;
+
+    return status_list::ok;
+}
+
 template <typename stream_t>
 auto flush_write_buffer(stream_t &stream, compression_state_t &state) noexcept -> qpl_ml_status {
     auto isal_state = &stream.isal_stream_ptr_->internal_state;
@@ -287,9 +326,11 @@ template
 auto flush_write_buffer<huffman_only_state<execution_path_t::software>>(huffman_only_state<execution_path_t::software> &stream,
                                                                         compression_state_t &state) noexcept -> qpl_ml_status;
 
-auto update_checksum(deflate_state<execution_path_t::software> &stream) noexcept -> qpl_ml_status {
-    stream.update_checksum(stream.source_begin_ptr_,
-                           static_cast<uint32_t>(stream.isal_stream_ptr_->next_in - stream.source_begin_ptr_));
+auto update_checksum(deflate_state<execution_path_t::software> &stream, uint8_t *&checksum_end_ptr) noexcept -> qpl_ml_status {
+    // The source before checksum_end_ptr is already in the checksum
+    stream.update_checksum(checksum_end_ptr,
+                           static_cast<uint32_t>(stream.isal_stream_ptr_->next_in - checksum_end_ptr));
+    checksum_end_ptr = stream.isal_stream_ptr_->next_in;
 
     return status_list::ok;
 }
@@ -301,7 +342,7 @@ auto finish_compression_process(deflate_state<execution_path_t::software> &strea
 }
 
 void update_hash(deflate_state<execution_path_t::software> &stream, uint8_t *dictionary_ptr, uint32_t dictionary_size) noexcept {
-    if (stream.compression_level() == high_level) {
+    if (stream.compression_level() != default_level) {
         qplc_setup_dictionary()(dictionary_ptr, dictionary_size, stream.hash_table());
     } else {
         isal_deflate_hash(stream.isal_stream_ptr_, dictionary_ptr, dictionary_size);
@@ -438,6 +479,7 @@ auto deflate_body_with_dictionary(deflate_state<execution_path_t::software> &str
             isal_state->b_bytes_processed += processed;
             buffered_size                 -= processed;
 
+            stream.isal_stream_ptr_->flush         = QPL_PARTIAL_FLUSH;
             stream.isal_stream_ptr_->end_of_stream = stream.is_last_chunk();
             stream.isal_stream_ptr_->total_in     += buffered_size;
 
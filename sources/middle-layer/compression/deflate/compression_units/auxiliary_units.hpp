@@ -22,12 +22,21 @@ auto finish_deflate_block(stream_t &stream, compression_state_t &state) noexcept
 template<typename stream_t>
 auto flush_bit_buffer(stream_t &stream, compression_state_t &state) noexcept -> qpl_ml_status;
 
+/**
+ * @brief Ends the open block and byte-aligns the output with an empty non-final stored block,
+ *        so the output of the next independently compressed chunk can be appended to it
+ */
+auto write_sync_flush(deflate_state<execution_path_t::software> &stream, compression_state_t &state) noexcept -> qpl_ml_status;
+
 template<typename stream_t>
 auto flush_write_buffer(stream_t &stream, compression_state_t &state) noexcept -> qpl_ml_status;
 
 auto skip_rest_units(deflate_state<execution_path_t::software> &stream, compression_state_t &state) noexcept -> qpl_ml_status;
 
-auto update_checksum(deflate_state<execution_path_t::software> &stream) noexcept -> qpl_ml_status;
+/**
+ * @brief Adds the source consumed since checksum_end_ptr to the checksum and moves the pointer to the input position
+ */
+auto update_checksum(deflate_state<execution_path_t::software> &stream, uint8_t *&checksum_end_ptr) noexcept -> qpl_ml_status;
 
 auto finish_compression_process(deflate_state<execution_path_t::software> &stream) noexcept -> qpl_ml_status;
 
@@ -185,6 +185,9 @@ auto deflate_body(deflate_state<execution_path_t::software> &stream, compression
 
     if (stream.isal_stream_ptr_->internal_state.state == ZSTATE_FLUSH_READ_BUFFER) {
         state = compression_state_t::compress_rest_data;
+    } else if (stream.isal_stream_ptr_->flush == NO_FLUSH) {
+        // The dictionary processing buffers the input, the body is continued with the rest of the input
+        return status_list::ok;
     } else {
         if (stream.is_first_chunk() &&
             stream.is_last_chunk() &&
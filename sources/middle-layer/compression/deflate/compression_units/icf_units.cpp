@@ -13,6 +13,7 @@
 #include "qplc_deflate_utils.h"
 
 #include "deflate_slow_icf.h"
+#include "deflate_optimal_icf.h"
 
 #include "igzip_lib.h"
 #include "bitbuf2.h"
@@ -26,6 +27,10 @@ static inline qplc_slow_deflate_icf_body_t_ptr qplc_slow_deflate_icf_body() {
     return (qplc_slow_deflate_icf_body_t_ptr)(qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_deflate_table()[0]);
 }
 
+static inline qplc_optimal_deflate_icf_body_t_ptr qplc_optimal_deflate_icf_body() {
+    return (qplc_optimal_deflate_icf_body_t_ptr)(qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_deflate_table()[3]);
+}
+
 namespace qpl::ml::compression {
 
 auto write_buffered_icf_header(deflate_state<execution_path_t::software> &stream, compression_state_t &state) noexcept -> qpl_ml_status {
@@ -227,7 +232,8 @@ auto init_new_icf_block(deflate_state<execution_path_t::software> &stream, compr
             reinterpret_cast<deflate_icf *>(stream.isal_stream_ptr_->level_buf + level_struct_size);
 
     level_buffer->icf_buf_next      = level_buffer->icf_buf_start;
-    level_buffer->icf_buf_avail_out = stream.isal_stream_ptr_->level_buf_size - level_struct_size - sizeof(deflate_icf);
+    level_buffer->icf_buf_avail_out = stream.isal_stream_ptr_->level_buf_size - level_struct_size - sizeof(deflate_icf)
+                                      - stream.history_buffer_size();
 
     core_sw::util::set_zeros(reinterpret_cast<uint8_t *>(&level_buffer->hist), sizeof(isal_mod_hist));
 
@@ -301,4 +307,38 @@ auto slow_deflate_icf_body(deflate_state<execution_path_t::software> &stream, co
     return status_list::ok;
 }
 
+auto optimal_deflate_icf_body(deflate_state<execution_path_t::software> &stream, compression_state_t &state) noexcept -> qpl_ml_status {
+    auto level_buffer = reinterpret_cast<level_buf *>(stream.isal_stream_ptr_->level_buf);
+
+    deflate_icf *icf_buffer_begin = level_buffer->icf_buf_next;
+    deflate_icf *icf_buffer_end   = icf_buffer_begin + (level_buffer->icf_buf_avail_out / sizeof(deflate_icf));
+
+    deflate_icf_stream icf_stream = {icf_buffer_begin, icf_buffer_begin, icf_buffer_end};
+
+    // The free part of the ICF buffer is used by the kernel as the parsing work area
+    uint32_t bytes_processed = qplc_optimal_deflate_icf_body()(stream.isal_stream_ptr_->next_in,
+                                                               stream.isal_stream_ptr_->next_in
+                                                               - stream.isal_stream_ptr_->total_in,
+                                                               stream.isal_stream_ptr_->next_in
+                                                               + stream.isal_stream_ptr_->avail_in,
+                                                               &stream.hash_table_,
+                                                               &level_buffer->hist,
+                                                               &icf_stream);
+
+    stream.isal_stream_ptr_->internal_state.block_end =
+            stream.isal_stream_ptr_->internal_state.block_end + bytes_processed;
+
+    stream.isal_stream_ptr_->next_in += bytes_processed;
+    stream.isal_stream_ptr_->avail_in -= bytes_processed;
+    stream.isal_stream_ptr_->total_in += bytes_processed;
+
+    level_buffer->icf_buf_next = icf_stream.next_ptr;
+    level_buffer->icf_buf_avail_out -= static_cast<uint32_t>(icf_stream.next_ptr -
+                                                             icf_stream.begin_ptr) * sizeof(deflate_icf);
+
+    state = compression_state_t::create_icf_header;
+
+    return status_list::ok;
+}
+
 } // namespace qpl::ml::compression
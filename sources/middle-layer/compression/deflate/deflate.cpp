@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <optional>
+
 #include "compression/verification/verification_state_builder.hpp"
 #include "compression/verification/verify.hpp"
 #include "deflate.hpp"
@@ -17,7 +19,15 @@
 
 namespace qpl::ml::compression {
 
-auto deflate_pass(deflate_state<execution_path_t::software> &stream, uint8_t *begin, uint32_t size) noexcept -> compression_operation_result_t {
+/**
+ * @brief Runs the compression pipeline, block_written() is called every time a dynamic block is complete
+ *        and its source is in the checksum, so the block can be verified while it is still in the cache
+ */
+template <class block_handler_t>
+auto deflate_pass(deflate_state<execution_path_t::software> &stream,
+                  uint8_t *begin,
+                  uint32_t size,
+                  block_handler_t &&block_written) noexcept -> compression_operation_result_t {
     compression_operation_result_t result;
 
     result.status_code_ = status_list::ok;
@@ -31,13 +41,26 @@ auto deflate_pass(deflate_state<execution_path_t::software> &stream, uint8_t *be
                                                                             stream.mini_blocks_support(),
                                                                             stream.dictionary_support());
 
+    // Mini blocks have own checksums, they are updated by the compression units
+    const bool is_checksum_updated = stream.mini_blocks_support() == mini_blocks_support_t::disabled;
+    uint8_t    *checksum_end_ptr   = begin;
+
+    // A written dynamic block is final, the static and fixed output can still be rewritten with stored blocks
+    const bool are_blocks_reported = is_checksum_updated && stream.compression_mode() == dynamic_mode;
+
     // Main pipeline
     do {
         result.status_code_ = implementation.execute(stream, state);
+
+        if (!result.status_code_ && state == compression_state_t::start_new_block && are_blocks_reported) {
+            update_checksum(stream, checksum_end_ptr);
+
+            result.status_code_ = block_written();
+        }
     } while (!result.status_code_ && state != compression_state_t::finish_compression_process);
 
-    if (!result.status_code_ && stream.mini_blocks_support() == mini_blocks_support_t::disabled) {
-        update_checksum(stream);
+    if (!result.status_code_ && is_checksum_updated) {
+        update_checksum(stream, checksum_end_ptr);
     }
 
     return result;
@@ -344,29 +367,45 @@ auto deflate<execution_path_t::software, deflate_mode_t::deflate_no_headers>(def
     state.compression_mode_ = canned_mode;
     auto output_begin_ptr   = state.next_out();
 
-    auto result = deflate_pass(state, begin, size);
+    std::optional<verify_state<execution_path_t::software>> verify_state;
 
-    if (state.is_verification_enabled_ && !result.status_code_) {
+    if (state.is_verification_enabled_) {
         auto builder = (state.is_first_chunk()) ?
                        compression::verification_state_builder<execution_path_t::software>::create(state.allocator_) :
                        compression::verification_state_builder<execution_path_t::software>::restore(state.allocator_);
 
-        auto verify_state = builder.build();
-
-        verify_state.input(output_begin_ptr, state.next_out())
-                    .required_crc(state.checksum_.crc32);
+        verify_state = builder.build();
+        verify_state->input(output_begin_ptr, output_begin_ptr);
 
         if (state.is_first_chunk() && state.compression_table_) {
-            verify_state.decompress_table(get_deflate_header_ptr(state.compression_table_),
-                                          get_deflate_header_bits_size(state.compression_table_));
+            verify_state->decompress_table(get_deflate_header_ptr(state.compression_table_),
+                                           get_deflate_header_bits_size(state.compression_table_));
+        }
+    }
+
+    // Verifies the output written since the previous call, the unread input of the verification is kept
+    auto verify_written_output = [&state, &verify_state]() noexcept -> qpl_ml_status {
+        if (!verify_state) {
+            return status_list::ok;
         }
 
+        auto *const inflate_state_ptr = verify_state->get_state();
+
+        verify_state->input(inflate_state_ptr->next_in, state.next_out())
+                     .required_crc(state.checksum_.crc32);
+
         auto verification_result = perform_verification<execution_path_t::software,
-                                                        verification_mode_t::verify_deflate_no_headers>(verify_state);
+                                                        verification_mode_t::verify_deflate_no_headers>(*verify_state);
 
-        if (verification_result.status == parser_status_t::error) {
-            result.status_code_ = qpl::ml::status_list::verify_error;
+        return (verification_result.status == parser_status_t::error) ? status_list::verify_error : status_list::ok;
+    };
 
+    auto result = deflate_pass(state, begin, size, verify_written_output);
+
+    if (!result.status_code_) {
+        result.status_code_ = verify_written_output();
+
+        if (result.status_code_) {
             return result;
         }
     }
@@ -389,28 +428,44 @@ auto deflate<execution_path_t::software, deflate_mode_t::deflate_default>(deflat
                                                                           const uint32_t size) noexcept -> compression_operation_result_t {
     auto output_begin_ptr = state.next_out();
 
-    compression_operation_result_t result = deflate_pass(state, begin, size);
-
-    if (!(state.is_first_chunk() && state.is_last_chunk())) {
-        state.save_bit_buffer();
-    }
+    std::optional<verify_state<execution_path_t::software>> verify_state;
 
-    if (state.is_verification_enabled_ && !result.status_code_) {
+    if (state.is_verification_enabled_) {
         auto builder = (state.is_first_chunk()) ?
                 compression::verification_state_builder<execution_path_t::software>::create(state.allocator_) :
                 compression::verification_state_builder<execution_path_t::software>::restore(state.allocator_);
 
-        auto verify_state = builder.build();
+        verify_state = builder.build();
+        verify_state->input(output_begin_ptr, output_begin_ptr);
+    }
+
+    // Verifies the output written since the previous call, the unread input of the verification is kept
+    auto verify_written_output = [&state, &verify_state]() noexcept -> qpl_ml_status {
+        if (!verify_state) {
+            return status_list::ok;
+        }
 
-        verify_state.input(output_begin_ptr, state.next_out())
-                    .required_crc(state.checksum_.crc32);
+        auto *const inflate_state_ptr = verify_state->get_state();
+
+        verify_state->input(inflate_state_ptr->next_in, state.next_out())
+                     .required_crc(state.checksum_.crc32);
 
         auto verification_result = perform_verification<execution_path_t::software,
-                                                        verification_mode_t::verify_deflate_default>(verify_state);
+                                                        verification_mode_t::verify_deflate_default>(*verify_state);
 
-        if (verification_result.status == parser_status_t::error) {
-            result.status_code_ = qpl::ml::status_list::verify_error;
+        return (verification_result.status == parser_status_t::error) ? status_list::verify_error : status_list::ok;
+    };
+
+    compression_operation_result_t result = deflate_pass(state, begin, size, verify_written_output);
 
+    if (!(state.is_first_chunk() && state.is_last_chunk())) {
+        state.save_bit_buffer();
+    }
+
+    if (!result.status_code_) {
+        result.status_code_ = verify_written_output();
+
+        if (result.status_code_) {
             return result;
         }
     }
@@ -427,4 +482,32 @@ auto deflate<execution_path_t::software, deflate_mode_t::deflate_default>(deflat
     return result;
 }
 
+template<>
+auto deflate<execution_path_t::software, deflate_mode_t::deflate_sync_flush>(deflate_state<execution_path_t::software> &state,
+                                                                             uint8_t *begin,
+                                                                             const uint32_t size) noexcept -> compression_operation_result_t {
+    auto output_end_ptr = state.next_out() + state.avail_out();
+
+    compression_operation_result_t result = deflate_pass(state, begin, size, []() noexcept { return status_list::ok; });
+
+    if (state.isal_stream_ptr_->internal_state.count) {
+        result.status_code_ = qpl::ml::status_list::more_output_needed;
+    }
+
+    if (!result.status_code_) {
+        // Dynamic mode limits the output by the size of stored blocks, the flush can use the rest of the buffer
+        state.isal_stream_ptr_->avail_out = static_cast<uint32_t>(output_end_ptr - state.next_out());
+
+        compression_state_t compression_state = compression_state_t::flush_bit_buffer;
+
+        result.status_code_ = write_sync_flush(state, compression_state);
+    }
+
+    result.completed_bytes_  = state.isal_stream_ptr_->total_in;
+    result.output_bytes_     = state.isal_stream_ptr_->total_out;
+    result.checksums_.crc32_ = state.checksum_.crc32;
+
+    return result;
+}
+
 } // namespace qpl::ml::compression
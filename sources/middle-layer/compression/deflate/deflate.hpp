@@ -25,6 +25,7 @@ namespace qpl::ml::compression {
 enum class deflate_mode_t {
     deflate_no_headers,
     deflate_default,
+    deflate_sync_flush, /**< Byte-aligned non-final blocks that can be concatenated with other chunks, software only */
 };
 
 template <execution_path_t path,
@@ -4,8 +4,15 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+
 #include "compression/deflate/histogram.hpp"
 #include "util/descriptor_processing.hpp"
+#include "util/thread_pool.hpp"
 #include "simple_memory_ops.hpp"
 
 #include "deflate_hash_table.h"
@@ -71,11 +78,18 @@ static inline void remove_empty_places_in_histogram(qpl_histogram &histogram) {
 
 }
 
+namespace details {
+template <execution_path_t path>
+auto gather_statistics(const uint8_t *begin,
+                       const uint8_t *end,
+                       deflate_histogram &histogram,
+                       deflate_level level) noexcept -> qpl_ml_status;
+
 template <>
-auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
-                                                  const uint8_t *end,
-                                                  deflate_histogram &histogram,
-                                                  deflate_level UNREFERENCED_PARAMETER(level)) noexcept -> qpl_ml_status {
+auto gather_statistics<execution_path_t::hardware>(const uint8_t *begin,
+                                                   const uint8_t *end,
+                                                   deflate_histogram &histogram,
+                                                   deflate_level UNREFERENCED_PARAMETER(level)) noexcept -> qpl_ml_status {
     hw_descriptor HW_PATH_ALIGN_STRUCTURE                         descriptor;
     HW_PATH_VOLATILE hw_completion_record HW_PATH_ALIGN_STRUCTURE completion_record;
     qpl_histogram                                                 hw_histogram;
@@ -95,11 +109,9 @@ auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
                                            util::execution_mode_t::sync>(&descriptor, &completion_record);
 
     if (status_list::ok == status) {
-        details::histogram_join_another(histogram, hw_histogram);
+        histogram_join_another(histogram, hw_histogram);
     }
 
-    details::remove_empty_places_in_histogram(histogram);
-
     return status;
 }
 
@@ -109,10 +121,10 @@ auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
 #endif
 
 template <>
-auto update_histogram<execution_path_t::software>(const uint8_t *begin,
-                                                  const uint8_t *end,
-                                                  deflate_histogram &histogram,
-                                                  deflate_level level) noexcept -> qpl_ml_status {
+auto gather_statistics<execution_path_t::software>(const uint8_t *begin,
+                                                   const uint8_t *end,
+                                                   deflate_histogram &histogram,
+                                                   deflate_level level) noexcept -> qpl_ml_status {
     using namespace qpl::ml;
 
     static const auto &histogram_reset = ((qplc_deflate_histogram_reset_ptr)
@@ -120,7 +132,7 @@ auto update_histogram<execution_path_t::software>(const uint8_t *begin,
 
     if (qpl_default_level == level) {
         isal_histogram isal_histogram_v = {{0u}, {0u}, {0u}};
-        details::isal_histogram_set_statistics(&isal_histogram_v,
+        isal_histogram_set_statistics(&isal_histogram_v,
                                                histogram.literal_lengths,
                                                histogram.distances);
 
@@ -130,7 +142,7 @@ auto update_histogram<execution_path_t::software>(const uint8_t *begin,
                               &isal_histogram_v);
 
         // Store result
-        details::isal_histogram_get_statistics(&isal_histogram_v,
+        isal_histogram_get_statistics(&isal_histogram_v,
                                                histogram.literal_lengths,
                                                histogram.distances);
     } else {
@@ -168,8 +180,6 @@ auto update_histogram<execution_path_t::software>(const uint8_t *begin,
                                          histogram.distances);
     }
 
-    details::remove_empty_places_in_histogram(histogram);
-
     return QPL_STS_OK;
 }
 
@@ -177,4 +187,135 @@ auto update_histogram<execution_path_t::software>(const uint8_t *begin,
 #pragma GCC diagnostic pop
 #endif
 
+/**
+ * @brief Chunks are picked evenly, the first one is always histogrammed
+ */
+static inline bool is_chunk_sampled(uint32_t chunk_index, uint32_t sample_percent) noexcept {
+    return (static_cast<uint64_t>(chunk_index) * sample_percent) % 100u < sample_percent;
+}
+
+}
+
+template <execution_path_t path, class iterator_t, class>
+auto update_histogram(iterator_t begin,
+                      iterator_t end,
+                      deflate_histogram &histogram,
+                      deflate_level level) noexcept -> qpl_ml_status {
+    auto status = details::gather_statistics<path>(begin, end, histogram, level);
+
+    details::remove_empty_places_in_histogram(histogram);
+
+    return status;
+}
+
+template <execution_path_t path>
+auto update_histogram_parallel(const uint8_t *begin,
+                               const uint8_t *end,
+                               deflate_histogram &histogram,
+                               deflate_level level,
+                               uint32_t threads_count,
+                               uint32_t sample_percent) noexcept -> qpl_ml_status {
+    const auto     source_size  = static_cast<uint32_t>(std::distance(begin, end));
+    const uint32_t chunks_count = std::max(1u, (source_size + statistics_chunk_size - 1u) / statistics_chunk_size);
+
+    if (0u == threads_count) {
+        threads_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    threads_count = std::min(threads_count, chunks_count);
+
+    // Single thread over the whole source gives the same statistics as the serial gathering
+    if (1u == threads_count && 100u == sample_percent) {
+        return update_histogram<path>(begin, end, histogram, level);
+    }
+
+    std::unique_ptr<deflate_histogram[]> thread_histograms_ptr(new (std::nothrow) deflate_histogram[threads_count]);
+
+    if (!thread_histograms_ptr) {
+        return status_list::internal_error;
+    }
+
+    std::atomic<uint32_t> next_chunk{0u};
+    std::atomic<uint32_t> first_error{status_list::ok};
+
+    // Every thread keeps raw counts, empty places are removed once the histograms are merged
+    auto worker = [&](deflate_histogram *thread_histogram_ptr) noexcept {
+        core_sw::util::set_zeros(thread_histogram_ptr, sizeof(deflate_histogram));
+
+        while (status_list::ok == first_error.load(std::memory_order_relaxed)) {
+            const uint32_t chunk_index = next_chunk.fetch_add(1u, std::memory_order_relaxed);
+
+            if (chunk_index >= chunks_count) {
+                break;
+            }
+
+            if (!details::is_chunk_sampled(chunk_index, sample_percent)) {
+                continue;
+            }
+
+            const uint8_t *const chunk_begin = begin + static_cast<size_t>(chunk_index) * statistics_chunk_size;
+            const uint8_t *const chunk_end   = chunk_begin + std::min(statistics_chunk_size,
+                                                                      static_cast<uint32_t>(std::distance(chunk_begin, end)));
+
+            auto status = details::gather_statistics<path>(chunk_begin, chunk_end, *thread_histogram_ptr, level);
+
+            if (status_list::ok != status) {
+                uint32_t expected = status_list::ok;
+
+                // The first error is reported
+                first_error.compare_exchange_strong(expected, status);
+
+                break;
+            }
+        }
+    };
+
+    // The calling thread takes the chunks too, every task has its own histogram
+    auto task = [&](uint32_t task_index) noexcept {
+        worker(thread_histograms_ptr.get() + task_index);
+    };
+
+    util::thread_pool::get_instance().run(threads_count, task);
+
+    const auto status = static_cast<qpl_ml_status>(first_error.load());
+
+    if (status_list::ok == status) {
+        for (uint32_t i = 0u; i < threads_count; i++) {
+            details::histogram_join_another(histogram, thread_histograms_ptr[i]);
+        }
+    }
+
+    details::remove_empty_places_in_histogram(histogram);
+
+    return status;
+}
+
+template
+auto update_histogram<execution_path_t::software>(const uint8_t *begin,
+                                                  const uint8_t *end,
+                                                  deflate_histogram &histogram,
+                                                  deflate_level level) noexcept -> qpl_ml_status;
+
+template
+auto update_histogram<execution_path_t::hardware>(const uint8_t *begin,
+                                                  const uint8_t *end,
+                                                  deflate_histogram &histogram,
+                                                  deflate_level level) noexcept -> qpl_ml_status;
+
+template
+auto update_histogram_parallel<execution_path_t::software>(const uint8_t *begin,
+                                                           const uint8_t *end,
+                                                           deflate_histogram &histogram,
+                                                           deflate_level level,
+                                                           uint32_t threads_count,
+                                                           uint32_t sample_percent) noexcept -> qpl_ml_status;
+
+template
+auto update_histogram_parallel<execution_path_t::hardware>(const uint8_t *begin,
+                                                           const uint8_t *end,
+                                                           deflate_histogram &histogram,
+                                                           deflate_level level,
+                                                           uint32_t threads_count,
+                                                           uint32_t sample_percent) noexcept -> qpl_ml_status;
+
 }
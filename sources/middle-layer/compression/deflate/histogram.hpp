@@ -16,6 +16,8 @@ namespace qpl::ml::compression {
 using deflate_histogram = qpl_histogram;
 using deflate_level = qpl_compression_levels;
 
+constexpr uint32_t statistics_chunk_size = QPL_STATISTICS_CHUNK_SIZE;
+
 template <execution_path_t path,
         class iterator_t,
         class = typename std::enable_if<path == execution_path_t::software ||
@@ -24,6 +26,23 @@ auto update_histogram(iterator_t begin,
                       iterator_t end,
                       deflate_histogram &histogram,
                       deflate_level level = qpl_default_level) noexcept -> qpl_ml_status;
+
+/**
+ * @brief Histograms every sampled chunk of the source on one of the threads and merges the partial histograms
+ *
+ * @details The threads are taken from @ref util::thread_pool, the calling thread is one of them, so the statistics
+ *          are gathered even if no other thread can be started.
+ *
+ * @param threads_count   number of threads, 0 means the number of hardware threads
+ * @param sample_percent  percent of the chunks that are histogrammed, 100 means the whole source
+ */
+template <execution_path_t path>
+auto update_histogram_parallel(const uint8_t *begin,
+                               const uint8_t *end,
+                               deflate_histogram &histogram,
+                               deflate_level level,
+                               uint32_t threads_count,
+                               uint32_t sample_percent) noexcept -> qpl_ml_status;
 }
 
 #endif //QPL_HISTOGRAM_HPP_
@@ -36,6 +36,13 @@ constexpr auto build_deflate_implementation(compression_level_t level,
     }
     
     if (mode == dynamic_mode) {
+        // Optimal parsing needs the whole ICF buffer of the block, so it isn't used for the mini-blocks
+        if constexpr (block_type == block_type_t::deflate_block) {
+            if (level == level_9) {
+                return deflate_implementation<level_9, dynamic_mode, block_type>::instance;
+            }
+        }
+
         return level == default_level
                ? deflate_implementation<default_level, dynamic_mode, block_type>::instance
                : deflate_implementation<high_level, dynamic_mode, block_type>::instance;
@@ -0,0 +1,401 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include "parallel_deflate.hpp"
+
+#include "compression/deflate/deflate.hpp"
+#include "compression/deflate/streams/deflate_state_builder.hpp"
+#include "compression/dictionary/dictionary_utils.hpp"
+#include "compression/inflate/inflate.hpp"
+#include "compression/inflate/inflate_state.hpp"
+#include "compression/stream_decorators/gzip_decorator.hpp"
+#include "compression/stream_decorators/zlib_decorator.hpp"
+
+#include "common/allocation_buffer_t.hpp"
+#include "common/linear_allocator.hpp"
+#include "util/checksum.hpp"
+#include "util/thread_pool.hpp"
+#include "simple_memory_ops.hpp"
+
+#include "igzip_checksums.h"
+
+namespace qpl::ml::compression {
+
+namespace {
+
+constexpr uint32_t own_chunk_not_ready = UINT32_MAX;
+
+/**
+ * Empty final block with the fixed Huffman codes, it contains only the end of block symbol
+ */
+constexpr uint8_t own_final_block[] = {0x03u, 0x00u};
+
+struct own_chunk_slot_t {
+    uint32_t      index        = own_chunk_not_ready; /**< Index of the chunk stored in the slot */
+    uint32_t      output_size  = 0u;
+    uint32_t      crc32        = 0u;
+    uint32_t      adler32      = 1u;
+    qpl_ml_status status       = status_list::ok;
+    uint8_t       *output_ptr  = nullptr;
+};
+
+inline auto own_get_stored_blocks_size(uint32_t source_size) noexcept -> uint32_t {
+    const uint32_t blocks_count = std::max(1u, (source_size + stored_block_max_length - 1u) / stored_block_max_length);
+
+    return source_size + blocks_count * stored_block_header_length;
+}
+
+/**
+ * @brief Writes the chunk as non-final stored blocks, the output starts at a byte boundary
+ */
+auto own_write_stored_blocks(const uint8_t *source_ptr, uint32_t source_size, uint8_t *destination_ptr) noexcept -> uint32_t {
+    auto *const destination_begin_ptr = destination_ptr;
+
+    do {
+        const auto block_size = static_cast<uint16_t>(std::min(source_size, stored_block_max_length));
+
+        destination_ptr[0] = 0u; // BFINAL = 0, BTYPE = 00
+        destination_ptr[1] = static_cast<uint8_t>(block_size);
+        destination_ptr[2] = static_cast<uint8_t>(block_size >> 8u);
+        destination_ptr[3] = static_cast<uint8_t>(~block_size);
+        destination_ptr[4] = static_cast<uint8_t>(~block_size >> 8u);
+        destination_ptr += stored_block_header_length;
+
+        core_sw::util::copy(source_ptr, source_ptr + block_size, destination_ptr);
+
+        source_ptr      += block_size;
+        destination_ptr += block_size;
+        source_size     -= block_size;
+    } while (source_size > 0u);
+
+    return static_cast<uint32_t>(destination_ptr - destination_begin_ptr);
+}
+
+/**
+ * @brief Decompresses the chunk with the history it was compressed with and compares the result with the source
+ *
+ * @details The chunk is checked by its worker right after the compression, while both the source and the output
+ *          are still in the cache. The history of the chunk is the end of the previous source chunk, so the stream
+ *          decompresses to the source if every chunk does.
+ */
+auto own_verify_chunk(uint8_t *compressed_ptr,
+                      uint32_t compressed_size,
+                      const uint8_t *chunk_begin_ptr,
+                      uint32_t chunk_size,
+                      qpl_dictionary *dictionary_ptr,
+                      uint8_t *state_buffer_ptr,
+                      uint8_t *decompressed_ptr) noexcept -> qpl_ml_status {
+    allocation_buffer_t state_buffer(state_buffer_ptr,
+                                     state_buffer_ptr + inflate_state<execution_path_t::software>::get_buffer_size());
+    const util::linear_allocator state_allocator(state_buffer);
+
+    auto state = inflate_state<execution_path_t::software>::create<true>(state_allocator);
+
+    state.input(compressed_ptr, compressed_ptr + compressed_size)
+         .output(decompressed_ptr, decompressed_ptr + chunk_size)
+         .terminate();
+
+    if (dictionary_ptr) {
+        state.dictionary(*dictionary_ptr);
+    }
+
+    auto result = inflate<execution_path_t::software, inflate_mode_t::inflate_default>(state, dont_stop_or_check);
+
+    if (result.status_code_ != status_list::ok ||
+        result.output_bytes_ != chunk_size ||
+        !std::equal(chunk_begin_ptr, chunk_begin_ptr + chunk_size, decompressed_ptr)) {
+        return status_list::verify_error;
+    }
+
+    return status_list::ok;
+}
+
+}
+
+auto parallel_deflate(uint8_t *const source_ptr,
+                      const uint32_t source_size,
+                      uint8_t *const destination_ptr,
+                      const uint32_t destination_size,
+                      const compression_level_t level,
+                      const compression_mode_t mode,
+                      qpl_compression_huffman_table *const huffman_table_ptr,
+                      const header_t header,
+                      const bool verify) noexcept -> compression_operation_result_t {
+    compression_operation_result_t result{};
+
+    const uint32_t prologue_size = (gzip_header_t == header) ? OWN_GZIP_HEADER_LENGTH :
+                                   (zlib_header_t == header) ? OWN_ZLIB_HEADER_LENGTH : 0u;
+    const uint32_t epilogue_size = (gzip_header_t == header) ? static_cast<uint32_t>(sizeof(gzip_decorator::gzip_trailer)) :
+                                   (zlib_header_t == header) ? OWN_ZLIB_TRAILER_LENGTH : 0u;
+    const uint32_t ending_size   = static_cast<uint32_t>(sizeof(own_final_block)) + epilogue_size;
+
+    if (destination_size < prologue_size + ending_size) {
+        result.status_code_ = status_list::more_output_needed;
+
+        return result;
+    }
+
+    const uint32_t chunks_count  = (source_size + parallel_deflate_chunk_size - 1u) / parallel_deflate_chunk_size;
+    const uint32_t threads_count = std::min(std::max(1u, std::thread::hardware_concurrency()), chunks_count);
+
+    // Compressed chunks are kept in a ring of slots till they are written in order
+    const uint32_t slots_count = 2u * threads_count;
+
+    // The output of a chunk that doesn't fit into the stored blocks size is replaced with the stored blocks,
+    // the rest of the slot is the slope for the bit buffer
+    const uint32_t slot_size          = static_cast<uint32_t>(util::align_size(own_get_stored_blocks_size(parallel_deflate_chunk_size) +
+                                                                               4u * bit_buffer_slope_bytes));
+    const uint32_t dictionary_size    = static_cast<uint32_t>(util::align_size(get_dictionary_size(software_compression_level::SW_NONE,
+                                                                                                   hardware_compression_level::HW_NONE,
+                                                                                                   max_history_size)));
+    const uint32_t state_size         = static_cast<uint32_t>(util::align_size(deflate_state<execution_path_t::software>::get_buffer_size()) +
+                                                              util::align_size(1u));
+    const uint32_t verify_size        = (verify) ? inflate_state<execution_path_t::software>::get_buffer_size() +
+                                                   parallel_deflate_chunk_size : 0u;
+    const size_t   thread_buffer_size = static_cast<size_t>(state_size) + dictionary_size + verify_size;
+
+    std::unique_ptr<uint8_t[]> memory_ptr(new (std::nothrow) uint8_t[static_cast<size_t>(slots_count) * slot_size +
+                                                                       threads_count * thread_buffer_size]);
+    std::unique_ptr<own_chunk_slot_t[]> slots_ptr(new (std::nothrow) own_chunk_slot_t[slots_count]);
+
+    if (!memory_ptr || !slots_ptr) {
+        result.status_code_ = status_list::internal_error;
+
+        return result;
+    }
+
+    for (uint32_t i = 0u; i < slots_count; i++) {
+        slots_ptr[i].output_ptr = memory_ptr.get() + static_cast<size_t>(i) * slot_size;
+    }
+
+    std::mutex              mutex;
+    std::condition_variable chunk_compressed;
+    std::condition_variable chunk_written;
+    std::atomic<uint32_t>   next_chunk_index{0u};
+    uint32_t                chunks_written = 0u;
+    bool                    is_aborted     = false;
+
+    auto compress_chunk = [&](uint32_t chunk_index, uint8_t *thread_buffer_ptr, own_chunk_slot_t &slot) noexcept {
+        auto *const chunk_begin_ptr = source_ptr + static_cast<size_t>(chunk_index) * parallel_deflate_chunk_size;
+        const auto  chunk_size      = std::min(parallel_deflate_chunk_size,
+                                               source_size - chunk_index * parallel_deflate_chunk_size);
+        const auto  stored_size     = own_get_stored_blocks_size(chunk_size);
+
+        allocation_buffer_t state_buffer(thread_buffer_ptr, thread_buffer_ptr + state_size);
+        const util::linear_allocator state_allocator(state_buffer);
+
+        auto builder = deflate_state_builder<execution_path_t::software>::create(state_allocator);
+
+        builder.output(slot.output_ptr, slot_size)
+               .compression_level(level)
+               .crc_seed({0u, 1u})
+               .terminate(false)
+               .verify(false);
+
+        if (dynamic_mode == mode) {
+            builder.collect_statistics_step(true);
+        } else if (huffman_table_ptr) {
+            builder.compression_table(huffman_table_ptr);
+        }
+
+        qpl_dictionary *dictionary_ptr = nullptr;
+
+        if (chunk_index > 0u) {
+            dictionary_ptr          = reinterpret_cast<qpl_dictionary *>(thread_buffer_ptr + state_size);
+            const auto history_size = std::min(max_history_size, static_cast<uint32_t>(chunk_begin_ptr - source_ptr));
+
+            build_dictionary(*dictionary_ptr,
+                             software_compression_level::SW_NONE,
+                             hardware_compression_level::HW_NONE,
+                             chunk_begin_ptr - history_size,
+                             history_size);
+
+            builder.dictionary(*dictionary_ptr);
+        }
+
+        auto state = builder.build();
+
+        auto chunk_result = deflate<execution_path_t::software, deflate_mode_t::deflate_sync_flush>(state,
+                                                                                                  chunk_begin_ptr,
+                                                                                                  chunk_size);
+
+        if (chunk_result.status_code_ == status_list::ok && chunk_result.output_bytes_ <= stored_size) {
+            slot.output_size = chunk_result.output_bytes_;
+            slot.crc32       = chunk_result.checksums_.crc32_;
+            slot.status      = status_list::ok;
+        } else if (chunk_result.status_code_ == status_list::ok ||
+                   chunk_result.status_code_ == status_list::more_output_needed) {
+            slot.output_size = own_write_stored_blocks(chunk_begin_ptr, chunk_size, slot.output_ptr);
+            slot.crc32       = util::crc32_gzip(chunk_begin_ptr, chunk_begin_ptr + chunk_size, 0u);
+            slot.status      = status_list::ok;
+        } else {
+            slot.status = chunk_result.status_code_;
+        }
+
+        if (verify && slot.status == status_list::ok) {
+            auto *const verify_buffer_ptr = thread_buffer_ptr + state_size + dictionary_size;
+
+            slot.status = own_verify_chunk(slot.output_ptr,
+                                           slot.output_size,
+                                           chunk_begin_ptr,
+                                           chunk_size,
+                                           dictionary_ptr,
+                                           verify_buffer_ptr,
+                                           verify_buffer_ptr + inflate_state<execution_path_t::software>::get_buffer_size());
+        }
+
+        if (zlib_header_t == header) {
+            slot.adler32 = isal_adler32(1u, chunk_begin_ptr, chunk_size);
+        }
+    };
+
+    auto worker = [&](uint8_t *thread_buffer_ptr) noexcept {
+        for (;;) {
+            const uint32_t chunk_index = next_chunk_index.fetch_add(1u);
+
+            if (chunk_index >= chunks_count) {
+                break;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                chunk_written.wait(lock, [&]() { return is_aborted || chunk_index < chunks_written + slots_count; });
+
+                if (is_aborted) {
+                    break;
+                }
+            }
+
+            auto &slot = slots_ptr[chunk_index % slots_count];
+
+            compress_chunk(chunk_index, thread_buffer_ptr, slot);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slot.index = chunk_index;
+            }
+
+            chunk_compressed.notify_all();
+        }
+    };
+
+    auto *const thread_buffers_ptr = memory_ptr.get() + static_cast<size_t>(slots_count) * slot_size;
+
+    uint8_t  *output_ptr           = destination_ptr + prologue_size;
+    uint8_t  *const output_end_ptr = destination_ptr + destination_size - ending_size;
+    uint32_t crc32                 = 0u;
+    uint32_t adler32               = 1u;
+
+    // Compressed chunks are written in the source order. The writer compresses the chunk it waits for if no worker
+    // has taken it, so the stream is done even if no worker is started
+    auto writer = [&]() noexcept {
+        result.status_code_ = status_list::ok;
+
+        for (uint32_t chunk_index = 0u; chunk_index < chunks_count; chunk_index++) {
+            auto &slot = slots_ptr[chunk_index % slots_count];
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+
+                while (slot.index != chunk_index) {
+                    uint32_t next_index = next_chunk_index.load();
+
+                    if (next_index < chunks_count && next_index < chunks_written + slots_count &&
+                        next_chunk_index.compare_exchange_strong(next_index, next_index + 1u)) {
+                        auto &next_slot = slots_ptr[next_index % slots_count];
+
+                        lock.unlock();
+                        compress_chunk(next_index, thread_buffers_ptr, next_slot);
+                        lock.lock();
+
+                        next_slot.index = next_index;
+                    } else {
+                        chunk_compressed.wait(lock);
+                    }
+                }
+            }
+
+            if (slot.status != status_list::ok) {
+                result.status_code_ = slot.status;
+            } else if (slot.output_size > static_cast<uint32_t>(output_end_ptr - output_ptr)) {
+                result.status_code_ = status_list::more_output_needed;
+            }
+
+            if (result.status_code_ != status_list::ok) {
+                break;
+            }
+
+            core_sw::util::copy(slot.output_ptr, slot.output_ptr + slot.output_size, output_ptr);
+            output_ptr += slot.output_size;
+
+            const auto chunk_size = std::min(parallel_deflate_chunk_size,
+                                             source_size - chunk_index * parallel_deflate_chunk_size);
+
+            crc32   = util::crc32_gzip_combine(crc32, slot.crc32, chunk_size);
+            adler32 = util::adler32_combine(adler32, slot.adler32, chunk_size);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                chunks_written++;
+            }
+
+            chunk_written.notify_all();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            is_aborted = true;
+        }
+
+        chunk_written.notify_all();
+    };
+
+    // The writer is the first task, so it is running while the workers wait for the free slots
+    auto task = [&](uint32_t task_index) noexcept {
+        if (0u == task_index) {
+            writer();
+        } else {
+            worker(thread_buffers_ptr + task_index * thread_buffer_size);
+        }
+    };
+
+    util::thread_pool::get_instance().run(threads_count, task);
+
+    if (result.status_code_ != status_list::ok) {
+        return result;
+    }
+
+    core_sw::util::copy(own_final_block, own_final_block + sizeof(own_final_block), output_ptr);
+    output_ptr += sizeof(own_final_block);
+
+    if (gzip_header_t == header) {
+        gzip_decorator::gzip_trailer trailer{crc32, source_size};
+
+        gzip_decorator::write_header_unsafe(destination_ptr, prologue_size);
+        gzip_decorator::write_trailer_unsafe(output_ptr, epilogue_size, trailer);
+    } else if (zlib_header_t == header) {
+        zlib_decorator::write_header_unsafe(destination_ptr);
+        zlib_decorator::write_trailer_unsafe(output_ptr, adler32);
+    }
+
+    output_ptr += epilogue_size;
+
+    result.completed_bytes_  = source_size;
+    result.output_bytes_     = static_cast<uint32_t>(output_ptr - destination_ptr);
+    result.checksums_.crc32_ = crc32;
+
+    return result;
+}
+
+} // namespace qpl::ml::compression
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#ifndef QPL_MIDDLE_LAYER_COMPRESSION_DEFLATE_PARALLEL_DEFLATE_HPP
+#define QPL_MIDDLE_LAYER_COMPRESSION_DEFLATE_PARALLEL_DEFLATE_HPP
+
+#include "common/defs.hpp"
+#include "compression/compression_defs.hpp"
+#include "compression/deflate/utils/compression_defs.hpp"
+#include "compression/huffman_table/huffman_table_utils.hpp"
+#include "util/util.hpp"
+
+namespace qpl::ml::compression {
+
+/**
+ * Size of the input compressed by one thread at a time
+ */
+constexpr uint32_t parallel_deflate_chunk_size = 256_kb;
+
+/**
+ * @brief Compresses the source with several software threads into one deflate, gzip or zlib stream
+ *
+ * @details The source is split into chunks of @ref parallel_deflate_chunk_size bytes. Every chunk is compressed
+ *          independently with the end of the previous chunk set as a dictionary, so matches keep crossing
+ *          the chunk boundaries. A chunk ends with an empty stored block, that aligns it to a byte boundary,
+ *          and the compressed chunks are concatenated in order. CRC32 and Adler32 of the chunks are combined.
+ *          With the verification enabled, every thread decompresses its chunk right after compressing it
+ *          and compares it with the source, so no serial pass over the whole stream is done at the end.
+ *          The chunks are compressed by the workers of @ref util::thread_pool, the calling thread writes them
+ *          to the destination and compresses the chunks no worker has taken.
+ *
+ * @param huffman_table_ptr  table for the static mode, nullptr for the fixed and the dynamic modes
+ */
+auto parallel_deflate(uint8_t *source_ptr,
+                      uint32_t source_size,
+                      uint8_t *destination_ptr,
+                      uint32_t destination_size,
+                      compression_level_t level,
+                      compression_mode_t mode,
+                      qpl_compression_huffman_table *huffman_table_ptr,
+                      header_t header,
+                      bool verify) noexcept -> compression_operation_result_t;
+
+} // namespace qpl::ml::compression
+
+#endif // QPL_MIDDLE_LAYER_COMPRESSION_DEFLATE_PARALLEL_DEFLATE_HPP
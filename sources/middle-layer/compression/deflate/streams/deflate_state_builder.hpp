@@ -50,6 +50,13 @@ public:
 
         builder.stream_.chunk_type_.is_first = true;
 
+        // The first chunk must not continue the bit buffer saved by the previous stream in the same memory
+        if (nullptr != builder.stream_.isal_stream_ptr_) {
+            auto bit_buffer_ptr = reinterpret_cast<uint8_t *>(&builder.stream_.isal_stream_ptr_->internal_state.bitbuf);
+
+            core_sw::util::set_zeros(bit_buffer_ptr, sizeof(BitBuf2));
+        }
+
         return builder;
     }
 
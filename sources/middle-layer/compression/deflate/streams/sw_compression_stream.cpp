@@ -9,6 +9,7 @@
 #include "simple_memory_ops.hpp"
 #include "util/util.hpp"
 #include "deflate_hash_table.h"
+#include "deflate_optimal_icf.h"
 
 namespace qpl::ml::compression {
 void deflate_state<execution_path_t::software>::set_source(uint8_t *begin, uint32_t size) noexcept {
@@ -44,18 +45,26 @@ void deflate_state<execution_path_t::software>::reset_match_history() noexcept {
 
     auto level_buffer = reinterpret_cast<level_buf *>(isal_stream_ptr_->level_buf);
 
-    if (compression_level() == high_level) {
+    if (compression_level() != default_level) {
+        const auto &preset = match_search_presets[compression_level()];
+
+        hash_table_.hash_mask   = util::build_mask<uint32_t>(preset.hash_bits);
+        hash_table_.window_mask = util::build_mask<uint32_t>(window_bits());
+        hash_table_.attempts    = preset.attempts;
+        hash_table_.good_match  = preset.good_match;
+        hash_table_.nice_match  = preset.nice_match;
+        hash_table_.lazy_match  = preset.lazy_match;
+
+        // The history is placed at the end of the level buffer if it doesn't fit next to the hash table
         hash_table_.hash_table_ptr = reinterpret_cast<uint32_t *>(level_buffer->hash_map.hash_table);
-        hash_table_.hash_story_ptr = hash_table_.hash_table_ptr + high_hash_table_size;
+        hash_table_.hash_story_ptr = (history_buffer_size() == 0u)
+                                     ? hash_table_.hash_table_ptr + hash_table_.hash_mask + 1u
+                                     : reinterpret_cast<uint32_t *>(isal_stream_ptr_->level_buf
+                                                                    + isal_stream_ptr_->level_buf_size
+                                                                    - history_buffer_size());
 
         if (isal_stream_ptr_->total_in == 0) {
             deflate_hash_table_reset(&hash_table_);
-
-            hash_table_.hash_mask  = util::build_mask<uint32_t, 12u>();
-            hash_table_.attempts   = 4096u;
-            hash_table_.good_match = 32u;
-            hash_table_.nice_match = 258u;
-            hash_table_.lazy_match = 258u;
         }
     } else {
         auto isal_state   = &isal_stream_ptr_->internal_state;
@@ -76,6 +85,47 @@ void deflate_state<execution_path_t::software>::reset_match_history() noexcept {
     }
 }
 
+auto deflate_state<execution_path_t::software>::window_bits() const noexcept -> uint32_t {
+    // Huffman tables provided by the user and dictionaries can be limited by the 4 kb window,
+    // so the wider window is used with the tables built by the library only
+    const bool is_wide_window_allowed = (compression_mode_ == dynamic_mode || compression_mode_ == fixed_mode)
+                                        && dictionary_support_ == dictionary_support_t::disabled
+                                        && mini_blocks_support() == mini_blocks_support_t::disabled;
+
+    return is_wide_window_allowed ? match_search_presets[compression_level()].window_bits : default_window_bits;
+}
+
+auto deflate_state<execution_path_t::software>::history_buffer_size() const noexcept -> uint32_t {
+    if (compression_level() == default_level) {
+        return 0u;
+    }
+
+    const uint32_t history_size = (1u << window_bits()) * sizeof(uint32_t);
+    const uint32_t tables_size  = (1u << match_search_presets[compression_level()].hash_bits) * sizeof(uint32_t)
+                                  + history_size;
+
+    return (tables_size <= sizeof(hash_map_buf::hash_table)) ? 0u : history_size;
+}
+
+auto deflate_state<execution_path_t::software>::min_block_size() const noexcept -> uint32_t {
+    if (compression_level() == default_level) {
+        return stored_block_max_length;
+    }
+
+    // Optimal parsing can start a new block after any segment if the statistics change
+    if (compression_level() == level_9 && compression_mode_ == dynamic_mode
+        && mini_blocks_support() == mini_blocks_support_t::disabled) {
+        return OWN_OPTIMAL_MIN_SEGMENT_SIZE;
+    }
+
+    // Otherwise the block is finished when the ICF buffer is full, each ICF entry covers 1 byte at least
+    const uint32_t level_struct_size = sizeof(level_buf) - MAX_LVL_BUF_SIZE + sizeof(hash_map_buf);
+    const uint32_t icf_buffer_size   = isal_stream_ptr_->level_buf_size - level_struct_size - sizeof(deflate_icf)
+                                       - history_buffer_size();
+
+    return std::min(stored_block_max_length, static_cast<uint32_t>(icf_buffer_size / sizeof(deflate_icf)));
+}
+
 void deflate_state<execution_path_t::software>::reset_bit_buffer() noexcept {
     set_buf(&isal_stream_ptr_->internal_state.bitbuf, isal_stream_ptr_->next_out, isal_stream_ptr_->avail_out);
 }
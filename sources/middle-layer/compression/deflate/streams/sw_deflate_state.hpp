@@ -75,6 +75,12 @@ public:
 protected:
     void reset_match_history() noexcept;
 
+    [[nodiscard]] auto window_bits() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto history_buffer_size() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto min_block_size() const noexcept -> uint32_t;
+
     void reset_bit_buffer() noexcept;
 
     void dump_bit_buffer() noexcept;
@@ -165,6 +171,9 @@ private:
     friend auto slow_deflate_icf_body(deflate_state<execution_path_t::software> &stream,
                                       compression_state_t &state) noexcept -> qpl_ml_status;
 
+    friend auto optimal_deflate_icf_body(deflate_state<execution_path_t::software> &stream,
+                                         compression_state_t &state) noexcept -> qpl_ml_status;
+
     friend auto write_header(deflate_state<execution_path_t::software> &stream,
                              compression_state_t &state) noexcept -> qpl_ml_status;
 
@@ -185,11 +194,15 @@ private:
     friend auto flush_bit_buffer(stream_t &stream,
                                  compression_state_t &state) noexcept -> qpl_ml_status;
 
+    friend auto write_sync_flush(deflate_state<execution_path_t::software> &stream,
+                                 compression_state_t &state) noexcept -> qpl_ml_status;
+
     template <typename stream_t>
     friend auto flush_write_buffer(stream_t &stream,
                                    compression_state_t &stat) noexcept -> qpl_ml_status;
 
-    friend auto update_checksum(deflate_state<execution_path_t::software> &stream) noexcept -> qpl_ml_status;
+    friend auto update_checksum(deflate_state<execution_path_t::software> &stream,
+                                uint8_t *&checksum_end_ptr) noexcept -> qpl_ml_status;
 
     friend auto deflate_body(deflate_state<execution_path_t::software> &stream,
                              compression_state_t &state) noexcept -> qpl_ml_status;
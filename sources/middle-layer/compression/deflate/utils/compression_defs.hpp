@@ -100,9 +100,41 @@ struct chunk_type {
 constexpr uint32_t isal_history_size_boundary = 12u;
 
 /**
- * Size of hash table that is used during match searching
+ * Number of bits of the history window searched by the slow levels when a large window can't be used
  */
-constexpr uint32_t high_hash_table_size = 4096u;
+constexpr uint32_t default_window_bits = 12u;
+
+/**
+ * @brief Parameters of the hash-chain match search used by the levels above the default one
+ */
+struct match_search_preset_t {
+    uint32_t hash_bits;      /**< Size of the main hash-table as a power of two */
+    uint32_t window_bits;    /**< Size of the history window searched for matches as a power of two */
+    uint32_t attempts;       /**< Maximal number of the hash chain entries checked for a position */
+    uint32_t good_match;     /**< Match length that cuts the rest of the search by four times */
+    uint32_t nice_match;     /**< Match length that stops the search */
+    uint32_t lazy_match;     /**< Match length that stops the lazy evaluation at the next position */
+};
+
+/**
+ * Search presets of the software path indexed by the level, the default level uses ISA-L and ignores its entry
+ *
+ * @note The levels 2-5 check their short chains in full: on data with many repeats, like images, a chain cut by
+ *       a good match misses the far and longer one and such levels compress worse than the default level
+ */
+constexpr std::array<match_search_preset_t, level_9 + 1u> match_search_presets = {{
+        // hash  window  attempts  good  nice  lazy
+        {12u,    12u,    0u,       0u,   0u,   0u},      // unused
+        {12u,    12u,    0u,       0u,   0u,   0u},      // level_1
+        {13u,    12u,    32u,      64u,  258u, 4u},      // level_2
+        {13u,    13u,    32u,      64u,  258u, 16u},     // level_3
+        {14u,    14u,    64u,      64u,  258u, 32u},     // level_4
+        {14u,    15u,    64u,      64u,  258u, 64u},     // level_5
+        {14u,    15u,    128u,     32u,  258u, 128u},    // level_6
+        {14u,    15u,    256u,     32u,  258u, 258u},    // level_7
+        {14u,    15u,    1024u,    64u,  258u, 258u},    // level_8
+        {14u,    15u,    4096u,    258u, 258u, 258u}     // level_9
+}};
 
 constexpr uint32_t byte_bit_size   = 8;
 constexpr uint32_t uint32_bit_size = 32;
@@ -36,6 +36,12 @@ template <execution_path_t path>
 auto decompress_huffman_only(huffman_only_decompression_state<path> &decompression_state,
                              decompression_huffman_table &decompression_table) noexcept -> decompression_operation_result_t;
 
+/**
+ * @brief Builds the software decoding tables of the Huffman Only decompression table
+ */
+void build_huffman_only_decoding_tables(const qplc_huffman_table_flat_format &huffman_table,
+                                        huffman_only_decoding_tables &decoding_tables) noexcept;
+
 template <execution_path_t path>
 auto verify_huffman_only(huffman_only_decompression_state<path> &state,
                          decompression_huffman_table &decompression_table,
@@ -74,10 +74,12 @@ auto compress_huffman_only<execution_path_t::software>(uint8_t *begin,
         auto *destination_begin_ptr = stream.allocator_.allocate<uint8_t>(4_kb);
         auto *destination_end_ptr   = destination_begin_ptr + 4_kb;
 
+        // The padding bits of the last byte are not decoded, both in LE and in BE16 format it is the byte
+        // written last by the bit buffer
         verify_state.input(output_begin_ptr, stream.isal_stream_ptr_->next_out)
                     .crc_seed(stream.crc_seed_)
                     .endianness(stream.endianness_)
-                    .last_bits_offset(result.last_bit_offset)
+                    .last_bits_offset(static_cast<uint8_t>(stream.get_last_bits_offset()))
                     .output(destination_begin_ptr, destination_end_ptr);
 
         result.status_code_ = verify_huffman_only<qpl::ml::execution_path_t::software>(verify_state,
@@ -93,14 +95,14 @@ auto compress_huffman_only<execution_path_t::software>(uint8_t *begin,
     // If output_bytes_ is odd, add 1 to it because the size of a compressed stream in BE16 format has to be
     // even. And if last_bit_offset is 0, it needs to be adjusted to 8.
     // If output_bytes_ is even, add 8 to last_bit_offset to represent the bits written in the last word,
-    // instead of last byte.
+    // instead of last byte, unless the last word is complete.
     if (stream.endianness_ == big_endian) {
         if (result.output_bytes_% 2 == 1) {
             result.output_bytes_ = result.output_bytes_ + 1;
             if (result.last_bit_offset == 0) {
                 result.last_bit_offset = 8;
             }
-        } else {
+        } else if (result.last_bit_offset != 0) {
             result.last_bit_offset = result.last_bit_offset + 8;
         }
     }
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <cstring>
+
 #include "huffman_only.hpp"
 #include "common/bit_reverse.hpp"
 #include "util/util.hpp"
@@ -45,7 +47,7 @@ static void restore_huffman_table(
 
 static void build_lookup_table(
         const std::array<huffman_code, huffman_only_number_of_literals> &huffman_table,
-        uint8_t *lookup_table_ptr) noexcept {
+        huffman_only_decoding_tables &decoding_tables) noexcept {
     // Main cycle
     for (uint16_t symbol = 0u; symbol < huffman_table.size(); symbol++) {
         const uint8_t  code_length             = huffman_table[symbol].length;
@@ -54,6 +56,8 @@ static void build_lookup_table(
         const uint16_t low_lookup_table_index  = 0u;
         const uint16_t high_lookup_table_index = util::build_mask<uint16_t>(offset);
 
+        decoding_tables.code_lengths[symbol] = code_length;
+
         if (0u == code_length) {
             continue;
         }
@@ -62,17 +66,158 @@ static void build_lookup_table(
         for (uint32_t i = low_lookup_table_index; i < high_lookup_table_index + 1u; i++) {
             const uint16_t symbol_position = (i << code_length) | code;
 
-            lookup_table_ptr[symbol_position] = (uint8_t) symbol;
+            decoding_tables.lookup_table[symbol_position] = (uint8_t) symbol;
+        }
+    }
+}
+
+/**
+ * Multi-symbol table entry layout: symbols in the bytes 0..2, total code length in the bits 24..27
+ * and number of symbols in the bits 28..29. Zero symbols mean that the next code is longer than 12 bits.
+ */
+constexpr uint32_t multi_symbol_max_symbols  = 3u;
+constexpr uint32_t multi_symbol_length_shift = 24u;
+constexpr uint32_t multi_symbol_count_shift  = 28u;
+
+static void build_multi_symbol_table(huffman_only_decoding_tables &decoding_tables) noexcept {
+    for (uint32_t index = 0u; index < (1u << huffman_only_multi_symbol_bits); index++) {
+        uint32_t entry         = 0u;
+        uint32_t symbols_count = 0u;
+        uint32_t total_length  = 0u;
+
+        // Symbols are taken while their codes are completely inside of the index bits
+        while (symbols_count < multi_symbol_max_symbols) {
+            const uint8_t  symbol      = decoding_tables.lookup_table[index >> total_length];
+            const uint32_t code_length = decoding_tables.code_lengths[symbol];
+
+            if (0u == code_length || total_length + code_length > huffman_only_multi_symbol_bits) {
+                break;
+            }
+
+            entry        |= static_cast<uint32_t>(symbol) << (symbols_count * byte_bits_size);
+            total_length += code_length;
+            symbols_count++;
         }
+
+        decoding_tables.multi_symbol_table[index] = entry |
+                                                    (total_length << multi_symbol_length_shift) |
+                                                    (symbols_count << multi_symbol_count_shift);
+    }
+}
+
+void build_huffman_only_decoding_tables(const qplc_huffman_table_flat_format &huffman_table,
+                                        huffman_only_decoding_tables &decoding_tables) noexcept {
+    std::array<huffman_code, huffman_only_number_of_literals> restored_huffman_table{};
+
+    restore_huffman_table(huffman_table, restored_huffman_table);
+    build_lookup_table(restored_huffman_table, decoding_tables);
+    build_multi_symbol_table(decoding_tables);
+}
+
+/**
+ * @brief Loads 8 bytes of the stream in the little-endian bit order
+ *
+ * @note In BE16 format every 16-bit word is reversed, so the load must start at a word boundary
+ */
+template <endianness_t endianness>
+static inline auto load_stream_bits(const uint8_t *source_ptr) noexcept -> uint64_t {
+    uint64_t bits;
+
+    std::memcpy(&bits, source_ptr, sizeof(bits));
+
+    if constexpr (endianness == endianness_t::big_endian) {
+        bits = ((bits >> 1u) & 0x5555555555555555u) | ((bits & 0x5555555555555555u) << 1u);
+        bits = ((bits >> 2u) & 0x3333333333333333u) | ((bits & 0x3333333333333333u) << 2u);
+        bits = ((bits >> 4u) & 0x0F0F0F0F0F0F0F0Fu) | ((bits & 0x0F0F0F0F0F0F0F0Fu) << 4u);
+        bits = ((bits >> 8u) & 0x00FF00FF00FF00FFu) | ((bits & 0x00FF00FF00FF00FFu) << 8u);
     }
+
+    return bits;
+}
+
+/**
+ * @brief Decodes the bulk of the stream with up to 3 symbols per table lookup
+ *
+ * @details The decoding stops before the last bytes of the source and output, they are processed
+ *          by @ref perform_huffman_only_decompression, that handles the stream end and output overflow.
+ *
+ * @return Number of the source bits that were decoded
+ */
+template <endianness_t endianness>
+static auto perform_multi_symbol_decompression(const uint8_t *source_ptr,
+                                               uint32_t source_size,
+                                               uint8_t *destination_ptr,
+                                               uint32_t destination_size,
+                                               const huffman_only_decoding_tables &decoding_tables,
+                                               uint32_t &output_bytes) noexcept -> uint32_t {
+    // A refill reads 8 bytes, the stream tail is left for the bit reader
+    constexpr uint32_t source_margin      = 24u;
+    // 3 lookups per refill write up to 9 symbols with 4-byte stores
+    constexpr uint32_t destination_margin = 16u;
+    // The refill keeps at least 48 bits in the buffer, that is enough for 3 codes of the maximal length
+    constexpr uint32_t lookups_per_refill = 3u;
+
+    constexpr uint32_t multi_symbol_mask  = util::build_mask<uint32_t, huffman_only_multi_symbol_bits>();
+    constexpr uint32_t single_symbol_mask = util::build_mask<uint32_t, huffman_code_bit_length>();
+
+    output_bytes = 0u;
+
+    if (source_size < source_margin || destination_size < destination_margin) {
+        return 0u;
+    }
+
+    const uint8_t *current_source_ptr      = source_ptr;
+    const uint8_t *const source_limit_ptr  = source_ptr + source_size - source_margin;
+    uint8_t       *current_destination_ptr = destination_ptr;
+    uint8_t *const destination_limit_ptr   = destination_ptr + destination_size - destination_margin;
+
+    uint64_t bit_buffer     = 0u;
+    uint32_t bits_in_buffer = 0u;
+
+    while (current_source_ptr <= source_limit_ptr && current_destination_ptr <= destination_limit_ptr) {
+        bit_buffer |= load_stream_bits<endianness>(current_source_ptr) << bits_in_buffer;
+
+        // Whole bytes (words for BE16) are added to the buffer, the bits above them are the same stream bits
+        uint32_t refill_bytes = (63u - bits_in_buffer) >> 3u;
+
+        if constexpr (endianness == endianness_t::big_endian) {
+            refill_bytes &= ~1u;
+        }
+
+        current_source_ptr += refill_bytes;
+        bits_in_buffer     += refill_bytes * byte_bits_size;
+
+        for (uint32_t i = 0u; i < lookups_per_refill; i++) {
+            const uint32_t entry         = decoding_tables.multi_symbol_table[bit_buffer & multi_symbol_mask];
+            const uint32_t symbols_count = entry >> multi_symbol_count_shift;
+            uint32_t       code_length   = (entry >> multi_symbol_length_shift) & 0xFu;
+
+            if (0u != symbols_count) {
+                std::memcpy(current_destination_ptr, &entry, sizeof(entry));
+                current_destination_ptr += symbols_count;
+            } else {
+                // The code is longer than the multi-symbol table index
+                const uint8_t symbol = decoding_tables.lookup_table[bit_buffer & single_symbol_mask];
+
+                code_length = decoding_tables.code_lengths[symbol];
+                *current_destination_ptr++ = symbol;
+            }
+
+            bit_buffer    >>= code_length;
+            bits_in_buffer -= code_length;
+        }
+    }
+
+    output_bytes = static_cast<uint32_t>(current_destination_ptr - destination_ptr);
+
+    return static_cast<uint32_t>(current_source_ptr - source_ptr) * byte_bits_size - bits_in_buffer;
 }
 
 static auto perform_huffman_only_decompression(
         bit_reader &reader,
         uint8_t *destination_ptr,
         uint32_t destination_length,
-        const uint8_t *lookup_table_ptr,
-        const std::array<huffman_code, huffman_only_number_of_literals> &huffman_table,
+        const huffman_only_decoding_tables &decoding_tables,
         bool forse_flush_last_bits) noexcept -> decompression_operation_result_t {
     // Main cycle
     uint32_t current_symbol_index = 0u;
@@ -94,8 +239,8 @@ static auto perform_huffman_only_decompression(
         const uint16_t next_bits = reader.peak_bits(huffman_code_bit_length);
 
         if (forse_flush_last_bits || !reader.is_overflowed()) {
-            const uint8_t  symbol                     = lookup_table_ptr[next_bits];
-            const uint8_t  current_symbol_code_length = huffman_table[symbol].length;
+            const uint8_t  symbol                     = decoding_tables.lookup_table[next_bits];
+            const uint8_t  current_symbol_code_length = decoding_tables.code_lengths[symbol];
 
             // Shifting bit buffer by code length
             reader.shift_bits(current_symbol_code_length);
@@ -123,8 +268,6 @@ template <>
 auto decompress_huffman_only<execution_path_t::software>(
         huffman_only_decompression_state<execution_path_t::software> &decompression_state,
         decompression_huffman_table &decompression_table) noexcept -> decompression_operation_result_t {
-    std::array<huffman_code, huffman_only_number_of_literals> restored_huffman_table;
-
     const auto *source_ptr = decompression_state.get_fields().current_source_ptr;
     const auto *source_end_ptr = source_ptr + decompression_state.get_fields().source_available;
 
@@ -134,34 +277,72 @@ auto decompress_huffman_only<execution_path_t::software>(
 
     const auto last_byte_valid_bits = decompression_state.get_fields().last_bits_offset;
 
-    bit_reader reader(source_ptr, source_end_ptr);
+    // The tables cached by the Huffman table object are used if any, otherwise they are built in the job state
+    const auto *decoding_tables_ptr = decompression_table.get_huffman_only_decoding_tables();
 
-    // Restore huffman table and build the lookup table
-    restore_huffman_table(*decompression_table.get_sw_decompression_table(), restored_huffman_table);
+    if (nullptr == decoding_tables_ptr) {
+        build_huffman_only_decoding_tables(*decompression_table.get_sw_decompression_table(),
+                                           *decompression_state.get_decoding_tables());
 
-    build_lookup_table(restored_huffman_table, decompression_state.get_lookup_table());
+        decoding_tables_ptr = decompression_state.get_decoding_tables();
+    }
 
     decompression_operation_result_t result{};
 
     if (decompression_state.get_endianness() == endianness_t::little_endian) {
+        uint32_t   fast_output_bytes = 0u;
+        const auto decoded_bits      = perform_multi_symbol_decompression<endianness_t::little_endian>(
+                source_ptr,
+                static_cast<uint32_t>(std::distance(source_ptr, source_end_ptr)),
+                destination_ptr,
+                available_out,
+                *decoding_tables_ptr,
+                fast_output_bytes);
+
+        // The rest of the stream is decoded symbol by symbol starting with the first not decoded bit
+        const uint32_t decoded_bytes = decoded_bits / byte_bits_size;
+        const auto     skipped_bits  = static_cast<uint8_t>(decoded_bits % byte_bits_size);
+
+        bit_reader reader(source_ptr + decoded_bytes, source_end_ptr);
         reader.set_last_bits_offset(last_byte_valid_bits);
+
+        if (0u != skipped_bits) {
+            reader.peak_bits(skipped_bits);
+            reader.shift_bits(skipped_bits);
+        }
+
         result = perform_huffman_only_decompression(reader,
-                                                    destination_ptr,
-                                                    available_out,
-                                                    decompression_state.get_lookup_table(),
-                                                    restored_huffman_table,
+                                                    destination_ptr + fast_output_bytes,
+                                                    available_out - fast_output_bytes,
+                                                    *decoding_tables_ptr,
                                                     true);
 
-        result.completed_bytes_ = reader.get_total_bytes_read();
+        result.output_bytes_   += fast_output_bytes;
+        result.completed_bytes_ = decoded_bytes + reader.get_total_bytes_read();
     } else {
         auto big_endian_buffer_ptr = reinterpret_cast<uint16_t *>(decompression_state.get_buffer());
 
         core_sw::util::set_zeros(big_endian_buffer_ptr, huffman_only_be_buffer_size);
 
-        uint32_t total_bytes_read = 0u;
         uint32_t source_size = static_cast<uint32_t>(std::distance(source_ptr, source_end_ptr));
 
-        auto current_source_ptr = reinterpret_cast<const uint16_t *>(source_ptr);
+        const auto decoded_bits = perform_multi_symbol_decompression<endianness_t::big_endian>(source_ptr,
+                                                                                              source_size,
+                                                                                              destination_ptr,
+                                                                                              available_out,
+                                                                                              *decoding_tables_ptr,
+                                                                                              result.output_bytes_);
+
+        destination_ptr += result.output_bytes_;
+        available_out   -= result.output_bytes_;
+
+        // The rest of the stream is reversed and decoded starting with the word of the first not decoded bit
+        uint32_t total_bytes_read = (decoded_bits / (2u * byte_bits_size)) * 2u;
+        auto     skipped_bits     = static_cast<uint8_t>(decoded_bits % (2u * byte_bits_size));
+
+        bit_reader reader(source_ptr, source_end_ptr);
+
+        auto current_source_ptr = reinterpret_cast<const uint16_t *>(source_ptr + total_bytes_read);
 
         // Perform decompression while there are enough bytes in the source
         // in 4k chunk sizes (which is the size of decompression_state huffman only buffer)
@@ -198,18 +379,25 @@ auto decompress_huffman_only<execution_path_t::software>(
             // Set reversed stream to the bit reader
             reader.set_source(decompression_state.get_buffer(), decompression_state.get_buffer() + actual_temporary_buffer_size);
 
+            if (0u != skipped_bits) {
+                reader.peak_bits(skipped_bits);
+                reader.shift_bits(skipped_bits);
+                skipped_bits = 0u;
+            }
+
             auto iteration_result = perform_huffman_only_decompression(reader,
                                                                        destination_ptr,
                                                                        available_out,
-                                                                       decompression_state.get_lookup_table(),
-                                                                       restored_huffman_table,
+                                                                       *decoding_tables_ptr,
                                                                        is_last_chunk);
 
             destination_ptr += iteration_result.output_bytes_;
             available_out   -= iteration_result.output_bytes_;
             result.output_bytes_    += iteration_result.output_bytes_;
 
-            if (result.status_code_ != status_list::ok) {
+            // The output is full, the next chunks cannot be decoded
+            if (iteration_result.status_code_ != status_list::ok) {
+                result.status_code_ = iteration_result.status_code_;
                 break;
             }
 
@@ -240,6 +428,14 @@ auto verify_huffman_only<execution_path_t::software>(huffman_only_decompression_
     auto *destination_end_ptr   = destination_begin_ptr + state.get_fields().destination_available;
     decompression_operation_result_t decompression_result {};
 
+    // The decoding tables are built once for all the decompression calls below
+    if (nullptr == decompression_table.get_huffman_only_decoding_tables()) {
+        build_huffman_only_decoding_tables(*decompression_table.get_sw_decompression_table(),
+                                           *state.get_decoding_tables());
+
+        decompression_table.set_huffman_only_decoding_tables(state.get_decoding_tables());
+    }
+
     do {
         state.output(destination_begin_ptr, destination_end_ptr);
         decompression_result = decompress_huffman_only<execution_path_t::software>(state, decompression_table);
@@ -20,7 +20,20 @@ template <execution_path_t path>
 class huffman_only_decompression_state;
 
 constexpr uint32_t huffman_only_be_buffer_size    = 4096;
-constexpr uint32_t huffman_only_lookup_table_size = 0xFFFF;
+constexpr uint32_t huffman_only_lookup_table_size = 0x10000;
+constexpr uint32_t huffman_only_multi_symbol_bits = 12u;
+
+/**
+ * @brief Software decoding tables of the Huffman Only table
+ *
+ * @details The tables depend on the Huffman table only, so they are built once and are kept by the table object.
+ *          The job state keeps its own copy for the tables that are not cached.
+ */
+struct huffman_only_decoding_tables {
+    uint32_t multi_symbol_table[1u << huffman_only_multi_symbol_bits]; /**< Up to 3 symbols that are fully coded by the next 12 bits */
+    uint8_t  lookup_table[huffman_only_lookup_table_size];             /**< Symbol for every value of the next 16 reversed bits */
+    uint8_t  code_lengths[256];                                         /**< Huffman code length of every symbol */
+};
 
 template <>
 class huffman_only_decompression_state<execution_path_t::software> {
@@ -38,8 +51,8 @@ public:
         // Allocate internal buffers
         state_ = allocator.allocate<internal_state_fields_t, qpl::ml::util::memory_block_t::not_aligned>(1u);
 
-        lookup_table_ptr_ = allocator.allocate<uint8_t, qpl::ml::util::memory_block_t::not_aligned>(
-                huffman_only_lookup_table_size);
+        decoding_tables_ptr_ = allocator.allocate<huffman_only_decoding_tables,
+                                                  qpl::ml::util::memory_block_t::aligned_64u>(1u);
 
         huffman_only_buffer_ptr_ = allocator.allocate<uint8_t, qpl::ml::util::memory_block_t::not_aligned>(
                 huffman_only_be_buffer_size);
@@ -72,7 +85,7 @@ public:
 
     [[nodiscard]] inline auto get_endianness() noexcept -> endianness_t;
 
-    [[nodiscard]] inline auto get_lookup_table() noexcept -> uint8_t *;
+    [[nodiscard]] inline auto get_decoding_tables() noexcept -> huffman_only_decoding_tables *;
 
     [[nodiscard]] inline auto get_buffer() noexcept -> uint8_t *;
 
@@ -80,7 +93,7 @@ public:
         size_t size = 0;
 
         size += sizeof(internal_state_fields_t);
-        size += sizeof(uint8_t)*huffman_only_lookup_table_size;
+        size += util::align_size(sizeof(huffman_only_decoding_tables));
         size += sizeof(uint8_t)*huffman_only_be_buffer_size;
         size += sizeof(uint8_t)*4_kb; // for compress + verify
 
@@ -90,10 +103,10 @@ public:
     static constexpr auto execution_path = execution_path_t::software;
 
 private:
-    internal_state_fields_t *state_;
-    uint8_t                 *lookup_table_ptr_;
-    uint8_t                 *huffman_only_buffer_ptr_;
-    endianness_t            endianness_ = endianness_t::little_endian;
+    internal_state_fields_t      *state_;
+    huffman_only_decoding_tables *decoding_tables_ptr_;
+    uint8_t                      *huffman_only_buffer_ptr_;
+    endianness_t                 endianness_ = endianness_t::little_endian;
 };
 
 template <>
@@ -198,8 +211,8 @@ inline auto huffman_only_decompression_state<execution_path_t::software>::last_b
     return endianness_;
 }
 
-[[nodiscard]] inline auto huffman_only_decompression_state<execution_path_t::software>::get_lookup_table() noexcept -> uint8_t * {
-    return lookup_table_ptr_;
+[[nodiscard]] inline auto huffman_only_decompression_state<execution_path_t::software>::get_decoding_tables() noexcept -> huffman_only_decoding_tables * {
+    return decoding_tables_ptr_;
 }
 
 [[nodiscard]] inline auto huffman_only_decompression_state<execution_path_t::software>::get_buffer() noexcept -> uint8_t * {
@@ -18,6 +18,7 @@
 #include "compression/huffman_table/inflate_huffman_table.hpp"
 #include "util/util.hpp"
 #include "compression/huffman_table/huffman_table_utils.hpp" // qpl::ml::compression qpl_triplet
+#include "compression/huffman_only/huffman_only.hpp"
 
 namespace qpl::ml::compression {
 
@@ -163,6 +164,7 @@ qpl_ml_status huffman_table_t<algorithm>::init(const qpl_histogram &histogram_pt
         }
     }
 
+    release_decoding_tables();
     m_is_initialized = true;
 
     return status_list::ok;
@@ -195,6 +197,7 @@ qpl_ml_status huffman_table_t<algorithm>::init(const qpl_triplet *triplet_ptr, c
         }
     }
 
+    release_decoding_tables();
     m_is_initialized = true;
 
     return status_list::ok;
@@ -225,6 +228,7 @@ qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::init(const huff
         return status_list::not_supported_err;
     }
 
+    release_decoding_tables();
     m_is_initialized = true;
 
     return status_list::ok;
@@ -260,6 +264,7 @@ qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::init(const
         return status_list::not_supported_err;
     }
 
+    release_decoding_tables();
     m_is_initialized = true;
 
     return status_list::ok;
@@ -299,6 +304,7 @@ qpl_ml_status huffman_table_t<algorithm>::init_with_stream(const uint8_t *const
         return status_list::not_supported_err;
     }
 
+    release_decoding_tables();
     m_is_initialized = true;
 
     return status_list::ok;
@@ -352,6 +358,102 @@ qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::write_to_stream
 template
 qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::write_to_stream(uint8_t *buffer) const noexcept;
 
+// function to initialize compression and decompression tables from the Deflate header
+// stored in the buffer, currently used for deserialization of the compact format
+template <compression_algorithm_e algorithm>
+qpl_ml_status huffman_table_t<algorithm>::init_with_compact_stream(const uint8_t *const buffer) noexcept {
+    if (m_meta.algorithm != compression_algorithm_e::deflate) {
+        return status_list::not_supported_err;
+    }
+
+    auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+    // Decompression table is built from the compression one, so a temporary one is used if the object has none
+    allocator_t table_allocator = details::get_allocator(m_allocator);
+    std::unique_ptr<uint8_t[], void(*)(void*)> temporary_table(nullptr, table_allocator.deallocator);
+
+    if (!c_table) {
+        temporary_table.reset(reinterpret_cast<uint8_t*>(table_allocator.allocator(sizeof(qpl_compression_huffman_table))));
+
+        if (!temporary_table) {
+            return status_list::nullptr_error;
+        }
+
+        memset(temporary_table.get(), 0u, sizeof(qpl_compression_huffman_table));
+        c_table = reinterpret_cast<qpl_compression_huffman_table*>(temporary_table.get());
+    }
+
+    auto status = compression::huffman_table_init_with_compact_stream(*c_table, buffer, m_meta.flags);
+    if (status) {
+        return static_cast<qpl_status>(status);
+    }
+
+    if (m_d_huffman_table) {
+        auto d_table = reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table);
+
+        status = compression::huffman_table_convert(*c_table, *d_table, m_meta.flags);
+        if (status) {
+            return static_cast<qpl_status>(status);
+        }
+    }
+
+    release_decoding_tables();
+    m_is_initialized = true;
+
+    return status_list::ok;
+}
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::init_with_compact_stream(const uint8_t *const buffer) noexcept;
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::init_with_compact_stream(const uint8_t *const buffer) noexcept;
+
+// function to write Deflate header of the table into buffer,
+// currently used for serialization into the compact format
+template <compression_algorithm_e algorithm>
+qpl_ml_status huffman_table_t<algorithm>::write_to_compact_stream(uint8_t *buffer) const noexcept {
+    if (m_meta.algorithm != compression_algorithm_e::deflate) {
+        return status_list::not_supported_err;
+    }
+
+    // Both tables keep the same Deflate header, so it is stored once
+    if (m_c_huffman_table) {
+        auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+        return compression::huffman_table_write_to_compact_stream(*c_table, buffer);
+    }
+
+    auto d_table = reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table);
+
+    return compression::huffman_table_write_to_compact_stream(*d_table, buffer);
+}
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::deflate>::write_to_compact_stream(uint8_t *buffer) const noexcept;
+
+template
+qpl_ml_status huffman_table_t<compression_algorithm_e::huffman_only>::write_to_compact_stream(uint8_t *buffer) const noexcept;
+
+template <compression_algorithm_e algorithm>
+size_t huffman_table_t<algorithm>::get_compact_stream_size() const noexcept {
+    if (m_c_huffman_table) {
+        auto c_table = reinterpret_cast<qpl_compression_huffman_table*>(m_c_huffman_table);
+
+        return compression::huffman_table_get_compact_stream_size(*c_table);
+    }
+
+    auto d_table = reinterpret_cast<qpl_decompression_huffman_table*>(m_d_huffman_table);
+
+    return compression::huffman_table_get_compact_stream_size(*d_table);
+}
+
+template
+size_t huffman_table_t<compression_algorithm_e::deflate>::get_compact_stream_size() const noexcept;
+
+template
+size_t huffman_table_t<compression_algorithm_e::huffman_only>::get_compact_stream_size() const noexcept;
+
 template<> template<>
 uint8_t *huffman_table_t<compression_algorithm_e::deflate>::compression_huffman_table<execution_path_t::software>() const noexcept {
     return m_c_huffman_table;
@@ -654,4 +756,65 @@ allocator_t huffman_table_t<compression_algorithm_e::deflate>::get_internal_allo
 template
 allocator_t huffman_table_t<compression_algorithm_e::huffman_only>::get_internal_allocator() noexcept;
 
+template <compression_algorithm_e algorithm>
+huffman_table_t<algorithm>::~huffman_table_t() {
+    release_decoding_tables();
+}
+
+template
+huffman_table_t<compression_algorithm_e::deflate>::~huffman_table_t();
+
+template
+huffman_table_t<compression_algorithm_e::huffman_only>::~huffman_table_t();
+
+template <compression_algorithm_e algorithm>
+void huffman_table_t<algorithm>::release_decoding_tables() noexcept {
+    auto *tables_ptr = m_decoding_tables.exchange(nullptr, std::memory_order_acq_rel);
+
+    if (tables_ptr) {
+        details::get_allocator(m_allocator).deallocator(tables_ptr);
+    }
+}
+
+template
+void huffman_table_t<compression_algorithm_e::deflate>::release_decoding_tables() noexcept;
+
+template
+void huffman_table_t<compression_algorithm_e::huffman_only>::release_decoding_tables() noexcept;
+
+template<>
+const huffman_only_decoding_tables *huffman_table_t<compression_algorithm_e::huffman_only>::get_huffman_only_decoding_tables() noexcept {
+    auto *tables_ptr = m_decoding_tables.load(std::memory_order_acquire);
+
+    if (tables_ptr || !m_d_huffman_table || !m_is_initialized) {
+        return tables_ptr;
+    }
+
+    allocator_t table_allocator = details::get_allocator(m_allocator);
+
+    auto *new_tables_ptr = reinterpret_cast<huffman_only_decoding_tables *>(
+            table_allocator.allocator(sizeof(huffman_only_decoding_tables)));
+
+    if (!new_tables_ptr) {
+        return nullptr;
+    }
+
+    auto d_table = reinterpret_cast<qpl_decompression_huffman_table *>(m_d_huffman_table);
+
+    build_huffman_only_decoding_tables(*reinterpret_cast<qplc_huffman_table_flat_format *>(&d_table->sw_flattened_table),
+                                       *new_tables_ptr);
+
+    // Several threads can build the tables at the same time, the tables of the first one are kept
+    if (!m_decoding_tables.compare_exchange_strong(tables_ptr,
+                                                   new_tables_ptr,
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_acquire)) {
+        table_allocator.deallocator(new_tables_ptr);
+
+        return tables_ptr;
+    }
+
+    return new_tables_ptr;
+}
+
 }
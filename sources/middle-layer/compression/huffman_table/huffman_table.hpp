@@ -10,6 +10,7 @@
  */
 
 #include "memory"
+#include <atomic>
 #include "common/defs.hpp"
 #include "compression/compression_defs.hpp"
 #include "qpl/c_api/statistics.h"
@@ -34,6 +35,8 @@ enum class table_version_e : uint8_t {
 
 constexpr auto LAST_VERSION = table_version_e::v_1_2_0;
 
+struct huffman_only_decoding_tables;
+
 /**
  * @brief meta structure that is holding information about Huffman Table internals and
  * its versioning.
@@ -61,6 +64,8 @@ public:
         , m_allocator({})
     {}
 
+    ~huffman_table_t();
+
     [[nodiscard]] qpl_ml_status create(huffman_table_type_e type, execution_path_t path, allocator_t allocator);
 
     [[nodiscard]] qpl_ml_status init(const qpl_histogram &histogram_ptr) noexcept;
@@ -70,6 +75,13 @@ public:
     [[nodiscard]] qpl_ml_status init_with_stream(const uint8_t *const buffer) noexcept;
     [[nodiscard]] qpl_ml_status write_to_stream(uint8_t *const buffer) const noexcept;
 
+    /**
+     * @brief Compact stream keeps the Deflate header only, the tables are rebuilt from the code lengths stored there
+     */
+    [[nodiscard]] qpl_ml_status init_with_compact_stream(const uint8_t *const buffer) noexcept;
+    [[nodiscard]] qpl_ml_status write_to_compact_stream(uint8_t *const buffer) const noexcept;
+    [[nodiscard]] size_t get_compact_stream_size() const noexcept;
+
     [[nodiscard]] bool is_equal(const huffman_table_t<algorithm> &other) const noexcept;
 
     [[nodiscard]] bool is_initialized() const noexcept;
@@ -113,13 +125,23 @@ public:
 
     [[nodiscard]] allocator_t get_internal_allocator() noexcept;
 
+    /**
+     * @brief Returns the software decoding tables of the Huffman Only table, the first call builds them
+     *
+     * @note The call is thread-safe, nullptr is returned if the tables can't be built
+     */
+    [[nodiscard]] const huffman_only_decoding_tables *get_huffman_only_decoding_tables() noexcept;
+
 private:
+    void release_decoding_tables() noexcept;
+
     huffman_table_meta_t       m_meta{};
     bool                       m_is_initialized{};
     uint8_t *                  m_c_huffman_table{};
     uint8_t *                  m_d_huffman_table{};
     std::unique_ptr<uint8_t[], void(*)(void*)> m_tables_buffer{nullptr, {}};
     allocator_t                m_allocator{};
+    std::atomic<huffman_only_decoding_tables *> m_decoding_tables{nullptr};
 };
 
 }
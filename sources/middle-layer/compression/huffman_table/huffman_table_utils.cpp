@@ -634,6 +634,29 @@ static inline auto init_decompression_table_with_stream(const uint8_t *const buf
     return status_list::ok;
 }
 
+static inline auto init_compression_table_with_compact_stream(const uint8_t *const buffer,
+                                                              qpl_compression_huffman_table &table,
+                                                              compression_huffman_table compression_table) noexcept -> qpl_ml_status {
+    using namespace qpl::ml::serialization;
+
+    // Software table is the source for the other representations, so it is rebuilt in any case
+    auto status = deserialize_table_compact(buffer,
+                                            *compression_table.get_deflate_header(),
+                                            *compression_table.get_sw_compression_table());
+
+    if (status_list::ok != status) {
+        return status;
+    }
+
+    qpl_huffman_table_to_isal(&table, compression_table.get_isal_compression_table(), little_endian);
+
+    // Software table is converted back from ISA-L one to be the same as the table built from the histogram
+    isal_compression_table_to_qpl(compression_table.get_isal_compression_table(),
+                                  compression_table.get_sw_compression_table());
+
+    return status_list::ok;
+}
+
 static inline auto write_compression_table_to_stream(uint8_t *const buffer,
                                                      compression_huffman_table compression_table) noexcept -> qpl_ml_status {
     using namespace qpl::ml::serialization;
@@ -1025,6 +1048,44 @@ auto huffman_table_init_with_stream(qpl_decompression_huffman_table &table,
     return details::init_decompression_table_with_stream(buffer, decompression_table);
 }
 
+template <>
+auto huffman_table_init_with_compact_stream(qpl_compression_huffman_table &table,
+                                            const uint8_t *const buffer,
+                                            const uint32_t representation_flags) noexcept -> qpl_ml_status {
+    using namespace qpl::ml;
+    using namespace qpl::ml::compression;
+
+    auto sw_compression_table_data_ptr   = reinterpret_cast<uint8_t *>(&table.sw_compression_table_data);
+    auto isal_compression_table_data_ptr = reinterpret_cast<uint8_t *>(&table.isal_compression_table_data);
+    auto hw_compression_table_data_ptr   = reinterpret_cast<uint8_t *>(&table.hw_compression_table_data);
+    auto deflate_header_buffer_ptr       = reinterpret_cast<uint8_t *>(&table.deflate_header_buffer);
+
+    compression_huffman_table compression_table(sw_compression_table_data_ptr,
+                                                isal_compression_table_data_ptr,
+                                                hw_compression_table_data_ptr,
+                                                deflate_header_buffer_ptr);
+
+    // Compact format keeps Deflate header only, so it is required
+    if (!(representation_flags & QPL_DEFLATE_REPRESENTATION)) {
+        return status_list::not_supported_err;
+    }
+
+    compression_table.enable_deflate_header();
+    table.representation_mask |= QPL_DEFLATE_REPRESENTATION;
+
+    if (representation_flags & QPL_SW_REPRESENTATION) {
+        compression_table.enable_sw_compression_table();
+        table.representation_mask |= QPL_SW_REPRESENTATION;
+    }
+
+    if (representation_flags & QPL_HW_REPRESENTATION) {
+        compression_table.enable_hw_compression_table();
+        table.representation_mask |= QPL_HW_REPRESENTATION;
+    }
+
+    return details::init_compression_table_with_compact_stream(buffer, table, compression_table);
+}
+
 // --- Convert functions group --- //
 
 template <>
@@ -1205,6 +1266,34 @@ auto huffman_table_write_to_stream(const qpl_decompression_huffman_table &table,
 }
 
 
+template <>
+auto huffman_table_write_to_compact_stream(const qpl_compression_huffman_table &table,
+                                           uint8_t *const buffer) noexcept -> qpl_ml_status {
+    serialization::serialize_table_compact(*reinterpret_cast<const deflate_header *>(&table.deflate_header_buffer),
+                                           buffer);
+
+    return status_list::ok;
+}
+
+template <>
+auto huffman_table_write_to_compact_stream(const qpl_decompression_huffman_table &table,
+                                           uint8_t *const buffer) noexcept -> qpl_ml_status {
+    serialization::serialize_table_compact(*reinterpret_cast<const deflate_header *>(&table.deflate_header_buffer),
+                                           buffer);
+
+    return status_list::ok;
+}
+
+template <>
+auto huffman_table_get_compact_stream_size(const qpl_compression_huffman_table &table) noexcept -> size_t {
+    return serialization::compact_table_size(*reinterpret_cast<const deflate_header *>(&table.deflate_header_buffer));
+}
+
+template <>
+auto huffman_table_get_compact_stream_size(const qpl_decompression_huffman_table &table) noexcept -> size_t {
+    return serialization::compact_table_size(*reinterpret_cast<const deflate_header *>(&table.deflate_header_buffer));
+}
+
 // --- Functions to compare two (de)compression tables --- //
 
 template <>
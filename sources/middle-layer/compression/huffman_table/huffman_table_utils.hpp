@@ -173,6 +173,11 @@ auto huffman_table_init_with_stream(table_t &table,
                                     const uint8_t *const buffer,
                                     const uint32_t representation_flags) noexcept -> qpl_ml_status;
 
+template<class table_t>
+auto huffman_table_init_with_compact_stream(table_t &table,
+                                            const uint8_t *const buffer,
+                                            const uint32_t representation_flags) noexcept -> qpl_ml_status;
+
 template<class first_table_t, class second_table_t>
 auto huffman_table_convert(const first_table_t &first_table,
                            second_table_t &second_table,
@@ -183,6 +188,12 @@ auto huffman_table_write_to_stream(const table_t &table,
                                    uint8_t *const buffer,
                                    const uint32_t representation_flags) noexcept -> qpl_ml_status;
 
+template<class table_t>
+auto huffman_table_write_to_compact_stream(const table_t &table, uint8_t *const buffer) noexcept -> qpl_ml_status;
+
+template<class table_t>
+auto huffman_table_get_compact_stream_size(const table_t &table) noexcept -> size_t;
+
 template<class first_table_t, class second_table_t>
 bool is_equal(first_table_t &first_table, second_table_t &second_table) noexcept;
 
@@ -31,6 +31,7 @@ decompression_huffman_table::decompression_huffman_table(uint8_t *sw_table_ptr,
     hw_decompression_table_ptr = reinterpret_cast<hw_decompression_state *>(aligned_aecs_ptr);
     deflate_header_ptr_ = reinterpret_cast<deflate_header *>(deflate_header_ptr);
     canned_table_ptr_ = reinterpret_cast<canned_table *>(canned_table_ptr);
+    huffman_only_decoding_tables_ptr_ = nullptr;
 
     sw_decompression_table_flag = false;
     hw_decompression_table_flag = false;
@@ -61,10 +62,18 @@ auto decompression_huffman_table::get_canned_table() noexcept -> canned_table *
     return canned_table_ptr_;
 }
 
+auto decompression_huffman_table::get_huffman_only_decoding_tables() noexcept -> const huffman_only_decoding_tables * {
+    return huffman_only_decoding_tables_ptr_;
+}
+
 void decompression_huffman_table::set_deflate_header_bit_size(uint32_t value) noexcept {
     deflate_header_ptr_->header_bit_size = value;
 }
 
+void decompression_huffman_table::set_huffman_only_decoding_tables(const huffman_only_decoding_tables *tables_ptr) noexcept {
+    huffman_only_decoding_tables_ptr_ = tables_ptr;
+}
+
 void decompression_huffman_table::enable_sw_decompression_table() noexcept {
     sw_decompression_table_flag = true;
 }
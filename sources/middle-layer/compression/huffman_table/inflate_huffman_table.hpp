@@ -51,6 +51,8 @@ struct hw_decompression_state {
     uint8_t data[hw_state_data_size];
 };
 
+struct huffman_only_decoding_tables;
+
 class decompression_huffman_table {
 public:
     decompression_huffman_table(uint8_t *sw_table_ptr,
@@ -64,8 +66,10 @@ public:
     auto get_deflate_header_data() noexcept -> uint8_t *;
     auto get_deflate_header_bit_size() noexcept -> uint32_t;
     auto get_canned_table() noexcept -> canned_table *;
+    auto get_huffman_only_decoding_tables() noexcept -> const huffman_only_decoding_tables *;
 
     void set_deflate_header_bit_size(uint32_t value) noexcept;
+    void set_huffman_only_decoding_tables(const huffman_only_decoding_tables *tables_ptr) noexcept;
 
     void enable_sw_decompression_table() noexcept;
     void enable_hw_decompression_table() noexcept;
@@ -76,10 +80,11 @@ public:
     auto is_deflate_header_used() noexcept -> bool;
 
 private:
-    hw_decompression_state         *hw_decompression_table_ptr;
-    qplc_huffman_table_flat_format *sw_decompression_table_ptr;
-    canned_table                   *canned_table_ptr_;
-    deflate_header                 *deflate_header_ptr_;
+    hw_decompression_state             *hw_decompression_table_ptr;
+    qplc_huffman_table_flat_format     *sw_decompression_table_ptr;
+    canned_table                       *canned_table_ptr_;
+    deflate_header                     *deflate_header_ptr_;
+    const huffman_only_decoding_tables *huffman_only_decoding_tables_ptr_;
 
     bool sw_decompression_table_flag;
     bool hw_decompression_table_flag;
@@ -9,10 +9,12 @@
  *  Middle Layer API (private C++ API)
  */
 
+#include <algorithm>
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 #include "compression/huffman_table/serialization_utils.hpp"
+#include "qplc_compression_consts.h"
 
 namespace qpl::ml::serialization {
 using namespace qpl::ml::compression;
@@ -319,4 +321,305 @@ void deserialize_table(const uint8_t * const buffer, canned_table &table) {
     read_impl(&src, &(table.eob_code_and_len));
     read_impl(&src, &(table.is_final_block));
 }
+
+/* Compact format stores only the Deflate header: |header bit size|header bytes|
+   The code lengths are parsed from it and the canonical codes are assigned back,
+   so the tables are the same as the ones built from the histogram
+*/
+
+namespace {
+
+constexpr uint32_t dynamic_block_type          = 2u;
+constexpr uint32_t code_length_codes_count     = 19u;
+constexpr uint32_t code_length_code_max_length = 7u;
+constexpr uint32_t code_max_length             = 15u;
+constexpr uint32_t literals_lengths_base_count = 257u;
+constexpr uint32_t distances_base_count        = 1u;
+constexpr uint32_t code_lengths_count_bits     = 4u;
+constexpr uint32_t code_length_code_bits       = 3u;
+
+constexpr uint8_t code_length_codes_order[code_length_codes_count] = {
+    16u, 17u, 18u, 0u, 8u, 7u, 9u, 6u, 10u, 5u, 11u, 4u, 12u, 3u, 13u, 2u, 14u, 1u, 15u
+};
+
+class header_bit_reader {
+public:
+    header_bit_reader(const uint8_t *data_ptr, uint32_t bit_size) noexcept
+        : m_data_ptr(data_ptr)
+        , m_bit_size(bit_size)
+    {}
+
+    /**
+     * @brief Reads the bits LSB-first, false is returned if the header is over
+     */
+    [[nodiscard]] bool read(uint32_t bits_count, uint32_t &value) noexcept {
+        if (m_bit_position + bits_count > m_bit_size) {
+            return false;
+        }
+
+        value = 0u;
+
+        for (uint32_t i = 0u; i < bits_count; i++, m_bit_position++) {
+            value |= ((m_data_ptr[m_bit_position >> 3u] >> (m_bit_position & 7u)) & 1u) << i;
+        }
+
+        return true;
+    }
+
+private:
+    const uint8_t *m_data_ptr;
+    uint32_t      m_bit_size;
+    uint32_t      m_bit_position = 0u;
+};
+
+inline uint32_t get_header_byte_size(const deflate_header &header) {
+    return (header.header_bit_size + 7u) >> 3u;
+}
+
+/**
+ * @brief Checks that the code lengths don't describe an over-subscribed code
+ */
+bool is_prefix_code(const uint8_t *lengths_ptr, uint32_t count, uint32_t max_length) {
+    uint32_t lengths_count[code_max_length + 1u] = {0u};
+
+    for (uint32_t i = 0u; i < count; i++) {
+        lengths_count[lengths_ptr[i]]++;
+    }
+
+    int32_t codes_left = 1;
+
+    for (uint32_t length = 1u; length <= max_length; length++) {
+        codes_left = (codes_left << 1) - static_cast<int32_t>(lengths_count[length]);
+
+        if (codes_left < 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Assigns canonical codes to the code lengths and stores them in the software table format
+ */
+void assign_canonical_codes(const uint8_t *lengths_ptr, uint32_t count, uint32_t *codes_ptr) {
+    uint32_t lengths_count[code_max_length + 1u] = {0u};
+    uint32_t next_code[code_max_length + 1u]     = {0u};
+
+    for (uint32_t i = 0u; i < count; i++) {
+        lengths_count[lengths_ptr[i]]++;
+    }
+
+    lengths_count[0] = 0u;
+
+    for (uint32_t length = 1u, code = 0u; length <= code_max_length; length++) {
+        code              = (code + lengths_count[length - 1u]) << 1u;
+        next_code[length] = code;
+    }
+
+    for (uint32_t i = 0u; i < count; i++) {
+        const uint32_t length = lengths_ptr[i];
+
+        codes_ptr[i] = (0u == length) ? 0u : (next_code[length]++ | (length << QPLC_HUFFMAN_CODE_BIT_LENGTH));
+    }
+}
+
+bool decode_code_length_symbol(header_bit_reader &reader,
+                                      const uint32_t *lengths_count_ptr,
+                                      const uint8_t *symbols_ptr,
+                                      uint32_t &symbol) {
+    int32_t code  = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+
+    for (uint32_t length = 1u; length <= code_length_code_max_length; length++) {
+        uint32_t bit = 0u;
+
+        if (!reader.read(1u, bit)) {
+            return false;
+        }
+
+        code |= static_cast<int32_t>(bit);
+
+        const auto count = static_cast<int32_t>(lengths_count_ptr[length]);
+
+        if (code - count < first) {
+            symbol = symbols_ptr[index + (code - first)];
+            return true;
+        }
+
+        index += count;
+        first  = (first + count) << 1;
+        code <<= 1;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Parses the header of a dynamic Deflate block into the literals/lengths and distances code lengths
+ */
+bool parse_code_lengths(const deflate_header &header,
+                               uint8_t *literals_lengths_ptr,
+                               uint8_t *distances_ptr) {
+    header_bit_reader reader(header.data, header.header_bit_size);
+
+    uint32_t final_bit  = 0u;
+    uint32_t block_type = 0u;
+    uint32_t hlit       = 0u;
+    uint32_t hdist      = 0u;
+    uint32_t hclen      = 0u;
+
+    if (!reader.read(1u, final_bit) || !reader.read(2u, block_type) || dynamic_block_type != block_type ||
+        !reader.read(5u, hlit) || !reader.read(5u, hdist) || !reader.read(code_lengths_count_bits, hclen)) {
+        return false;
+    }
+
+    hlit  += literals_lengths_base_count;
+    hdist += distances_base_count;
+    hclen += code_lengths_count_bits;
+
+    if (hlit > QPLC_DEFLATE_LL_TABLE_SIZE || hdist > QPLC_DEFLATE_D_TABLE_SIZE) {
+        return false;
+    }
+
+    // Code lengths code
+    uint8_t code_length_lengths[code_length_codes_count] = {0u};
+
+    for (uint32_t i = 0u; i < hclen; i++) {
+        uint32_t length = 0u;
+
+        if (!reader.read(code_length_code_bits, length)) {
+            return false;
+        }
+
+        code_length_lengths[code_length_codes_order[i]] = static_cast<uint8_t>(length);
+    }
+
+    if (!is_prefix_code(code_length_lengths, code_length_codes_count, code_length_code_max_length)) {
+        return false;
+    }
+
+    uint32_t lengths_count[code_length_code_max_length + 1u] = {0u};
+    uint32_t offsets[code_length_code_max_length + 1u]       = {0u};
+    uint8_t  symbols[code_length_codes_count]                = {0u};
+
+    for (auto length : code_length_lengths) {
+        lengths_count[length]++;
+    }
+
+    for (uint32_t length = 1u; length < code_length_code_max_length; length++) {
+        offsets[length + 1u] = offsets[length] + lengths_count[length];
+    }
+
+    for (uint32_t symbol = 0u; symbol < code_length_codes_count; symbol++) {
+        if (0u != code_length_lengths[symbol]) {
+            symbols[offsets[code_length_lengths[symbol]]++] = static_cast<uint8_t>(symbol);
+        }
+    }
+
+    // Run-length encoded code lengths of both alphabets
+    uint8_t  lengths[QPLC_DEFLATE_LL_TABLE_SIZE + QPLC_DEFLATE_D_TABLE_SIZE] = {0u};
+    uint32_t lengths_decoded = 0u;
+
+    while (lengths_decoded < hlit + hdist) {
+        uint32_t symbol = 0u;
+
+        if (!decode_code_length_symbol(reader, lengths_count, symbols, symbol)) {
+            return false;
+        }
+
+        if (symbol < 16u) {
+            lengths[lengths_decoded++] = static_cast<uint8_t>(symbol);
+            continue;
+        }
+
+        uint8_t  repeated_length = 0u;
+        uint32_t repeat_count    = 0u;
+
+        if (16u == symbol) {
+            if (0u == lengths_decoded || !reader.read(2u, repeat_count)) {
+                return false;
+            }
+
+            repeated_length = lengths[lengths_decoded - 1u];
+            repeat_count   += 3u;
+        } else if (17u == symbol) {
+            if (!reader.read(3u, repeat_count)) {
+                return false;
+            }
+
+            repeat_count += 3u;
+        } else {
+            if (!reader.read(7u, repeat_count)) {
+                return false;
+            }
+
+            repeat_count += 11u;
+        }
+
+        if (lengths_decoded + repeat_count > hlit + hdist) {
+            return false;
+        }
+
+        std::fill_n(lengths + lengths_decoded, repeat_count, repeated_length);
+        lengths_decoded += repeat_count;
+    }
+
+    std::copy_n(lengths, hlit, literals_lengths_ptr);
+    std::fill_n(literals_lengths_ptr + hlit, QPLC_DEFLATE_LL_TABLE_SIZE - hlit, 0u);
+    std::copy_n(lengths + hlit, hdist, distances_ptr);
+    std::fill_n(distances_ptr + hdist, QPLC_DEFLATE_D_TABLE_SIZE - hdist, 0u);
+
+    constexpr uint32_t end_of_block_symbol = 256u;
+
+    return 0u != literals_lengths_ptr[end_of_block_symbol] &&
+           is_prefix_code(literals_lengths_ptr, QPLC_DEFLATE_LL_TABLE_SIZE, code_max_length) &&
+           is_prefix_code(distances_ptr, QPLC_DEFLATE_D_TABLE_SIZE, code_max_length);
+}
+
+} // anonymous namespace
+
+size_t compact_table_size(const deflate_header &header) {
+    size_t table_size = 0;
+
+    table_size += sizeof(header.header_bit_size);
+    table_size += get_header_byte_size(header);
+
+    return table_size;
+}
+
+void serialize_table_compact(const deflate_header &header, uint8_t *buffer) {
+    uint8_t *dst = buffer; // adding an offset internally
+
+    write_impl(&dst, &(header.header_bit_size));
+    memcpy(dst, header.data, get_header_byte_size(header));
+}
+
+qpl_ml_status deserialize_table_compact(const uint8_t * const buffer,
+                                        deflate_header &header,
+                                        qplc_huffman_table_default_format &table) {
+    uint8_t *src = const_cast<uint8_t *>(buffer); // adding an offset internally
+
+    read_impl(&src, &(header.header_bit_size));
+
+    if (0u == header.header_bit_size || get_header_byte_size(header) > sizeof(header.data)) {
+        return QPL_STS_SERIALIZATION_CORRUPTED_DUMP;
+    }
+
+    memset(header.data, 0, sizeof(header.data));
+    memcpy(header.data, src, get_header_byte_size(header));
+
+    uint8_t literals_lengths[QPLC_DEFLATE_LL_TABLE_SIZE] = {0u};
+    uint8_t distances[QPLC_DEFLATE_D_TABLE_SIZE]         = {0u};
+
+    if (!parse_code_lengths(header, literals_lengths, distances)) {
+        return QPL_STS_SERIALIZATION_CORRUPTED_DUMP;
+    }
+
+    assign_canonical_codes(literals_lengths, QPLC_DEFLATE_LL_TABLE_SIZE, table.literals_matches);
+    assign_canonical_codes(distances, QPLC_DEFLATE_D_TABLE_SIZE, table.offsets);
+
+    return status_list::ok;
+}
 }
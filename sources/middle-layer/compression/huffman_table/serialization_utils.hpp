@@ -82,6 +82,23 @@ void deserialize_table(const uint8_t * const buffer, inflate_huff_code_large &ta
 void deserialize_table(const uint8_t * const buffer, inflate_huff_code_small &table);
 void deserialize_table(const uint8_t * const buffer, canned_table &table);
 
+// (de)serialization-related functions for the compact format, that stores only the Deflate header
+// (i.e. run-length encoded code lengths), the rest of the tables are rebuilt from it
+
+/**
+ * Bit of the serialized meta flags that marks the compact format,
+ * it is never set in the flags of the table object itself
+ */
+constexpr uint32_t compact_format_flag = 0x80000000u;
+
+[[nodiscard]] size_t compact_table_size(const deflate_header &header);
+
+void serialize_table_compact(const deflate_header &header, uint8_t *buffer);
+
+[[nodiscard]] qpl_ml_status deserialize_table_compact(const uint8_t * const buffer,
+                                                      deflate_header &header,
+                                                      qplc_huffman_table_default_format &table);
+
 }
 
 #endif // QPL_SERIALIZATION_UTILS_HPP_
@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+
+#include "gzip_members.hpp"
+
+#include "compression/inflate/inflate.hpp"
+#include "compression/inflate/inflate_state.hpp"
+#include "compression/stream_decorators/gzip_decorator.hpp"
+
+#include "common/allocation_buffer_t.hpp"
+#include "common/linear_allocator.hpp"
+#include "util/checksum.hpp"
+#include "util/thread_pool.hpp"
+
+namespace qpl::ml::compression {
+
+namespace {
+
+constexpr uint32_t own_gzip_header_min_size = 10u;
+constexpr uint32_t own_gzip_trailer_size    = static_cast<uint32_t>(sizeof(gzip_decorator::gzip_trailer));
+
+struct own_member_t {
+    uint8_t       *deflate_ptr   = nullptr; /**< Deflate stream of the member, without the header and the trailer */
+    uint32_t      deflate_size   = 0u;
+    uint32_t      output_offset  = 0u;
+    uint32_t      output_size    = 0u;      /**< ISIZE from the trailer */
+    uint32_t      crc32          = 0u;      /**< CRC32 from the trailer */
+    uint32_t      xor_checksum   = 0u;
+    qpl_ml_status status         = status_list::ok;
+};
+
+inline auto own_is_member_start(const uint8_t *begin_ptr, const uint8_t *end_ptr) noexcept -> bool {
+    return end_ptr - begin_ptr >= static_cast<ptrdiff_t>(own_gzip_header_min_size + own_gzip_trailer_size) &&
+           0x1fu == begin_ptr[0] &&
+           0x8bu == begin_ptr[1];
+}
+
+/**
+ * @brief Decompresses the deflate stream of one member till the end of its final block
+ *
+ * @param completed_bytes  size of the deflate stream, the trailer of the member follows it
+ */
+auto own_inflate_member(uint8_t *input_ptr,
+                        uint32_t input_size,
+                        uint8_t *output_ptr,
+                        uint32_t output_size,
+                        uint8_t *state_buffer_ptr,
+                        bool is_xor_enabled,
+                        uint32_t &completed_bytes) noexcept -> decompression_operation_result_t {
+    allocation_buffer_t state_buffer(state_buffer_ptr,
+                                     state_buffer_ptr + inflate_state<execution_path_t::software>::get_buffer_size());
+    const util::linear_allocator state_allocator(state_buffer);
+
+    auto state = inflate_state<execution_path_t::software>::create<true>(state_allocator);
+
+    state.input(input_ptr, input_ptr + input_size)
+         .output(output_ptr, output_ptr + output_size)
+         .crc_seed(0u)
+         .output_checksum(output_checksum_t::crc32_gzip)
+         .terminate();
+
+    if (is_xor_enabled) {
+        state.xor_checksum(0u, 0u);
+    }
+
+    auto result = inflate<execution_path_t::software, inflate_mode_t::inflate_default>(state,
+                                                                                      stop_and_check_for_bfinal_eob);
+
+    if (status_list::more_output_needed == result.status_code_ ||
+        (status_list::ok == result.status_code_ && !state.is_stream_end() && 0u == state.get_output_size())) {
+        result.status_code_ = status_list::destination_is_short_error;
+    } else if (status_list::ok == result.status_code_ && !state.is_stream_end()) {
+        result.status_code_ = status_list::input_too_small;
+    }
+
+    completed_bytes = static_cast<uint32_t>(state.get_stream_end_ptr() - input_ptr);
+
+    return result;
+}
+
+/**
+ * @brief Locates the members with the BGZF BSIZE subfield, members_ptr can be nullptr to count them only
+ *
+ * @return number of members, the scan stops at the first member without BSIZE
+ */
+auto own_scan_bgzf_members(uint8_t *source_ptr,
+                           uint32_t source_size,
+                           own_member_t *members_ptr,
+                           uint32_t &scanned_bytes) noexcept -> uint32_t {
+    uint32_t members_count = 0u;
+    uint64_t output_offset = 0u;
+
+    scanned_bytes = 0u;
+
+    while (own_is_member_start(source_ptr + scanned_bytes, source_ptr + source_size)) {
+        auto *const member_ptr     = source_ptr + scanned_bytes;
+        const auto  remaining_size = source_size - scanned_bytes;
+
+        gzip_decorator::gzip_header header{};
+
+        if (status_list::ok != gzip_decorator::read_header(member_ptr, remaining_size, header) ||
+            header.block_size > remaining_size ||
+            header.block_size < header.byte_size + own_gzip_trailer_size) {
+            break;
+        }
+
+        const auto *trailer_ptr = reinterpret_cast<const gzip_decorator::gzip_trailer *>(member_ptr + header.block_size -
+                                                                                         own_gzip_trailer_size);
+
+        if (output_offset + trailer_ptr->input_size > UINT32_MAX) {
+            break;
+        }
+
+        if (members_ptr) {
+            auto &member = members_ptr[members_count];
+
+            member.deflate_ptr   = member_ptr + header.byte_size;
+            member.deflate_size  = header.block_size - header.byte_size - own_gzip_trailer_size;
+            member.output_offset = static_cast<uint32_t>(output_offset);
+            member.output_size   = trailer_ptr->input_size;
+            member.crc32         = trailer_ptr->crc32;
+        }
+
+        output_offset += trailer_ptr->input_size;
+        scanned_bytes += header.block_size;
+        members_count++;
+    }
+
+    return members_count;
+}
+
+/**
+ * @brief Decompresses the members with known input and output positions by the threads of the library pool
+ */
+auto own_inflate_bgzf_members(own_member_t *members_ptr,
+                              uint32_t members_count,
+                              uint8_t *destination_ptr,
+                              bool is_xor_enabled) noexcept -> qpl_ml_status {
+    const uint32_t threads_count = std::min(std::max(1u, std::thread::hardware_concurrency()), members_count);
+    const uint32_t state_size    = inflate_state<execution_path_t::software>::get_buffer_size();
+
+    std::unique_ptr<uint8_t[]> memory_ptr(new (std::nothrow) uint8_t[static_cast<size_t>(threads_count) * state_size]);
+
+    if (!memory_ptr) {
+        return status_list::internal_error;
+    }
+
+    std::atomic<uint32_t> next_member_index{0u};
+
+    auto worker = [&](uint8_t *state_buffer_ptr) noexcept {
+        for (;;) {
+            const uint32_t member_index = next_member_index.fetch_add(1u);
+
+            if (member_index >= members_count) {
+                break;
+            }
+
+            auto     &member         = members_ptr[member_index];
+            uint32_t completed_bytes = 0u;
+
+            auto result = own_inflate_member(member.deflate_ptr,
+                                             member.deflate_size,
+                                             destination_ptr + member.output_offset,
+                                             member.output_size,
+                                             state_buffer_ptr,
+                                             is_xor_enabled,
+                                             completed_bytes);
+
+            if (status_list::ok != result.status_code_) {
+                member.status = result.status_code_;
+            } else if (result.output_bytes_ != member.output_size || result.checksums_.crc32_ != member.crc32) {
+                member.status = status_list::verify_error;
+            }
+
+            member.xor_checksum = result.checksums_.xor_;
+        }
+    };
+
+    // The members left by the workers are decompressed by the calling thread
+    auto task = [&](uint32_t task_index) noexcept {
+        worker(memory_ptr.get() + static_cast<size_t>(task_index) * state_size);
+    };
+
+    util::thread_pool::get_instance().run(threads_count, task);
+
+    return status_list::ok;
+}
+
+}
+
+auto inflate_gzip_members(uint8_t *const source_ptr,
+                          const uint32_t source_size,
+                          uint8_t *const destination_ptr,
+                          const uint32_t destination_size,
+                          const bool is_xor_enabled,
+                          const bool is_parallel) noexcept -> decompression_operation_result_t {
+    decompression_operation_result_t result{};
+
+    uint32_t crc32        = 0u;
+    uint32_t xor_checksum = 0u;
+    uint32_t source_done  = 0u;
+    uint32_t output_done  = 0u;
+
+    if (is_parallel) {
+        uint32_t   scanned_bytes = 0u;
+        const auto members_count = own_scan_bgzf_members(source_ptr, source_size, nullptr, scanned_bytes);
+
+        if (members_count > 0u) {
+            std::unique_ptr<own_member_t[]> members_ptr(new (std::nothrow) own_member_t[members_count]);
+
+            if (!members_ptr) {
+                result.status_code_ = status_list::internal_error;
+
+                return result;
+            }
+
+            own_scan_bgzf_members(source_ptr, source_size, members_ptr.get(), scanned_bytes);
+
+            const auto &last_member = members_ptr[members_count - 1u];
+
+            if (last_member.output_offset + last_member.output_size > destination_size) {
+                result.status_code_ = status_list::destination_is_short_error;
+
+                return result;
+            }
+
+            result.status_code_ = own_inflate_bgzf_members(members_ptr.get(),
+                                                           members_count,
+                                                           destination_ptr,
+                                                           is_xor_enabled);
+
+            // Members are combined in the stream order, so the first failed member gives the status
+            for (uint32_t i = 0u; i < members_count && status_list::ok == result.status_code_; i++) {
+                const auto &member = members_ptr[i];
+
+                result.status_code_ = member.status;
+
+                crc32        = util::crc32_gzip_combine(crc32, member.crc32, member.output_size);
+                xor_checksum = util::xor_checksum_combine(xor_checksum, member.xor_checksum, output_done);
+                output_done += member.output_size;
+            }
+
+            if (status_list::ok != result.status_code_) {
+                return result;
+            }
+
+            source_done = scanned_bytes;
+        }
+    }
+
+    const uint32_t state_size = inflate_state<execution_path_t::software>::get_buffer_size();
+
+    std::unique_ptr<uint8_t[]> state_buffer_ptr;
+
+    // Members without BSIZE are found only by decompressing the previous member
+    while (own_is_member_start(source_ptr + source_done, source_ptr + source_size)) {
+        auto *const member_ptr     = source_ptr + source_done;
+        const auto  remaining_size = source_size - source_done;
+
+        gzip_decorator::gzip_header header{};
+
+        auto status = gzip_decorator::read_header(member_ptr, remaining_size, header);
+
+        if (status_list::ok != status || header.byte_size + own_gzip_trailer_size > remaining_size) {
+            result.status_code_ = (status_list::ok != status) ? status : status_list::input_too_small;
+
+            return result;
+        }
+
+        if (!state_buffer_ptr) {
+            state_buffer_ptr.reset(new (std::nothrow) uint8_t[state_size]);
+
+            if (!state_buffer_ptr) {
+                result.status_code_ = status_list::internal_error;
+
+                return result;
+            }
+        }
+
+        uint32_t completed_bytes = 0u;
+
+        auto member_result = own_inflate_member(member_ptr + header.byte_size,
+                                                remaining_size - header.byte_size - own_gzip_trailer_size,
+                                                destination_ptr + output_done,
+                                                destination_size - output_done,
+                                                state_buffer_ptr.get(),
+                                                is_xor_enabled,
+                                                completed_bytes);
+
+        if (status_list::ok != member_result.status_code_) {
+            result.status_code_ = member_result.status_code_;
+
+            return result;
+        }
+
+        const auto *trailer_ptr = reinterpret_cast<const gzip_decorator::gzip_trailer *>(member_ptr + header.byte_size +
+                                                                                         completed_bytes);
+
+        if (trailer_ptr->crc32 != member_result.checksums_.crc32_ ||
+            trailer_ptr->input_size != member_result.output_bytes_) {
+            result.status_code_ = status_list::verify_error;
+
+            return result;
+        }
+
+        crc32        = util::crc32_gzip_combine(crc32, member_result.checksums_.crc32_, member_result.output_bytes_);
+        xor_checksum = util::xor_checksum_combine(xor_checksum, member_result.checksums_.xor_, output_done);
+        output_done += member_result.output_bytes_;
+        source_done += header.byte_size + completed_bytes + own_gzip_trailer_size;
+    }
+
+    result.status_code_      = status_list::ok;
+    result.completed_bytes_  = source_done;
+    result.output_bytes_     = output_done;
+    result.checksums_.crc32_ = crc32;
+    result.checksums_.xor_   = xor_checksum;
+
+    return result;
+}
+
+} // namespace qpl::ml::compression
@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#ifndef QPL_MIDDLE_LAYER_COMPRESSION_INFLATE_GZIP_MEMBERS_HPP
+#define QPL_MIDDLE_LAYER_COMPRESSION_INFLATE_GZIP_MEMBERS_HPP
+
+#include "common/defs.hpp"
+#include "compression/compression_defs.hpp"
+
+namespace qpl::ml::compression {
+
+/**
+ * @brief Decompresses the gzip members concatenated in the source, the source starts with a member header
+ *
+ * @details Every member is an independent deflate stream with its own trailer, so it is decompressed with a fresh
+ *          inflate state and its CRC32 and size are checked against the trailer. Decompression stops at the end
+ *          of the source or at the first byte that doesn't start a gzip member.
+ *          In the parallel mode the members that have the BGZF BSIZE subfield in the header are located
+ *          by their headers first, their output offsets are taken from the ISIZE fields of the trailers and
+ *          the members are decompressed by several software threads. The members without BSIZE are decompressed
+ *          one by one by the calling thread.
+ *
+ * @return Status is @ref status_list::destination_is_short_error if the output of the members doesn't fit,
+ *         checksums_.crc32_ is CRC32 of the whole output, checksums_.xor_ is its XOR checksum if is_xor_enabled
+ */
+auto inflate_gzip_members(uint8_t *source_ptr,
+                          uint32_t source_size,
+                          uint8_t *destination_ptr,
+                          uint32_t destination_size,
+                          bool is_xor_enabled,
+                          bool is_parallel) noexcept -> decompression_operation_result_t;
+
+} // namespace qpl::ml::compression
+
+#endif // QPL_MIDDLE_LAYER_COMPRESSION_INFLATE_GZIP_MEMBERS_HPP
@@ -63,6 +63,8 @@ auto inflate(inflate_state<path> &decompression_state,
 
     result.completed_bytes_  = static_cast<uint32_t>(inflate_state->next_in - saved_next_in_ptr);
     result.output_bytes_     = static_cast<uint32_t>(inflate_state->next_out - saved_next_out_ptr);
+    result.checksums_.crc32_ = decompression_state.get_crc();
+    result.checksums_.xor_   = decompression_state.get_xor_checksum();
 
     decompression_state.in_progress();
 
@@ -130,7 +132,11 @@ static auto own_inflate(inflate_state<execution_path_t::software> &decompression
         inflate_state_ptr->avail_out = saved_output_available;
     }
 
-    auto flush_status = utility::flush_tmp_out_buffer(*inflate_state_ptr);
+    uint8_t *flush_start_ptr = inflate_state_ptr->next_out;
+    auto    flush_status     = utility::flush_tmp_out_buffer(*inflate_state_ptr);
+
+    decompression_state.update_checksums(flush_start_ptr, inflate_state_ptr->next_out);
+
     /* Prevent overwrite of inflate pass errors by flush_tmp_out_buffer errors */
     if (status_list::ok != flush_status && status_list::ok == result.status_code_) { 
         result.status_code_ = flush_status;
@@ -160,8 +166,13 @@ static auto own_inflate(inflate_state<execution_path_t::software> &decompression
 
         // Main pipeline cycle
         while (do_next_inflate_pass) {
+            uint8_t *pass_start_ptr = inflate_state_ptr->next_out;
+
             result.status_code_ = inflate_pass(*inflate_state_ptr, output_start_ptr);
 
+            // Checksums are taken from the output of each pass while it is still in cache
+            decompression_state.update_checksums(pass_start_ptr, inflate_state_ptr->next_out);
+
             if (status_list::ok != result.status_code_) {
                 break; //todo really break?
             }
@@ -46,6 +46,15 @@ enum end_processing_condition_t : uint8_t {
     check_on_nonlast_block = 8         /**< Stop condition: disabled; Check condition: not last block */
 };
 
+/**
+ * @brief Checksum that the software inflate accumulates over the output while it is still in cache
+ */
+enum class output_checksum_t : uint8_t {
+    none,       /**< Checksum is calculated by the caller if needed */
+    crc32_gzip, /**< CRC32 (gzip) of the output */
+    adler32     /**< Adler32 of the output, kept in the same format as @ref util::adler32 uses */
+};
+
 struct access_properties {
     bool    is_random;
     uint8_t ignore_start_bits;
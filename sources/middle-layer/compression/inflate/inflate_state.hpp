@@ -17,6 +17,7 @@
 #include "compression/multitask/multi_task.hpp"
 #include "compression/utils.hpp"
 #include "dispatcher/hw_dispatcher.hpp"
+#include "util/checksum.hpp"
 
 // core-iaa
 #include "hw_aecs_api.h"
@@ -62,12 +63,24 @@ public:
 
     inline auto crc_seed(uint32_t seed) noexcept -> inflate_state &;
 
+    inline auto output_checksum(output_checksum_t checksum) noexcept -> inflate_state &;
+
+    /**
+     * @brief Enables the XOR checksum of the output, bytes_before is the number of bytes decompressed by previous jobs
+     */
+    inline auto xor_checksum(uint32_t seed, uint32_t bytes_before) noexcept -> inflate_state &;
+
     inline auto terminate() noexcept -> inflate_state &;
 
     inline auto in_progress() noexcept -> inflate_state &;
 
     inline auto flush_out() noexcept -> inflate_state &;
 
+    /**
+     * @brief Accumulates the enabled checksums over the output bytes that have just been written
+     */
+    inline void update_checksums(const uint8_t *begin, const uint8_t *end) noexcept;
+
     [[nodiscard]] inline auto is_first() const noexcept -> bool;
 
     [[nodiscard]] inline auto is_last() const noexcept -> bool;
@@ -82,8 +95,25 @@ public:
 
     [[nodiscard]] inline auto get_output_data() const noexcept -> uint8_t *;
 
+    [[nodiscard]] inline auto get_output_size() const noexcept -> uint32_t;
+
     [[nodiscard]] inline auto get_crc() const noexcept -> uint32_t;
 
+    [[nodiscard]] inline auto get_xor_checksum() const noexcept -> uint32_t;
+
+    [[nodiscard]] inline auto is_xor_checksum_enabled() const noexcept -> bool;
+
+    /**
+     * @brief Checks if the final block of the deflate stream has been decompressed and flushed to the output
+     */
+    [[nodiscard]] inline auto is_stream_end() const noexcept -> bool;
+
+    /**
+     * @brief Returns the first byte after the final block, the whole bytes read ahead into the bit buffer
+     *        are not counted as consumed
+     */
+    [[nodiscard]] inline auto get_stream_end_ptr() const noexcept -> uint8_t *;
+
     [[nodiscard]] inline auto build_state() -> isal_inflate_state *;
 
     [[nodiscard]] inline auto get_state() -> isal_inflate_state *;
@@ -102,6 +132,10 @@ private:
     util::multitask_status processing_step   = util::multitask_status::ready;
     bool                   is_dictionary_set = false;
     qpl_dictionary         *dictionary_ptr   = nullptr;
+    output_checksum_t      output_checksum_  = output_checksum_t::none;
+    bool                   is_xor_enabled_   = false;
+    bool                   is_xor_odd_       = false; /**< Next output byte is the high byte of a 16-bit word */
+    uint32_t               xor_checksum_     = 0u;
 
     explicit inflate_state(const util::linear_allocator &allocator) {
         inflate_state_ = allocator.allocate<isal_inflate_state, util::memory_block_t::not_aligned>(1u);
@@ -364,6 +398,58 @@ inline auto inflate_state<execution_path_t::software>::crc_seed(uint32_t seed) n
     return *this;
 }
 
+inline auto inflate_state<execution_path_t::software>::output_checksum(output_checksum_t checksum) noexcept
+-> inflate_state & {
+    output_checksum_ = checksum;
+
+    return *this;
+}
+
+inline auto inflate_state<execution_path_t::software>::xor_checksum(uint32_t seed,
+                                                                    uint32_t bytes_before) noexcept -> inflate_state & {
+    is_xor_enabled_ = true;
+    is_xor_odd_     = (bytes_before & 1u);
+    xor_checksum_   = seed;
+
+    return *this;
+}
+
+inline void inflate_state<execution_path_t::software>::update_checksums(const uint8_t *begin,
+                                                                        const uint8_t *end) noexcept {
+    if (begin == end) {
+        return;
+    }
+
+    switch (output_checksum_) {
+        case output_checksum_t::crc32_gzip: {
+            inflate_state_->crc = util::crc32_gzip(begin, end, inflate_state_->crc);
+            break;
+        }
+        case output_checksum_t::adler32: {
+            inflate_state_->crc = util::adler32(const_cast<uint8_t *>(begin),
+                                                static_cast<uint32_t>(end - begin),
+                                                inflate_state_->crc);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+
+    if (is_xor_enabled_) {
+        const bool is_odd_size = (end - begin) & 1;
+
+        // The XOR checksum is taken over 16-bit words of the whole output, so the odd byte left by the
+        // previous call is completed here
+        if (is_xor_odd_) {
+            xor_checksum_ ^= static_cast<uint32_t>(*begin++) << byte_bits_size;
+        }
+
+        xor_checksum_ = util::xor_checksum(begin, end, xor_checksum_);
+        is_xor_odd_   = (is_xor_odd_ != is_odd_size);
+    }
+}
+
 inline auto inflate_state<execution_path_t::software>::terminate() noexcept -> inflate_state & {
     processing_step = static_cast<util::multitask_status>(processing_step
                                                           | util::multitask_status::multi_chunk_last_chunk);
@@ -414,10 +500,33 @@ inline auto inflate_state<execution_path_t::software>::flush_out() noexcept -> i
     return inflate_state_->next_out;
 }
 
+[[nodiscard]] inline auto inflate_state<execution_path_t::software>::get_output_size() const noexcept -> uint32_t {
+    return inflate_state_->avail_out;
+}
+
 [[nodiscard]] inline auto inflate_state<execution_path_t::software>::get_crc() const noexcept -> uint32_t {
     return inflate_state_->crc;
 }
 
+[[nodiscard]] inline auto inflate_state<execution_path_t::software>::get_xor_checksum() const noexcept -> uint32_t {
+    return xor_checksum_;
+}
+
+[[nodiscard]] inline auto inflate_state<execution_path_t::software>::is_xor_checksum_enabled() const noexcept -> bool {
+    return is_xor_enabled_;
+}
+
+[[nodiscard]] inline auto inflate_state<execution_path_t::software>::is_stream_end() const noexcept -> bool {
+    return ISAL_BLOCK_FINISH == inflate_state_->block_state;
+}
+
+[[nodiscard]] inline auto inflate_state<execution_path_t::software>::get_stream_end_ptr() const noexcept -> uint8_t * {
+    const auto bits_in_buffer = (inflate_state_->read_in_length > 0) ?
+                                static_cast<uint32_t>(inflate_state_->read_in_length) : 0u;
+
+    return inflate_state_->next_in - bits_in_buffer / byte_bits_size;
+}
+
 [[nodiscard]] inline auto inflate_state<execution_path_t::software>::build_state() -> isal_inflate_state * {
     inflate_state_skip_start_bits(access_properties_.ignore_start_bits,
                                   access_properties_.is_random);
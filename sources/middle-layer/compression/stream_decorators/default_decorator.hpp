@@ -13,6 +13,7 @@
 #define QPL_DEFAULT_DECORATOR_HPP_
 
 #include "compression/compression_defs.hpp"
+#include "compression/inflate/inflate_defs.hpp"
 #include "compression/inflate/isal_kernels_wrappers.hpp"
 #include "util/checksum.hpp"
 
@@ -22,28 +23,18 @@ class default_decorator {
 public:
     template <class F, class state_t, class ...arguments>
     static auto unwrap(F function, state_t &state, arguments... args) noexcept -> decompression_operation_result_t {
-#if defined(__GNUC__) && !defined(__clang__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
-#endif
-        uint8_t *saved_output_ptr = state.get_output_data(); //state.get_output_buffer;
-#if defined(__GNUC__) && !defined(__clang__)
-#pragma GCC diagnostic pop
-#endif
+        if constexpr (execution_path_t::software == state_t::execution_path) {
+            state.output_checksum(output_checksum_t::crc32_gzip);
+        }
+
         auto result = function(state, args...);
 
         if (result.status_code_) {
             return result;
         }
 
-        auto crc = state.get_crc();
-
         // @todo Add both crc32 support
-        if constexpr (execution_path_t::hardware == state_t::execution_path) {
-            crc = result.checksums_.crc32_;
-        } else {
-            crc = util::crc32_gzip(saved_output_ptr, saved_output_ptr + result.output_bytes_, crc);
-        }
+        auto crc = result.checksums_.crc32_;
 
         state.crc_seed(crc);
         result.checksums_.crc32_ = crc;
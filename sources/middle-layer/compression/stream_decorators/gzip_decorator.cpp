@@ -10,6 +10,7 @@
 
 #include "gzip_decorator.hpp"
 
+#include "compression/inflate/gzip_members.hpp"
 #include "compression/inflate/inflate.hpp"
 #include "compression/inflate/inflate_state.hpp"
 
@@ -53,24 +54,53 @@ std::array<uint8_t, gzip_sizes::gzip_header_size> default_gzip_header = {0x1f, 0
                                                                          0x00, 0x00,
                                                                          0x00, 0xff};
 
+namespace bgzf_fields {
+constexpr uint8_t  SI1_VALUE            = 66u; // 'B'
+constexpr uint8_t  SI2_VALUE            = 67u; // 'C'
+constexpr uint16_t SLEN_VALUE           = 2u;
+constexpr uint32_t SUBFIELD_HEADER_SIZE = 4u;
+}
+
+// Moves the pointer past the terminating zero of the string
 static inline auto seek_until_zero(const uint8_t **begin_ptr, const uint8_t *end_ptr) noexcept -> qpl_ml_status {
     auto current_ptr = begin_ptr;
 
     do {
         if (*current_ptr == end_ptr) {
             return status_list::input_too_small;
-        } else {
-            (*current_ptr)++;
         }
-    } while ((**current_ptr) != 0u);
+    } while (*((*current_ptr)++) != 0u);
 
     return status_list::ok;
 }
 
+// Returns the size of the whole member from the BGZF "BC" subfield (BSIZE + 1), 0 if there is no such subfield
+static inline auto read_bgzf_block_size(const uint8_t *extra_ptr, const uint8_t *extra_end_ptr) noexcept -> uint32_t {
+    while (extra_ptr + bgzf_fields::SUBFIELD_HEADER_SIZE <= extra_end_ptr) {
+        const uint16_t subfield_length = *(reinterpret_cast<const uint16_t *>(extra_ptr + 2));
+        const uint8_t  *data_ptr       = extra_ptr + bgzf_fields::SUBFIELD_HEADER_SIZE;
+
+        if (data_ptr + subfield_length > extra_end_ptr) {
+            break;
+        }
+
+        if (bgzf_fields::SI1_VALUE == extra_ptr[0] &&
+            bgzf_fields::SI2_VALUE == extra_ptr[1] &&
+            bgzf_fields::SLEN_VALUE == subfield_length) {
+            return static_cast<uint32_t>(*(reinterpret_cast<const uint16_t *>(data_ptr))) + 1u;
+        }
+
+        extra_ptr = data_ptr + subfield_length;
+    }
+
+    return 0u;
+}
+
 static inline bool parse_gzip_flags(const uint8_t *begin_ptr,
                                     const uint8_t *end_ptr,
                                     uint8_t flags,
-                                    uint32_t &size) noexcept {
+                                    uint32_t &size,
+                                    uint32_t &block_size) noexcept {
     const uint8_t *current_stream_ptr = begin_ptr;
 
     if (flags & gzip_flags::reserverd_bits) {
@@ -89,6 +119,8 @@ static inline bool parse_gzip_flags(const uint8_t *begin_ptr,
             return status_list::input_too_small;
         }
 
+        block_size = read_bgzf_block_size(current_stream_ptr, current_stream_ptr + extra_length);
+
         current_stream_ptr += extra_length;
     }
 
@@ -158,11 +190,12 @@ auto gzip_decorator::read_header(const uint8_t *stream_ptr,
     header.modification_time  = modification_time;
     header.os                 = os;
 
-    header.flags = flags;
+    header.flags      = flags;
+    header.block_size = 0u;
 
     uint32_t gzip_extra_bytes = 0u;
 
-    auto status = parse_gzip_flags(current_stream_ptr, stream_end_ptr, flags, gzip_extra_bytes);
+    auto status = parse_gzip_flags(current_stream_ptr, stream_end_ptr, flags, gzip_extra_bytes, header.block_size);
 
     if (status) {
         return status;
@@ -177,7 +210,7 @@ auto gzip_decorator::read_header(const uint8_t *stream_ptr,
 
 template <class F, class state_t, class ...arguments>
 auto gzip_decorator::unwrap(F function, state_t &state, arguments... args) noexcept -> decompression_operation_result_t {
-    uint8_t* saved_output_ptr  = state.get_output_data(); //state.get_output_buffer;
+    uint8_t  *origin_input_ptr  = state.get_input_data();
     uint32_t origin_input_size = state.get_input_size();
     uint32_t wrapper_bytes     = 0;
 
@@ -205,18 +238,65 @@ auto gzip_decorator::unwrap(F function, state_t &state, arguments... args) noexc
         wrapper_bytes += sizeof(gzip_trailer);
     }
 
+    if constexpr (state_t::execution_path == execution_path_t::software) {
+        state.output_checksum(output_checksum_t::crc32_gzip);
+    }
+
     result = function(state, args...);
 
     if (result.status_code_) {
         return result;
     }
 
-    auto crc = state.get_crc();
+    // Both paths return CRC32 of the output, the software inflate accumulates it block by block
+    auto crc = result.checksums_.crc32_;
 
-    if constexpr (state_t::execution_path == execution_path_t::hardware) {
-        crc = result.checksums_.crc32_;
-    } else {
-        crc = util::crc32_gzip(saved_output_ptr, saved_output_ptr + result.output_bytes_, crc);
+    if constexpr (state_t::execution_path == execution_path_t::software) {
+        // A single job decompresses the members concatenated after the first one (e.g. pigz, BGZF)
+        if (state.is_first() && state.is_last() && state.is_stream_end()) {
+            auto *const member_end_ptr  = state.get_stream_end_ptr();
+            auto *const stream_end_ptr  = origin_input_ptr + origin_input_size;
+            auto *const next_member_ptr = member_end_ptr + sizeof(gzip_trailer);
+
+            if (stream_end_ptr - next_member_ptr >= static_cast<ptrdiff_t>(gzip_fields::GZIP_HEADER_MIN_BYTE_SIZE) &&
+                gzip_fields::ID1_RFC_VALUE == next_member_ptr[0] &&
+                gzip_fields::ID2_RFC_VALUE == next_member_ptr[1]) {
+                auto trailer = reinterpret_cast<gzip_trailer *>(member_end_ptr);
+
+                if (trailer->crc32 != crc || trailer->input_size != result.output_bytes_) {
+                    result.status_code_ = qpl::ml::status_list::verify_error;
+
+                    return result;
+                }
+
+                auto members_result = inflate_gzip_members(next_member_ptr,
+                                                           static_cast<uint32_t>(stream_end_ptr - next_member_ptr),
+                                                           state.get_output_data(),
+                                                           state.get_output_size(),
+                                                           state.is_xor_checksum_enabled(),
+                                                           false);
+
+                if (members_result.status_code_) {
+                    result.status_code_ = members_result.status_code_;
+
+                    return result;
+                }
+
+                crc = util::crc32_gzip_combine(crc, members_result.checksums_.crc32_, members_result.output_bytes_);
+
+                result.checksums_.xor_ = util::xor_checksum_combine(result.checksums_.xor_,
+                                                                    members_result.checksums_.xor_,
+                                                                    result.output_bytes_);
+                result.checksums_.crc32_ = crc;
+                result.output_bytes_    += members_result.output_bytes_;
+                result.completed_bytes_  = static_cast<uint32_t>(next_member_ptr - origin_input_ptr) +
+                                           members_result.completed_bytes_;
+
+                state.crc_seed(crc);
+
+                return result;
+            }
+        }
     }
 
     if (state.is_last() && origin_input_size - result.completed_bytes_ < sizeof(gzip_trailer)) {
@@ -47,6 +47,7 @@ public:
         uint8_t os;
         uint16_t crc16;
         uint32_t byte_size;
+        uint32_t block_size; /**< Size of the whole member from the BGZF BSIZE subfield, 0 if it is absent */
     };
 
     struct gzip_trailer {
@@ -96,6 +96,18 @@ auto zlib_decorator::read_header(const uint8_t *stream_ptr,
     return status_list::ok;
 }
 
+void zlib_decorator::write_header_unsafe(uint8_t *const destination_ptr) noexcept {
+    core_sw::util::copy(default_zlib_header.data(), default_zlib_header.data() + zlib_sizes::zlib_header_size, destination_ptr);
+}
+
+void zlib_decorator::write_trailer_unsafe(uint8_t *const destination_ptr, const uint32_t adler32) noexcept {
+    uint32_t zlib_trailer = swap_bytes(adler32);
+
+    auto data_ptr = reinterpret_cast<uint8_t *>(&zlib_trailer);
+
+    core_sw::util::copy(data_ptr, data_ptr + zlib_sizes::zlib_trailer_size, destination_ptr);
+}
+
 static inline auto own_write_header(uint8_t *const destination_ptr, const uint32_t size) noexcept -> wrapper_result_t {
     wrapper_result_t result{};
 
@@ -179,13 +191,21 @@ auto zlib_decorator::unwrap(F function, state_t &state, arguments... args) noexc
         wrapper_bytes = header.byte_size;
     }
 
+    if constexpr (state_t::execution_path == execution_path_t::software) {
+        state.output_checksum(output_checksum_t::adler32);
+    }
+
     result = function(state, args...);
 
     if (result.status_code_) {
         return result;
     }
 
-    adler_value = util::adler32(saved_output_ptr, result.output_bytes_, adler_value);
+    if constexpr (state_t::execution_path == execution_path_t::software) {
+        adler_value = state.get_crc();
+    } else {
+        adler_value = util::adler32(saved_output_ptr, result.output_bytes_, adler_value);
+    }
 
     state.crc_seed(adler_value);
     result.checksums_.crc32_ = adler_value;
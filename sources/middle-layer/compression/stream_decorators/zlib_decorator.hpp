@@ -21,6 +21,9 @@
 
 namespace qpl::ml::compression {
 
+constexpr uint32_t OWN_ZLIB_HEADER_LENGTH  = 2u;
+constexpr uint32_t OWN_ZLIB_TRAILER_LENGTH = 4u;
+
 class zlib_decorator {
 public:
     template <class F, class state_t, class ...arguments>
@@ -39,6 +42,13 @@ public:
     };
 
     static auto read_header(const uint8_t *stream_ptr, uint32_t stream_size, zlib_header &header) noexcept -> qpl_ml_status;
+
+    static void write_header_unsafe(uint8_t *destination_ptr) noexcept;
+
+    /**
+     * @brief Writes Adler32 in the zlib format, i.e. the checksum of an empty stream is 1
+     */
+    static void write_trailer_unsafe(uint8_t *destination_ptr, uint32_t adler32) noexcept;
 };
 
 }
@@ -17,6 +17,11 @@
 #include "compression/utils.hpp"
 
 namespace qpl::ml::compression {
+/**
+ * Size of the history kept by the software verification: the largest deflate window
+ */
+constexpr uint32_t verification_history_size = 32_kb;
+
 template <execution_path_t path>
 class verify_state;
 
@@ -47,6 +52,8 @@ public:
 
     inline auto reset_miniblock_state() noexcept -> verify_state &;
 
+    inline auto keep_history(uint32_t history_size) noexcept -> verify_state &;
+
     inline auto reset_state() noexcept -> verify_state &;
 
     [[nodiscard]] inline auto is_first() const noexcept -> bool;
@@ -66,7 +73,7 @@ public:
     [[nodiscard]] constexpr static inline auto get_buffer_size() noexcept -> uint32_t {
         size_t size = 0;
         size += sizeof(state_buffer);
-        size += sizeof(uint8_t)*32_kb;
+        size += sizeof(uint8_t)*2u*verification_history_size;
 
         return static_cast<uint32_t>(util::align_size(size, 1_kb));
     }
@@ -78,8 +85,10 @@ private:
 
     explicit verify_state(const qpl::ml::util::linear_allocator &allocator) {
         verify_state_ptr = allocator.allocate<state_buffer, qpl::ml::util::memory_block_t::not_aligned>(1u);
-        verify_state_ptr->decompression_buffer_ptr  = allocator.allocate<uint8_t, util::memory_block_t::not_aligned>(32_kb);
-        verify_state_ptr->decompression_buffer_size = 32_kb;
+        // The kept history takes a half of the buffer at most, the rest is for the output of the next decoding
+        verify_state_ptr->decompression_buffer_ptr  = allocator.allocate<uint8_t, util::memory_block_t::not_aligned>(
+                2u * verification_history_size);
+        verify_state_ptr->decompression_buffer_size = 2u * verification_history_size;
     };
 
     struct state_buffer {
@@ -170,6 +179,24 @@ inline auto verify_state<execution_path_t::software>::reset_miniblock_state() no
     return *this;
 }
 
+inline auto verify_state<execution_path_t::software>::keep_history(uint32_t history_size) noexcept -> verify_state & {
+    auto *const buffer_ptr   = verify_state_ptr->decompression_buffer_ptr;
+    const auto  written_size = static_cast<uint32_t>(verify_state_ptr->state_ptr.next_out - buffer_ptr);
+
+    history_size = std::min(history_size, written_size);
+
+    // The next block can refer to the end of the previous one, so it is moved to the beginning of the buffer
+    core_sw::util::move(verify_state_ptr->state_ptr.next_out - history_size,
+                        verify_state_ptr->state_ptr.next_out,
+                        buffer_ptr);
+
+    verify_state_ptr->state_ptr.next_out  = buffer_ptr + history_size;
+    verify_state_ptr->state_ptr.avail_out = verify_state_ptr->decompression_buffer_size - history_size;
+    verify_state_ptr->state_ptr.total_out = 0;
+
+    return *this;
+}
+
 inline auto verify_state<execution_path_t::software>::reset_state() noexcept -> verify_state & {
     reset_inflate_state(&verify_state_ptr->state_ptr);
 
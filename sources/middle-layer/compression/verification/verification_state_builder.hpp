@@ -31,6 +31,7 @@ public:
         auto builder = verification_state_builder<execution_path_t::software>(allocator);
         builder.state_.first(true);
         builder.state_.reset();
+        builder.state_.set_parser_position(parser_position_t::verify_header);
         builder.state_.crc_seed(0);
         builder.state_.reset_state();
         builder.state_.reset_miniblock_state();
@@ -44,7 +44,9 @@ auto verify_deflate_header(verify_state<execution_path_t::software> &state) noex
 
             parser_status = parser_status_t::need_more_input;
         } else if (ISAL_BLOCK_TYPE0 == inflate_state.block_state &&
-                   0u == inflate_state.type0_block_len) {
+                   0u == inflate_state.type0_block_len &&
+                   1u == inflate_state.bfinal) {
+            // Only non-final stored blocks can be empty, they byte-align the chunks of the parallel compression
             parser_status = parser_status_t::error;
         } else {
             parser_status = parser_status_t::ok;
@@ -74,9 +76,20 @@ auto verify_deflate_stream_body(verify_state<execution_path_t::software> &state)
     }
 
     if (inflate_state.copy_overflow_length != 0) {
-        // The match didn't fit into the output, mini block is overflowed
-        result.status = parser_status_t::error;
-        return result;
+        // The match didn't fit into the full buffer, its rest is copied after the kept history (may overlap)
+        const auto  copy_size       = static_cast<uint32_t>(inflate_state.copy_overflow_length);
+        const auto *copy_source_ptr = inflate_state.next_out - inflate_state.copy_overflow_distance;
+
+        for (uint32_t i = 0u; i < copy_size; i++) {
+            inflate_state.next_out[i] = copy_source_ptr[i];
+        }
+
+        inflate_state.next_out  += copy_size;
+        inflate_state.total_out += copy_size;
+        inflate_state.avail_out -= copy_size;
+
+        inflate_state.copy_overflow_length   = 0;
+        inflate_state.copy_overflow_distance = 0;
     }
 
     if (inflate_state.avail_in == 0u &&
@@ -122,6 +135,9 @@ auto verify_deflate_stream_body(verify_state<execution_path_t::software> &state)
         if (inflate_state.total_out > 0) {
             // EOB symbol could be the first symbol of the compressed stream, so there won't be any actual output
             result.crc_value = util::crc32_gzip(initial_next_out_ptr, initial_next_out_ptr + bytes_written_during_current_iteration, inflate_state.crc);
+        } else {
+            // The block is empty, e.g. a byte-aligning stored block, the checksum of the previous blocks is kept
+            result.crc_value = inflate_state.crc;
         }
 
         result.status = parser_status_t::end_of_block;
@@ -130,6 +146,8 @@ auto verify_deflate_stream_body(verify_state<execution_path_t::software> &state)
         // bfinal EOB symbol was met
         if (inflate_state.total_out > 0) {
             result.crc_value = util::crc32_gzip(initial_next_out_ptr, initial_next_out_ptr + bytes_written_during_current_iteration, inflate_state.crc);
+        } else {
+            result.crc_value = inflate_state.crc;
         }
 
         result.status = parser_status_t::final_end_of_block;
@@ -22,7 +22,8 @@ auto perform_verification<execution_path_t::software, verification_mode_t::verif
 
         switch (verification_result.status) {
             case parser_status_t::end_of_mini_block:
-                state.reset_miniblock_state();
+                // The decompression buffer is full, the next symbols can still refer to its end
+                state.keep_history(verification_history_size);
                 break;
             case parser_status_t::end_of_block:
             case parser_status_t::final_end_of_block:
@@ -71,11 +72,12 @@ auto perform_verification<execution_path_t::software, verification_mode_t::verif
 
             switch (verification_result.status) {
             case parser_status_t::end_of_block:
-                state.reset_miniblock_state();
+                state.keep_history(verification_history_size);
                 state.set_parser_position(parser_position_t::verify_header);
                 break;
             case parser_status_t::end_of_mini_block:
-                state.reset_miniblock_state();
+                // The decompression buffer is full, the next symbols can still refer to its end
+                state.keep_history(verification_history_size);
                 break;
             case parser_status_t::final_end_of_block:
                 state.reset_miniblock_state();
@@ -12,6 +12,7 @@
 
 #include "hw_device.hpp"
 #include "hw_descriptors_api.h"
+#include "hw_emulator.hpp"
 
 #ifdef DYNAMIC_LOADING_LIBACCEL_CONFIG
 #include "hw_configuration_driver.h"
@@ -210,6 +211,32 @@ auto hw_device::initialize_new_device(descriptor_t *device_descriptor_ptr) noexc
     return HW_ACCELERATOR_STATUS_OK;
 }
 
+#if defined( QPL_HW_EMULATOR )
+
+auto hw_device::initialize_emulated_device() noexcept -> hw_accelerator_status {
+    // The model failed to start its workers, the descriptors submitted to it would never complete
+    if (!hw_emulator::get_instance().is_available()) {
+        return HW_ACCELERATOR_SUPPORT_ERR;
+    }
+
+    // Generation 1 device: 1 GB transfers, 15-bit sets, no NUMA affinity and no cache control
+    version_major_    = 1u;
+    version_minor_    = 0u;
+    gen_cap_register_ = (30ull << 16u) | (14ull << 42u) | (14ull << 47u);
+    iaa_cap_register_ = 0u;
+    numa_node_id_     = static_cast<uint64_t>(-1);
+
+    // The only queue forwards the descriptors to the software model
+    queue_count_ = 1u;
+
+    DIAG("emulated device: GENCAP: maximum supported transfer size: %" PRIu32 "\n", get_max_transfer_size());
+    DIAG("emulated device: GENCAP: maximum set size:                %d\n", get_max_set_size());
+
+    return HW_ACCELERATOR_STATUS_OK;
+}
+
+#endif
+
 auto hw_device::size() const noexcept -> size_t {
     return queue_count_;
 }
@@ -37,6 +37,10 @@ public:
 
     [[nodiscard]] auto initialize_new_device(descriptor_t *device_descriptor_ptr) noexcept -> hw_accelerator_status;
 
+#if defined( QPL_HW_EMULATOR )
+    [[nodiscard]] auto initialize_emulated_device() noexcept -> hw_accelerator_status;
+#endif
+
     [[nodiscard]] auto size() const noexcept -> size_t;
 
     [[nodiscard]] auto numa_id() const noexcept -> uint64_t;
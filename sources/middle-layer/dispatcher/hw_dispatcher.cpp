@@ -26,7 +26,17 @@ hw_dispatcher::hw_dispatcher() noexcept {
 }
 
 auto hw_dispatcher::initialize_hw() noexcept -> hw_accelerator_status {
-#if defined( __linux__ )
+#if defined( __linux__ ) && defined( QPL_HW_EMULATOR )
+    DIAG("Intel QPL version %s\n", QPL_VERSION);
+
+    // The software model replaces the devices, libaccel-config is not used
+    auto status = devices_[0].initialize_emulated_device();
+    QPL_HWSTS_RET(status != HW_ACCELERATOR_STATUS_OK, status);
+
+    device_count_ = 1u;
+
+    return HW_ACCELERATOR_STATUS_OK;
+#elif defined( __linux__ )
     accfg_ctx *ctx_ptr = nullptr;
 
     DIAG("Intel QPL version %s\n", QPL_VERSION);
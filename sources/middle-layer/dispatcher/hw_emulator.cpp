@@ -0,0 +1,404 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#if defined( QPL_HW_EMULATOR )
+
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <new>
+
+#include "hw_emulator.hpp"
+#include "hw_devices.h"
+#include "hw_status.h"
+#include "hw_aecs_api.h"
+#include "hw_completion_record_api.h"
+#include "hw_iaa_flags.h"
+#include "own_hw_definitions.h"
+
+#include "analytics/scan.hpp"
+#include "analytics/extract.hpp"
+#include "analytics/select.hpp"
+#include "analytics/expand.hpp"
+#include "other/crc.hpp"
+#include "util/util.hpp"
+
+namespace qpl::ml::dispatcher {
+
+namespace {
+
+constexpr uint32_t default_workers_count = 8u;     /**< Number of engines of the device */
+constexpr uint32_t default_queue_depth   = 128u;   /**< Maximal size of the shared work queue */
+
+/**
+ * Sizes of the intermediate buffers of the filter operations, the same as the job ones,
+ * the software kernels process the input by the chunks of the aligned buffer size
+ */
+constexpr uint32_t max_unpacked_elements = 4096u;
+constexpr auto     unpack_buffer_size    = util::align_size((max_unpacked_elements + 1u) * sizeof(uint32_t));
+constexpr auto     set_buffer_size       = util::align_size(1u << limits::max_set_size);
+constexpr auto     src2_buffer_size      = util::align_size(max_unpacked_elements * sizeof(uint32_t));
+
+/**
+ * @brief Layout of the CRC64 descriptor, the same as the one in hw_crc64_descriptor.c
+ */
+HW_PATH_BYTE_PACKED_STRUCTURE_BEGIN {
+    uint32_t trusted_fields;
+    uint32_t op_code_op_flags;
+    uint8_t  *completion_record_ptr;
+    uint8_t  *source_ptr;
+    uint8_t  reserved_1[8];
+    uint32_t calculated_bytes;
+    uint16_t interruption_handle;
+    uint16_t crc_flags;
+    uint8_t  reserved_2[16];
+    uint64_t polynomial;
+} own_crc64_descriptor;
+HW_PATH_BYTE_PACKED_STRUCTURE_END
+
+static_assert(sizeof(own_crc64_descriptor) == HW_PATH_DESCRIPTOR_SIZE, "Descriptor size is not correct");
+
+/**
+ * @brief Intermediate buffers of one worker
+ */
+struct own_buffers_t {
+    uint8_t unpack[unpack_buffer_size];
+    uint8_t set[set_buffer_size];
+    uint8_t src2[src2_buffer_size];
+};
+
+auto own_read_variable(const char *name, uint32_t default_value, uint32_t max_value) noexcept -> uint32_t {
+    const char *value_ptr = std::getenv(name);
+
+    if (nullptr == value_ptr || '\0' == *value_ptr) {
+        return default_value;
+    }
+
+    char *end_ptr = nullptr;
+    auto value    = std::strtoul(value_ptr, &end_ptr, 10);
+
+    return ('\0' == *end_ptr) ? static_cast<uint32_t>(std::min<unsigned long>(value, max_value)) : default_value;
+}
+
+/**
+ * @brief Status of the software kernel is turned back to the completion record fields,
+ *        so the hardware path converts it to the same qpl_status
+ */
+void own_complete(HW_PATH_VOLATILE hw_iaa_completion_record *record_ptr, uint32_t status) noexcept {
+    hw_operation_status completion_status = AD_STATUS_SUCCESS;
+    hw_operation_error  error_code        = AD_ERROR_CODE_OK;
+
+    if (status_list::ok != status) {
+        if (status >= status_list::hardware_error_base && status < status_list::hardware_status_base) {
+            completion_status = AD_STATUS_ANALYTICS_ERROR;
+            error_code        = static_cast<hw_operation_error>(status - status_list::hardware_error_base);
+        } else if (status > status_list::hardware_status_base && status <= status_list::hardware_status_base + 0xFFu) {
+            completion_status = static_cast<hw_operation_status>(status - status_list::hardware_status_base);
+        } else {
+            completion_status = AD_STATUS_INVALID_FILTER_FLAG;
+        }
+    }
+
+    record_ptr->error_code = error_code;
+
+    // The caller polls the status byte, all other fields must be visible before it changes
+    std::atomic_thread_fence(std::memory_order_release);
+    record_ptr->status = completion_status;
+}
+
+void own_execute_crc64(const own_crc64_descriptor &descriptor,
+                       HW_PATH_VOLATILE hw_iaa_completion_record *record_ptr) noexcept {
+    auto result = other::call_crc<execution_path_t::software>(descriptor.source_ptr,
+                                                              descriptor.calculated_bytes,
+                                                              descriptor.polynomial,
+                                                              descriptor.crc_flags & ADC64F_BE,
+                                                              descriptor.crc_flags & ADC64F_INVCRC);
+
+    record_ptr->bytes_completed = descriptor.calculated_bytes;
+    record_ptr->sum_agg         = static_cast<uint32_t>(result.crc_ >> 32u);
+    record_ptr->max_last_agg    = static_cast<uint32_t>(result.crc_);
+
+    own_complete(record_ptr, result.status_code_);
+}
+
+void own_execute_filter(const hw_iaa_analytics_descriptor &descriptor,
+                        own_buffers_t &buffers,
+                        HW_PATH_VOLATILE hw_iaa_completion_record *record_ptr) noexcept {
+    using namespace qpl::ml::analytics;
+
+    const uint32_t opcode       = ADOF_GET_OPCODE(descriptor.op_code_op_flags);
+    const uint32_t filter_flags = descriptor.filter_flags;
+    const bool     is_inverted  = filter_flags & hw_iaa_output_modifier_inverse;
+
+    // Decompression and output inversion of the array outputs are not modeled
+    if ((descriptor.decomp_flags & ADDF_ENABLE_DECOMP) || (is_inverted && QPL_OPCODE_SCAN != opcode)) {
+        own_complete(record_ptr, status_list::hardware_status_base + AD_STATUS_UNSUPPORTED_OPCODE);
+        return;
+    }
+
+    if (0u == descriptor.src1_size) {
+        own_complete(record_ptr, status_list::hardware_status_base + AD_STATUS_TRANSFER_SIZE_INVALID);
+        return;
+    }
+
+    const auto input_format  = static_cast<stream_format_t>(filter_flags & 3u);
+    const auto output_format = (filter_flags & hw_iaa_output_modifier_big_endian) ? stream_format_t::be_format
+                                                                                  : stream_format_t::le_format;
+    const auto mask_format   = (filter_flags & (1u << 12u)) ? stream_format_t::be_format
+                                                            : stream_format_t::le_format;
+    const auto out_bit_width = static_cast<output_bit_width_format_t>((filter_flags >> 13u) & 3u);
+    const auto crc_type      = (descriptor.op_code_op_flags & ADOF_CRC32C) ? input_stream_t::crc_t::iscsi
+                                                                           : input_stream_t::crc_t::gzip;
+
+    // Scan and extract read their parameters from the AECS
+    const uint32_t aecs_offset = (descriptor.op_code_op_flags & ADOF_AECS_SEL) ? descriptor.src2_size : 0u;
+    const auto     *aecs_ptr   = reinterpret_cast<const hw_iaa_aecs_analytic *>(descriptor.src2_ptr + aecs_offset);
+
+    auto input_stream = input_stream_t::builder(descriptor.src1_ptr, descriptor.src1_ptr + descriptor.src1_size)
+            .element_count(descriptor.num_input_elements)
+            .crc_type(crc_type)
+            .stream_format(input_format, ((filter_flags >> 2u) & 0x1Fu) + 1u)
+            .build<execution_path_t::software>();
+
+    uint8_t *const destination_begin = descriptor.dst_ptr;
+    uint8_t *const destination_end   = descriptor.dst_ptr + descriptor.max_dst_size;
+
+    limited_buffer_t unpack_buffer(std::begin(buffers.unpack), std::end(buffers.unpack), input_stream.bit_width());
+
+    analytic_operation_result_t result{};
+
+    switch (opcode) {
+        case QPL_OPCODE_SCAN: {
+            auto output_stream = output_stream_t<bit_stream>::builder(destination_begin, destination_end)
+                    .stream_format(output_format)
+                    .bit_format(out_bit_width, bit_bits_size)
+                    .nominal(true)
+                    .initial_output_index(aecs_ptr->filtering_options.output_mod_idx)
+                    .build<execution_path_t::software>();
+
+            const uint32_t low  = aecs_ptr->filtering_options.filter_low;
+            const uint32_t high = aecs_ptr->filtering_options.filter_high;
+
+            // The device always scans the range, the other comparators invert its output
+            result = (is_inverted)
+                     ? call_scan_sw<out_of_range>(input_stream, output_stream, low, high, unpack_buffer)
+                     : call_scan_sw<in_range>(input_stream, output_stream, low, high, unpack_buffer);
+            break;
+        }
+        case QPL_OPCODE_EXTRACT: {
+            auto output_stream = output_stream_t<array_stream>::builder(destination_begin, destination_end)
+                    .stream_format(output_format)
+                    .bit_format(out_bit_width, input_stream.bit_width())
+                    .nominal(input_stream.bit_width() == bit_bits_size)
+                    .initial_output_index(aecs_ptr->filtering_options.output_mod_idx)
+                    .build<execution_path_t::software>();
+
+            result = call_extract<execution_path_t::software>(input_stream,
+                                                              output_stream,
+                                                              aecs_ptr->filtering_options.filter_low,
+                                                              aecs_ptr->filtering_options.filter_high,
+                                                              unpack_buffer);
+            break;
+        }
+        case QPL_OPCODE_SELECT:
+        case QPL_OPCODE_EXPAND: {
+            const uint32_t mask_elements = (QPL_OPCODE_SELECT == opcode)
+                                           ? descriptor.num_input_elements
+                                           : descriptor.src2_size * byte_bits_size;
+
+            auto mask_stream = input_stream_t::builder(descriptor.src2_ptr, descriptor.src2_ptr + descriptor.src2_size)
+                    .element_count(mask_elements)
+                    .stream_format(mask_format, bit_bits_size)
+                    .build<execution_path_t::software>();
+
+            auto output_stream = output_stream_t<array_stream>::builder(destination_begin, destination_end)
+                    .stream_format(output_format)
+                    .bit_format(out_bit_width, input_stream.bit_width())
+                    .nominal(input_stream.bit_width() == bit_bits_size)
+                    .build<execution_path_t::software>();
+
+            limited_buffer_t mask_buffer(std::begin(buffers.src2), std::end(buffers.src2), byte_bits_size);
+            limited_buffer_t output_buffer(std::begin(buffers.set), std::end(buffers.set), bit_bits_size);
+
+            result = (QPL_OPCODE_SELECT == opcode)
+                     ? call_select<execution_path_t::software>(input_stream,
+                                                               mask_stream,
+                                                               output_stream,
+                                                               unpack_buffer,
+                                                               mask_buffer,
+                                                               output_buffer)
+                     : call_expand<execution_path_t::software>(input_stream,
+                                                               mask_stream,
+                                                               output_stream,
+                                                               unpack_buffer,
+                                                               mask_buffer,
+                                                               output_buffer);
+            break;
+        }
+        default: {
+            result.status_code_ = status_list::hardware_status_base + AD_STATUS_UNSUPPORTED_OPCODE;
+        }
+    }
+
+    record_ptr->bytes_completed = descriptor.src1_size;
+    record_ptr->output_size     = result.output_bytes_;
+    record_ptr->output_bits     = static_cast<uint8_t>(result.last_bit_offset_);
+    record_ptr->crc             = result.checksums_.crc32_;
+    record_ptr->xor_checksum    = static_cast<uint16_t>(result.checksums_.xor_);
+    record_ptr->min_first_agg   = result.aggregates_.min_value_;
+    record_ptr->max_last_agg    = result.aggregates_.max_value_;
+    record_ptr->sum_agg         = result.aggregates_.sum_;
+
+    own_complete(record_ptr, result.status_code_);
+}
+
+void own_execute(const hw_descriptor &descriptor, own_buffers_t &buffers) noexcept {
+    const auto &analytics_descriptor = reinterpret_cast<const hw_iaa_analytics_descriptor &>(descriptor);
+
+    auto *record_ptr = reinterpret_cast<HW_PATH_VOLATILE hw_iaa_completion_record *>(analytics_descriptor.completion_record_ptr);
+
+    switch (ADOF_GET_OPCODE(analytics_descriptor.op_code_op_flags)) {
+        case QPL_OPCODE_CRC64: {
+            own_execute_crc64(reinterpret_cast<const own_crc64_descriptor &>(descriptor), record_ptr);
+            break;
+        }
+        case QPL_OPCODE_SCAN:
+        case QPL_OPCODE_EXTRACT:
+        case QPL_OPCODE_SELECT:
+        case QPL_OPCODE_EXPAND: {
+            own_execute_filter(analytics_descriptor, buffers, record_ptr);
+            break;
+        }
+        default: {
+            own_complete(record_ptr, status_list::hardware_status_base + AD_STATUS_UNSUPPORTED_OPCODE);
+        }
+    }
+}
+
+}
+
+hw_emulator::hw_emulator() noexcept {
+    const uint32_t workers_count = std::max(1u, own_read_variable("QPL_HW_EMULATOR_WORKERS", default_workers_count, 256u));
+
+    queue_depth_ = std::max(1u, own_read_variable("QPL_HW_EMULATOR_QUEUE_DEPTH", default_queue_depth, 1u << 16u));
+    busy_rate_   = own_read_variable("QPL_HW_EMULATOR_BUSY_RATE", 0u, 100u);
+    latency_     = std::chrono::microseconds(own_read_variable("QPL_HW_EMULATOR_LATENCY_US", 0u, 10000000u));
+
+    DIAG("using software model of the accelerator: workers: %u, queue depth: %u, latency: %u us, busy rate: %u%%\n",
+         workers_count, queue_depth_,
+         static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency_).count()), busy_rate_);
+
+    tasks_.reset(new (std::nothrow) task_t[queue_depth_]);
+
+    // Without the queue every submission is rejected as busy
+    if (!tasks_) {
+        queue_depth_ = 0u;
+        return;
+    }
+
+    // The buffers are too big for the stacks of the workers
+    buffers_.reset(new (std::nothrow) uint8_t[workers_count * sizeof(own_buffers_t)]);
+
+    if (buffers_) {
+        try {
+            workers_.reserve(workers_count);
+
+            for (uint32_t i = 0u; i < workers_count; i++) {
+                workers_.emplace_back(&hw_emulator::work, this, i);
+            }
+        } catch (const std::exception &) {
+            // The descriptors are executed by the workers started before
+        }
+    }
+
+    // Nothing would complete the descriptors, the device is reported as unavailable
+    if (workers_.empty()) {
+        queue_depth_ = 0u;
+    }
+}
+
+hw_emulator::~hw_emulator() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopped_ = true;
+    }
+
+    condition_.notify_all();
+
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+auto hw_emulator::get_instance() noexcept -> hw_emulator & {
+    static hw_emulator instance{};
+    return instance;
+}
+
+auto hw_emulator::is_available() const noexcept -> bool {
+    return !workers_.empty();
+}
+
+auto hw_emulator::submit(const void *desc_ptr) noexcept -> bool {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // As on the device, the queue entry is freed once an engine takes the descriptor
+        if (queued_count_ >= queue_depth_) {
+            return false;
+        }
+
+        if (0u != busy_rate_ && random_() % 100u < busy_rate_) {
+            return false;
+        }
+
+        auto &task = tasks_[(head_ + queued_count_) % queue_depth_];
+
+        task.descriptor = *reinterpret_cast<const hw_descriptor *>(desc_ptr);
+        task.ready_time = clock_t::now() + latency_;
+
+        queued_count_++;
+    }
+
+    condition_.notify_one();
+
+    return true;
+}
+
+void hw_emulator::work(uint32_t index) noexcept {
+    auto &buffers = reinterpret_cast<own_buffers_t *>(buffers_.get())[index];
+
+    while (true) {
+        task_t task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return is_stopped_ || 0u != queued_count_; });
+
+            if (is_stopped_) {
+                return;
+            }
+
+            task  = tasks_[head_];
+            head_ = (head_ + 1u) % queue_depth_;
+            queued_count_--;
+        }
+
+        std::this_thread::sleep_until(task.ready_time);
+
+        own_execute(task.descriptor, buffers);
+    }
+}
+
+}
+
+#endif //QPL_HW_EMULATOR
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
+
+#if defined( QPL_HW_EMULATOR )
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "hw_definitions.h"
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Software model of the accelerator work queue, it replaces the device when the library is built
+ *        with the HW_EMULATOR option
+ *
+ * @details The descriptor is copied on submission, as ENQCMD does, and executed later by a pool of worker
+ *          threads with the software kernels. The completion record is written the way the device does it:
+ *          the status byte goes last, so the regular polling of the hardware path works unchanged.
+ *          Only CRC64 and the filter operations (scan, extract, select, expand) on uncompressed input are
+ *          modeled. Compression, decompression and decompression with filtering are not: they need the
+ *          device bit stream state in the AECS, which the software kernels don't keep, so the model never
+ *          writes the AECS. These descriptors complete with AD_STATUS_UNSUPPORTED_OPCODE.
+ *
+ *          The model is configured with the environment variables read once on the first use:
+ *          - QPL_HW_EMULATOR_WORKERS     - number of worker threads (engines), 8 by default
+ *          - QPL_HW_EMULATOR_QUEUE_DEPTH - number of descriptors waiting for a worker, 128 by default,
+ *                                          the submission above it is rejected as WQ_IS_BUSY
+ *          - QPL_HW_EMULATOR_LATENCY_US  - minimal time between the submission and the completion, 0 by default
+ *          - QPL_HW_EMULATOR_BUSY_RATE   - percent of submissions rejected as WQ_IS_BUSY, 0 by default
+ */
+class hw_emulator final {
+    using clock_t = std::chrono::steady_clock;
+
+    struct task_t {
+        hw_descriptor       descriptor;
+        clock_t::time_point ready_time;
+    };
+
+public:
+    static auto get_instance() noexcept -> hw_emulator &;
+
+    /**
+     * @brief Puts a copy of the descriptor into the queue
+     *
+     * @return false if the queue is full or the busy state is injected, true otherwise
+     */
+    [[nodiscard]] auto submit(const void *desc_ptr) noexcept -> bool;
+
+    /**
+     * @brief Checks that at least one worker is running, otherwise the submitted descriptors are never completed
+     */
+    [[nodiscard]] auto is_available() const noexcept -> bool;
+
+    hw_emulator(const hw_emulator &) = delete;
+
+    auto operator=(const hw_emulator &) -> hw_emulator & = delete;
+
+    ~hw_emulator() noexcept;
+
+private:
+    hw_emulator() noexcept;
+
+    void work(uint32_t index) noexcept;
+
+    std::unique_ptr<task_t[]>  tasks_;                /**< Ring of the queued descriptors */
+    std::unique_ptr<uint8_t[]> buffers_;              /**< Intermediate buffers of the workers */
+    std::vector<std::thread>   workers_;
+    std::mutex                 mutex_;
+    std::condition_variable    condition_;
+    std::minstd_rand           random_;               /**< Source of the injected busy states */
+    clock_t::duration          latency_{};
+    uint32_t                   busy_rate_    = 0u;    /**< Percent of the rejected submissions */
+    uint32_t                   queue_depth_  = 0u;
+    uint32_t                   head_         = 0u;    /**< Index of the oldest queued descriptor */
+    uint32_t                   queued_count_ = 0u;    /**< Descriptors not taken by the workers yet */
+    bool                       is_stopped_   = false;
+};
+
+}
+
+#endif //QPL_HW_EMULATOR
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
@@ -10,6 +10,7 @@
 #include <sys/mman.h>
 
 #include "hw_queue.hpp"
+#include "hw_emulator.hpp"
 
 #ifdef DYNAMIC_LOADING_LIBACCEL_CONFIG
 #include "hw_configuration_driver.h"
@@ -68,6 +69,9 @@ auto hw_queue::get_portal_ptr() const noexcept -> void * {
 }
 
 auto hw_queue::enqueue_descriptor(void *desc_ptr) const noexcept -> qpl_status {
+#if defined( QPL_HW_EMULATOR )
+    const uint8_t retry = !hw_emulator::get_instance().submit(desc_ptr);
+#else
     uint8_t retry = 0u;
 
     void *current_place_ptr = get_portal_ptr();
@@ -75,6 +79,7 @@ auto hw_queue::enqueue_descriptor(void *desc_ptr) const noexcept -> qpl_status {
                  ".byte 0xf2, 0x0f, 0x38, 0xf8, 0x02\t\n"
                  "setz %0\t\n"
     : "=r"(retry) : "a" (current_place_ptr), "d" (desc_ptr));
+#endif
 
     return static_cast<qpl_status>(retry);
 }
@@ -5,6 +5,7 @@
  ******************************************************************************/
 
 #include "util/checksum.hpp"
+#include "common/defs.hpp"
 #include "igzip_checksums.h"
 #include "compression/inflate/isal_kernels_wrappers.hpp"
 
@@ -22,4 +23,61 @@ auto adler32(uint8_t *const begin, uint32_t size, uint32_t seed) noexcept -> uin
     return (old_adler32 & most_significant_16_bits) | new_adler32;
 }
 
+namespace {
+
+constexpr uint32_t crc32_gzip_reflected_polynomial = 0xEDB88320u;
+constexpr uint32_t crc32_gzip_x0                   = 0x80000000u; // x^0 in the reflected representation
+constexpr uint32_t crc32_gzip_x1                   = 0x40000000u; // x^1 in the reflected representation
+
+/**
+ * @brief Multiplies two polynomials modulo the CRC32 (gzip) polynomial, both are in the reflected representation
+ */
+auto crc32_gzip_multiply(uint32_t a, uint32_t b) noexcept -> uint32_t {
+    uint32_t product = 0u;
+
+    for (uint32_t mask = crc32_gzip_x0; mask != 0u; mask >>= 1u) {
+        if (a & mask) {
+            product ^= b;
+        }
+
+        b = (b & 1u) ? (b >> 1u) ^ crc32_gzip_reflected_polynomial : b >> 1u;
+    }
+
+    return product;
+}
+
+}
+
+auto crc32_gzip_combine(uint32_t crc1, uint32_t crc2, uint64_t size2) noexcept -> uint32_t {
+    // Appending size2 bytes to the first buffer multiplies its CRC by x^(8 * size2),
+    // the power is accumulated from x^(2^k) by repeated squaring
+    uint32_t shift  = crc32_gzip_x0;
+    uint32_t square = crc32_gzip_x1;
+
+    for (uint64_t bits = size2 * byte_bits_size; bits != 0u; bits >>= 1u) {
+        if (bits & 1u) {
+            shift = crc32_gzip_multiply(square, shift);
+        }
+
+        square = crc32_gzip_multiply(square, square);
+    }
+
+    return crc32_gzip_multiply(shift, crc1) ^ crc2;
+}
+
+auto adler32_combine(uint32_t adler1, uint32_t adler2, uint64_t size2) noexcept -> uint32_t {
+    const auto remainder = static_cast<uint32_t>(size2 % adler32_mod);
+
+    uint32_t sum1 = adler1 & least_significant_16_bits;
+    uint32_t sum2 = static_cast<uint32_t>((static_cast<uint64_t>(remainder) * sum1) % adler32_mod);
+
+    sum1 += (adler2 & least_significant_16_bits) + adler32_mod - 1u;
+    sum2 += (adler1 >> 16u) + (adler2 >> 16u) + adler32_mod - remainder;
+
+    sum1 %= adler32_mod;
+    sum2 %= adler32_mod;
+
+    return (sum2 << 16u) | sum1;
+}
+
 } // namespace qpl::ml
@@ -39,6 +39,36 @@ enum class crc_type_t {
 
 auto adler32(uint8_t *begin, uint32_t size, uint32_t seed) noexcept -> uint32_t;
 
+/**
+ * @brief Calculates CRC32 (gzip) of two concatenated buffers from the CRC32 values of the buffers
+ *
+ * @param crc1   CRC32 of the first buffer
+ * @param crc2   CRC32 of the second buffer
+ * @param size2  size of the second buffer in bytes
+ */
+auto crc32_gzip_combine(uint32_t crc1, uint32_t crc2, uint64_t size2) noexcept -> uint32_t;
+
+/**
+ * @brief Calculates Adler32 of two concatenated buffers from the Adler32 values of the buffers
+ *
+ * @note Values are in the zlib format, i.e. the checksum of an empty buffer is 1
+ */
+auto adler32_combine(uint32_t adler1, uint32_t adler2, uint64_t size2) noexcept -> uint32_t;
+
+/**
+ * @brief Calculates the 16-bit XOR checksum of two concatenated buffers from the checksums of the buffers
+ *
+ * @param size1  size of the first buffer in bytes, the bytes of the second buffer swap their places
+ *               in the 16-bit words if it is odd
+ */
+inline auto xor_checksum_combine(uint32_t xor1, uint32_t xor2, uint64_t size1) noexcept -> uint32_t {
+    if (size1 & 1u) {
+        xor2 = ((xor2 << 8u) | (xor2 >> 8u)) & 0xFFFFu;
+    }
+
+    return xor1 ^ xor2;
+}
+
 template <class input_iterator_t>
 inline uint32_t crc32_gzip(const input_iterator_t source_begin,
                            const input_iterator_t source_end,
@@ -68,6 +68,17 @@ inline auto process_descriptor(hw_descriptor *const descriptor_ptr,
     return operation_result;
 }
 
+/**
+ * @brief Completion records are owned by the caller, so it can't return while the device still writes them
+ */
+template <uint32_t number_of_descriptors>
+inline void wait_submitted_descriptors(std::array<hw_completion_record, number_of_descriptors> &completion_records,
+                                       uint32_t submitted_count) noexcept {
+    for (uint32_t i = 0; i < submitted_count; i++) {
+        awaiter::wait_for(&completion_records[i].status, AD_STATUS_INPROG);
+    }
+}
+
 template <typename return_t, uint32_t number_of_descriptors>
 inline auto process_descriptor(std::array<hw_descriptor, number_of_descriptors> &descriptors,
                                std::array<hw_completion_record, number_of_descriptors> &completion_records,
@@ -83,6 +94,7 @@ inline auto process_descriptor(std::array<hw_descriptor, number_of_descriptors>
                                                                                      &completion_records[i],
                                                                                      numa_id);
             if (operation_result != status_list::ok) {
+                wait_submitted_descriptors<number_of_descriptors>(completion_records, i);
                 return operation_result;
             }
         } else {
@@ -90,6 +102,7 @@ inline auto process_descriptor(std::array<hw_descriptor, number_of_descriptors>
                                                                                                   &completion_records[i],
                                                                                                   numa_id);
             if (operation_result.status_code_ != status_list::ok) {
+                wait_submitted_descriptors<number_of_descriptors>(completion_records, i);
                 return operation_result;
             }
         }
@@ -100,6 +113,7 @@ inline auto process_descriptor(std::array<hw_descriptor, number_of_descriptors>
 
         if (execution_status.status_code_ != status_list::ok) {
             operation_result.status_code_ = execution_status.status_code_;
+            wait_submitted_descriptors<number_of_descriptors>(completion_records, static_cast<uint32_t>(descriptors.size()));
             return operation_result;
         } else {
             operation_result.output_bytes_ += execution_status.output_bytes_;
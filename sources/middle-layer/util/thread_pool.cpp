@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <exception>
+
+#include "thread_pool.hpp"
+
+namespace qpl::ml::util {
+
+auto thread_pool::get_instance() noexcept -> thread_pool & {
+    static thread_pool instance;
+
+    return instance;
+}
+
+thread_pool::thread_pool() noexcept
+        : max_workers_count_(std::max(1u, std::thread::hardware_concurrency()) - 1u) {
+    // Workers are started by the first batches
+}
+
+thread_pool::~thread_pool() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopped_ = true;
+    }
+
+    task_added_.notify_all();
+
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void thread_pool::run(uint32_t tasks_count, task_t task, void *context_ptr) noexcept {
+    if (0u == tasks_count) {
+        return;
+    }
+
+    batch_t batch;
+    batch.task        = task;
+    batch.context_ptr = context_ptr;
+    batch.tasks_count = tasks_count;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (tasks_count > 1u) {
+        start_workers(tasks_count - 1u);
+
+        batch.next_ptr = batches_ptr_;
+        batches_ptr_   = &batch;
+
+        task_added_.notify_all();
+    }
+
+    // The calling thread takes the tasks that are not started by the workers yet
+    while (batch.started_count < batch.tasks_count) {
+        run_next_task(batch, lock);
+    }
+
+    task_finished_.wait(lock, [&batch]() { return batch.finished_count == batch.tasks_count; });
+}
+
+void thread_pool::start_workers(uint32_t workers_count) noexcept {
+    workers_count = std::min(workers_count, max_workers_count_);
+
+    try {
+        while (workers_.size() < workers_count) {
+            workers_.emplace_back(&thread_pool::work, this);
+        }
+    } catch (const std::exception &) {
+        // The batch is run by the workers started before and by the calling thread, the next batch tries again
+    }
+}
+
+void thread_pool::remove_batch(batch_t *batch_ptr) noexcept {
+    for (batch_t **link_ptr = &batches_ptr_; *link_ptr; link_ptr = &(*link_ptr)->next_ptr) {
+        if (*link_ptr == batch_ptr) {
+            *link_ptr = batch_ptr->next_ptr;
+            break;
+        }
+    }
+}
+
+void thread_pool::run_next_task(batch_t &batch, std::unique_lock<std::mutex> &lock) noexcept {
+    const uint32_t task_index = batch.started_count++;
+
+    if (batch.started_count == batch.tasks_count) {
+        remove_batch(&batch);
+    }
+
+    lock.unlock();
+    batch.task(batch.context_ptr, task_index);
+    lock.lock();
+
+    if (++batch.finished_count == batch.tasks_count) {
+        task_finished_.notify_all();
+    }
+}
+
+void thread_pool::work() noexcept {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;) {
+        task_added_.wait(lock, [this]() { return is_stopped_ || batches_ptr_; });
+
+        if (!batches_ptr_) {
+            break;
+        }
+
+        run_next_task(*batches_ptr_, lock);
+    }
+}
+
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#ifndef QPL_MIDDLE_LAYER_UTIL_THREAD_POOL_HPP
+#define QPL_MIDDLE_LAYER_UTIL_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace qpl::ml::util {
+
+/**
+ * @brief Pool of the worker threads shared by the parallel operations of the software path
+ *
+ * @details Workers are started on demand, up to the number of the hardware threads minus one, and are kept
+ *          till the library is unloaded. The thread that runs a batch of tasks takes the tasks too, so every task
+ *          is done even if no worker can be started: the failure of the thread creation isn't an error,
+ *          it only reduces the parallelism.
+ *          Tasks of a batch are started in the order of their indices, so a task may wait for the tasks with
+ *          lower indices, they are surely started.
+ *
+ * @note The thread creation is the only place of the library that can throw, thread_pool.cpp (and hw_emulator.cpp
+ *       of the HW_EMULATOR build) is built with the exceptions enabled to catch it.
+ */
+class thread_pool final {
+public:
+    using task_t = void (*)(void *context_ptr, uint32_t task_index) noexcept;
+
+    static auto get_instance() noexcept -> thread_pool &;
+
+    /**
+     * @brief Runs the tasks with indices from 0 to tasks_count - 1, returns when all of them are done
+     */
+    void run(uint32_t tasks_count, task_t task, void *context_ptr) noexcept;
+
+    /**
+     * @brief Runs function(task_index) for the indices from 0 to tasks_count - 1
+     */
+    template <class function_t>
+    void run(uint32_t tasks_count, function_t &function) noexcept {
+        run(tasks_count,
+            [](void *context_ptr, uint32_t task_index) noexcept {
+                (*reinterpret_cast<function_t *>(context_ptr))(task_index);
+            },
+            &function);
+    }
+
+    thread_pool(const thread_pool &) = delete;
+
+    auto operator=(const thread_pool &) -> thread_pool & = delete;
+
+    ~thread_pool() noexcept;
+
+private:
+    struct batch_t {
+        task_t   task            = nullptr;
+        void     *context_ptr    = nullptr;
+        uint32_t tasks_count     = 0u;
+        uint32_t started_count   = 0u;
+        uint32_t finished_count  = 0u;
+        batch_t  *next_ptr       = nullptr; /**< Next batch with tasks not started yet */
+    };
+
+    thread_pool() noexcept;
+
+    void start_workers(uint32_t workers_count) noexcept;
+
+    void remove_batch(batch_t *batch_ptr) noexcept;
+
+    void work() noexcept;
+
+    /**
+     * @brief Runs the next task of the batch, the lock is released for the time of the task
+     */
+    void run_next_task(batch_t &batch, std::unique_lock<std::mutex> &lock) noexcept;
+
+    std::vector<std::thread> workers_;
+    std::mutex               mutex_;
+    std::condition_variable  task_added_;
+    std::condition_variable  task_finished_;
+    batch_t                  *batches_ptr_       = nullptr; /**< Batches with tasks not started yet */
+    uint32_t                 max_workers_count_  = 0u;
+    bool                     is_stopped_         = false;
+};
+
+}
+
+#endif //QPL_MIDDLE_LAYER_UTIL_THREAD_POOL_HPP
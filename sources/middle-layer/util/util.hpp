@@ -55,6 +55,8 @@ inline uint32_t bit_width_to_bits(const uint32_t value) noexcept {
         return byte_bits_size;
     } else if (value > 8 && value <= 16) {
         return short_bits_size;
+    } else if (value > 32 && value <= 64) {
+        return long_bits_size;
     } else {
         return int_bits_size;
     }
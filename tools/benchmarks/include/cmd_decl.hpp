@@ -27,6 +27,10 @@ BM_DECLARE_string(out_mem);
 
 BM_DECLARE_double(canned_part);
 BM_DECLARE_bool(canned_regen);
+BM_DECLARE_int32(level);
+
+BM_DECLARE_int32(bit_width);
+BM_DECLARE_double(selectivity);
 
 std::int32_t get_block_size();
 mem_loc_e    get_in_mem();
@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <ops/c_api/base.hpp>
+#include <stdexcept>
+
+namespace bench::ops::c_api
+{
+static inline qpl_operation to_qpl_op(analytics_op_e op)
+{
+    switch(op)
+    {
+    case analytics_op_e::scan_eq:        return qpl_op_scan_eq;
+    case analytics_op_e::scan_ne:        return qpl_op_scan_ne;
+    case analytics_op_e::scan_lt:        return qpl_op_scan_lt;
+    case analytics_op_e::scan_le:        return qpl_op_scan_le;
+    case analytics_op_e::scan_gt:        return qpl_op_scan_gt;
+    case analytics_op_e::scan_ge:        return qpl_op_scan_ge;
+    case analytics_op_e::scan_range:     return qpl_op_scan_range;
+    case analytics_op_e::scan_not_range: return qpl_op_scan_not_range;
+    case analytics_op_e::extract:        return qpl_op_extract;
+    case analytics_op_e::select:         return qpl_op_select;
+    case analytics_op_e::expand:         return qpl_op_expand;
+    default:                             throw std::runtime_error("Invalid analytics operation!");
+    }
+}
+
+static inline qpl_parser to_qpl_parser(parser_e parser)
+{
+    switch(parser)
+    {
+    case parser_e::le:   return qpl_p_le_packed_array;
+    case parser_e::be:   return qpl_p_be_packed_array;
+    case parser_e::prle: return qpl_p_parquet_rle;
+    default:             throw std::runtime_error("Invalid parser!");
+    }
+}
+
+static inline qpl_out_format to_qpl_out_format(std::uint32_t out_bit_width)
+{
+    switch(out_bit_width)
+    {
+    case 0:  return qpl_ow_nom;
+    case 8:  return qpl_ow_8;
+    case 16: return qpl_ow_16;
+    case 32: return qpl_ow_32;
+    default: throw std::runtime_error("Invalid output bit width!");
+    }
+}
+
+template <path_e path>
+class analytics_t: public operation_base_t<analytics_t<path>>
+{
+public:
+    using result_t    = analytics_results_t;
+    using params_t    = analytics_params_t;
+    using data_type_t = typename result_t::data_type_t;
+    using base_t      = ops::operation_base_t<analytics_t<path>>;
+    using base_api_t  = operation_base_t<analytics_t<path>>;
+
+    static constexpr auto path_v = path;
+
+private:
+    using base_api_t::deinit_lib_impl;
+    using base_api_t::job_;
+    using base_t::bytes_read_;
+    using base_t::bytes_written_;
+
+public:
+    analytics_t() noexcept {}
+    ~analytics_t() noexcept
+    {
+        deinit_lib_impl();
+    }
+
+protected:
+    void init_buffers_impl(const params_t &params)
+    {
+        params_ = params;
+
+        // The widest output is an array of 32-bit indices or elements
+        data_.resize(static_cast<std::size_t>(params_.elements_)*sizeof(std::uint32_t) + 64);
+        if(params_.op_ == analytics_op_e::expand)
+            data_.resize(params_.p_mask_->buffer.size()*8*sizeof(std::uint32_t) + 64);
+    }
+
+    void init_lib_params_impl()
+    {
+        job_->next_in_ptr        = const_cast<std::uint8_t*>(params_.p_source_->buffer.data());
+        job_->available_in       = static_cast<std::uint32_t>(params_.p_source_->buffer.size());
+        job_->next_out_ptr       = data_.data();
+        job_->available_out      = static_cast<std::uint32_t>(data_.size());
+        job_->op                 = to_qpl_op(params_.op_);
+        job_->parser             = to_qpl_parser(params_.parser_);
+        job_->src1_bit_width     = params_.bit_width_;
+        job_->num_input_elements = params_.elements_;
+        job_->param_low          = params_.param_low_;
+        job_->param_high         = params_.param_high_;
+        job_->out_bit_width      = to_qpl_out_format(params_.out_bit_width_);
+        job_->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+        if(params_.decompress_)
+            job_->flags |= QPL_FLAG_DECOMPRESS_ENABLE;
+
+        if(params_.op_ == analytics_op_e::select || params_.op_ == analytics_op_e::expand)
+        {
+            job_->next_src2_ptr  = const_cast<std::uint8_t*>(params_.p_mask_->buffer.data());
+            job_->available_src2 = static_cast<std::uint32_t>(params_.p_mask_->buffer.size());
+            job_->src2_bit_width = 1;
+        }
+    }
+
+    void sync_execute_impl()
+    {
+        auto status = qpl_execute_job(job_);
+        if(QPL_STS_OK == status)
+        {
+            data_size_     = job_->total_out;
+            bytes_read_    = job_->total_in;
+            bytes_written_ = job_->total_out;
+        }
+        else
+            throw std::runtime_error(format("qpl_execute_job() failed with status %d", status));
+    }
+
+    void async_submit_impl()
+    {
+        auto status = qpl_submit_job(job_);
+        if(QPL_STS_OK != status)
+            throw std::runtime_error(format("qpl_submit_job() failed with status %d", status));
+    }
+
+    task_status_e async_wait_impl()
+    {
+        auto status = qpl_wait_job(job_);
+        if(QPL_STS_OK == status)
+        {
+            data_size_     = job_->total_out;
+            bytes_read_    = job_->total_in;
+            bytes_written_ = job_->total_out;
+            return task_status_e::completed;
+        }
+        else
+            throw std::runtime_error(format("qpl_wait_job() failed with status %d", status));
+    }
+
+    [[nodiscard]] task_status_e async_poll_impl()
+    {
+        auto status = qpl_check_job(job_);
+        if(QPL_STS_BEING_PROCESSED == status)
+            return task_status_e::in_progress;
+        else
+        {
+            if(QPL_STS_OK == status)
+            {
+                data_size_     = job_->total_out;
+                bytes_read_    = job_->total_in;
+                bytes_written_ = job_->total_out;
+                return task_status_e::completed;
+            }
+            else
+                throw std::runtime_error(format("qpl_check_job() failed with status %d", status));
+        }
+    }
+
+    void light_reset_impl() noexcept
+    {
+        // Filter operations update the sizes of the buffers, but not the pointers
+        job_->next_in_ptr   = const_cast<std::uint8_t*>(params_.p_source_->buffer.data());
+        job_->available_in  = static_cast<std::uint32_t>(params_.p_source_->buffer.size());
+        job_->next_out_ptr  = data_.data();
+        job_->available_out = static_cast<std::uint32_t>(data_.size());
+        job_->total_in  = 0;
+        job_->total_out = 0;
+    }
+
+    void mem_control_impl(mem_loc_e op, mem_loc_mask_e mask) const noexcept
+    {
+        if(mask&mem_loc_mask_e::src1)
+            details::mem_control(params_.p_source_->buffer.begin(), params_.p_source_->buffer.end(), op);
+        if(mask&mem_loc_mask_e::src2)
+            details::mem_control(params_.p_mask_->buffer.begin(), params_.p_mask_->buffer.end(), op);
+        if(mask&mem_loc_mask_e::dst1)
+            details::mem_control(data_.begin(), data_.end(), op);
+    }
+
+    result_t& get_result_impl() noexcept
+    {
+        result_.data_ = data_;
+        result_.data_.resize(data_size_);
+        return result_;
+    }
+
+private:
+    friend class ops::operation_base_t<analytics_t>;
+    friend class operation_base_t<analytics_t>;
+
+    params_t    params_;
+    data_type_t data_;
+    std::size_t data_size_{0};
+    result_t    result_;
+};
+}
+
+namespace bench::ops
+{
+template <path_e path>
+struct traits<operation_base_t<c_api::analytics_t<path>>>
+{
+    using result_t = analytics_results_t;
+};
+}
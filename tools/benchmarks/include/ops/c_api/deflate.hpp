@@ -50,7 +50,12 @@ protected:
         job_->next_out_ptr  = stream_.data();
         job_->available_out = static_cast<std::uint32_t>(stream_.size());
         job_->op            = qpl_op_compress;
-        job_->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_OMIT_VERIFY;
+        job_->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+        if(!params_.verify_)
+            job_->flags |= QPL_FLAG_OMIT_VERIFY;
+        if(params_.parallel_)
+            job_->flags |= QPL_FLAG_PARALLEL;
 
         if(params_.huffman_only_)
             job_->flags |= QPL_FLAG_GEN_LITERALS;
@@ -64,10 +69,8 @@ protected:
         else
             throw std::runtime_error(format("invalid Huffman mode: %s", to_string(params_.huffman_).c_str()));
 
-        if(params_.level_ == 1)
-            job_->level = qpl_level_1;
-        else if(params_.level_ == 3)
-            job_->level = qpl_level_3;
+        if(params_.level_ >= qpl_level_1 && params_.level_ <= qpl_level_9)
+            job_->level = static_cast<qpl_compression_levels>(params_.level_);
         else
             throw std::runtime_error(format("invalid level: %d", params_.level_));
     }
@@ -10,6 +10,7 @@
 #include "c_api/deflate.hpp"
 #include "c_api/inflate.hpp"
 #include "c_api/crc64.hpp"
+#include "c_api/analytics.hpp"
 
 namespace bench::ops
 {
@@ -33,4 +34,10 @@ struct api_dispatcher_t<api_e::c, path, operation_e::crc64>
 {
     using impl_t = c_api::crc64_t<path>;
 };
+
+template <path_e path>
+struct api_dispatcher_t<api_e::c, path, operation_e::analytics>
+{
+    using impl_t = c_api::analytics_t<path>;
+};
 }
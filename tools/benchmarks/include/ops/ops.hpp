@@ -17,4 +17,7 @@ using inflate_t = typename api_dispatcher_t<api, path, operation_e::inflate>::im
 
 template <api_e api, path_e path>
 using crc64_t = typename api_dispatcher_t<api, path, operation_e::crc64>::impl_t;
+
+template <api_e api, path_e path>
+using analytics_t = typename api_dispatcher_t<api, path, operation_e::analytics>::impl_t;
 }
@@ -14,12 +14,14 @@ namespace bench::ops
 struct deflate_params_t
 {
     explicit deflate_params_t() = default;
-    deflate_params_t(const data_t &data, std::int32_t level, huffman_type_e huffman, bool huffman_only = false, bool no_headers = false, const canned_table_t &canned_table_table = canned_table_t{}) :
+    deflate_params_t(const data_t &data, std::int32_t level, huffman_type_e huffman, bool huffman_only = false, bool no_headers = false, const canned_table_t &canned_table_table = canned_table_t{}, bool verify = false, bool parallel = false) :
         p_source_data_(&data),
         level_(level),
         huffman_(huffman),
         huffman_only_(huffman_only),
-        no_headers_(no_headers)
+        no_headers_(no_headers),
+        verify_(verify),
+        parallel_(parallel)
     {
         if(canned_table_table.com_table_l1.size())
             p_canned_table_table_ = &canned_table_table;
@@ -30,6 +32,8 @@ struct deflate_params_t
     huffman_type_e        huffman_{huffman_type_e::fixed};
     bool                  huffman_only_{false};
     bool                  no_headers_{false};
+    bool                  verify_{false};
+    bool                  parallel_{false};
     const canned_table_t *p_canned_table_table_{nullptr};
 };
 
@@ -63,4 +67,34 @@ struct crc64_params_t
     crc_type_e            crc_type;
 };
 
+struct analytics_params_t
+{
+    explicit analytics_params_t() = default;
+    analytics_params_t(const data_t &source, const data_t &mask, analytics_op_e op, parser_e parser, std::uint32_t bit_width,
+                       std::uint32_t elements, std::uint32_t param_low, std::uint32_t param_high, std::uint32_t out_bit_width,
+                       bool decompress) :
+        p_source_(&source),
+        p_mask_(&mask),
+        op_(op),
+        parser_(parser),
+        bit_width_(bit_width),
+        elements_(elements),
+        param_low_(param_low),
+        param_high_(param_high),
+        out_bit_width_(out_bit_width),
+        decompress_(decompress)
+    {}
+
+    const data_t         *p_source_{nullptr};
+    const data_t         *p_mask_{nullptr};       // Second source of select and expand
+    analytics_op_e        op_{analytics_op_e::scan_eq};
+    parser_e              parser_{parser_e::le};
+    std::uint32_t         bit_width_{8};
+    std::uint32_t         elements_{0};
+    std::uint32_t         param_low_{0};
+    std::uint32_t         param_high_{0};
+    std::uint32_t         out_bit_width_{0};      // 0 - nominal, 8, 16 or 32 - indices of the scan output
+    bool                  decompress_{false};     // Source is a Deflate stream of the packed elements
+};
+
 }
@@ -80,7 +80,8 @@ enum class operation_e
 {
     deflate,
     inflate,
-    crc64
+    crc64,
+    analytics
 };
 
 enum class stat_type_e
@@ -108,6 +109,28 @@ enum class crc_type_e
     crc64
 };
 
+enum class analytics_op_e
+{
+    scan_eq,
+    scan_ne,
+    scan_lt,
+    scan_le,
+    scan_gt,
+    scan_ge,
+    scan_range,
+    scan_not_range,
+    extract,
+    select,
+    expand
+};
+
+enum class parser_e
+{
+    le,
+    be,
+    prle
+};
+
 enum class task_status_e
 {
     retired,
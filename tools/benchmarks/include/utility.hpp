@@ -140,6 +140,40 @@ static inline std::string crc_to_name(crc_type_e type)
     return std::string("/crc:") + crc_to_string(type);
 }
 
+static inline std::string to_string(analytics_op_e op)
+{
+    switch(op)
+    {
+    case analytics_op_e::scan_eq:        return "scan_eq";
+    case analytics_op_e::scan_ne:        return "scan_ne";
+    case analytics_op_e::scan_lt:        return "scan_lt";
+    case analytics_op_e::scan_le:        return "scan_le";
+    case analytics_op_e::scan_gt:        return "scan_gt";
+    case analytics_op_e::scan_ge:        return "scan_ge";
+    case analytics_op_e::scan_range:     return "scan_range";
+    case analytics_op_e::scan_not_range: return "scan_not_range";
+    case analytics_op_e::extract:        return "extract";
+    case analytics_op_e::select:         return "select";
+    case analytics_op_e::expand:         return "expand";
+    default:                             return "error";
+    }
+}
+
+static inline std::string to_string(parser_e parser)
+{
+    switch(parser)
+    {
+    case parser_e::le:   return "le";
+    case parser_e::be:   return "be";
+    case parser_e::prle: return "prle";
+    default:             return "error";
+    }
+}
+static inline std::string to_name(parser_e parser)
+{
+    return std::string("/parser:") + to_string(parser);
+}
+
 static inline std::string to_string(mem_loc_e loc)
 {
     switch(loc)
@@ -259,6 +293,12 @@ static inline void base_counters(benchmark::State &state, statistics_t &stat, st
                                                           benchmark::Counter::kIsIterationInvariantRate|benchmark::Counter::kAvgThreads,
                                                           benchmark::Counter::kIs1000);
     }
+    else if(type == stat_type_e::filter)
+    {
+        state.counters["Throughput"] = benchmark::Counter(static_cast<double>(stat.data_read / state.iterations()),
+                                                          benchmark::Counter::kIsIterationInvariantRate|benchmark::Counter::kAvgThreads,
+                                                          benchmark::Counter::kIs1000);
+    }
 
     state.counters["Latency/Op"] = benchmark::Counter(stat.operations_per_thread,
                                                       benchmark::Counter::kIsIterationInvariantRate|benchmark::Counter::kAvgThreads|benchmark::Counter::kInvert,
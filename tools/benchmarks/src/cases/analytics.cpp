@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <ops/ops.hpp>
+#include <data_providers.hpp>
+#include <utility.hpp>
+#include <measure.hpp>
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+
+using namespace bench;
+
+// Elements are read from the data as the little-endian packed array
+static inline std::vector<std::uint32_t> unpack_elements(const data_t &data, std::uint32_t bit_width)
+{
+    std::vector<std::uint32_t> elements(data.buffer.size()*8/bit_width);
+
+    for(std::size_t i = 0; i < elements.size(); ++i)
+    {
+        std::uint64_t value = 0;
+        for(std::uint32_t bit = 0; bit < bit_width; ++bit)
+        {
+            std::size_t index = i*bit_width + bit;
+            value |= static_cast<std::uint64_t>((data.buffer[index/8] >> (index%8)) & 1u) << bit;
+        }
+        elements[i] = static_cast<std::uint32_t>(value);
+    }
+
+    return elements;
+}
+
+static inline void pack_elements(std::vector<std::uint8_t> &stream, const std::uint32_t *elements, std::size_t count, std::uint32_t bit_width, bool is_be)
+{
+    const std::size_t offset = stream.size();
+    stream.resize(offset + (count*bit_width + 7)/8, 0);
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        for(std::uint32_t bit = 0; bit < bit_width; ++bit)
+        {
+            // Big-endian array is filled from the most significant bits of the element and of the byte
+            std::size_t   index = i*bit_width + bit;
+            std::uint32_t value = is_be ? (elements[i] >> (bit_width - 1 - bit)) & 1u : (elements[i] >> bit) & 1u;
+            std::uint32_t shift = is_be ? 7 - index%8 : index%8;
+            stream[offset + index/8] |= static_cast<std::uint8_t>(value << shift);
+        }
+    }
+}
+
+static inline void put_varint(std::vector<std::uint8_t> &stream, std::uint32_t value)
+{
+    while(value >= 0x80)
+    {
+        stream.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    stream.push_back(static_cast<std::uint8_t>(value));
+}
+
+// Parquet RLE/bit-packed hybrid: runs of 8 and more equal elements are RLE-encoded, the rest is bit-packed
+static inline std::vector<std::uint8_t> to_prle(const std::vector<std::uint32_t> &elements, std::uint32_t bit_width)
+{
+    constexpr std::size_t group_size = 8;
+    constexpr std::size_t max_groups = 63;
+
+    std::vector<std::uint8_t> stream{static_cast<std::uint8_t>(bit_width)};
+
+    auto run_length = [&](std::size_t begin)
+    {
+        std::size_t end = begin + 1;
+        while(end < elements.size() && elements[end] == elements[begin])
+            ++end;
+        return end - begin;
+    };
+
+    std::size_t position = 0;
+    while(position < elements.size())
+    {
+        auto run = run_length(position);
+        if(run >= group_size)
+        {
+            put_varint(stream, static_cast<std::uint32_t>(run << 1));
+            for(std::uint32_t byte = 0; byte < (bit_width + 7)/8; ++byte)
+                stream.push_back(static_cast<std::uint8_t>(elements[position] >> (byte*8)));
+            position += run;
+            continue;
+        }
+
+        std::size_t end = position;
+        do
+        {
+            end += group_size;
+        } while(end < elements.size() && (end - position)/group_size < max_groups && run_length(end) < group_size);
+
+        // The last group is padded with zeroes, they are cut off by the number of elements
+        std::vector<std::uint32_t> groups(end - position, 0);
+        std::copy(elements.begin() + position, elements.begin() + std::min(end, elements.size()), groups.begin());
+
+        put_varint(stream, static_cast<std::uint32_t>(((groups.size()/group_size) << 1) | 1));
+        pack_elements(stream, groups.data(), groups.size(), bit_width, false);
+        position = end;
+    }
+
+    return stream;
+}
+
+template <execution_e exec, api_e api, path_e path>
+class analytics_t
+{
+public:
+    static constexpr auto exec_v = exec;
+    static constexpr auto api_v  = api;
+    static constexpr auto path_v = path;
+
+    void operator()(benchmark::State &state, const case_params_t &common_params, const data_t &, const data_t *p_data, analytics_op_e op, parser_e parser,
+                    std::uint32_t bit_width, double selectivity, std::uint32_t out_bit_width, bool decompress) const
+    {
+        try
+        {
+            // Prepare elements and filter parameters
+            auto elements = unpack_elements(*p_data, bit_width);
+            if(elements.empty())
+                throw std::runtime_error("Data is too small");
+
+            auto sorted = elements;
+            std::sort(sorted.begin(), sorted.end());
+            auto quantile = [&](double part) { return sorted[std::min(sorted.size() - 1, static_cast<std::size_t>(part*sorted.size()))]; };
+
+            std::uint32_t param_low  = 0;
+            std::uint32_t param_high = 0;
+            switch(op)
+            {
+            case analytics_op_e::scan_eq:
+            case analytics_op_e::scan_ne:
+            case analytics_op_e::scan_lt:
+            case analytics_op_e::scan_le:        param_low = quantile(selectivity); break;
+            case analytics_op_e::scan_gt:
+            case analytics_op_e::scan_ge:        param_low = quantile(1 - selectivity); break;
+            case analytics_op_e::scan_range:
+            case analytics_op_e::scan_not_range: param_low = sorted.front(); param_high = quantile(selectivity); break;
+            case analytics_op_e::extract:
+                param_high = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(selectivity*elements.size())) - 1;
+                break;
+            default: break;
+            }
+
+            // Mask of select and expand has the same density for any data
+            data_t mask;
+            auto   column_size = static_cast<std::uint32_t>(elements.size());
+            if(op == analytics_op_e::select || op == analytics_op_e::expand)
+            {
+                mask.buffer.resize((elements.size() + 7)/8, 0);
+                std::uint32_t ones = 0;
+                for(std::uint32_t i = 0; i < column_size; ++i)
+                {
+                    if(((i*2654435761u) >> 16)%1000 < selectivity*1000)
+                    {
+                        mask.buffer[i/8] |= static_cast<std::uint8_t>(1u << (i%8));
+                        ++ones;
+                    }
+                }
+
+                // Expand source has an element per each set bit of the mask
+                if(op == analytics_op_e::expand)
+                    elements.resize(std::max<std::uint32_t>(ones, 1));
+            }
+
+            data_t source;
+            if(parser == parser_e::prle)
+                source.buffer = to_prle(elements, bit_width);
+            else
+                pack_elements(source.buffer, elements.data(), elements.size(), bit_width, parser == parser_e::be);
+
+            if(decompress)
+            {
+                ops::deflate_params_t comp_params(source, 1, huffman_type_e::dynamic);
+                ops::deflate_t<api, path_e::cpu> compression;
+                compression.init(comp_params);
+                compression.async_submit();
+                compression.async_wait();
+                source.buffer = compression.get_result().stream_;
+            }
+
+            ops::analytics_params_t params(source, mask, op, parser, bit_width, static_cast<std::uint32_t>(elements.size()),
+                                           param_low, param_high, out_bit_width, decompress);
+            std::vector<ops::analytics_t<api, path>> operations;
+
+            // Measuring loop
+            auto stat = measure<exec, path>(state, common_params, operations, params);
+
+            // Validation
+            if constexpr (path != path_e::cpu)
+            {
+                ops::analytics_t<api, path_e::cpu> reference;
+                reference.init(params);
+                reference.async_submit();
+                reference.async_wait();
+
+                for(auto &operation : operations)
+                {
+                    if(operation.get_result().data_ != reference.get_result().data_)
+                        throw std::runtime_error("Verification failed");
+                }
+            }
+
+            // Set counters
+            base_counters(state, stat, stat_type_e::filter);
+            state.counters["Elements"] = benchmark::Counter(static_cast<double>(stat.completed_operations/state.iterations()*column_size),
+                                                            benchmark::Counter::kIsIterationInvariantRate|benchmark::Counter::kAvgThreads,
+                                                            benchmark::Counter::kIs1000);
+        }
+        catch(std::runtime_error &err) { state.SkipWithError(err.what()); }
+        catch(...)                     { state.SkipWithError("Unknown exception"); }
+    }
+};
+
+static inline std::string out_width_to_name(std::uint32_t out_bit_width)
+{
+    return std::string("/out_width:") + ((out_bit_width) ? std::to_string(out_bit_width) : "nom");
+}
+
+template <path_e path>
+static inline void cases_set(const data_t &data, analytics_op_e op, parser_e parser, std::uint32_t bit_width, double selectivity, std::uint32_t out_bit_width, bool decompress)
+{
+    if(path != path_e::cpu && cmd::FLAGS_no_hw)
+        return;
+
+    // Registered copy of the data keeps its name only, all the cases of the block share its buffer
+    data_t name_only{data.name, {}};
+
+    std::string name = to_name(parser) + to_name(bit_width, "bit_width") + to_name(static_cast<std::int32_t>(selectivity*100), "selectivity") +
+                       out_width_to_name(out_bit_width) + to_name(static_cast<std::int32_t>(decompress), "decompress");
+
+    register_benchmarks_common(to_string(op), name, analytics_t<execution_e::sync,  api_e::c, path>{}, case_params_t{}, name_only, &data, op, parser, bit_width, selectivity, out_bit_width, decompress);
+    register_benchmarks_common(to_string(op), name, analytics_t<execution_e::async, api_e::c, path>{}, case_params_t{}, name_only, &data, op, parser, bit_width, selectivity, out_bit_width, decompress);
+}
+
+BENCHMARK_SET_DELAYED(analytics)
+{
+    // Blocks must outlive the registered cases
+    static std::deque<data_t> blocks_storage;
+
+    std::vector<std::int32_t>   block_sizes  = (cmd::get_block_size() >= 0) ? std::vector<std::int32_t>{cmd::get_block_size()} : std::vector<std::int32_t>{65536, 0};
+    std::vector<std::uint32_t>  bit_widths   = (cmd::FLAGS_bit_width > 0) ? std::vector<std::uint32_t>{static_cast<std::uint32_t>(cmd::FLAGS_bit_width)} :
+                                                                            std::vector<std::uint32_t>{1, 3, 4, 7, 8, 12, 16, 24, 32};
+    std::vector<double>         selectivities = (cmd::FLAGS_selectivity >= 0) ? std::vector<double>{cmd::FLAGS_selectivity} : std::vector<double>{0.1, 0.5, 0.9};
+    std::vector<parser_e>       parsers{parser_e::le, parser_e::be, parser_e::prle};
+    std::vector<analytics_op_e> scan_ops{analytics_op_e::scan_eq, analytics_op_e::scan_ne, analytics_op_e::scan_lt, analytics_op_e::scan_le,
+                                         analytics_op_e::scan_gt, analytics_op_e::scan_ge, analytics_op_e::scan_range, analytics_op_e::scan_not_range};
+    std::vector<analytics_op_e> array_ops{analytics_op_e::extract, analytics_op_e::select, analytics_op_e::expand};
+
+    auto dataset = data::read_dataset(cmd::FLAGS_dataset);
+    for(auto &data : dataset)
+    {
+        for(auto &size : block_sizes)
+        {
+            auto blocks = data::split_data(data, size);
+            for(auto &block_data : blocks)
+            {
+                auto &block = blocks_storage.emplace_back(std::move(block_data));
+
+                for(auto bit_width : bit_widths)
+                {
+                    // Indices of the scan output must fit into the output width
+                    std::size_t                elements = block.buffer.size()*8/bit_width;
+                    std::vector<std::uint32_t> out_bit_widths{0, 32};
+                    if(elements <= 256)
+                        out_bit_widths.push_back(8);
+                    if(elements <= 65536)
+                        out_bit_widths.push_back(16);
+
+                    for(auto parser : parsers)
+                    {
+                        for(auto selectivity : selectivities)
+                        {
+                            for(bool decompress : {false, true})
+                            {
+                                for(auto op : scan_ops)
+                                {
+                                    for(auto out_bit_width : out_bit_widths)
+                                    {
+                                        cases_set<path_e::iaa>(block, op, parser, bit_width, selectivity, out_bit_width, decompress);
+                                        cases_set<path_e::cpu>(block, op, parser, bit_width, selectivity, out_bit_width, decompress);
+                                    }
+                                }
+                                for(auto op : array_ops)
+                                {
+                                    cases_set<path_e::iaa>(block, op, parser, bit_width, selectivity, 0, decompress);
+                                    cases_set<path_e::cpu>(block, op, parser, bit_width, selectivity, 0, decompress);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -22,12 +22,12 @@ public:
     static constexpr auto api_v  = api;
     static constexpr auto path_v = path;
 
-    void operator()(benchmark::State &state, const case_params_t &common_params, const data_t &data, huffman_type_e huffman, const canned_table_t &canned, std::int32_t level) const
+    void operator()(benchmark::State &state, const case_params_t &common_params, const data_t &data, huffman_type_e huffman, const canned_table_t &canned, std::int32_t level, bool verify, bool parallel) const
     {
         try
         {
             // Prepare compression
-            ops::deflate_params_t params(data, level, huffman, false, false, canned);
+            ops::deflate_params_t params(data, level, huffman, false, false, canned, verify, parallel);
             std::vector<ops::deflate_t<api, path>> operations;
 
             // Measuring loop
@@ -57,15 +57,27 @@ public:
 };
 
 template <path_e path>
-static inline void cases_set(data_t &data, huffman_type_e huffman, const canned_table_t &canned, std::vector<std::int32_t> &levels)
+static inline void cases_set(data_t &data, huffman_type_e huffman, const canned_table_t &canned, std::vector<std::int32_t> &levels, bool is_whole_file)
 {
     if(path != path_e::cpu && cmd::FLAGS_no_hw)
         return;
 
     for(auto &level : levels)
     {
-        register_benchmarks_common("deflate", to_name(huffman) + level_to_name(level), deflate_t<execution_e::sync,  api_e::c,   path>{}, case_params_t{}, data, huffman, canned, level);
-        register_benchmarks_common("deflate", to_name(huffman) + level_to_name(level), deflate_t<execution_e::async, api_e::c,   path>{}, case_params_t{}, data, huffman, canned, level);
+        register_benchmarks_common("deflate", to_name(huffman) + level_to_name(level), deflate_t<execution_e::sync,  api_e::c,   path>{}, case_params_t{}, data, huffman, canned, level, false, false);
+        register_benchmarks_common("deflate", to_name(huffman) + level_to_name(level), deflate_t<execution_e::async, api_e::c,   path>{}, case_params_t{}, data, huffman, canned, level, false, false);
+
+        if(path != path_e::cpu)
+            continue;
+
+        // Cost of the compression verification, single-threaded and with several threads for the whole file
+        register_benchmarks_common("deflate", to_name(huffman) + level_to_name(level) + to_name(true, "verify"), deflate_t<execution_e::sync, api_e::c, path>{}, case_params_t{}, data, huffman, canned, level, true, false);
+
+        if(is_whole_file)
+        {
+            register_benchmarks_common("deflate", to_name(huffman) + level_to_name(level) + to_name(true, "parallel"), deflate_t<execution_e::sync, api_e::c, path>{}, case_params_t{}, data, huffman, canned, level, false, true);
+            register_benchmarks_common("deflate", to_name(huffman) + level_to_name(level) + to_name(true, "parallel") + to_name(true, "verify"), deflate_t<execution_e::sync, api_e::c, path>{}, case_params_t{}, data, huffman, canned, level, true, true);
+        }
     }
 }
 
@@ -74,8 +86,8 @@ BENCHMARK_SET_DELAYED(deflate)
     std::vector<std::int32_t>   block_sizes = (cmd::get_block_size() >= 0) ? std::vector<std::int32_t>{cmd::get_block_size()} : std::vector<std::int32_t>{4096, 8192, 16384, 65536, 0} ;
     std::vector<huffman_type_e> huffman_modes{huffman_type_e::fixed, huffman_type_e::dynamic};
     std::vector<double>         canned_parts = (cmd::FLAGS_canned_part >= 0) ? std::vector<double>{cmd::FLAGS_canned_part} : std::vector<double>{0.1, 0.5, 0};
-    std::vector<std::int32_t>   sw_levels{1, 3};
-    std::vector<std::int32_t>   hw_levels{1};
+    std::vector<std::int32_t>   sw_levels = (cmd::FLAGS_level > 0) ? std::vector<std::int32_t>{cmd::FLAGS_level} : std::vector<std::int32_t>{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<std::int32_t>   hw_levels = (cmd::FLAGS_level > 1) ? std::vector<std::int32_t>{} : std::vector<std::int32_t>{1};
 
     auto dataset = data::read_dataset(cmd::FLAGS_dataset);
     for(auto &data : dataset)
@@ -87,8 +99,8 @@ BENCHMARK_SET_DELAYED(deflate)
             {
                 for(auto &huffman : huffman_modes)
                 {
-                    cases_set<path_e::iaa>(block, huffman, canned_table_t{}, hw_levels);
-                    cases_set<path_e::cpu>(block, huffman, canned_table_t{}, sw_levels);
+                    cases_set<path_e::iaa>(block, huffman, canned_table_t{}, hw_levels, 0 == size);
+                    cases_set<path_e::cpu>(block, huffman, canned_table_t{}, sw_levels, 0 == size);
                 }
             }
         }
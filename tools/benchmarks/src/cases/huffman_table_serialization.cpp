@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <ops/ops.hpp>
+#include <data_providers.hpp>
+#include <utility.hpp>
+#include <measure.hpp>
+#include <memory>
+#include <stdexcept>
+
+using namespace bench;
+
+static inline std::string format_to_name(qpl_serialization_format_e format)
+{
+    return std::string("/format:") + ((format == serialization_compact) ? "compact" : "raw");
+}
+
+using huffman_table_ptr_t = std::unique_ptr<std::remove_pointer_t<qpl_huffman_table_t>, qpl_status(*)(qpl_huffman_table_t)>;
+
+// Measures deserialization latency of the combined Deflate table built for the data,
+// size of the serialized table is reported with "Size" counter
+template <execution_e exec, api_e api, path_e path>
+class huffman_table_deserialize_t
+{
+public:
+    static constexpr auto exec_v = exec;
+    static constexpr auto api_v  = api;
+    static constexpr auto path_v = path;
+
+    void operator()(benchmark::State &state, const case_params_t &, const data_t &data, qpl_serialization_format_e format) const
+    {
+        try
+        {
+            const serialization_options_t options{format, 0};
+            const qpl_path_t              qpl_path = ops::c_api::to_qpl_path<path>();
+
+            // Prepare serialized table
+            qpl_histogram histogram{};
+            if(qpl_gather_deflate_statistics(const_cast<std::uint8_t*>(data.buffer.data()), static_cast<std::uint32_t>(data.buffer.size()),
+                                             &histogram, qpl_default_level, qpl_path) != QPL_STS_OK)
+                throw std::runtime_error("qpl_gather_deflate_statistics failed");
+
+            qpl_huffman_table_t table_ptr = nullptr;
+            if(qpl_deflate_huffman_table_create(combined_table_type, qpl_path, DEFAULT_ALLOCATOR_C, &table_ptr) != QPL_STS_OK)
+                throw std::runtime_error("qpl_deflate_huffman_table_create failed");
+            huffman_table_ptr_t table(table_ptr, qpl_huffman_table_destroy);
+
+            if(qpl_huffman_table_init_with_histogram(table.get(), &histogram) != QPL_STS_OK)
+                throw std::runtime_error("qpl_huffman_table_init_with_histogram failed");
+
+            std::size_t serialized_size = 0;
+            if(qpl_huffman_table_get_serialized_size(table.get(), options, &serialized_size) != QPL_STS_OK)
+                throw std::runtime_error("qpl_huffman_table_get_serialized_size failed");
+
+            std::vector<std::uint8_t> stream(serialized_size);
+            if(qpl_huffman_table_serialize(table.get(), stream.data(), serialized_size, options) != QPL_STS_OK)
+                throw std::runtime_error("qpl_huffman_table_serialize failed");
+
+            // Measuring loop
+            for(auto _ : state)
+            {
+                qpl_huffman_table_t restored_ptr = nullptr;
+                auto status = qpl_huffman_table_deserialize(stream.data(), serialized_size, DEFAULT_ALLOCATOR_C, &restored_ptr);
+                huffman_table_ptr_t restored(restored_ptr, qpl_huffman_table_destroy);
+
+                if(status != QPL_STS_OK)
+                    throw std::runtime_error("qpl_huffman_table_deserialize failed");
+            }
+
+            // Set counters
+            state.counters["Size"] = benchmark::Counter(static_cast<double>(serialized_size));
+        }
+        catch(std::runtime_error &err) { state.SkipWithError(err.what()); }
+        catch(...)                     { state.SkipWithError("Unknown exception"); }
+    }
+};
+
+template <path_e path>
+static inline void cases_set(data_t &data, qpl_serialization_format_e format)
+{
+    if(path != path_e::cpu && cmd::FLAGS_no_hw)
+        return;
+
+    register_benchmarks_common("huffman_table_deserialize", format_to_name(format), huffman_table_deserialize_t<execution_e::sync, api_e::c, path>{}, case_params_t{}, data, format);
+}
+
+BENCHMARK_SET_DELAYED(huffman_table_deserialize)
+{
+    std::vector<qpl_serialization_format_e> formats{serialization_compact, serialization_raw};
+
+    auto dataset = data::read_dataset(cmd::FLAGS_dataset);
+    for(auto &data : dataset)
+    {
+        for(auto &format : formats)
+        {
+            cases_set<path_e::cpu>(data, format);
+        }
+    }
+}
@@ -219,6 +219,10 @@ BM_DEFINE_bool(no_hw, false);
 
 BM_DEFINE_double(canned_part, -1);
 BM_DEFINE_bool(canned_regen, false);
+BM_DEFINE_int32(level, 0);
+
+BM_DEFINE_int32(bit_width, 0);
+BM_DEFINE_double(selectivity, -1);
 
 static void print_help()
 {
@@ -239,6 +243,11 @@ static void print_help()
             "benchmark [--canned_part=<num>]         - amount of data used for tables generation:\n"
             "                                          0 - full file; (0-1) - portion of file. [1-N] - number of blocks\n"
             "          [--canned_regen]              - regen tables for each part\n"
+            "          [--level=<num>]               - compression level [1-9], all software levels by default\n"
+
+            "\nAnalytics arguments:\n"
+            "benchmark [--bit_width=<num>]           - bit width of the elements [1-32], representative widths by default\n"
+            "          [--selectivity=<num>]         - part of the elements passing the filter (0-1)\n"
 
             "\nDefault benchmark arguments:\n");
 }
@@ -259,7 +268,11 @@ static void parse_local(int* argc, char** argv)
            benchmark::ParseStringFlag(argv[i],  "out_mem",      &FLAGS_out_mem) ||
 
            benchmark::ParseDoubleFlag(argv[i],  "canned_part",  &FLAGS_canned_part) ||
-           benchmark::ParseBoolFlag(argv[i],    "canned_regen", &FLAGS_canned_regen))
+           benchmark::ParseBoolFlag(argv[i],    "canned_regen", &FLAGS_canned_regen) ||
+           benchmark::ParseInt32Flag(argv[i],   "level",        &FLAGS_level) ||
+
+           benchmark::ParseInt32Flag(argv[i],   "bit_width",    &FLAGS_bit_width) ||
+           benchmark::ParseDoubleFlag(argv[i],  "selectivity",  &FLAGS_selectivity))
         {
             for(int j = i; j != *argc - 1; ++j)
                 argv[j] = argv[j + 1];
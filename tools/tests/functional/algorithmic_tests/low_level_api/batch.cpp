@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "operation_test.hpp"
+#include "ta_ll_common.hpp"
+#include "random_generator.h"
+
+namespace qpl::test {
+
+constexpr uint32_t batch_jobs_count    = 64u;
+constexpr uint32_t batch_min_page_size = 4u * 1024u;
+constexpr uint32_t batch_max_page_size = 16u * 1024u;
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(batch, deflate_inflate_pages, JobFixture) {
+    auto path = GetExecutionPath();
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    qpl::test::random random_size(batch_min_page_size, batch_max_page_size, GetSeed());
+    qpl::test::random random_symbol(0u, 15u, GetSeed());
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffers(batch_jobs_count);
+    std::vector<qpl_job *>                  jobs(batch_jobs_count);
+    std::vector<qpl_status>                 statuses(batch_jobs_count, QPL_STS_OK);
+    std::vector<std::vector<uint8_t>>       pages(batch_jobs_count);
+    std::vector<std::vector<uint8_t>>       compressed_pages(batch_jobs_count);
+    std::vector<std::vector<uint8_t>>       decompressed_pages(batch_jobs_count);
+
+    for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+        job_buffers[i] = std::make_unique<uint8_t[]>(job_size);
+        jobs[i]        = reinterpret_cast<qpl_job *>(job_buffers[i].get());
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, jobs[i]));
+
+        pages[i].resize(static_cast<uint32_t>(random_size));
+        std::generate(pages[i].begin(), pages[i].end(), [&]() { return static_cast<uint8_t>(random_symbol); });
+        compressed_pages[i].resize(pages[i].size() * 2u);
+        decompressed_pages[i].resize(pages[i].size());
+
+        jobs[i]->op            = qpl_op_compress;
+        jobs[i]->level         = qpl_default_level;
+        jobs[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        jobs[i]->next_in_ptr   = pages[i].data();
+        jobs[i]->available_in  = static_cast<uint32_t>(pages[i].size());
+        jobs[i]->next_out_ptr  = compressed_pages[i].data();
+        jobs[i]->available_out = static_cast<uint32_t>(compressed_pages[i].size());
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_submit_batch(jobs.data(), batch_jobs_count, statuses.data()));
+    ASSERT_EQ(QPL_STS_OK, qpl_wait_batch(jobs.data(), batch_jobs_count, statuses.data()));
+
+    for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+        ASSERT_EQ(QPL_STS_OK, statuses[i]) << "Compression of page " << i;
+        compressed_pages[i].resize(jobs[i]->total_out);
+
+        jobs[i]->op            = qpl_op_decompress;
+        jobs[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        jobs[i]->next_in_ptr   = compressed_pages[i].data();
+        jobs[i]->available_in  = static_cast<uint32_t>(compressed_pages[i].size());
+        jobs[i]->next_out_ptr  = decompressed_pages[i].data();
+        jobs[i]->available_out = static_cast<uint32_t>(decompressed_pages[i].size());
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_submit_batch(jobs.data(), batch_jobs_count, statuses.data()));
+    ASSERT_EQ(QPL_STS_OK, qpl_wait_batch(jobs.data(), batch_jobs_count, statuses.data()));
+
+    for (uint32_t i = 0u; i < batch_jobs_count; i++) {
+        ASSERT_EQ(QPL_STS_OK, statuses[i]) << "Decompression of page " << i;
+        ASSERT_EQ(pages[i].size(), jobs[i]->total_out) << "Decompression of page " << i;
+        ASSERT_TRUE(std::equal(pages[i].begin(), pages[i].end(), decompressed_pages[i].begin()))
+                                    << "Decompression of page " << i;
+
+        qpl_fini_job(jobs[i]);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(batch, per_job_status, JobFixture) {
+    uint8_t    source[16] = {};
+    qpl_job    *jobs[2]   = {job_ptr, nullptr};
+    qpl_status statuses[2];
+
+    job_ptr->op           = qpl_op_crc64;
+    job_ptr->crc64_poly   = 0x9A6C9329AC4BC9B5ULL;
+    job_ptr->next_in_ptr  = source;
+    job_ptr->available_in = sizeof(source);
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_submit_batch(jobs, 2u, statuses));
+    EXPECT_EQ(QPL_STS_OK, statuses[0]);
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, statuses[1]);
+
+    // The job with failed submission is skipped and keeps its status
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_wait_batch(jobs, 2u, statuses));
+    EXPECT_EQ(QPL_STS_OK, statuses[0]);
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, statuses[1]);
+}
+
+}
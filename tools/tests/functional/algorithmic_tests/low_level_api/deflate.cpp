@@ -13,6 +13,7 @@
 #include "../../../common/execution_wrapper.hpp"
 #include "util.hpp"
 #include "source_provider.hpp"
+#include "random_generator.h"
 
 namespace qpl::test {
 enum HeaderType {
@@ -112,6 +113,41 @@ protected:
         ASSERT_TRUE(CompareVectors(decompressed_source, source));
     }
 
+    void CompressIncompressibleDynamicMode(qpl_compression_levels level) {
+        constexpr uint32_t source_size = 256u * 1024u;
+
+        qpl::test::random random(0u, UINT8_MAX, GetSeed());
+
+        source.resize(source_size);
+        std::generate(source.begin(), source.end(), [&random]() { return static_cast<uint8_t>(random); });
+        destination.resize(source_size * 2u);
+
+        job_ptr->flags |= QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job_ptr->available_in  = source_size;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->level         = level;
+
+        auto status = run_job_api(job_ptr);
+
+        if (qpl_path_hardware == job_ptr->data_ptr.path) {
+            if (QPL_FLAG_ZLIB_MODE & job_ptr->flags) {
+                ASSERT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, status);
+                return;
+            }
+        }
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        destination.resize(job_ptr->total_out);
+
+        std::vector<uint8_t> decompressed_source(source.size());
+
+        DecompressStream(destination, decompressed_source);
+
+        ASSERT_TRUE(CompareVectors(decompressed_source, source));
+    }
+
     void CompressStaticMode(qpl_compression_levels level, bool omit_verification = true) {
         qpl_huffman_table_t huffman_table_ptr;
 
@@ -293,6 +329,102 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_default_level, Defla
     CompressFixedMode(qpl_default_level);
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_blocks_all_levels, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression levels above default on the hardware path";
+        }
+        return;
+    }
+
+    for (auto level : {qpl_level_2, qpl_level_4, qpl_level_5, qpl_level_6, qpl_level_7, qpl_level_8, qpl_level_9}) {
+        SCOPED_TRACE(testing::Message() << "level: " << level);
+
+        SetUpBeforeIteration();
+        CompressDynamicMode(level);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_blocks_all_levels_incompressible, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression levels above default on the hardware path";
+        }
+        return;
+    }
+
+    // Random data is written as stored blocks, the output must fit them all
+    for (auto level : {qpl_level_2, qpl_level_4, qpl_level_5, qpl_level_6, qpl_level_7, qpl_level_8, qpl_level_9}) {
+        SCOPED_TRACE(testing::Message() << "level: " << level);
+
+        SetUpBeforeIteration();
+        CompressIncompressibleDynamicMode(level);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_blocks_levels_ratio, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression levels above default on the hardware path";
+        }
+        return;
+    }
+
+    // The header doesn't change the compressed size
+    if (no_header != GetTestCase().header) {
+        return;
+    }
+
+    uint32_t default_level_size = 0u;
+
+    for (auto level : {qpl_level_1, qpl_level_2, qpl_level_3, qpl_level_4, qpl_level_5,
+                       qpl_level_6, qpl_level_7, qpl_level_8, qpl_level_9}) {
+        SCOPED_TRACE(testing::Message() << "level: " << level);
+
+        SetUpBeforeIteration();
+        CompressDynamicMode(level);
+
+        if (qpl_level_1 == level) {
+            default_level_size = job_ptr->total_out;
+        } else {
+            // Every level above the default one must compress at least as good as the default one
+            EXPECT_LE(job_ptr->total_out, default_level_size) << GetTestCase().file_name;
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, static_blocks_all_levels, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression levels above default on the hardware path";
+        }
+        return;
+    }
+
+    for (auto level : {qpl_level_2, qpl_level_4, qpl_level_5, qpl_level_6, qpl_level_7, qpl_level_8, qpl_level_9}) {
+        SCOPED_TRACE(testing::Message() << "level: " << level);
+
+        SetUpBeforeIteration();
+        CompressStaticMode(level);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_all_levels, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression levels above default on the hardware path";
+        }
+        return;
+    }
+
+    for (auto level : {qpl_level_2, qpl_level_4, qpl_level_5, qpl_level_6, qpl_level_7, qpl_level_8, qpl_level_9}) {
+        SCOPED_TRACE(testing::Message() << "level: " << level);
+
+        SetUpBeforeIteration();
+        CompressFixedMode(level);
+    }
+}
+
 QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_index, dynamic_blocks_high_level, DeflateTest) {
     if (GetExecutionPath() == qpl_path_hardware) {
         GTEST_SKIP() << "Resource management mistake when HW test (replaced by test deflate_high.dynamic_verify";
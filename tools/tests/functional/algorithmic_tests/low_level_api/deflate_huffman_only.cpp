@@ -332,6 +332,85 @@ protected:
         }
     }
 
+    // Software decompression decodes the bulk of the stream with several symbols per lookup and the last bytes
+    // symbol by symbol, so the stream sizes around the switching point and the exact output size are checked
+    void RunHuffmanOnlySizesTest(bool is_big_endian) {
+        const uint32_t source_sizes[] = {32u, 33u, 47u, 48u, 63u, 100u, 257u, 1000u, 4095u, 4096u, 4097u, 12345u};
+
+        std::vector<uint8_t> full_source(*std::max_element(std::begin(source_sizes), std::end(source_sizes)));
+
+        // Short and long codes are mixed
+        for (uint32_t i = 0u; i < full_source.size(); i++) {
+            full_source[i] = static_cast<uint8_t>((0u == i % 5u) ? (i * 131u) >> 3u : 'a' + (i * i) % 3u);
+        }
+
+        for (uint32_t source_size : source_sizes) {
+            source.assign(full_source.begin(), full_source.begin() + source_size);
+            destination.assign(source_size * 2u, 0u);
+
+            std::vector<uint8_t> reference_buffer(source_size, 0u);
+
+            qpl_huffman_table_t c_huffman_table;
+            auto status = qpl_huffman_only_table_create(compression_table_type,
+                                                        GetExecutionPath(),
+                                                        DEFAULT_ALLOCATOR_C,
+                                                        &c_huffman_table);
+            ASSERT_EQ(QPL_STS_OK, status) << "Table creation failed";
+
+            job_ptr->op            = qpl_op_compress;
+            job_ptr->next_in_ptr   = source.data();
+            job_ptr->available_in  = source_size;
+            job_ptr->next_out_ptr  = destination.data();
+            job_ptr->available_out = static_cast<uint32_t>(destination.size());
+            job_ptr->huffman_table = c_huffman_table;
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_NO_HDRS | QPL_FLAG_GEN_LITERALS |
+                                     QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY |
+                                     ((is_big_endian) ? QPL_FLAG_HUFFMAN_BE : no_flag);
+
+            status = run_job_api(job_ptr);
+            ASSERT_EQ(QPL_STS_OK, status);
+
+            qpl_huffman_table_t d_huffman_table;
+            status = qpl_huffman_only_table_create(decompression_table_type,
+                                                   GetExecutionPath(),
+                                                   DEFAULT_ALLOCATOR_C,
+                                                   &d_huffman_table);
+            ASSERT_EQ(QPL_STS_OK, status) << "Table creation failed";
+
+            status = qpl_huffman_table_init_with_other(d_huffman_table, c_huffman_table);
+            ASSERT_EQ(QPL_STS_OK, status) << "Decompression table creation failed";
+
+            decompression_job_ptr->op            = qpl_op_decompress;
+            decompression_job_ptr->next_in_ptr   = destination.data();
+            decompression_job_ptr->available_in  = job_ptr->total_out;
+            decompression_job_ptr->next_out_ptr  = reference_buffer.data();
+            decompression_job_ptr->available_out = source_size;
+            decompression_job_ptr->huffman_table = d_huffman_table;
+            decompression_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_NO_HDRS |
+                                                   ((is_big_endian) ? QPL_FLAG_HUFFMAN_BE : no_flag);
+
+            if (is_big_endian) {
+                decompression_job_ptr->ignore_end_bits = (16 - job_ptr->last_bit_offset) & 15;
+            } else {
+                decompression_job_ptr->ignore_end_bits = (8 - job_ptr->last_bit_offset) & 7;
+            }
+
+            status = run_job_api(decompression_job_ptr);
+
+            // IAA 1.0 limitation: cannot work if ignore_end_bits is greater than 7 bits for BE16 decompress
+            if (is_big_endian && qpl_path_hardware == job_ptr->data_ptr.path && decompression_job_ptr->ignore_end_bits > 7) {
+                EXPECT_EQ(QPL_STS_HUFFMAN_BE_IGNORE_MORE_THAN_7_BITS_ERR, status);
+            } else {
+                EXPECT_EQ(QPL_STS_OK, status) << "Source size: " << source_size;
+                EXPECT_EQ(source_size, decompression_job_ptr->total_out) << "Source size: " << source_size;
+                EXPECT_TRUE(CompareVectors(source, reference_buffer, source_size)) << "Source size: " << source_size;
+            }
+
+            EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(c_huffman_table));
+            EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(d_huffman_table));
+        }
+    }
+
     // Huffman only compression on SW path was inefficient due to incorrect huffman table construction
     // ISAL routine to compute histogram for HT construction did not do huffman only
     // Manually computing the histogram with a for loop and then constructing HT works properly
@@ -432,4 +511,12 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, dynamic_correct_single_value_
     RunHuffmanOnlyDynamicCorrectnessTest();
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, sizes_le, DeflateTestHuffmanOnly) {
+    RunHuffmanOnlySizesTest(false);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, sizes_be, DeflateTestHuffmanOnly) {
+    RunHuffmanOnlySizesTest(true);
+}
+
 }
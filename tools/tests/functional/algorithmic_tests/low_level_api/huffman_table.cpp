@@ -428,9 +428,6 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, init_with_histogram, Huffma
                  test_case.algorithm == compression_algorithm_huffman_only,
                  "initialization from histogram is not supported for combined table type currently with huffman only");
 
-    SKIP_TC_TEST((test_case.options.format != serialization_raw),
-                 "serialization only supports raw format");
-
     switch (test_case.algorithm) {
         case compression_algorithm_deflate:
             ASSERT_TRUE(run_create_tables<compression_algorithm_deflate>(test_case.c_type, test_case.d_type));
@@ -525,9 +522,6 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(huffman_table, init_with_other, HuffmanTab
     SKIP_TC_TEST(test_case.d_type == combined_table_type,
                  "initialization of combined table type from other table is not supported currently");
 
-    SKIP_TC_TEST((test_case.options.format != serialization_raw),
-                 "serialization only supports raw format");
-
     switch (test_case.algorithm) {
         case compression_algorithm_deflate:
             ASSERT_TRUE(run_create_tables<compression_algorithm_deflate>(test_case.c_type, test_case.d_type));
@@ -5,12 +5,14 @@
  ******************************************************************************/
 
 #include "cstring"
+#include <vector>
 
 #include "gendefs.hpp"
 #include "igenerator.h"
 #include "../../../common/operation_test.hpp"
 #include "ta_ll_common.hpp"
 #include "source_provider.hpp"
+#include "random_generator.h"
 
 typedef struct qpl_decompression_huffman_table qpl_decompression_huffman_table;
 
@@ -242,4 +244,160 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate, all_literal_lengths, Inflate) {
     ASSERT_TRUE(RunTestOnDataPreset(compressed_source,
                                     encoded_source));
 }
+
+// Checksums accumulated by the software inflate must cover the whole output of a multi-job stream,
+// odd chunk sizes make jobs end in the middle of 16-bit words of the XOR checksum
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate, checksums_in_chunks, Inflate) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Checksums are accumulated during decompression on the software path only";
+    }
+
+    constexpr uint32_t source_size = 300000u;
+
+    qpl::test::random random_value(0u, 15u, GetSeed());
+
+    std::vector<uint8_t> source(source_size);
+    std::generate(source.begin(), source.end(), [&random_value]() {
+        return static_cast<uint8_t>(random_value);
+    });
+
+    uint32_t reference_xor = 0u;
+    for (uint32_t i = 0u; i < source_size; i += 2u) {
+        reference_xor ^= source[i] | ((i + 1u < source_size) ? static_cast<uint32_t>(source[i + 1u]) << 8u : 0u);
+    }
+
+    for (uint32_t wrapper_flag : {0u, QPL_FLAG_GZIP_MODE, QPL_FLAG_ZLIB_MODE}) {
+        std::vector<uint8_t> compressed(source_size * 2u);
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = source_size;
+        job_ptr->next_out_ptr  = compressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY
+                                 | wrapper_flag;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+        const uint32_t compressed_size = job_ptr->total_out;
+        const uint32_t reference_crc   = job_ptr->crc;
+
+        for (uint32_t chunk_size : {1001u, 4097u, compressed_size}) {
+            std::vector<uint8_t> destination(source_size);
+
+            job_ptr->op            = qpl_op_decompress;
+            job_ptr->next_out_ptr  = destination.data();
+            job_ptr->available_out = source_size;
+            job_ptr->flags         = QPL_FLAG_FIRST | wrapper_flag;
+
+            for (uint32_t offset = 0u; offset < compressed_size; offset += chunk_size) {
+                job_ptr->next_in_ptr  = compressed.data() + offset;
+                job_ptr->available_in = std::min(chunk_size, compressed_size - offset);
+
+                if (offset + chunk_size >= compressed_size) {
+                    job_ptr->flags |= QPL_FLAG_LAST;
+                }
+
+                ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "Chunk size " << chunk_size;
+
+                job_ptr->flags &= ~QPL_FLAG_FIRST;
+            }
+
+            ASSERT_EQ(source, destination) << "Chunk size " << chunk_size;
+            EXPECT_EQ(reference_xor, job_ptr->xor_checksum) << "Chunk size " << chunk_size;
+
+            // Zlib stream keeps Adler32 in the crc field, it is checked by the trailer
+            if (QPL_FLAG_ZLIB_MODE != wrapper_flag) {
+                EXPECT_EQ(reference_crc, job_ptr->crc) << "Chunk size " << chunk_size;
+            }
+        }
+    }
+}
+
+// Concatenated members are decompressed by a single job, the headers have the optional name and comment fields
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(inflate, gzip_members, Inflate) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Concatenated gzip members are supported on the software path only";
+    }
+
+    constexpr uint32_t source_size   = 100001u;
+    constexpr uint32_t members_count = 3u;
+
+    const std::vector<uint8_t> headers[members_count] = {
+            {0x1f, 0x8b, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 'a', '.', 't', 'x', 't', 0x00},
+            {0x1f, 0x8b, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 'm', 'e', 'm', 'b', 'e', 'r', 0x00},
+            {0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff}};
+
+    qpl::test::random random_value(0u, 15u, GetSeed());
+
+    std::vector<uint8_t> source(source_size);
+    std::generate(source.begin(), source.end(), [&random_value]() {
+        return static_cast<uint8_t>(random_value);
+    });
+
+    std::vector<uint8_t> stream;
+    std::vector<uint8_t> deflate_block(source_size * 2u);
+    size_t               first_trailer_offset = 0u;
+
+    // Members of odd sizes
+    const uint32_t member_size = source_size / members_count;
+
+    for (uint32_t member = 0u; member < members_count; member++) {
+        const uint32_t begin = member * member_size;
+        const uint32_t size  = (member + 1u == members_count) ? source_size - begin : member_size;
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->next_in_ptr   = source.data() + begin;
+        job_ptr->available_in  = size;
+        job_ptr->next_out_ptr  = deflate_block.data();
+        job_ptr->available_out = static_cast<uint32_t>(deflate_block.size());
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+        stream.insert(stream.end(), headers[member].begin(), headers[member].end());
+        stream.insert(stream.end(), deflate_block.begin(), deflate_block.begin() + job_ptr->total_out);
+
+        if (0u == member) {
+            first_trailer_offset = stream.size();
+        }
+
+        for (uint32_t value : {job_ptr->crc, size}) {
+            for (uint32_t byte = 0u; byte < 4u; byte++) {
+                stream.push_back(static_cast<uint8_t>(value >> (8u * byte)));
+            }
+        }
+    }
+
+    uint32_t reference_xor = 0u;
+    for (uint32_t i = 0u; i < source_size; i += 2u) {
+        reference_xor ^= source[i] | ((i + 1u < source_size) ? static_cast<uint32_t>(source[i + 1u]) << 8u : 0u);
+    }
+
+    std::vector<uint8_t> destination(source_size);
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->next_in_ptr   = stream.data();
+    job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = source_size;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE;
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+    EXPECT_EQ(stream.size(), job_ptr->total_in);
+    EXPECT_EQ(source, destination);
+    EXPECT_EQ(reference_xor, job_ptr->xor_checksum);
+
+    // The trailer of a member in the middle is checked as well
+    stream[first_trailer_offset] ^= 1u;
+
+    job_ptr->next_in_ptr   = stream.data();
+    job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = source_size;
+
+    EXPECT_NE(QPL_STS_OK, run_job_api(job_ptr));
+}
 }
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "operation_test.hpp"
+#include "ta_ll_common.hpp"
+#include "random_generator.h"
+
+namespace qpl::test {
+
+constexpr uint32_t job_size_ex_source_size = 64u * 1024u;
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_size_ex, class_sizes, JobFixture) {
+    auto path = GetExecutionPath();
+
+    uint32_t full_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &full_size));
+
+    uint32_t all_classes_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_ex(path, QPL_OP_CLASS_ALL, &all_classes_size));
+    EXPECT_EQ(full_size, all_classes_size);
+
+    for (uint32_t op_class : {QPL_OP_CLASS_COMPRESS, QPL_OP_CLASS_DECOMPRESS, QPL_OP_CLASS_ANALYTICS, QPL_OP_CLASS_CRC64}) {
+        uint32_t class_size = 0u;
+        ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_ex(path, op_class, &class_size));
+        EXPECT_LE(class_size, full_size) << "Operation class " << op_class;
+    }
+
+    uint32_t decompress_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_ex(path, QPL_OP_CLASS_DECOMPRESS, &decompress_size));
+    EXPECT_LT(decompress_size, full_size);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_size_ex, compress_decompress_crc64, JobFixture) {
+    auto path = GetExecutionPath();
+
+    qpl::test::random random_symbol(0u, 15u, GetSeed());
+
+    std::vector<uint8_t> source(job_size_ex_source_size);
+    std::vector<uint8_t> compressed(source.size() * 2u);
+    std::vector<uint8_t> decompressed(source.size());
+    std::generate(source.begin(), source.end(), [&]() { return static_cast<uint8_t>(random_symbol); });
+
+    uint32_t compress_size   = 0u;
+    uint32_t decompress_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_ex(path, QPL_OP_CLASS_COMPRESS, &compress_size));
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_ex(path, QPL_OP_CLASS_DECOMPRESS | QPL_OP_CLASS_CRC64, &decompress_size));
+
+    auto compress_buffer   = std::make_unique<uint8_t[]>(compress_size);
+    auto decompress_buffer = std::make_unique<uint8_t[]>(decompress_size);
+    auto compress_job_ptr   = reinterpret_cast<qpl_job *>(compress_buffer.get());
+    auto decompress_job_ptr = reinterpret_cast<qpl_job *>(decompress_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job_ex(path, QPL_OP_CLASS_COMPRESS, compress_job_ptr));
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job_ex(path, QPL_OP_CLASS_DECOMPRESS | QPL_OP_CLASS_CRC64, decompress_job_ptr));
+
+    compress_job_ptr->op            = qpl_op_compress;
+    compress_job_ptr->level         = qpl_default_level;
+    compress_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN;
+    compress_job_ptr->next_in_ptr   = source.data();
+    compress_job_ptr->available_in  = static_cast<uint32_t>(source.size());
+    compress_job_ptr->next_out_ptr  = compressed.data();
+    compress_job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(compress_job_ptr));
+    compressed.resize(compress_job_ptr->total_out);
+
+    // The compression job is not sized for the other operations
+    compress_job_ptr->op = qpl_op_decompress;
+    EXPECT_EQ(QPL_STS_BAD_JOB_STRUCT_ERR, run_job_api(compress_job_ptr));
+
+    decompress_job_ptr->op            = qpl_op_decompress;
+    decompress_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    decompress_job_ptr->next_in_ptr   = compressed.data();
+    decompress_job_ptr->available_in  = static_cast<uint32_t>(compressed.size());
+    decompress_job_ptr->next_out_ptr  = decompressed.data();
+    decompress_job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(decompress_job_ptr));
+    ASSERT_EQ(source.size(), decompress_job_ptr->total_out);
+    ASSERT_TRUE(std::equal(source.begin(), source.end(), decompressed.begin()));
+
+    decompress_job_ptr->op           = qpl_op_crc64;
+    decompress_job_ptr->flags        = 0u;
+    decompress_job_ptr->crc64_poly   = 0x9A6C9329AC4BC9B5ULL;
+    decompress_job_ptr->next_in_ptr  = source.data();
+    decompress_job_ptr->available_in = static_cast<uint32_t>(source.size());
+
+    EXPECT_EQ(QPL_STS_OK, run_job_api(decompress_job_ptr));
+
+    decompress_job_ptr->op = qpl_op_compress;
+    EXPECT_EQ(QPL_STS_BAD_JOB_STRUCT_ERR, run_job_api(decompress_job_ptr));
+
+    qpl_fini_job(compress_job_ptr);
+    qpl_fini_job(decompress_job_ptr);
+}
+
+}
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "operation_test.hpp"
+#include "ta_ll_common.hpp"
+#include "random_generator.h"
+#include "ref_convert.h"
+
+namespace qpl::test {
+
+constexpr uint32_t prle_output_max_run    = 300u;
+constexpr uint32_t prle_output_group_size = 8u;
+
+// Random elements mixed with runs of equal elements of random lengths
+static auto generate_runs(uint32_t number_of_elements, uint32_t bit_width, uint32_t seed) -> std::vector<uint32_t> {
+    const uint32_t max_value = (32u == bit_width) ? UINT32_MAX : (1u << bit_width) - 1u;
+
+    qpl::test::random random_value(0u, static_cast<double>(max_value), seed);
+    qpl::test::random random_length(1u, prle_output_max_run, seed);
+
+    std::vector<uint32_t> elements;
+    elements.reserve(number_of_elements);
+
+    while (elements.size() < number_of_elements) {
+        const auto length = std::min(static_cast<uint32_t>(random_length),
+                                     number_of_elements - static_cast<uint32_t>(elements.size()));
+        const bool is_run = (0u != (length & 1u));
+        const auto value  = static_cast<uint32_t>(random_value);
+
+        for (uint32_t i = 0u; i < length; i++) {
+            elements.push_back(is_run ? value : static_cast<uint32_t>(random_value));
+        }
+    }
+
+    return elements;
+}
+
+static auto pack_le_elements(const std::vector<uint32_t> &elements, uint32_t bit_width) -> std::vector<uint8_t> {
+    std::vector<uint8_t> packed((elements.size() * bit_width + 7u) / 8u, 0u);
+
+    for (size_t idx = 0u; idx < elements.size(); idx++) {
+        for (uint32_t bit = 0u; bit < bit_width; bit++) {
+            const size_t position = idx * bit_width + bit;
+
+            packed[position / 8u] |= static_cast<uint8_t>(((elements[idx] >> bit) & 1u) << (position % 8u));
+        }
+    }
+
+    return packed;
+}
+
+// Every group takes at most its bit-packed bytes with a run header, or a repeated run of up to 5 + 4 bytes
+static auto get_prle_capacity(uint32_t number_of_elements, uint32_t bit_width) -> uint32_t {
+    const uint32_t groups = (number_of_elements + prle_output_group_size - 1u) / prle_output_group_size;
+
+    return 1u + groups * (bit_width + 9u);
+}
+
+static auto decode_prle(const std::vector<uint8_t> &stream, uint32_t size, uint32_t number_of_elements)
+-> std::vector<uint32_t> {
+    std::vector<uint32_t> elements(number_of_elements + prle_output_group_size);
+    uint32_t              available_bytes = size;
+
+    EXPECT_EQ(QPL_STS_OK, ref_convert_to_32u_prle(stream.data(),
+                                                  stream.data() + size,
+                                                  elements.data(),
+                                                  &available_bytes));
+    elements.resize(number_of_elements);
+
+    return elements;
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_output, pack_parquet_rle, JobFixture) {
+    for (uint32_t bit_width = 1u; bit_width <= 32u; bit_width++) {
+        for (uint32_t number_of_elements : {1u, 7u, 64u, 1000u, 4099u}) {
+            for (uint32_t run_threshold : {0u, 8u, 20u}) {
+                const auto elements = generate_runs(number_of_elements, bit_width, GetSeed());
+                const auto source   = pack_le_elements(elements, bit_width);
+
+                std::vector<uint8_t> destination(get_prle_capacity(number_of_elements, bit_width));
+                uint32_t             total_out = 0u;
+
+                ASSERT_EQ(QPL_STS_OK, qpl_pack_parquet_rle(source.data(),
+                                                           static_cast<uint32_t>(source.size()),
+                                                           bit_width,
+                                                           number_of_elements,
+                                                           run_threshold,
+                                                           destination.data(),
+                                                           static_cast<uint32_t>(destination.size()),
+                                                           &total_out));
+
+                ASSERT_EQ(bit_width, destination[0]);
+                ASSERT_EQ(elements, decode_prle(destination, total_out, number_of_elements))
+                                        << "Bit width " << bit_width << ", elements " << number_of_elements
+                                        << ", threshold " << run_threshold;
+            }
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_output, extract, JobFixture) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Parquet RLE output is supported on the software path only";
+    }
+
+    for (uint32_t bit_width : {1u, 5u, 8u, 11u, 16u, 23u, 32u}) {
+        for (uint32_t number_of_elements : {64u, 1000u, 20001u}) {
+            const auto elements = generate_runs(number_of_elements, bit_width, GetSeed());
+            auto       source   = pack_le_elements(elements, bit_width);
+
+            const uint32_t low  = number_of_elements / 10u;
+            const uint32_t high = number_of_elements - number_of_elements / 7u;
+
+            const std::vector<uint32_t> reference(elements.begin() + low, elements.begin() + high + 1u);
+            std::vector<uint8_t>        destination(get_prle_capacity(high - low + 1u, bit_width));
+
+            job_ptr->op                 = qpl_op_extract;
+            job_ptr->next_in_ptr        = source.data();
+            job_ptr->available_in       = static_cast<uint32_t>(source.size());
+            job_ptr->next_out_ptr       = destination.data();
+            job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+            job_ptr->src1_bit_width     = bit_width;
+            job_ptr->num_input_elements = number_of_elements;
+            job_ptr->parser             = qpl_p_le_packed_array;
+            job_ptr->out_bit_width      = qpl_ow_nom;
+            job_ptr->out_rle_threshold  = 0u;
+            job_ptr->param_low          = low;
+            job_ptr->param_high         = high;
+            job_ptr->flags              = QPL_FLAG_OMIT_CHECKSUMS | QPL_FLAG_OUT_PARQUET_RLE;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+            ASSERT_EQ(reference, decode_prle(destination, job_ptr->total_out, high - low + 1u))
+                                    << "Bit width " << bit_width << ", elements " << number_of_elements;
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_output, select, JobFixture) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Parquet RLE output is supported on the software path only";
+    }
+
+    for (uint32_t bit_width : {1u, 5u, 8u, 11u, 16u, 23u, 32u}) {
+        for (uint32_t number_of_elements : {64u, 1000u, 20001u}) {
+            const auto elements = generate_runs(number_of_elements, bit_width, GetSeed());
+            const auto selected = generate_runs(number_of_elements, 1u, GetSeed() + 1u);
+            auto       source   = pack_le_elements(elements, bit_width);
+            auto       mask     = pack_le_elements(selected, 1u);
+
+            std::vector<uint32_t> reference;
+
+            for (uint32_t idx = 0u; idx < number_of_elements; idx++) {
+                if (0u != selected[idx]) {
+                    reference.push_back(elements[idx]);
+                }
+            }
+
+            if (reference.empty()) {
+                continue;
+            }
+
+            const auto           selected_count = static_cast<uint32_t>(reference.size());
+            std::vector<uint8_t> destination(get_prle_capacity(selected_count, bit_width));
+
+            job_ptr->op                 = qpl_op_select;
+            job_ptr->next_in_ptr        = source.data();
+            job_ptr->available_in       = static_cast<uint32_t>(source.size());
+            job_ptr->next_src2_ptr      = mask.data();
+            job_ptr->available_src2     = static_cast<uint32_t>(mask.size());
+            job_ptr->src2_bit_width     = 1u;
+            job_ptr->next_out_ptr       = destination.data();
+            job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+            job_ptr->src1_bit_width     = bit_width;
+            job_ptr->num_input_elements = number_of_elements;
+            job_ptr->parser             = qpl_p_le_packed_array;
+            job_ptr->out_bit_width      = qpl_ow_nom;
+            job_ptr->out_rle_threshold  = 16u;
+            job_ptr->flags              = QPL_FLAG_OMIT_CHECKSUMS | QPL_FLAG_OUT_PARQUET_RLE;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+            ASSERT_EQ(reference, decode_prle(destination, job_ptr->total_out, selected_count))
+                                    << "Bit width " << bit_width << ", elements " << number_of_elements;
+        }
+    }
+}
+
+}
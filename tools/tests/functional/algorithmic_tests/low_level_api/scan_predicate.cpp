@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "operation_test.hpp"
+#include "ta_ll_common.hpp"
+#include "random_generator.h"
+
+namespace qpl::test {
+
+constexpr uint32_t scan_predicate_columns_count = 3u;
+
+static auto pack_le_elements(const std::vector<uint32_t> &elements, uint32_t bit_width) -> std::vector<uint8_t> {
+    std::vector<uint8_t> packed((elements.size() * bit_width + 7u) / 8u, 0u);
+
+    for (size_t idx = 0u; idx < elements.size(); idx++) {
+        for (uint32_t bit = 0u; bit < bit_width; bit++) {
+            const size_t position = idx * bit_width + bit;
+
+            packed[position / 8u] |= static_cast<uint8_t>(((elements[idx] >> bit) & 1u) << (position % 8u));
+        }
+    }
+
+    return packed;
+}
+
+static auto run_scan_job(qpl_job *job_ptr,
+                         qpl_operation operation,
+                         std::vector<uint8_t> &column,
+                         uint32_t bit_width,
+                         uint32_t number_of_elements,
+                         uint32_t param_low,
+                         uint32_t param_high,
+                         std::vector<uint8_t> &bit_vector) -> qpl_status {
+    bit_vector.assign((number_of_elements + 7u) / 8u, 0u);
+
+    job_ptr->op                 = operation;
+    job_ptr->next_in_ptr        = column.data();
+    job_ptr->available_in       = static_cast<uint32_t>(column.size());
+    job_ptr->next_out_ptr       = bit_vector.data();
+    job_ptr->available_out      = static_cast<uint32_t>(bit_vector.size());
+    job_ptr->src1_bit_width     = bit_width;
+    job_ptr->num_input_elements = number_of_elements;
+    job_ptr->out_bit_width      = qpl_ow_nom;
+    job_ptr->param_low          = param_low;
+    job_ptr->param_high         = param_high;
+    job_ptr->flags              = QPL_FLAG_OMIT_CHECKSUMS;
+
+    return run_job_api(job_ptr);
+}
+
+// (a BETWEEN low AND high AND b = value) OR NOT c < value, checked against separate scan jobs.
+// The first column is sorted, so whole blocks of the conjunction are known to be false from it.
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_predicate, conjunction_disjunction_negation, JobFixture) {
+    for (uint32_t bit_width : {1u, 3u, 8u, 13u, 16u, 27u, 32u}) {
+        for (uint32_t number_of_elements : {1u, 63u, 64u, 1000u, 8192u, 20001u}) {
+            const uint32_t max_value = (32u == bit_width) ? UINT32_MAX : (1u << bit_width) - 1u;
+
+            qpl::test::random random_value(0u, std::min(max_value, 7u), GetSeed());
+
+            std::vector<std::vector<uint8_t>> columns(scan_predicate_columns_count);
+            std::vector<qpl_predicate_column> column_descriptors(scan_predicate_columns_count);
+
+            for (uint32_t column = 0u; column < scan_predicate_columns_count; column++) {
+                std::vector<uint32_t> elements(number_of_elements);
+                std::generate(elements.begin(), elements.end(), [&]() {
+                    return static_cast<uint32_t>(random_value);
+                });
+
+                if (0u == column) {
+                    std::sort(elements.begin(), elements.end());
+                }
+
+                columns[column]            = pack_le_elements(elements, bit_width);
+                column_descriptors[column] = {columns[column].data(),
+                                              static_cast<uint32_t>(columns[column].size()),
+                                              bit_width};
+            }
+
+            const uint32_t low   = std::min(max_value, 1u);
+            const uint32_t high  = std::min(max_value, 2u);
+            const uint32_t value = std::min(max_value, 4u);
+
+            const qpl_predicate_instruction program[] = {
+                    {qpl_predicate_scan, qpl_op_scan_range, 0u, low, high},
+                    {qpl_predicate_scan, qpl_op_scan_eq, 1u, value, 0u},
+                    {qpl_predicate_and, qpl_op_scan_eq, 0u, 0u, 0u},
+                    {qpl_predicate_scan, qpl_op_scan_lt, 2u, value, 0u},
+                    {qpl_predicate_not, qpl_op_scan_eq, 0u, 0u, 0u},
+                    {qpl_predicate_or, qpl_op_scan_eq, 0u, 0u, 0u}
+            };
+
+            std::vector<uint8_t> range_result;
+            std::vector<uint8_t> equal_result;
+            std::vector<uint8_t> less_result;
+
+            ASSERT_EQ(QPL_STS_OK, run_scan_job(job_ptr, qpl_op_scan_range, columns[0], bit_width,
+                                               number_of_elements, low, high, range_result));
+            ASSERT_EQ(QPL_STS_OK, run_scan_job(job_ptr, qpl_op_scan_eq, columns[1], bit_width,
+                                               number_of_elements, value, 0u, equal_result));
+            ASSERT_EQ(QPL_STS_OK, run_scan_job(job_ptr, qpl_op_scan_lt, columns[2], bit_width,
+                                               number_of_elements, value, 0u, less_result));
+
+            std::vector<uint8_t> reference(range_result.size());
+            uint32_t first_index = UINT32_MAX;
+            uint32_t last_index  = 0u;
+            uint32_t set_bits    = 0u;
+
+            for (uint32_t idx = 0u; idx < number_of_elements; idx++) {
+                const uint32_t byte = idx / 8u;
+                const uint32_t bit  = idx % 8u;
+                const bool     is_set = (((range_result[byte] & equal_result[byte]) >> bit) & 1u)
+                                        || !((less_result[byte] >> bit) & 1u);
+
+                if (is_set) {
+                    reference[byte] |= static_cast<uint8_t>(1u << bit);
+                    first_index = std::min(first_index, idx);
+                    last_index  = idx;
+                    set_bits++;
+                }
+            }
+
+            std::vector<uint8_t> destination(reference.size());
+            qpl_predicate_result result{};
+
+            ASSERT_EQ(QPL_STS_OK, qpl_scan_predicate(column_descriptors.data(),
+                                                     scan_predicate_columns_count,
+                                                     program,
+                                                     sizeof(program) / sizeof(program[0]),
+                                                     number_of_elements,
+                                                     destination.data(),
+                                                     static_cast<uint32_t>(destination.size()),
+                                                     &result));
+
+            ASSERT_EQ(reference, destination) << "Bit width " << bit_width << ", elements " << number_of_elements;
+            EXPECT_EQ(reference.size(), result.total_out);
+            EXPECT_EQ(first_index, result.first_index_min_value);
+            EXPECT_EQ(last_index, result.last_index_max_value);
+            EXPECT_EQ(set_bits, result.sum_value);
+        }
+    }
+}
+
+}
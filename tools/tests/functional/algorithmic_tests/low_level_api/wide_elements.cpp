@@ -0,0 +1,305 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "operation_test.hpp"
+#include "ta_ll_common.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t wide_elements_values_count = 16u;
+
+// Elements are taken from a small set of random values, so the equal elements and the bounds of the scans occur
+static auto generate_wide_elements(uint32_t number_of_elements, uint32_t bit_width, uint32_t seed)
+-> std::vector<uint64_t> {
+    const uint64_t  max_value = (64u == bit_width) ? UINT64_MAX : (1ULL << bit_width) - 1u;
+    std::mt19937_64 generator(seed);
+
+    std::vector<uint64_t> values(wide_elements_values_count);
+
+    for (auto &value : values) {
+        value = generator() & max_value;
+    }
+
+    // The extreme values check that no high bits are lost
+    values[0] = max_value;
+    values[1] = 0u;
+
+    std::vector<uint64_t> elements(number_of_elements);
+
+    for (auto &element : elements) {
+        element = values[generator() % wide_elements_values_count];
+    }
+
+    return elements;
+}
+
+static auto pack_wide_elements(const std::vector<uint64_t> &elements, uint32_t bit_width, qpl_parser parser)
+-> std::vector<uint8_t> {
+    std::vector<uint8_t> packed((elements.size() * bit_width + 7u) / 8u, 0u);
+
+    for (size_t idx = 0u; idx < elements.size(); idx++) {
+        for (uint32_t bit = 0u; bit < bit_width; bit++) {
+            const size_t position = idx * bit_width + bit;
+
+            if (qpl_p_be_packed_array == parser) {
+                // The most significant bit goes first, starting with the most significant bit of the byte
+                packed[position / 8u] |= static_cast<uint8_t>(((elements[idx] >> (bit_width - 1u - bit)) & 1u)
+                                                              << (7u - position % 8u));
+            } else {
+                packed[position / 8u] |= static_cast<uint8_t>(((elements[idx] >> bit) & 1u) << (position % 8u));
+            }
+        }
+    }
+
+    return packed;
+}
+
+static auto generate_mask(uint32_t number_of_elements, uint32_t seed) -> std::vector<uint64_t> {
+    std::mt19937_64       generator(seed);
+    std::vector<uint64_t> mask(number_of_elements);
+
+    for (auto &bit : mask) {
+        bit = generator() & 1u;
+    }
+
+    return mask;
+}
+
+static auto is_wide_scan_match(qpl_operation operation, uint64_t element, uint64_t low, uint64_t high) -> bool {
+    switch (operation) {
+        case qpl_op_scan_eq: return element == low;
+        case qpl_op_scan_ne: return element != low;
+        case qpl_op_scan_lt: return element < low;
+        case qpl_op_scan_le: return element <= low;
+        case qpl_op_scan_gt: return element > low;
+        case qpl_op_scan_ge: return element >= low;
+        case qpl_op_scan_range: return element >= low && element <= high;
+        default: return element < low || element > high;
+    }
+}
+
+static void set_wide_job(qpl_job *job_ptr,
+                         qpl_operation operation,
+                         std::vector<uint8_t> &source,
+                         uint32_t bit_width,
+                         uint32_t number_of_elements,
+                         std::vector<uint8_t> &destination) {
+    job_ptr->op                 = operation;
+    job_ptr->next_in_ptr        = source.data();
+    job_ptr->available_in       = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr       = destination.data();
+    job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    job_ptr->src1_bit_width     = bit_width;
+    job_ptr->num_input_elements = number_of_elements;
+    job_ptr->parser             = qpl_p_le_packed_array;
+    job_ptr->out_bit_width      = qpl_ow_nom;
+    job_ptr->flags              = 0u;
+}
+
+constexpr uint32_t wide_bit_widths[]          = {33u, 40u, 47u, 57u, 63u, 64u};
+constexpr uint32_t wide_numbers_of_elements[] = {1u, 63u, 1000u, 4099u};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, scan, JobFixture) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Elements wider than 32 bits are supported on the software path only";
+    }
+
+    const qpl_operation operations[] = {qpl_op_scan_eq, qpl_op_scan_ne, qpl_op_scan_lt, qpl_op_scan_le,
+                                        qpl_op_scan_gt, qpl_op_scan_ge, qpl_op_scan_range, qpl_op_scan_not_range};
+
+    for (uint32_t bit_width : wide_bit_widths) {
+        for (uint32_t number_of_elements : wide_numbers_of_elements) {
+            for (qpl_parser parser : {qpl_p_le_packed_array, qpl_p_be_packed_array}) {
+                const auto elements = generate_wide_elements(number_of_elements, bit_width, GetSeed());
+                auto       source   = pack_wide_elements(elements, bit_width, parser);
+
+                const uint64_t low  = std::min(elements[0], elements[number_of_elements / 2u]);
+                const uint64_t high = std::max(elements[0], elements[number_of_elements / 2u]);
+
+                for (qpl_operation operation : operations) {
+                    std::vector<uint8_t> destination((number_of_elements + 7u) / 8u, 0u);
+                    std::vector<uint8_t> reference(destination.size(), 0u);
+
+                    for (uint32_t idx = 0u; idx < number_of_elements; idx++) {
+                        if (is_wide_scan_match(operation, elements[idx], low, high)) {
+                            reference[idx / 8u] |= static_cast<uint8_t>(1u << (idx % 8u));
+                        }
+                    }
+
+                    set_wide_job(job_ptr, operation, source, bit_width, number_of_elements, destination);
+                    job_ptr->parser        = parser;
+                    job_ptr->param_low     = 0u;
+                    job_ptr->param_high    = 0u;
+                    job_ptr->param_low_64  = low;
+                    job_ptr->param_high_64 = high;
+
+                    ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+                    ASSERT_EQ(reference.size(), job_ptr->total_out);
+                    ASSERT_EQ(reference, destination) << "Operation " << operation << ", bit width " << bit_width
+                                                      << ", elements " << number_of_elements
+                                                      << ", parser " << parser;
+                }
+            }
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, extract_and_aggregates, JobFixture) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Elements wider than 32 bits are supported on the software path only";
+    }
+
+    for (uint32_t bit_width : wide_bit_widths) {
+        for (uint32_t number_of_elements : wide_numbers_of_elements) {
+            const auto elements = generate_wide_elements(number_of_elements, bit_width, GetSeed());
+            auto       source   = pack_wide_elements(elements, bit_width, qpl_p_le_packed_array);
+
+            const uint32_t low  = number_of_elements / 10u;
+            const uint32_t high = number_of_elements - 1u - number_of_elements / 7u;
+
+            const std::vector<uint64_t> extracted(elements.begin() + low, elements.begin() + high + 1u);
+            const auto                  reference = pack_wide_elements(extracted, bit_width, qpl_p_le_packed_array);
+
+            uint64_t sum = 0u;
+
+            for (uint64_t element : extracted) {
+                sum += element;
+            }
+
+            std::vector<uint8_t> destination(static_cast<size_t>(number_of_elements) * sizeof(uint64_t), 0u);
+
+            set_wide_job(job_ptr, qpl_op_extract, source, bit_width, number_of_elements, destination);
+            job_ptr->param_low  = low;
+            job_ptr->param_high = high;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+            ASSERT_EQ(reference.size(), job_ptr->total_out);
+            ASSERT_TRUE(std::equal(reference.begin(), reference.end(), destination.begin()))
+                                    << "Bit width " << bit_width << ", elements " << number_of_elements;
+
+            // The sum wraps modulo 2^64
+            EXPECT_EQ(*std::min_element(extracted.begin(), extracted.end()), job_ptr->min_value_64);
+            EXPECT_EQ(*std::max_element(extracted.begin(), extracted.end()), job_ptr->max_value_64);
+            EXPECT_EQ(sum, job_ptr->sum_value_64);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, select, JobFixture) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Elements wider than 32 bits are supported on the software path only";
+    }
+
+    for (uint32_t bit_width : wide_bit_widths) {
+        for (uint32_t number_of_elements : wide_numbers_of_elements) {
+            const auto elements = generate_wide_elements(number_of_elements, bit_width, GetSeed());
+            const auto selected = generate_mask(number_of_elements, GetSeed() + 1u);
+            auto       source   = pack_wide_elements(elements, bit_width, qpl_p_le_packed_array);
+            auto       mask     = pack_wide_elements(selected, 1u, qpl_p_le_packed_array);
+
+            std::vector<uint64_t> reference_elements;
+
+            for (uint32_t idx = 0u; idx < number_of_elements; idx++) {
+                if (0u != selected[idx]) {
+                    reference_elements.push_back(elements[idx]);
+                }
+            }
+
+            const auto reference = pack_wide_elements(reference_elements, bit_width, qpl_p_le_packed_array);
+
+            std::vector<uint8_t> destination(static_cast<size_t>(number_of_elements) * sizeof(uint64_t), 0u);
+
+            set_wide_job(job_ptr, qpl_op_select, source, bit_width, number_of_elements, destination);
+            job_ptr->next_src2_ptr  = mask.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(mask.size());
+            job_ptr->src2_bit_width = 1u;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+            ASSERT_EQ(reference.size(), job_ptr->total_out);
+            ASSERT_TRUE(std::equal(reference.begin(), reference.end(), destination.begin()))
+                                    << "Bit width " << bit_width << ", elements " << number_of_elements;
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, expand, JobFixture) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "Elements wider than 32 bits are supported on the software path only";
+    }
+
+    for (uint32_t bit_width : wide_bit_widths) {
+        // Every bit of the mask bytes is an output element, so the mask has no padding bits
+        for (uint32_t number_of_elements : {8u, 64u, 1000u, 4096u}) {
+            // The source has an element per mask bit, only the first ones are taken by the set bits
+            const auto expanded = generate_mask(number_of_elements, GetSeed() + 1u);
+            const auto elements = generate_wide_elements(number_of_elements, bit_width, GetSeed());
+            auto       source   = pack_wide_elements(elements, bit_width, qpl_p_le_packed_array);
+            auto       mask     = pack_wide_elements(expanded, 1u, qpl_p_le_packed_array);
+
+            std::vector<uint64_t> reference_elements(number_of_elements, 0u);
+
+            for (uint32_t idx = 0u, element_idx = 0u; idx < number_of_elements; idx++) {
+                if (0u != expanded[idx]) {
+                    reference_elements[idx] = elements[element_idx++];
+                }
+            }
+
+            const auto reference = pack_wide_elements(reference_elements, bit_width, qpl_p_le_packed_array);
+
+            std::vector<uint8_t> destination(static_cast<size_t>(number_of_elements) * sizeof(uint64_t), 0u);
+
+            set_wide_job(job_ptr, qpl_op_expand, source, bit_width, number_of_elements, destination);
+            job_ptr->next_src2_ptr  = mask.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(mask.size());
+            job_ptr->src2_bit_width = 1u;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+            ASSERT_EQ(reference.size(), job_ptr->total_out);
+            ASSERT_TRUE(std::equal(reference.begin(), reference.end(), destination.begin()))
+                                    << "Bit width " << bit_width << ", elements " << number_of_elements;
+        }
+    }
+}
+
+// The auto path runs the elements wider than 32 bits on the software path instead of failing on the accelerator
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(wide_elements_auto_path, scan_routing) {
+    constexpr uint32_t bit_width          = 48u;
+    constexpr uint32_t number_of_elements = 1000u;
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_auto, &job_size));
+
+    std::vector<uint8_t> job_buffer(job_size);
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_auto, job_ptr));
+
+    const auto elements = generate_wide_elements(number_of_elements, bit_width,
+                                                 util::TestEnvironment::GetInstance().GetSeed());
+    auto       source   = pack_wide_elements(elements, bit_width, qpl_p_le_packed_array);
+
+    std::vector<uint8_t> destination((number_of_elements + 7u) / 8u, 0u);
+    std::vector<uint8_t> reference(destination.size(), 0u);
+
+    for (uint32_t idx = 0u; idx < number_of_elements; idx++) {
+        if (elements[idx] >= elements[0]) {
+            reference[idx / 8u] |= static_cast<uint8_t>(1u << (idx % 8u));
+        }
+    }
+
+    set_wide_job(job_ptr, qpl_op_scan_ge, source, bit_width, number_of_elements, destination);
+    job_ptr->param_low_64 = elements[0];
+
+    EXPECT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+    EXPECT_EQ(reference, destination);
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+}
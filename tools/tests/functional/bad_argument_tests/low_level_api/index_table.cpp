@@ -130,4 +130,52 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(index_table, find_mini_block_index) {
 
     EXPECT_EQ(QPL_STS_NULL_PTR_ERR, status);
 }
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(index_table, decompress_indexed) {
+    uint8_t source[8]      = {};
+    uint8_t destination[8] = {};
+    uint32_t output_size   = 0u;
+    qpl_index indices[3]   = {};
+    qpl_index_table table;
+    table.block_count           = 1u;
+    table.mini_block_count      = 1u;
+    table.mini_blocks_per_block = 1u;
+    table.indices_ptr           = indices;
+
+    auto status = qpl_decompress_indexed(qpl_path_software, nullptr, 8u, &table, qpl_mblk_size_512,
+                                         destination, 8u, &output_size);
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, status);
+
+    status = qpl_decompress_indexed(qpl_path_software, source, 8u, nullptr, qpl_mblk_size_512,
+                                    destination, 8u, &output_size);
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, status);
+
+    status = qpl_decompress_indexed(qpl_path_software, source, 8u, &table, qpl_mblk_size_512,
+                                    destination, 8u, nullptr);
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, status);
+
+    status = qpl_decompress_indexed(qpl_path_software, source, 8u, &table, qpl_mblk_size_none,
+                                    destination, 8u, &output_size);
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR, status);
+
+    table.mini_blocks_per_block = 0u;
+
+    status = qpl_decompress_indexed(qpl_path_software, source, 8u, &table, qpl_mblk_size_512,
+                                    destination, 8u, &output_size);
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR, status);
+
+    // The last mini-block must start inside the destination
+    table.mini_block_count      = 2u;
+    table.mini_blocks_per_block = 2u;
+
+    status = qpl_decompress_indexed(qpl_path_software, source, 8u, &table, qpl_mblk_size_512,
+                                    destination, 8u, &output_size);
+
+    EXPECT_EQ(QPL_STS_DST_IS_SHORT_ERR, status);
+}
 } // namespace qpl::test
@@ -40,6 +40,43 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_init, test) {
     EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_get_job_size_ex, test) {
+    qpl_status status;
+    uint32_t   size;
+
+    status = qpl_get_job_size_ex(PATH, QPL_OP_CLASS_ALL, nullptr);
+
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr";
+
+    status = qpl_get_job_size_ex(INCORRECT_PATH, QPL_OP_CLASS_ALL, &size);
+
+    EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
+
+    status = qpl_get_job_size_ex(PATH, 0u, &size);
+
+    EXPECT_EQ(status, QPL_STS_OPERATION_ERR) << "Failed on empty op_mask check";
+
+    status = qpl_get_job_size_ex(PATH, QPL_OP_CLASS_ALL + 1u, &size);
+
+    EXPECT_EQ(status, QPL_STS_OPERATION_ERR) << "Failed on unknown op_mask check";
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_init_ex, test) {
+    qpl_status status;
+
+    status = qpl_init_job_ex(PATH, QPL_OP_CLASS_ALL, nullptr);
+
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr";
+
+    status = qpl_init_job_ex(INCORRECT_PATH, QPL_OP_CLASS_ALL, job_ptr);
+
+    EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
+
+    status = qpl_init_job_ex(PATH, 0u, job_ptr);
+
+    EXPECT_EQ(status, QPL_STS_OPERATION_ERR) << "Failed on empty op_mask check";
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_submit, test) {
     qpl_status status;
     uint8_t    *stored_ptr;
@@ -131,6 +168,111 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_check, test) {
     }
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_submit_batch, test) {
+    qpl_job    *jobs[1] = {job_ptr};
+    qpl_status statuses[1];
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_submit_batch(nullptr, 1u, statuses)) << "Failed on job_ptrs == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_submit_batch(jobs, 1u, nullptr)) << "Failed on status_ptr == nullptr";
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_wait_batch, test) {
+    qpl_job    *jobs[1] = {job_ptr};
+    qpl_status statuses[1];
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_wait_batch(nullptr, 1u, statuses)) << "Failed on job_ptrs == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_wait_batch(jobs, 1u, nullptr)) << "Failed on status_ptr == nullptr";
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_job_pool, test) {
+    qpl_job_pool_t pool = nullptr;
+    qpl_job        *pool_job_ptr = nullptr;
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_job_pool_create(PATH, 1u, -1, nullptr)) << "Failed on pool_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_PATH_ERR, qpl_job_pool_create(INCORRECT_PATH, 1u, -1, &pool)) << "Failed on incorrect path check";
+    EXPECT_EQ(QPL_STS_SIZE_ERR, qpl_job_pool_create(PATH, 0u, -1, &pool)) << "Failed on capacity == 0";
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_job_pool_acquire(nullptr, &pool_job_ptr)) << "Failed on pool == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_job_pool_release(nullptr, job_ptr)) << "Failed on pool == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_job_pool_destroy(nullptr)) << "Failed on pool == nullptr";
+
+    ASSERT_EQ(QPL_STS_OK, qpl_job_pool_create(qpl_path_software, 1u, -1, &pool));
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_job_pool_acquire(pool, nullptr)) << "Failed on job_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_job_pool_release(pool, nullptr)) << "Failed on job_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_job_pool_release(pool, job_ptr)) << "Failed on foreign job";
+
+    ASSERT_EQ(QPL_STS_OK, qpl_job_pool_acquire(pool, &pool_job_ptr));
+    EXPECT_EQ(QPL_STS_JOB_POOL_IS_EMPTY_ERR, qpl_job_pool_acquire(pool, &pool_job_ptr)) << "Failed on empty pool";
+    EXPECT_EQ(nullptr, pool_job_ptr);
+
+    EXPECT_EQ(QPL_STS_OK, qpl_job_pool_destroy(pool));
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_scan_predicate, test) {
+    uint8_t                   source[8u]      = {0u};
+    uint8_t                   destination[1u] = {0u};
+    qpl_predicate_column      column{source, sizeof(source), 8u};
+    qpl_predicate_result      result{};
+    qpl_predicate_instruction program[2u]     = {{qpl_predicate_scan, qpl_op_scan_eq, 0u, 0u, 0u},
+                                                 {qpl_predicate_and, qpl_op_scan_eq, 0u, 0u, 0u}};
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_scan_predicate(nullptr, 1u, program, 1u, 8u, destination, 1u, &result))
+                        << "Failed on columns_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_scan_predicate(&column, 1u, nullptr, 1u, 8u, destination, 1u, &result))
+                        << "Failed on program_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_scan_predicate(&column, 1u, program, 1u, 8u, nullptr, 1u, &result))
+                        << "Failed on destination_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_scan_predicate(&column, 1u, program, 1u, 8u, destination, 1u, nullptr))
+                        << "Failed on result_ptr == nullptr";
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR, qpl_scan_predicate(&column, 1u, program, 1u, 0u, destination, 1u, &result))
+                        << "Failed on num_elements == 0";
+    EXPECT_EQ(QPL_STS_SIZE_ERR, qpl_scan_predicate(&column, 0u, program, 1u, 8u, destination, 1u, &result))
+                        << "Failed on columns_count == 0";
+    EXPECT_EQ(QPL_STS_SRC_IS_SHORT_ERR, qpl_scan_predicate(&column, 1u, program, 1u, 9u, destination, 2u, &result))
+                        << "Failed on short column";
+    EXPECT_EQ(QPL_STS_DST_IS_SHORT_ERR, qpl_scan_predicate(&column, 1u, program, 1u, 8u, destination, 0u, &result))
+                        << "Failed on short destination";
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_scan_predicate(&column, 1u, program, 2u, 8u, destination, 1u, &result))
+                        << "Failed on stack underflow";
+
+    program[0].column_index = 1u;
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_scan_predicate(&column, 1u, program, 1u, 8u, destination, 1u, &result))
+                        << "Failed on incorrect column index";
+
+    program[0].column_index = 0u;
+    column.bit_width        = 33u;
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, qpl_scan_predicate(&column, 1u, program, 1u, 8u, destination, 1u, &result))
+                        << "Failed on incorrect bit width";
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_pack_parquet_rle, test) {
+    uint8_t  source[8u]       = {0u};
+    uint8_t  destination[16u] = {0u};
+    uint32_t total_out        = 0u;
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_pack_parquet_rle(nullptr, 8u, 8u, 8u, 0u, destination, 16u, &total_out))
+                        << "Failed on source_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_pack_parquet_rle(source, 8u, 8u, 8u, 0u, nullptr, 16u, &total_out))
+                        << "Failed on destination_ptr == nullptr";
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_pack_parquet_rle(source, 8u, 8u, 8u, 0u, destination, 16u, nullptr))
+                        << "Failed on total_out_ptr == nullptr";
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR, qpl_pack_parquet_rle(source, 8u, 8u, 0u, 0u, destination, 16u, &total_out))
+                        << "Failed on num_elements == 0";
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, qpl_pack_parquet_rle(source, 8u, 0u, 8u, 0u, destination, 16u, &total_out))
+                        << "Failed on zero bit width";
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, qpl_pack_parquet_rle(source, 8u, 33u, 1u, 0u, destination, 16u, &total_out))
+                        << "Failed on incorrect bit width";
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_pack_parquet_rle(source, 8u, 8u, 8u, 7u, destination, 16u, &total_out))
+                        << "Failed on run_threshold shorter than a group";
+    EXPECT_EQ(QPL_STS_SRC_IS_SHORT_ERR, qpl_pack_parquet_rle(source, 8u, 8u, 9u, 0u, destination, 16u, &total_out))
+                        << "Failed on short source";
+    EXPECT_EQ(QPL_STS_DST_IS_SHORT_ERR, qpl_pack_parquet_rle(source, 8u, 8u, 8u, 0u, destination, 1u, &total_out))
+                        << "Failed on short destination";
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_finalize, test) {
     EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_fini_job(nullptr)) << "Failed on job_ptr == nullptr";
 }
@@ -172,6 +314,38 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_gather_deflate_statistics, test) {
     EXPECT_EQ(status, QPL_STS_PATH_ERR);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_gather_deflate_statistics_ext, test) {
+    qpl_status             status;
+    uint8_t                source;
+    uint32_t               source_length = 1u;
+    qpl_histogram          deflate_histogram{};
+    qpl_path_t             path          = qpl_path_software;
+    qpl_compression_levels level         = qpl_default_level;
+    qpl_statistics_options options{1u, 100u};
+
+    status = qpl_gather_deflate_statistics_ext(nullptr, source_length, &deflate_histogram, level, path, &options);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_ext(&source, source_length, nullptr, level, path, &options);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_ext(&source, source_length, &deflate_histogram, level, path, nullptr);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_ext(&source, source_length, &deflate_histogram, INCORRECT_LEVEL, path, &options);
+    EXPECT_EQ(status, QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL);
+
+    status = qpl_gather_deflate_statistics_ext(&source, source_length, &deflate_histogram, level, INCORRECT_PATH, &options);
+    EXPECT_EQ(status, QPL_STS_PATH_ERR);
+
+    for (uint32_t sample_percent : {0u, 101u}) {
+        options.sample_percent = sample_percent;
+
+        status = qpl_gather_deflate_statistics_ext(&source, source_length, &deflate_histogram, level, path, &options);
+        EXPECT_EQ(status, QPL_STS_INVALID_PARAM_ERR) << "Failed on sample_percent == " << sample_percent;
+    }
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_get_existing_dict_size, test) {
     size_t dictionary_size = 0;
 
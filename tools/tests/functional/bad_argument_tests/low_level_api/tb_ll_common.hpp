@@ -35,7 +35,7 @@ constexpr qpl_parser INPUT_FORMAT                = qpl_p_le_packed_array;
 constexpr qpl_out_format OUTPUT_BIT_WIDTH        = qpl_ow_nom;
 constexpr qpl_path_t  PATH                       = qpl_path_auto;
 constexpr qpl_path_t  INCORRECT_PATH             = static_cast<qpl_path_t>(qpl_path_software + 1u);
-constexpr qpl_compression_levels INCORRECT_LEVEL = static_cast<qpl_compression_levels>(qpl_high_level + 1u);
+constexpr qpl_compression_levels INCORRECT_LEVEL = static_cast<qpl_compression_levels>(qpl_level_9 + 1u);
 constexpr uint32_t NOT_APPLICABLE_PARAMETER      = 0u;
 
 #define LAST_INPUT_PARSER   qpl_p_parquet_rle
@@ -105,8 +105,14 @@ static inline void check_input_stream_validation(qpl_job *const job_ptr, qpl_ope
     set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 0u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
     EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:32]";
 
-    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 33u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
-    EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:32]";
+    // Elements up to 64 bits wide are supported on the software path
+    if (TestEnviroment::GetInstance().GetExecutionPath() == qpl_path_hardware) {
+        set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 33u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+        EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:32]";
+    }
+
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 65u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+    EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:64]";
 
     // Input format check
     set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, INPUT_BIT_WIDTH, ELEMENTS_TO_PROCESS, (qpl_parser)(LAST_INPUT_PARSER + 1u));
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_checksum.h"
+#include "dispatcher.hpp"
+
+namespace qpl::test {
+
+static inline qplc_crc64_t_ptr qplc_crc64() {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_crc64_table();
+
+    return (qplc_crc64_t_ptr) table[0u];
+}
+
+static inline qplc_crc64_init_context_t_ptr qplc_crc64_init_context() {
+    static const auto &table =
+            qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_crc64_init_context_table();
+
+    return (qplc_crc64_init_context_t_ptr) table[0u];
+}
+
+static inline qplc_crc64_with_context_t_ptr qplc_crc64_with_context() {
+    static const auto &table =
+            qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_crc64_with_context_table();
+
+    return (qplc_crc64_with_context_t_ptr) table[0u];
+}
+
+using TestEnviroment = qpl::test::util::TestEnvironment;
+using randomizer = qpl::test::random;
+
+constexpr uint32_t TEST_MAX_LENGTH       = 4u * 1024u;
+constexpr uint32_t TEST_POLYNOMIALS      = 16u;
+constexpr uint64_t TEST_KNOWN_POLYNOMIAL = 0x42F0E1EBA9EA3693ULL; // ECMA-182
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64_with_context, equals_to_crc64) {
+    auto seed = TestEnviroment::GetInstance().GetSeed();
+    randomizer random_8u(0u, UINT8_MAX, seed);
+    randomizer random_32u(0u, UINT32_MAX, seed);
+
+    std::vector<uint8_t> source(TEST_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), [&random_8u]() { return static_cast<uint8_t>(random_8u); });
+
+    auto context_ptr = std::make_unique<qplc_crc64_context>();
+
+    for (uint32_t poly_idx = 0u; poly_idx <= TEST_POLYNOMIALS; poly_idx++) {
+        uint64_t polynomial = (0u == poly_idx)
+                              ? TEST_KNOWN_POLYNOMIAL
+                              : (static_cast<uint64_t>(static_cast<uint32_t>(random_32u)) << 32u) |
+                                static_cast<uint32_t>(random_32u) | 1u;
+
+        for (uint8_t be_flag = 0u; be_flag <= 1u; be_flag++) {
+            qplc_crc64_init_context()(polynomial, be_flag, context_ptr.get());
+
+            for (uint8_t inversion_flag = 0u; inversion_flag <= 1u; inversion_flag++) {
+                for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += (length < 64u) ? 1u : 61u) {
+                    auto reference = qplc_crc64()(source.data(), length, polynomial, be_flag, inversion_flag);
+                    auto result    = qplc_crc64_with_context()(source.data(), length, context_ptr.get(), inversion_flag);
+
+                    ASSERT_EQ(reference, result) << "polynomial: " << std::hex << polynomial
+                                                 << ", be: " << static_cast<uint32_t>(be_flag)
+                                                 << ", inversion: " << static_cast<uint32_t>(inversion_flag)
+                                                 << ", length: " << std::dec << length;
+                }
+            }
+        }
+    }
+}
+
+}
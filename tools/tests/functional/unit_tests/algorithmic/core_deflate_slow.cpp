@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 #include <array>
+#include <cstring>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "qpl_test_environment.hpp"
@@ -18,6 +20,7 @@
 #include "deflate_histogram.h"
 #include "qpl/c_api/defs.h"
 #include "qplc_checksum.h"
+#include "crc.h"
 
 #include "deflate_slow_utils.h"
 #include "deflate_slow_matcher.h"
@@ -165,6 +168,40 @@ static uint32_t test_source(const uint8_t* source, const uint8_t* destination, u
 
 constexpr uint32_t TEST_BUFFER_SIZE = 4096u;
 
+extern "C" deflate_match_t avx2_get_lazy_best_match(const deflate_hash_table_t *const hash_table_ptr,
+                                                    const uint8_t *const lower_bound_ptr,
+                                                    const uint8_t *const string_ptr,
+                                                    const uint8_t *const upper_bound_ptr);
+
+using get_lazy_best_match_t = deflate_match_t (*)(const deflate_hash_table_t *const,
+                                                  const uint8_t *const,
+                                                  const uint8_t *const,
+                                                  const uint8_t *const);
+
+/**
+ * @brief Length of the longest match for the position among all the positions of the window, capped by 258
+ */
+static uint32_t get_reference_match_length(const uint8_t *lower_bound_ptr,
+                                           const uint8_t *string_ptr,
+                                           const uint8_t *upper_bound_ptr,
+                                           uint32_t window_size) {
+    const auto     position   = static_cast<uint32_t>(string_ptr - lower_bound_ptr);
+    const uint32_t max_length = QPL_MIN(258u, static_cast<uint32_t>(upper_bound_ptr - string_ptr));
+    uint32_t       result     = 0u;
+
+    for (uint32_t index = (position > window_size) ? position - window_size : 0u; index < position; index++) {
+        uint32_t length = 0u;
+
+        while (length < max_length && lower_bound_ptr[index + length] == string_ptr[length]) {
+            length++;
+        }
+
+        result = QPL_MAX(result, length);
+    }
+
+    return result;
+}
+
 namespace qpl::test {
 using randomizer = qpl::test::random;
 QPL_UNIT_API_ALGORITHMIC_TEST(qplc_deflate_slow_icf, base) {
@@ -187,6 +224,7 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_deflate_slow_icf, base) {
     str_hash_table.hash_table_ptr = hash_table;
     str_hash_table.hash_story_ptr = hash_story;
     str_hash_table.hash_mask      = 0x0fff;
+    str_hash_table.window_mask    = D_SIZE_HASH_STORE - 1u;
     str_hash_table.attempts       = 0x1000;
     str_hash_table.good_match     = 0x0020;
     str_hash_table.nice_match     = 0x0102;
@@ -628,4 +666,81 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_deflate_slow_icf, base) {
     result |= test_source((uint8_t*)source.data(), (uint8_t*)destination.data(), compressed_bytes_0);
     ASSERT_EQ(0, result);
 }
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_deflate_slow_matcher, longest_match) {
+    constexpr uint32_t window_size = 1024u;
+
+    std::array<uint8_t, TEST_BUFFER_SIZE> source{};
+    uint64_t   seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer random_value(0u, static_cast<double>(UINT32_MAX), seed);
+
+    // A small alphabet and copies of earlier strings give long chains with the matches of every length
+    for (uint32_t indx = 0u; indx < source.size();) {
+        const uint32_t value = static_cast<uint32_t>(random_value);
+
+        if (indx > 0u && 0u == value % 4u) {
+            const uint32_t distance = 1u + (value >> 8u) % QPL_MIN(indx, window_size);
+            const uint32_t length   = QPL_MIN(1u + (value >> 20u) % 300u, static_cast<uint32_t>(source.size()) - indx);
+
+            for (uint32_t i = 0u; i < length; i++, indx++) {
+                source[indx] = source[indx - distance];
+            }
+        } else {
+            source[indx++] = static_cast<uint8_t>('a' + value % 4u);
+        }
+    }
+
+    std::vector<get_lazy_best_match_t> matchers = {px_get_lazy_best_match};
+
+    if (qpl::core_sw::dispatcher::detect_platform() >= qpl::core_sw::dispatcher::avx2_arch) {
+        matchers.push_back(avx2_get_lazy_best_match);
+    }
+
+    for (const auto matcher : matchers) {
+        const uint8_t *lower_bound_ptr = source.data();
+        const uint8_t *upper_bound_ptr = source.data() + source.size();
+
+        deflate_hash_table_t str_hash_table;
+        str_hash_table.hash_table_ptr = hash_table;
+        str_hash_table.hash_story_ptr = hash_story;
+        str_hash_table.hash_mask      = D_SIZE_HASH_TABLE - 1u;
+        str_hash_table.window_mask    = window_size - 1u;
+        str_hash_table.attempts       = D_SIZE_HASH_STORE;   // Longer than any chain of the window
+        str_hash_table.good_match     = 258u;
+        str_hash_table.nice_match     = 258u;
+        str_hash_table.lazy_match     = 0u;                  // Only the given position is searched
+
+        init_hash_table();
+
+        for (const uint8_t *string_ptr = lower_bound_ptr;
+             string_ptr + OWN_BYTES_FOR_HASH_CALCULATION <= upper_bound_ptr;
+             string_ptr++) {
+            const deflate_match_t match     = matcher(&str_hash_table, lower_bound_ptr, string_ptr, upper_bound_ptr);
+            const uint32_t        reference = get_reference_match_length(lower_bound_ptr,
+                                                                         string_ptr,
+                                                                         upper_bound_ptr,
+                                                                         window_size);
+            const auto            position  = static_cast<uint32_t>(string_ptr - lower_bound_ptr);
+
+            // Strings with the equal hashed bytes are in the same chain, so the longest of them is surely found
+            if (reference >= OWN_BYTES_FOR_HASH_CALCULATION) {
+                ASSERT_EQ(reference, match.length) << "position " << position;
+            } else {
+                ASSERT_GE(reference, match.length) << "position " << position;
+            }
+
+            if (match.length > 0u) {
+                ASSERT_TRUE(match.offset > 0u && match.offset <= QPL_MIN(position, window_size))
+                                        << "position " << position;
+                ASSERT_EQ(0, std::memcmp(string_ptr - match.offset, string_ptr, match.length))
+                                        << "position " << position;
+            }
+
+            own_deflate_hash_table_update(&str_hash_table,
+                                          position,
+                                          crc32_gzip_refl(0u, string_ptr, OWN_BYTES_FOR_HASH_CALCULATION) &
+                                          str_hash_table.hash_mask);
+        }
+    }
+}
 }
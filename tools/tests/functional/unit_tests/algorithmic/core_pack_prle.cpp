@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_pack.h"
+#include "dispatcher.hpp"
+
+namespace qpl::test {
+
+static inline qplc_prle_run_length_t_ptr qplc_prle_run_length(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_prle_run_length_table();
+
+    return (qplc_prle_run_length_t_ptr) table[index];
+}
+
+static inline qplc_prle_find_equal_octet_t_ptr qplc_prle_find_equal_octet(uint32_t index) {
+    static const auto &table =
+            qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_prle_find_equal_octet_table();
+
+    return (qplc_prle_find_equal_octet_t_ptr) table[index];
+}
+
+using randomizer = qpl::test::random;
+
+constexpr uint32_t prle_test_octet_size   = 8u;
+constexpr uint32_t prle_test_max_elements = 300u;
+constexpr uint32_t prle_test_max_run      = 24u;
+constexpr uint32_t prle_test_iterations   = 1000u;
+
+template <class element_t>
+static void test_prle_kernels(uint32_t index) {
+    const auto run_length       = qplc_prle_run_length(index);
+    const auto find_equal_octet = qplc_prle_find_equal_octet(index);
+
+    randomizer random_length(0u, prle_test_max_elements, util::TestEnvironment::GetInstance().GetSeed());
+    randomizer random_value(0u, 3u, util::TestEnvironment::GetInstance().GetSeed());
+    randomizer random_run(1u, prle_test_max_run, util::TestEnvironment::GetInstance().GetSeed());
+
+    for (uint32_t iteration = 0u; iteration < prle_test_iterations; iteration++) {
+        // Runs of random lengths give both equal octets and mismatches at all positions, including the tails
+        std::vector<element_t> elements(static_cast<uint32_t>(random_length));
+
+        for (auto it = elements.begin(); it != elements.end();) {
+            const auto run   = std::min<ptrdiff_t>(static_cast<uint32_t>(random_run), elements.end() - it);
+            const auto value = static_cast<element_t>(static_cast<uint32_t>(random_value) * 0x01010101u);
+
+            it = std::fill_n(it, run, value);
+        }
+
+        const auto     *source_ptr    = reinterpret_cast<const uint8_t *>(elements.data());
+        const auto     elements_count = static_cast<uint32_t>(elements.size());
+        const uint32_t octets_count   = elements_count / prle_test_octet_size;
+        const uint32_t value          = elements.empty() ? 0u : static_cast<uint32_t>(elements[0]);
+
+        const auto mismatch = std::find_if(elements.begin(), elements.end(), [value](element_t element) {
+            return static_cast<uint32_t>(element) != value;
+        });
+
+        const auto reference_length = static_cast<uint32_t>(mismatch - elements.begin());
+        uint32_t   reference_octet  = octets_count;
+
+        for (uint32_t octet = 0u; octet < octets_count; octet++) {
+            const auto begin = elements.begin() + octet * prle_test_octet_size;
+
+            if (std::all_of(begin, begin + prle_test_octet_size, [&begin](element_t element) {
+                return element == *begin;
+            })) {
+                reference_octet = octet;
+                break;
+            }
+        }
+
+        ASSERT_EQ(reference_length, run_length(source_ptr, elements_count, value))
+                                << "Run length failed on " << elements_count << " elements";
+        ASSERT_EQ(reference_octet, find_equal_octet(source_ptr, octets_count))
+                                << "Equal octet search failed on " << elements_count << " elements";
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_prle_kernels_8u, base) {
+    test_prle_kernels<uint8_t>(0u);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_prle_kernels_16u, base) {
+    test_prle_kernels<uint16_t>(1u);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_prle_kernels_32u, base) {
+    test_prle_kernels<uint32_t>(2u);
+}
+
+}
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_scan.h"
+#include "dispatcher.hpp"
+
+namespace qpl::test {
+
+static inline qplc_scan_t_ptr qplc_scan(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_table();
+
+    return (qplc_scan_t_ptr) table[index];
+}
+
+static inline qplc_scan_i_t_ptr qplc_scan_i(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_i_table();
+
+    return (qplc_scan_i_t_ptr) table[index];
+}
+
+static inline qplc_scan_nu1u_t_ptr qplc_scan_nu1u(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_nu1u_table();
+
+    return (qplc_scan_nu1u_t_ptr) table[index];
+}
+
+static inline qplc_scan_64u_i_t_ptr qplc_scan_64u_i(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_64u_i_table();
+
+    return (qplc_scan_64u_i_t_ptr) table[index];
+}
+
+using TestEnviroment = qpl::test::util::TestEnvironment;
+using randomizer = qpl::test::random;
+
+constexpr uint32_t TEST_MAX_LENGTH = 300u;
+constexpr uint32_t TEST_FLAVORS    = 8u; // eq, ne, lt, le, gt, ge, range, not_range
+constexpr uint32_t TEST_NU1U_MAX_LENGTH = 1100u;
+
+static uint8_t ref_scan_element(uint64_t value, uint64_t low_value, uint64_t high_value, uint32_t flavor) {
+    switch (flavor) {
+        case 0u: return (value == low_value) ? 1u : 0u;
+        case 1u: return (value != low_value) ? 1u : 0u;
+        case 2u: return (value < low_value) ? 1u : 0u;
+        case 3u: return (value <= low_value) ? 1u : 0u;
+        case 4u: return (value > low_value) ? 1u : 0u;
+        case 5u: return (value >= low_value) ? 1u : 0u;
+        case 6u: return (value >= low_value && value <= high_value) ? 1u : 0u;
+        default: return (value < low_value || value > high_value) ? 1u : 0u;
+    }
+}
+
+template <class input_t>
+static void test_scan(uint32_t bit_width) {
+    auto seed = TestEnviroment::GetInstance().GetSeed();
+    const uint32_t max_value = static_cast<uint32_t>(std::numeric_limits<input_t>::max());
+
+    // Narrow range is used for some of the values, so that equality comparisons are hit as well
+    randomizer random_value(0u, static_cast<double>(max_value), seed);
+    randomizer random_narrow(0u, 16u, seed);
+
+    std::vector<input_t> source(TEST_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), [&]() {
+        return static_cast<input_t>((static_cast<uint32_t>(random_narrow) < 4u) ? static_cast<uint32_t>(random_narrow)
+                                                                                 : static_cast<uint32_t>(random_value));
+    });
+
+    std::vector<uint8_t> destination(TEST_MAX_LENGTH + 1u);
+    std::vector<uint8_t> reference(TEST_MAX_LENGTH);
+    std::vector<input_t> source_destination(TEST_MAX_LENGTH);
+
+    for (uint32_t flavor = 0u; flavor < TEST_FLAVORS; flavor++) {
+        const uint32_t index = qpl::core_sw::dispatcher::get_scan_index(bit_width, flavor);
+
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length++) {
+            uint32_t low_value  = (length & 1u) ? static_cast<uint32_t>(random_narrow) : static_cast<uint32_t>(random_value);
+            uint32_t high_value = static_cast<uint32_t>(random_value);
+
+            for (uint32_t idx = 0u; idx < length; idx++) {
+                reference[idx] = ref_scan_element(source[idx], low_value, high_value, flavor);
+            }
+
+            std::fill(destination.begin(), destination.end(), 0xFFu);
+            qplc_scan(index)(reinterpret_cast<const uint8_t *>(source.data()),
+                             destination.data(), length, low_value, high_value);
+
+            ASSERT_TRUE(std::equal(reference.begin(), reference.begin() + length, destination.begin()))
+                                        << "flavor: " << flavor << ", length: " << length;
+            ASSERT_EQ(destination[length], 0xFFu) << "flavor: " << flavor << ", length: " << length;
+
+            std::copy(source.begin(), source.end(), source_destination.begin());
+            auto *src_dst_ptr = reinterpret_cast<uint8_t *>(source_destination.data());
+            qplc_scan_i(index)(src_dst_ptr, length, low_value, high_value);
+
+            ASSERT_TRUE(std::equal(reference.begin(), reference.begin() + length, src_dst_ptr))
+                                        << "in-place, flavor: " << flavor << ", length: " << length;
+        }
+    }
+}
+
+static void test_scan_nu1u(uint32_t bit_width) {
+    auto seed = TestEnviroment::GetInstance().GetSeed();
+    const uint32_t value_mask = static_cast<uint32_t>((1ULL << bit_width) - 1u);
+
+    randomizer random_value(0u, static_cast<double>(value_mask), seed);
+    randomizer random_narrow(0u, 16u, seed);
+
+    std::vector<uint32_t> values(TEST_NU1U_MAX_LENGTH);
+    std::generate(values.begin(), values.end(), [&]() {
+        return ((static_cast<uint32_t>(random_narrow) < 4u) ? static_cast<uint32_t>(random_narrow)
+                                                            : static_cast<uint32_t>(random_value)) & value_mask;
+    });
+
+    for (uint32_t flavor = 0u; flavor < TEST_FLAVORS; flavor++) {
+        for (uint32_t length = 1u; length <= TEST_NU1U_MAX_LENGTH; length += 1u + length / 16u) {
+            // Source of the exact size, so that any overread is caught by sanitizers
+            std::vector<uint8_t> source((static_cast<uint64_t>(length) * bit_width + 7u) / 8u);
+
+            for (uint32_t idx = 0u; idx < length; idx++) {
+                for (uint32_t bit = 0u; bit < bit_width; bit++) {
+                    uint64_t position = static_cast<uint64_t>(idx) * bit_width + bit;
+                    source[position / 8u] |= static_cast<uint8_t>(((values[idx] >> bit) & 1u) << (position % 8u));
+                }
+            }
+
+            const uint32_t start_bit  = length % 8u;
+            const uint32_t low_value  = (length & 1u) ? (values[length / 2u] & value_mask)
+                                                      : (static_cast<uint32_t>(random_narrow) & value_mask);
+            const uint32_t high_value = static_cast<uint32_t>(random_value) & value_mask;
+
+            std::vector<uint8_t> reference((start_bit + length + 7u) / 8u + 1u, 0xA5u);
+            std::vector<uint8_t> destination(reference);
+            uint32_t ref_min = std::numeric_limits<uint32_t>::max();
+            uint32_t ref_max = 0u;
+            uint32_t ref_sum = 0u;
+
+            reference[0] &= static_cast<uint8_t>((1u << start_bit) - 1u);
+            for (uint32_t idx = 0u; idx < length; idx++) {
+                const uint32_t position = start_bit + idx;
+
+                if (ref_scan_element(values[idx], low_value, high_value, flavor)) {
+                    reference[position / 8u] |= static_cast<uint8_t>(1u << (position % 8u));
+                    ref_min = (std::numeric_limits<uint32_t>::max() == ref_min) ? idx : ref_min;
+                    ref_max = idx;
+                    ref_sum++;
+                } else {
+                    reference[position / 8u] &= static_cast<uint8_t>(~(1u << (position % 8u)));
+                }
+            }
+            if (0u != ((start_bit + length) % 8u)) {
+                reference[(start_bit + length) / 8u] &= static_cast<uint8_t>((1u << ((start_bit + length) % 8u)) - 1u);
+            }
+
+            uint32_t min_value = std::numeric_limits<uint32_t>::max();
+            uint32_t max_value = 0u;
+            uint32_t sum       = 0u;
+            uint32_t index     = 0u;
+
+            qplc_scan_nu1u(flavor)(source.data(), length, bit_width, low_value, high_value,
+                                   destination.data(), start_bit, &min_value, &max_value, &sum, &index);
+
+            ASSERT_EQ(reference, destination) << "flavor: " << flavor << ", length: " << length;
+            ASSERT_EQ(ref_min, min_value) << "flavor: " << flavor << ", length: " << length;
+            ASSERT_EQ(ref_max, max_value) << "flavor: " << flavor << ", length: " << length;
+            ASSERT_EQ(ref_sum, sum) << "flavor: " << flavor << ", length: " << length;
+            ASSERT_EQ(length, index) << "flavor: " << flavor << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan_8u, all_flavors) {
+    test_scan<uint8_t>(8u);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan_16u8u, all_flavors) {
+    test_scan<uint16_t>(16u);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan_32u8u, all_flavors) {
+    test_scan<uint32_t>(32u);
+}
+
+static void test_scan_64u() {
+    const uint64_t seed = TestEnviroment::GetInstance().GetSeed();
+
+    // Values differ in both halves of the qword, so a comparison of the low dwords only would fail
+    randomizer random_value(0u, 3u, seed);
+
+    std::vector<uint64_t> source(TEST_MAX_LENGTH);
+    std::vector<uint8_t>  destination(TEST_MAX_LENGTH * sizeof(uint64_t));
+
+    for (uint32_t flavor = 0u; flavor < TEST_FLAVORS; flavor++) {
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length++) {
+            for (auto &element : source) {
+                element = (static_cast<uint64_t>(random_value) << 40u) | static_cast<uint64_t>(random_value);
+            }
+
+            const uint64_t low_value  = (static_cast<uint64_t>(random_value) << 40u) | 1u;
+            const uint64_t high_value = low_value + (static_cast<uint64_t>(1u) << 40u);
+
+            std::copy(reinterpret_cast<const uint8_t *>(source.data()),
+                      reinterpret_cast<const uint8_t *>(source.data() + length),
+                      destination.begin());
+
+            qplc_scan_64u_i(flavor)(destination.data(), length, low_value, high_value);
+
+            for (uint32_t idx = 0u; idx < length; idx++) {
+                ASSERT_EQ(ref_scan_element(source[idx], low_value, high_value, flavor), destination[idx])
+                    << "flavor: " << flavor << ", length: " << length << ", index: " << idx;
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan_64u8u, all_flavors) {
+    test_scan_64u();
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan_nu1u, all_bit_widths) {
+    for (uint32_t bit_width = 1u; bit_width <= 32u; bit_width++) {
+        test_scan_nu1u(bit_width);
+    }
+}
+
+}
@@ -3,7 +3,10 @@
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "qpl_test_environment.hpp"
@@ -26,6 +29,12 @@ qplc_select_i_t_ptr qplc_select_i(uint32_t index) {
     return (qplc_select_i_t_ptr) table[index];
 }
 
+qplc_select_bit_mask_t_ptr qplc_select_bit_mask(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_select_bit_mask_table();
+
+    return (qplc_select_bit_mask_t_ptr) table[index];
+}
+
 static void fill_buffer_8u(uint8_t* src, uint8_t* dst, uint32_t length) {
     uint8_t* p_src_8u = src;
     uint8_t* p_dst_8u = dst;
@@ -109,9 +118,63 @@ constexpr uint32_t fun_indx_select_16u = 1;
 constexpr uint32_t fun_indx_select_32u = 2;
 
 constexpr uint32_t TEST_BUFFER_SIZE = 64u;
+constexpr uint32_t TEST_BIT_MASK_MAX_LENGTH = 600u;
 
 namespace qpl::test {
 using randomizer = qpl::test::random;
+
+template <class input_t>
+static void test_select_bit_mask(uint32_t function_index) {
+    uint64_t   seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer random_value(0u, static_cast<double>(std::numeric_limits<input_t>::max()), seed);
+    randomizer random_percent(0u, 99u, seed);
+
+    std::vector<input_t> source(TEST_BIT_MASK_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), [&]() { return static_cast<input_t>(random_value); });
+
+    // Sparse, half-filled and dense masks, so that empty and full mask words are hit as well
+    for (uint32_t density : {1u, 50u, 99u}) {
+        for (uint32_t length = 1u; length <= TEST_BIT_MASK_MAX_LENGTH; length += 1u + length / 16u) {
+            const uint32_t start_bit = length % 8u;
+
+            // Mask of the exact size, so that any overread is caught by sanitizers
+            std::vector<uint8_t> mask((start_bit + length + 7u) / 8u, 0u);
+            std::vector<input_t> reference;
+
+            mask[0] = static_cast<uint8_t>(random_value) & static_cast<uint8_t>((1u << start_bit) - 1u);
+            for (uint32_t idx = 0u; idx < length; idx++) {
+                if (static_cast<uint32_t>(random_percent) < density) {
+                    mask[(start_bit + idx) / 8u] |= static_cast<uint8_t>(1u << ((start_bit + idx) % 8u));
+                    reference.push_back(source[idx]);
+                }
+            }
+
+            std::vector<input_t> destination(length);
+            const uint32_t selected = qplc_select_bit_mask(function_index)(reinterpret_cast<uint8_t *>(source.data()),
+                                                                           mask.data(),
+                                                                           start_bit,
+                                                                           reinterpret_cast<uint8_t *>(destination.data()),
+                                                                           length);
+
+            ASSERT_EQ(reference.size(), selected) << "density: " << density << ", length: " << length;
+            destination.resize(selected);
+            ASSERT_EQ(reference, destination) << "density: " << density << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_select_bit_mask_8u, all_densities) {
+    test_select_bit_mask<uint8_t>(fun_indx_select_8u);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_select_bit_mask_16u, all_densities) {
+    test_select_bit_mask<uint16_t>(fun_indx_select_16u);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_select_bit_mask_32u, all_densities) {
+    test_select_bit_mask<uint32_t>(fun_indx_select_32u);
+}
+
 QPL_UNIT_API_ALGORITHMIC_TEST(qplc_select_8u, base) {
     std::array < uint8_t, TEST_BUFFER_SIZE > buffer_mask{};
     std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint8_t)> source{};
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#include <array>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+#include "util.hpp"
+
+#include "qplc_api.h"
+#include "dispatcher.hpp"
+#include "check_result.hpp"
+
+static inline qplc_pack_bits_t_ptr qplc_pack_bits(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_pack_table();
+
+    return (qplc_pack_bits_t_ptr) table[index];
+}
+
+static inline qplc_unpack_bits_t_ptr qplc_unpack_bits(uint32_t index) {
+    static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_table();
+
+    return (qplc_unpack_bits_t_ptr) table[index];
+}
+
+static void fill_src_buffer_64u(uint8_t* src, uint8_t* dst, uint32_t length, uint32_t nbits) {
+    uint64_t* p_src_64u = (uint64_t*)src;
+    uint64_t* p_dst_64u = (uint64_t*)dst;
+    uint64_t mask = UINT64_MAX >> (64u - nbits);
+    for (uint32_t indx = 0; indx < length; indx++) {
+        p_dst_64u[indx] = p_src_64u[indx] & mask;
+    }
+}
+
+constexpr uint32_t TEST_BUFFER_SIZE = 64u;
+
+namespace qpl::test {
+using randomizer = qpl::test::random;
+
+static void test_unpack_64u(uint32_t flag_be) {
+    std::array<uint8_t, TEST_BUFFER_SIZE*sizeof(uint64_t)> buffer{};
+    std::array<uint8_t, TEST_BUFFER_SIZE*sizeof(uint64_t)> source{};
+    std::array<uint8_t, TEST_BUFFER_SIZE*sizeof(uint64_t) + 1u> source_pack{};
+    std::array<uint8_t, TEST_BUFFER_SIZE*sizeof(uint64_t)> destination{};
+    uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer         random_value(0u, static_cast<double>(UINT32_MAX), seed);
+
+    {
+        uint64_t* p_buffer_64u = (uint64_t*)buffer.data();
+        for (uint32_t indx = 0; indx < TEST_BUFFER_SIZE; indx++) {
+            p_buffer_64u[indx] = (static_cast<uint64_t>(static_cast<uint32_t>(random_value)) << 32u)
+                                 | static_cast<uint32_t>(random_value);
+        }
+    }
+
+    for (uint32_t nbits = 33; nbits <= 64; nbits++) {
+        const uint32_t pack_index   = qpl::core_sw::dispatcher::get_pack_bits_index(flag_be, nbits, 0u);
+        const uint32_t unpack_index = qpl::core_sw::dispatcher::get_unpack_index(flag_be, nbits);
+
+        source.fill(0);
+        fill_src_buffer_64u(buffer.data(), source.data(), TEST_BUFFER_SIZE, nbits);
+        for (uint32_t length = 1; length <= TEST_BUFFER_SIZE; length++) {
+            for (uint32_t start_bit = 0; start_bit < 8; start_bit++) {
+                destination.fill(0);
+                source_pack.fill(0);
+
+                qplc_pack_bits(pack_index)(source.data(), length, source_pack.data(), start_bit);
+                qplc_unpack_bits(unpack_index)(source_pack.data(), length, start_bit, destination.data());
+                ASSERT_TRUE(CompareSegments(source.begin(), source.begin() + length * sizeof(uint64_t),
+                    destination.begin(), destination.begin() + length * sizeof(uint64_t),
+                    "FAIL qplc_unpack_64u!!! "));
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_64u, base) {
+    test_unpack_64u(0u);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_be_64u, base) {
+    test_unpack_64u(1u);
+}
+}
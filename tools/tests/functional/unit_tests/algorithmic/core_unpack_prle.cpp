@@ -5,6 +5,7 @@
  ******************************************************************************/
 #include <array>
 #include <algorithm>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "qpl_test_environment.hpp"
@@ -43,6 +44,7 @@
 #include "qplc_api.h"
 #include "dispatcher.hpp"
 #include "check_result.hpp"
+#include "ref_convert.h"
 
 static inline qplc_unpack_bits_t_ptr qplc_unpack_bits(uint32_t index) {
     static const auto &table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_table();
@@ -828,4 +830,129 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_prle_32u, base) {
         }
     }
 }
+
+/**
+ * @brief Writes PRLE header, the varint is padded with empty bytes up to the given length to cover long headers
+ */
+static uint8_t *put_prle_header(uint8_t *destination_ptr, uint32_t count, uint32_t format, uint32_t min_length) {
+    uint32_t value  = (count << 1u) | format;
+    uint32_t length = 0u;
+
+    do {
+        uint8_t byte = static_cast<uint8_t>(value & QPL_TEST_7_BIT_MASK);
+
+        value >>= 7u;
+        length++;
+        if (0u != value || length < min_length) {
+            byte |= QPL_TEST_HIGH_BIT_MASK;
+        }
+        *destination_ptr++ = byte;
+    } while (0u != value || length < min_length);
+
+    return destination_ptr;
+}
+
+static uint32_t get_element(const std::vector<uint8_t> &destination, uint32_t element_size, uint32_t index) {
+    switch (element_size) {
+        case sizeof(uint8_t):
+            return destination[index];
+        case sizeof(uint16_t):
+            return reinterpret_cast<const uint16_t *>(destination.data())[index];
+        default:
+            return reinterpret_cast<const uint32_t *>(destination.data())[index];
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_unpack_prle, reference) {
+    constexpr uint32_t max_runs             = 32u;
+    constexpr uint32_t max_short_run_length = 100u;
+    constexpr uint32_t max_long_run_length  = 20000u;
+    constexpr uint32_t max_header_length    = 4u;      // Reference accepts up to 4-byte varints
+    constexpr uint32_t max_chunk_octas      = 64u;
+
+    uint64_t   seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer random_value(0u, static_cast<double>(UINT32_MAX), seed);
+
+    for (uint32_t bit_width = 1u; bit_width <= 32u; bit_width++) {
+        const uint32_t value_size   = (bit_width + 7u) / 8u;
+        const uint32_t element_size = 1u << qpl::core_sw::dispatcher::get_unpack_prle_index(bit_width);
+        const auto     kernel       = qplc_unpack_prle(qpl::core_sw::dispatcher::get_unpack_prle_index(bit_width));
+        const uint32_t value_mask   = (32u == bit_width) ? UINT32_MAX : ((1u << bit_width) - 1u);
+
+        // Mixed RLE and bit-packed runs of short and long lengths, with 1 to 4-byte headers
+        std::vector<uint8_t> source(1u + max_runs * (max_header_length + max_chunk_octas * 8u * bit_width));
+        uint8_t  *current_ptr    = source.data();
+        uint32_t elements_number = 0u;
+
+        *current_ptr++ = static_cast<uint8_t>(bit_width);
+        for (uint32_t run = 0u; run < max_runs; run++) {
+            const uint32_t header_length = 1u + static_cast<uint32_t>(random_value) % max_header_length;
+
+            if (0u != (static_cast<uint32_t>(random_value) & 1u)) {
+                const uint32_t octas = 1u + static_cast<uint32_t>(random_value) % max_chunk_octas;
+
+                current_ptr = put_prle_header(current_ptr, octas, QPL_TEST_LITERAL_OCTA_GROUP, header_length);
+                for (uint32_t i = 0u; i < octas * bit_width; i++) {
+                    *current_ptr++ = static_cast<uint8_t>(static_cast<uint32_t>(random_value));
+                }
+                elements_number += octas * QPL_TEST_PARQUET_WIDTH;
+            } else {
+                const uint32_t max_length = (0u == run % 4u) ? max_long_run_length : max_short_run_length;
+                const uint32_t count      = 1u + static_cast<uint32_t>(random_value) % max_length;
+                const uint32_t value      = static_cast<uint32_t>(random_value) & value_mask;
+
+                current_ptr = put_prle_header(current_ptr, count, 0u, header_length);
+                for (uint32_t i = 0u; i < value_size; i++) {
+                    *current_ptr++ = static_cast<uint8_t>(value >> (i * 8u));
+                }
+                elements_number += count;
+            }
+        }
+
+        const auto source_size     = static_cast<uint32_t>(current_ptr - source.data());
+        uint32_t   available_bytes = source_size;
+
+        std::vector<uint32_t> reference(elements_number);
+        ASSERT_EQ(QPL_STS_OK, ref_convert_to_32u_prle(source.data(),
+                                                      current_ptr,
+                                                      reference.data(),
+                                                      &available_bytes));
+
+        // Whole stream at once, then the same stream split into the output chunks of a random number of octa-groups
+        for (uint32_t chunked = 0u; chunked <= 1u; chunked++) {
+            std::vector<uint8_t> destination(elements_number * element_size);
+            uint8_t  *src_ptr  = source.data() + 1u;
+            uint8_t  *dst_ptr  = destination.data();
+            int32_t  count     = 0;
+            uint32_t value     = 0u;
+            uint32_t processed = 0u;
+
+            while (processed < elements_number) {
+                uint32_t chunk = (0u == chunked)
+                                 ? elements_number
+                                 : QPL_TEST_PARQUET_WIDTH * (1u + static_cast<uint32_t>(random_value) % max_chunk_octas);
+                chunk = QPL_TEST_MIN(chunk, elements_number - processed);
+
+                kernel(&src_ptr,
+                       static_cast<uint32_t>(source.data() + source_size - src_ptr),
+                       bit_width,
+                       &dst_ptr,
+                       chunk,
+                       &count,
+                       &value);
+
+                // Octa-groups aren't split, so the kernel may stop short of the chunk end, but never without progress
+                const auto unpacked = static_cast<uint32_t>(dst_ptr - destination.data()) / element_size;
+                ASSERT_LT(processed, unpacked) << "bit width " << bit_width;
+                ASSERT_GE(processed + chunk, unpacked) << "bit width " << bit_width;
+                processed = unpacked;
+            }
+
+            for (uint32_t i = 0u; i < elements_number; i++) {
+                ASSERT_EQ(reference[i], get_element(destination, element_size, i))
+                    << "bit width " << bit_width << ", element " << i;
+            }
+        }
+    }
+}
 }
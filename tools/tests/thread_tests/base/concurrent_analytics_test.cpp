@@ -0,0 +1,240 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tt_common.hpp"
+#include "qpl/qpl.h"
+
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+struct analytics_case_t {
+    qpl_operation operation;
+    uint32_t      bit_width;
+    uint32_t      flags;
+};
+
+static auto run_analytics(qpl_job *job_ptr,
+                          const analytics_case_t &test_case,
+                          std::vector<uint8_t> &source,
+                          std::vector<uint8_t> &destination,
+                          bool is_async) -> qpl_status {
+    const uint32_t elements_count = static_cast<uint32_t>(source.size() * 8u / test_case.bit_width);
+    const uint32_t max_value      = (32u == test_case.bit_width) ? UINT32_MAX : (1u << test_case.bit_width) - 1u;
+
+    qpl_status status = QPL_STS_OK;
+
+    // The work queue can be filled by the other threads, so the busy job is resubmitted as the application does
+    do {
+        job_ptr->op                 = test_case.operation;
+        job_ptr->flags              = test_case.flags;
+        job_ptr->next_in_ptr        = source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+        job_ptr->src1_bit_width     = test_case.bit_width;
+        job_ptr->num_input_elements = elements_count;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->param_low          = (qpl_op_extract == test_case.operation) ? 3u : max_value / 3u;
+        job_ptr->param_high         = (qpl_op_extract == test_case.operation) ? elements_count - 5u : max_value / 2u;
+
+        if (is_async) {
+            status = qpl_submit_job(job_ptr);
+
+            if (QPL_STS_OK == status) {
+                status = qpl_wait_job(job_ptr);
+            }
+        } else {
+            status = qpl_execute_job(job_ptr);
+        }
+    } while (QPL_STS_QUEUES_ARE_BUSY_ERR == status);
+
+    destination.resize(job_ptr->total_out);
+
+    return status;
+}
+
+static void fill_source(std::vector<uint8_t> &source) {
+    for (uint32_t i = 0u; i < source.size(); i++) {
+        source[i] = static_cast<uint8_t>(i * 37u + (i >> 3u) * 11u);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(concurrent_analytics, matches_software_path) {
+    constexpr uint32_t threads_count = 8u;
+    constexpr uint32_t repeats_count = 2u;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    // The large source is split into several descriptors if checksums and aggregates are omitted
+    std::vector<uint8_t> small_source(4096u + 17u);
+    std::vector<uint8_t> large_source(256u * 1024u + 3u);
+
+    fill_source(small_source);
+    fill_source(large_source);
+
+    const uint32_t omit_flags = QPL_FLAG_OMIT_CHECKSUMS | QPL_FLAG_OMIT_AGGREGATES;
+
+    std::vector<analytics_case_t> cases;
+
+    for (uint32_t bit_width : {1u, 3u, 8u, 13u, 32u}) {
+        for (auto operation : {qpl_op_scan_eq, qpl_op_scan_ne, qpl_op_scan_lt, qpl_op_scan_range, qpl_op_scan_not_range}) {
+            cases.push_back({operation, bit_width, QPL_FLAG_FIRST | QPL_FLAG_LAST});
+            cases.push_back({operation, bit_width, QPL_FLAG_FIRST | QPL_FLAG_LAST | omit_flags});
+        }
+
+        cases.push_back({qpl_op_extract, bit_width, QPL_FLAG_FIRST | QPL_FLAG_LAST});
+    }
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &job_size));
+
+    std::vector<uint8_t> reference_job_buffer(job_size);
+    auto *reference_job_ptr = reinterpret_cast<qpl_job *>(reference_job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, reference_job_ptr));
+
+    std::vector<std::vector<uint8_t>> references;
+
+    for (auto &test_case : cases) {
+        for (auto *source_ptr : {&small_source, &large_source}) {
+            references.emplace_back(source_ptr->size() * 8u + 64u);
+            ASSERT_EQ(QPL_STS_OK, run_analytics(reference_job_ptr, test_case, *source_ptr, references.back(), false));
+        }
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(reference_job_ptr));
+
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    // All the threads share the work queues, synchronous and asynchronous jobs are interleaved
+    std::atomic<uint32_t>    failures_count {0u};
+    std::vector<std::thread> threads;
+
+    for (uint32_t thread_index = 0u; thread_index < threads_count; thread_index++) {
+        threads.emplace_back([&, thread_index]() {
+            std::unique_ptr<uint8_t[]> job_buffer(new uint8_t[job_size]);
+            auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+            if (QPL_STS_OK != qpl_init_job(path, job_ptr)) {
+                failures_count++;
+                return;
+            }
+
+            for (uint32_t repeat = 0u; repeat < repeats_count; repeat++) {
+                uint32_t reference_index = 0u;
+
+                for (auto &test_case : cases) {
+                    for (auto *source_ptr : {&small_source, &large_source}) {
+                        std::vector<uint8_t> destination(source_ptr->size() * 8u + 64u);
+
+                        const bool is_async = (thread_index + repeat + reference_index) % 2u;
+                        const auto status   = run_analytics(job_ptr, test_case, *source_ptr, destination, is_async);
+
+                        if (QPL_STS_OK != status || references[reference_index] != destination) {
+                            failures_count++;
+                        }
+
+                        reference_index++;
+                    }
+                }
+            }
+
+            qpl_fini_job(job_ptr);
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, failures_count.load());
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(concurrent_analytics, split_job_matches_software_path) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    // The source size is not a multiple of the descriptors count, so the last descriptor takes the rest
+    std::vector<uint8_t> source(1024u * 1024u + 77u);
+    fill_source(source);
+
+    const uint32_t flags = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_OMIT_CHECKSUMS | QPL_FLAG_OMIT_AGGREGATES;
+
+    uint32_t reference_job_size = 0u;
+    uint32_t job_size           = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &reference_job_size));
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    std::vector<uint8_t> reference_job_buffer(reference_job_size);
+    std::vector<uint8_t> job_buffer(job_size);
+    auto *reference_job_ptr = reinterpret_cast<qpl_job *>(reference_job_buffer.data());
+    auto *job_ptr           = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, reference_job_ptr));
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    // The nominal output of the scan is split by the elements, the other widths by the bytes of the input
+    for (uint32_t bit_width : {1u, 3u, 8u, 13u, 17u, 32u}) {
+        for (auto operation : {qpl_op_scan_eq, qpl_op_scan_range, qpl_op_scan_not_range}) {
+            const analytics_case_t test_case {operation, bit_width, flags};
+
+            std::vector<uint8_t> reference(source.size() * 8u + 64u);
+            std::vector<uint8_t> destination(source.size() * 8u + 64u);
+
+            ASSERT_EQ(QPL_STS_OK, run_analytics(reference_job_ptr, test_case, source, reference, false));
+            ASSERT_EQ(QPL_STS_OK, run_analytics(job_ptr, test_case, source, destination, false));
+
+            EXPECT_EQ(reference, destination) << "bit width: " << bit_width << ", operation: " << operation;
+        }
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(reference_job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(concurrent_analytics, auto_path_wait_reports_status) {
+    std::vector<uint8_t> source(64u * 1024u + 5u);
+    fill_source(source);
+
+    uint32_t reference_job_size = 0u;
+    uint32_t job_size           = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &reference_job_size));
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_auto, &job_size));
+
+    std::vector<uint8_t> reference_job_buffer(reference_job_size);
+    std::vector<uint8_t> job_buffer(job_size);
+    auto *reference_job_ptr = reinterpret_cast<qpl_job *>(reference_job_buffer.data());
+    auto *job_ptr           = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, reference_job_ptr));
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_auto, job_ptr));
+
+    // Without an accelerator, or with busy queues, the job is done by the software path on submission,
+    // and qpl_wait_job still has to report its status
+    for (uint32_t bit_width : {1u, 8u, 13u}) {
+        for (auto operation : {qpl_op_scan_lt, qpl_op_extract}) {
+            const analytics_case_t test_case {operation, bit_width, QPL_FLAG_FIRST | QPL_FLAG_LAST};
+
+            std::vector<uint8_t> reference(source.size() * 8u + 64u);
+            std::vector<uint8_t> destination(source.size() * 8u + 64u);
+
+            ASSERT_EQ(QPL_STS_OK, run_analytics(reference_job_ptr, test_case, source, reference, false));
+            ASSERT_EQ(QPL_STS_OK, run_analytics(job_ptr, test_case, source, destination, true));
+            EXPECT_EQ(QPL_STS_OK, qpl_check_job(job_ptr));
+
+            EXPECT_EQ(reference, destination) << "bit width: " << bit_width << ", operation: " << operation;
+        }
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(reference_job_ptr));
+}
+} // namespace qpl::test
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tt_common.hpp"
+#include "qpl/qpl.h"
+
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+static auto gather_chunks(std::vector<uint8_t> &source,
+                          qpl_compression_levels level,
+                          qpl_path_t path,
+                          uint32_t chunks_step,
+                          qpl_histogram &histogram) -> uint32_t {
+    uint32_t chunks_count = 0u;
+
+    for (size_t offset = 0u; offset < source.size(); offset += chunks_step * QPL_STATISTICS_CHUNK_SIZE) {
+        const auto chunk_size = static_cast<uint32_t>(std::min<size_t>(QPL_STATISTICS_CHUNK_SIZE, source.size() - offset));
+
+        EXPECT_EQ(QPL_STS_OK, qpl_gather_deflate_statistics(source.data() + offset, chunk_size, &histogram, level, path));
+        chunks_count++;
+    }
+
+    return chunks_count;
+}
+
+/**
+ * @brief Serial gathering of every chunk fills the empty places of the histogram after each chunk,
+ *        while the parallel one fills them once, so the counts can differ by the number of chunks at most
+ */
+static void expect_histograms_near(const qpl_histogram &expected, const qpl_histogram &actual, uint32_t chunks_count) {
+    for (uint32_t i = 0u; i < QPL_LITERALS_MATCHES_TABLE_SIZE; i++) {
+        EXPECT_LE(actual.literal_lengths[i], expected.literal_lengths[i]) << "Literal/length symbol: " << i;
+        EXPECT_LE(expected.literal_lengths[i], actual.literal_lengths[i] + chunks_count) << "Literal/length symbol: " << i;
+        EXPECT_LT(0u, actual.literal_lengths[i]) << "Literal/length symbol: " << i;
+    }
+
+    for (uint32_t i = 0u; i < QPL_DEFAULT_OFFSETS_NUMBER; i++) {
+        EXPECT_LE(actual.distances[i], expected.distances[i]) << "Distance symbol: " << i;
+        EXPECT_LE(expected.distances[i], actual.distances[i] + chunks_count) << "Distance symbol: " << i;
+        EXPECT_LT(0u, actual.distances[i]) << "Distance symbol: " << i;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(gather_deflate_statistics_ext, parallel_and_sampled) {
+    constexpr uint32_t source_size = 16u * QPL_STATISTICS_CHUNK_SIZE + 1234u;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    std::vector<uint8_t> source(source_size);
+
+    for (uint32_t i = 0u; i < source_size; i++) {
+        source[i] = static_cast<uint8_t>(((i * 7u) / 13u) ^ (i >> 12u));
+    }
+
+    std::vector<qpl_compression_levels> levels = {qpl_default_level};
+
+    if (qpl_path_software == path) {
+        levels.push_back(qpl_high_level);
+    }
+
+    for (auto level : levels) {
+        qpl_statistics_options options;
+        options.sample_percent = 100u;
+
+        // The result doesn't depend on the number of threads
+        qpl_histogram two_threads_histogram {};
+        options.threads_count = 2u;
+        ASSERT_EQ(QPL_STS_OK, qpl_gather_deflate_statistics_ext(source.data(), source_size, &two_threads_histogram,
+                                                                level, path, &options));
+
+        qpl_histogram four_threads_histogram {};
+        options.threads_count = 4u;
+        ASSERT_EQ(QPL_STS_OK, qpl_gather_deflate_statistics_ext(source.data(), source_size, &four_threads_histogram,
+                                                                level, path, &options));
+
+        EXPECT_TRUE(std::equal(std::begin(two_threads_histogram.literal_lengths),
+                               std::end(two_threads_histogram.literal_lengths),
+                               std::begin(four_threads_histogram.literal_lengths)));
+        EXPECT_TRUE(std::equal(std::begin(two_threads_histogram.distances),
+                               std::end(two_threads_histogram.distances),
+                               std::begin(four_threads_histogram.distances)));
+
+        qpl_histogram chunks_histogram {};
+        uint32_t      chunks_count = gather_chunks(source, level, path, 1u, chunks_histogram);
+
+        expect_histograms_near(chunks_histogram, four_threads_histogram, chunks_count);
+
+        // Every fourth chunk is histogrammed
+        qpl_histogram sampled_histogram {};
+        options.sample_percent = 25u;
+        ASSERT_EQ(QPL_STS_OK, qpl_gather_deflate_statistics_ext(source.data(), source_size, &sampled_histogram,
+                                                                level, path, &options));
+
+        qpl_histogram sampled_chunks_histogram {};
+        chunks_count = gather_chunks(source, level, path, 4u, sampled_chunks_histogram);
+
+        expect_histograms_near(sampled_chunks_histogram, sampled_histogram, chunks_count);
+    }
+}
+} // namespace qpl::test
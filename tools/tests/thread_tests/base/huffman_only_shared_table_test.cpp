@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tt_common.hpp"
+#include "qpl/qpl.h"
+
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(huffman_only_shared_table, concurrent_decompression) {
+    constexpr uint32_t threads_count = 8u;
+    constexpr uint32_t pages_count   = 64u;
+    constexpr uint32_t page_size     = 4096u;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    std::vector<uint8_t> job_buffer(job_size);
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    std::vector<uint8_t> source(page_size * pages_count);
+
+    for (uint32_t i = 0u; i < source.size(); i++) {
+        source[i] = static_cast<uint8_t>('a' + ((i * i / 7u + i / 3u) % 23u));
+    }
+
+    qpl_histogram histogram {};
+    ASSERT_EQ(QPL_STS_OK, qpl_gather_deflate_statistics(source.data(),
+                                                        static_cast<uint32_t>(source.size()),
+                                                        &histogram,
+                                                        qpl_default_level,
+                                                        path));
+
+    for (bool is_big_endian : {false, true}) {
+        const uint32_t endianness_flag = is_big_endian ? QPL_FLAG_HUFFMAN_BE : 0u;
+
+        qpl_huffman_table_t c_huffman_table = nullptr;
+        qpl_huffman_table_t d_huffman_table = nullptr;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_huffman_only_table_create(compression_table_type,
+                                                            path,
+                                                            DEFAULT_ALLOCATOR_C,
+                                                            &c_huffman_table));
+        ASSERT_EQ(QPL_STS_OK, qpl_huffman_table_init_with_histogram(c_huffman_table, &histogram));
+        ASSERT_EQ(QPL_STS_OK, qpl_huffman_only_table_create(decompression_table_type,
+                                                            path,
+                                                            DEFAULT_ALLOCATOR_C,
+                                                            &d_huffman_table));
+        ASSERT_EQ(QPL_STS_OK, qpl_huffman_table_init_with_other(d_huffman_table, c_huffman_table));
+
+        std::vector<std::vector<uint8_t>> pages(pages_count);
+        std::vector<uint8_t>              ignore_end_bits(pages_count);
+
+        for (uint32_t page = 0u; page < pages_count; page++) {
+            pages[page].resize(page_size * 2u);
+
+            job_ptr->op            = qpl_op_compress;
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_NO_HDRS |
+                                     QPL_FLAG_GEN_LITERALS | QPL_FLAG_OMIT_VERIFY | endianness_flag;
+            job_ptr->huffman_table = c_huffman_table;
+            job_ptr->next_in_ptr   = source.data() + page * page_size;
+            job_ptr->available_in  = page_size;
+            job_ptr->next_out_ptr  = pages[page].data();
+            job_ptr->available_out = static_cast<uint32_t>(pages[page].size());
+
+            ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+            pages[page].resize(job_ptr->total_out);
+            ignore_end_bits[page] = is_big_endian
+                                    ? static_cast<uint8_t>((16u - job_ptr->last_bit_offset) & 15u)
+                                    : static_cast<uint8_t>((8u - job_ptr->last_bit_offset) & 7u);
+        }
+
+        // All the threads use the same decompression table, its decoding tables are built by the first job only
+        std::atomic<uint32_t>    failures_count {0u};
+        std::vector<std::thread> threads;
+
+        for (uint32_t thread_index = 0u; thread_index < threads_count; thread_index++) {
+            threads.emplace_back([&, thread_index]() {
+                std::vector<uint8_t> thread_job_buffer(job_size);
+                std::vector<uint8_t> decompressed(page_size);
+
+                auto *thread_job_ptr = reinterpret_cast<qpl_job *>(thread_job_buffer.data());
+
+                if (QPL_STS_OK != qpl_init_job(path, thread_job_ptr)) {
+                    failures_count++;
+                    return;
+                }
+
+                for (uint32_t page = thread_index; page < pages_count; page += threads_count) {
+                    thread_job_ptr->op              = qpl_op_decompress;
+                    thread_job_ptr->flags           = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_NO_HDRS | endianness_flag;
+                    thread_job_ptr->huffman_table   = d_huffman_table;
+                    thread_job_ptr->next_in_ptr     = pages[page].data();
+                    thread_job_ptr->available_in    = static_cast<uint32_t>(pages[page].size());
+                    thread_job_ptr->ignore_end_bits = ignore_end_bits[page];
+                    thread_job_ptr->next_out_ptr    = decompressed.data();
+                    thread_job_ptr->available_out   = page_size;
+
+                    auto status = qpl_execute_job(thread_job_ptr);
+
+                    // IAA 1.0 limitation for BE16 streams, see deflate_huffman_only tests
+                    if (QPL_STS_HUFFMAN_BE_IGNORE_MORE_THAN_7_BITS_ERR == status) {
+                        continue;
+                    }
+
+                    if (QPL_STS_OK != status || page_size != thread_job_ptr->total_out ||
+                        !std::equal(decompressed.begin(), decompressed.end(), source.begin() + page * page_size)) {
+                        failures_count++;
+                    }
+                }
+
+                qpl_fini_job(thread_job_ptr);
+            });
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(0u, failures_count.load());
+
+        EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(c_huffman_table));
+        EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(d_huffman_table));
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+} // namespace qpl::test
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tt_common.hpp"
+#include "qpl/qpl.h"
+
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(indexed_decompression, all_mini_blocks) {
+    constexpr uint32_t source_size      = 512u * 1024u + 777u;
+    constexpr auto     mini_block_size  = qpl_mblk_size_4k;
+    constexpr uint32_t mini_block_bytes = 4096u;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    std::vector<uint8_t> job_buffer(job_size);
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    std::vector<uint8_t> source(source_size);
+
+    for (uint32_t i = 0u; i < source_size; i++) {
+        source[i] = static_cast<uint8_t>(((i * 7u) / 13u) ^ (i >> 12u));
+    }
+
+    const uint32_t mini_block_count = (source_size + mini_block_bytes - 1u) / mini_block_bytes;
+
+    // Single block and blocks of 8 mini-blocks
+    for (uint32_t mini_blocks_per_block : {mini_block_count, 8u}) {
+        const uint32_t block_size  = mini_blocks_per_block * mini_block_bytes;
+        const uint32_t block_count = (mini_block_count + mini_blocks_per_block - 1u) / mini_blocks_per_block;
+
+        std::vector<uint8_t>   compressed(source_size * 2u);
+        std::vector<qpl_index> indices(block_count * 2u + mini_block_count + 1u);
+
+        job_ptr->op              = qpl_op_compress;
+        job_ptr->level           = qpl_default_level;
+        job_ptr->mini_block_size = mini_block_size;
+        job_ptr->idx_array       = reinterpret_cast<uint64_t *>(indices.data());
+        job_ptr->idx_max_size    = static_cast<uint32_t>(indices.size());
+        job_ptr->next_in_ptr     = source.data();
+        job_ptr->next_out_ptr    = compressed.data();
+        job_ptr->available_out   = static_cast<uint32_t>(compressed.size());
+        job_ptr->flags           = QPL_FLAG_FIRST | QPL_FLAG_DYNAMIC_HUFFMAN;
+
+        for (uint32_t offset = 0u; offset < source_size; offset += block_size) {
+            job_ptr->available_in = std::min(block_size, source_size - offset);
+
+            if (offset + block_size >= source_size) {
+                job_ptr->flags |= QPL_FLAG_LAST;
+            }
+
+            ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+            job_ptr->flags = QPL_FLAG_START_NEW_BLOCK | QPL_FLAG_DYNAMIC_HUFFMAN;
+        }
+
+        const uint32_t compressed_size = job_ptr->total_out;
+
+        qpl_index_table table;
+        table.block_count           = block_count;
+        table.mini_block_count      = mini_block_count;
+        table.mini_blocks_per_block = mini_blocks_per_block;
+        table.indices_ptr           = indices.data();
+
+        std::vector<uint8_t> decompressed(source_size);
+        uint32_t             output_size = 0u;
+
+        EXPECT_EQ(QPL_STS_OK, qpl_decompress_indexed(path,
+                                                     compressed.data(),
+                                                     compressed_size,
+                                                     &table,
+                                                     mini_block_size,
+                                                     decompressed.data(),
+                                                     source_size,
+                                                     &output_size));
+        EXPECT_EQ(source_size, output_size);
+        EXPECT_TRUE(CompareVectors(source, decompressed));
+
+        // A damaged CRC in the table must be detected
+        uint32_t damaged_index = 0u;
+        ASSERT_EQ(QPL_STS_OK, qpl_find_mini_block_index(&table, mini_block_count / 2u, &damaged_index));
+        indices[damaged_index].crc ^= 1u;
+
+        EXPECT_EQ(QPL_STS_INDEX_CRC_MISMATCH_ERR, qpl_decompress_indexed(path,
+                                                                         compressed.data(),
+                                                                         compressed_size,
+                                                                         &table,
+                                                                         mini_block_size,
+                                                                         decompressed.data(),
+                                                                         source_size,
+                                                                         &output_size));
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+} // namespace qpl::test
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tt_common.hpp"
+#include "qpl/qpl.h"
+
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(job_pool, concurrent_compression_decompression) {
+    constexpr uint32_t pool_capacity       = 4u;
+    constexpr uint32_t threads_count       = 8u;
+    constexpr uint32_t iterations_count    = 64u;
+    constexpr uint32_t source_size         = 4096u;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    qpl_job_pool_t pool = nullptr;
+    ASSERT_EQ(QPL_STS_OK, qpl_job_pool_create(path, pool_capacity, -1, &pool));
+
+    std::atomic<uint32_t> failures_count {0u};
+    std::vector<std::thread> threads;
+
+    for (uint32_t thread_index = 0u; thread_index < threads_count; thread_index++) {
+        threads.emplace_back([&, thread_index]() {
+            std::vector<uint8_t> source(source_size);
+            std::vector<uint8_t> compressed(source_size * 2u);
+            std::vector<uint8_t> decompressed(source_size);
+
+            for (uint32_t i = 0u; i < source_size; i++) {
+                source[i] = static_cast<uint8_t>((i / (thread_index + 1u)) & 0xFFu);
+            }
+
+            for (uint32_t iteration = 0u; iteration < iterations_count; iteration++) {
+                qpl_job *job_ptr = nullptr;
+
+                while (QPL_STS_JOB_POOL_IS_EMPTY_ERR == qpl_job_pool_acquire(pool, &job_ptr)) {
+                    std::this_thread::yield();
+                }
+
+                // Released jobs must not keep the fields of the previous user
+                if (0u != job_ptr->total_in || 0u != job_ptr->total_out || 0u != job_ptr->flags) {
+                    failures_count++;
+                }
+
+                job_ptr->op            = qpl_op_compress;
+                job_ptr->level         = qpl_default_level;
+                job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+                job_ptr->next_in_ptr   = source.data();
+                job_ptr->available_in  = source_size;
+                job_ptr->next_out_ptr  = compressed.data();
+                job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+                auto status = qpl_execute_job(job_ptr);
+                auto compressed_size = job_ptr->total_out;
+
+                if (QPL_STS_OK == status) {
+                    job_ptr->op            = qpl_op_decompress;
+                    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+                    job_ptr->next_in_ptr   = compressed.data();
+                    job_ptr->available_in  = compressed_size;
+                    job_ptr->next_out_ptr  = decompressed.data();
+                    job_ptr->available_out = source_size;
+
+                    status = qpl_execute_job(job_ptr);
+                }
+
+                if (QPL_STS_OK != status || source_size != job_ptr->total_out || !CompareVectors(source, decompressed)) {
+                    failures_count++;
+                }
+
+                if (QPL_STS_OK != qpl_job_pool_release(pool, job_ptr)) {
+                    failures_count++;
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, failures_count.load());
+
+    // All jobs must be back in the pool
+    std::vector<qpl_job *> jobs(pool_capacity, nullptr);
+
+    for (auto &job_ptr : jobs) {
+        EXPECT_EQ(QPL_STS_OK, qpl_job_pool_acquire(pool, &job_ptr));
+    }
+
+    qpl_job *extra_job_ptr = nullptr;
+    EXPECT_EQ(QPL_STS_JOB_POOL_IS_EMPTY_ERR, qpl_job_pool_acquire(pool, &extra_job_ptr));
+
+    for (auto *job_ptr : jobs) {
+        EXPECT_EQ(QPL_STS_OK, qpl_job_pool_release(pool, job_ptr));
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_job_pool_destroy(pool));
+}
+} // namespace qpl::test
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tt_common.hpp"
+#include "qpl/qpl.h"
+
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+static auto compress_and_decompress(qpl_job *job_ptr,
+                                    std::vector<uint8_t> &source,
+                                    uint32_t flags,
+                                    uint32_t &crc) -> bool {
+    std::vector<uint8_t> compressed(source.size() * 2u + 1024u);
+    std::vector<uint8_t> decompressed(source.size());
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | flags;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr  = compressed.data();
+    job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+    if (QPL_STS_OK != qpl_execute_job(job_ptr)) {
+        return false;
+    }
+
+    crc = job_ptr->crc;
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | (flags & (QPL_FLAG_GZIP_MODE | QPL_FLAG_ZLIB_MODE));
+    job_ptr->next_in_ptr   = compressed.data();
+    job_ptr->available_in  = job_ptr->total_out;
+    job_ptr->next_out_ptr  = decompressed.data();
+    job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+    return QPL_STS_OK == qpl_execute_job(job_ptr) &&
+           source.size() == job_ptr->total_out &&
+           CompareVectors(source, decompressed);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_deflate, round_trip) {
+    // Several chunks with the repeated content to have the matches across the chunk boundaries
+    constexpr uint32_t source_size = 1024u * 1024u + 4321u;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    if (qpl_path_software != path) {
+        GTEST_SKIP() << "Parallel compression is supported on the Software Path only";
+    }
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    std::vector<uint8_t> job_buffer(job_size);
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    std::vector<uint8_t> source(source_size);
+
+    for (uint32_t i = 0u; i < source_size; i++) {
+        source[i] = static_cast<uint8_t>(((i * 7u) / 13u) ^ (i >> 12u));
+    }
+
+    const uint32_t modes[] = {0u, QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY};
+    const uint32_t headers[] = {0u, QPL_FLAG_GZIP_MODE, QPL_FLAG_ZLIB_MODE};
+
+    for (auto mode : modes) {
+        for (auto header : headers) {
+            uint32_t serial_crc   = 0u;
+            uint32_t parallel_crc = 0u;
+
+            EXPECT_TRUE(compress_and_decompress(job_ptr, source, mode | header, serial_crc));
+            EXPECT_TRUE(compress_and_decompress(job_ptr, source, mode | header | QPL_FLAG_PARALLEL, parallel_crc));
+
+            // Checksum of the chunks is combined into the checksum of the whole source
+            EXPECT_EQ(serial_crc, parallel_crc);
+        }
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+} // namespace qpl::test
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tt_common.hpp"
+#include "qpl/qpl.h"
+
+#include "util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t bgzf_block_source_size = 60000u;
+
+// Empty member that ends BGZF files
+constexpr uint8_t bgzf_eof_member[] = {0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43,
+                                       0x02, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+static void append_le(std::vector<uint8_t> &stream, uint32_t value, uint32_t bytes) {
+    for (uint32_t i = 0u; i < bytes; i++) {
+        stream.push_back(static_cast<uint8_t>(value >> (8u * i)));
+    }
+}
+
+// Compresses every block into a separate gzip member with the BSIZE extra subfield
+static auto compress_bgzf(qpl_job *job_ptr, std::vector<uint8_t> &source) -> std::vector<uint8_t> {
+    std::vector<uint8_t> stream;
+    std::vector<uint8_t> deflate_block(bgzf_block_source_size * 2u);
+
+    for (size_t offset = 0u; offset < source.size(); offset += bgzf_block_source_size) {
+        const auto block_size = static_cast<uint32_t>(std::min<size_t>(bgzf_block_source_size, source.size() - offset));
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job_ptr->next_in_ptr   = source.data() + offset;
+        job_ptr->available_in  = block_size;
+        job_ptr->next_out_ptr  = deflate_block.data();
+        job_ptr->available_out = static_cast<uint32_t>(deflate_block.size());
+
+        EXPECT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+        // Header with FEXTRA, the subfield "BC" keeps the size of the member minus 1
+        const uint32_t member_size = 18u + job_ptr->total_out + 8u;
+        const uint8_t  header[]    = {0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43,
+                                      0x02, 0x00};
+
+        stream.insert(stream.end(), std::begin(header), std::end(header));
+        append_le(stream, member_size - 1u, 2u);
+        stream.insert(stream.end(), deflate_block.begin(), deflate_block.begin() + job_ptr->total_out);
+        append_le(stream, job_ptr->crc, 4u);
+        append_le(stream, block_size, 4u);
+    }
+
+    stream.insert(stream.end(), std::begin(bgzf_eof_member), std::end(bgzf_eof_member));
+
+    return stream;
+}
+
+static auto decompress(qpl_job *job_ptr,
+                       std::vector<uint8_t> &stream,
+                       std::vector<uint8_t> &destination,
+                       uint32_t flags) -> qpl_status {
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE | flags;
+    job_ptr->next_in_ptr   = stream.data();
+    job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    return qpl_execute_job(job_ptr);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_inflate, bgzf_members) {
+    // Odd sizes of the blocks move the XOR checksum words of the next members
+    constexpr uint32_t source_size = 40u * bgzf_block_source_size + 12345u;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    if (qpl_path_software != path) {
+        GTEST_SKIP() << "Parallel decompression is supported on the Software Path only";
+    }
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    std::vector<uint8_t> job_buffer(job_size);
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    std::vector<uint8_t> source(source_size);
+
+    for (uint32_t i = 0u; i < source_size; i++) {
+        source[i] = static_cast<uint8_t>(((i * 7u) / 13u) ^ (i >> 12u));
+    }
+
+    auto stream = compress_bgzf(job_ptr, source);
+
+    std::vector<uint8_t> serial_output(source_size);
+    std::vector<uint8_t> parallel_output(source_size);
+
+    ASSERT_EQ(QPL_STS_OK, decompress(job_ptr, stream, serial_output, 0u));
+    EXPECT_EQ(stream.size(), job_ptr->total_in);
+    EXPECT_EQ(source_size, job_ptr->total_out);
+
+    const uint32_t serial_crc = job_ptr->crc;
+    const uint32_t serial_xor = job_ptr->xor_checksum;
+
+    ASSERT_EQ(QPL_STS_OK, decompress(job_ptr, stream, parallel_output, QPL_FLAG_PARALLEL));
+    EXPECT_EQ(stream.size(), job_ptr->total_in);
+    EXPECT_EQ(source_size, job_ptr->total_out);
+
+    // Checksums of the members are combined into the checksums of the whole output
+    EXPECT_EQ(serial_crc, job_ptr->crc);
+    EXPECT_EQ(serial_xor, job_ptr->xor_checksum);
+
+    EXPECT_TRUE(CompareVectors(source, serial_output));
+    EXPECT_TRUE(CompareVectors(source, parallel_output));
+
+    // The output of all the members must fit, the stream can't be continued in the next job
+    std::vector<uint8_t> short_output(source_size - 1u);
+
+    EXPECT_EQ(QPL_STS_DST_IS_SHORT_ERR, decompress(job_ptr, stream, short_output, QPL_FLAG_PARALLEL));
+
+    // A corrupted member in the middle of the stream is detected by its thread
+    stream[stream.size() / 2u - sizeof(bgzf_eof_member)] ^= 1u;
+
+    EXPECT_NE(QPL_STS_OK, decompress(job_ptr, stream, parallel_output, QPL_FLAG_PARALLEL));
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+} // namespace qpl::test